@@ -0,0 +1,210 @@
+/**
+ * @file   CommandDispatcher.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the CommandDispatcher class.
+ */
+
+#include <chrono>
+#include "CommandDispatcher.h"
+#include "Logger.h"
+using namespace std;
+
+/**
+ * @brief Returns the steady clock time in nanoseconds.
+ */
+static long long steadyNowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * @param api Robot API the commands are sent to.
+ */
+CommandDispatcher::CommandDispatcher(RobotInterface* api)
+    : robotAPI(api), running(false), submitted(0), handled(0), issued(0), coalesced(0), rejected(0),
+      hasLast(false), lastCommand(COMMAND_STOP) {
+}
+
+/**
+ * @brief Destructor. Issues the queued commands and stops the thread.
+ */
+CommandDispatcher::~CommandDispatcher() {
+    stop();
+}
+
+/**
+ * @brief Starts the dispatcher thread.
+ * @return true if the thread is running.
+ */
+bool CommandDispatcher::start() {
+    if (this->running.load()) {
+        return true;
+    }
+    if (this->robotAPI == nullptr) {
+        LOG_ERROR("CommandDispatcher has no robot API.");
+        return false;
+    }
+    // The robot state is unknown after a restart, so the first command is always sent.
+    this->hasLast = false;
+    this->running.store(true);
+    this->worker = thread(&CommandDispatcher::dispatchLoop, this);
+    return true;
+}
+
+/**
+ * @brief Issues the queued commands, then stops the dispatcher thread.
+ */
+void CommandDispatcher::stop() {
+    this->running.store(false);
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+bool CommandDispatcher::isRunning() const {
+    return this->running.load();
+}
+
+/**
+ * @brief Queues a command without blocking.
+ * @return false if the dispatcher is not running or the queue is full.
+ */
+bool CommandDispatcher::submit(RobotCommand command) {
+    if (!this->running.load(memory_order_relaxed)) {
+        return false;
+    }
+    QueuedCommand* slot = this->queue.beginWrite();
+    if (slot == nullptr) {
+        this->rejected++;
+        return false;
+    }
+    slot->command = command;
+    slot->submittedNs = steadyNowNs();
+    this->queue.commitWrite();
+    this->submitted.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * @brief Waits until every submitted command has been issued or coalesced.
+ */
+void CommandDispatcher::flush() {
+    unsigned long long target = this->submitted.load(memory_order_relaxed);
+    while (this->handled.load(memory_order_acquire) < target && this->worker.joinable()) {
+        this_thread::yield();
+    }
+}
+
+/**
+ * @brief Issues every queued command, skipping repeats of the last one sent.
+ * @return the number of commands taken from the queue.
+ */
+int CommandDispatcher::drain() {
+    int taken = 0;
+    QueuedCommand* entry;
+    while ((entry = this->queue.front()) != nullptr) {
+        RobotCommand command = entry->command;
+        long long submittedNs = entry->submittedNs;
+        this->queue.pop();
+        taken++;
+
+        if (this->hasLast && command == this->lastCommand) {
+            this->coalesced.fetch_add(1, memory_order_relaxed);
+        }
+        else {
+            this->latency.record(steadyNowNs() - submittedNs);
+            issue(this->robotAPI, command);
+            this->issued.fetch_add(1, memory_order_relaxed);
+            this->lastCommand = command;
+            this->hasLast = true;
+        }
+        this->handled.fetch_add(1, memory_order_release);
+    }
+    return taken;
+}
+
+/**
+ * @brief Body of the dispatcher thread.
+ *
+ * The thread spins briefly when the queue is empty, then yields, then sleeps for
+ * short intervals, so an idle dispatcher costs little CPU while a busy one reacts
+ * within microseconds. Commands still queued when stop() is called are issued before
+ * the thread exits.
+ */
+void CommandDispatcher::dispatchLoop() {
+    int idle = 0;
+    while (this->running.load(memory_order_acquire)) {
+        if (drain() > 0) {
+            idle = 0;
+        }
+        else if (++idle < 64) {
+            continue;
+        }
+        else if (idle < 256) {
+            this_thread::yield();
+        }
+        else {
+            this_thread::sleep_for(chrono::microseconds(100));
+        }
+    }
+    drain();
+}
+
+/**
+ * @brief Sends one command to the API right away.
+ */
+void CommandDispatcher::issue(RobotInterface* api, RobotCommand command) {
+    switch (command) {
+    case COMMAND_MOVE_FORWARD:
+        api->move(FORWARD);
+        break;
+    case COMMAND_MOVE_BACKWARD:
+        api->move(BACKWARD);
+        break;
+    case COMMAND_MOVE_LEFT:
+        api->move(LEFT);
+        break;
+    case COMMAND_MOVE_RIGHT:
+        api->move(RIGHT);
+        break;
+    case COMMAND_TURN_LEFT:
+        api->rotate(LEFT);
+        break;
+    case COMMAND_TURN_RIGHT:
+        api->rotate(RIGHT);
+        break;
+    case COMMAND_STOP:
+        api->stop();
+        break;
+    }
+}
+
+unsigned long long CommandDispatcher::getSubmittedCount() const {
+    return this->submitted.load(memory_order_relaxed);
+}
+
+unsigned long long CommandDispatcher::getIssuedCount() const {
+    return this->issued.load(memory_order_relaxed);
+}
+
+unsigned long long CommandDispatcher::getCoalescedCount() const {
+    return this->coalesced.load(memory_order_relaxed);
+}
+
+unsigned long long CommandDispatcher::getRejectedCount() const {
+    return this->rejected;
+}
+
+/**
+ * @brief Returns the submit-to-API latency histogram.
+ */
+const LatencyHistogram& CommandDispatcher::getLatency() const {
+    return this->latency;
+}
+
+/**
+ * @brief Clears the latency histogram.
+ */
+void CommandDispatcher::resetLatency() {
+    this->latency.reset();
+}
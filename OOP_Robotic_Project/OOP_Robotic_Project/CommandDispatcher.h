@@ -0,0 +1,163 @@
+#pragma once
+/**
+ * @file   CommandDispatcher.h
+ * @date   October, 2026
+ * @brief  Header file for the CommandDispatcher class.
+ *
+ * This file contains the definition of the CommandDispatcher class, which sends motion
+ * commands to the robot from a dedicated thread.
+ */
+
+#include <atomic>
+#include <thread>
+#include "LatencyHistogram.h"
+#include "RobotInterface.h"
+#include "SpscRing.h"
+
+//! RobotCommand enum
+/*!
+ * @brief Motion commands that can be queued.
+ */
+enum RobotCommand {
+    COMMAND_MOVE_FORWARD = 0,
+    COMMAND_MOVE_BACKWARD,
+    COMMAND_MOVE_LEFT,
+    COMMAND_MOVE_RIGHT,
+    COMMAND_TURN_LEFT,
+    COMMAND_TURN_RIGHT,
+    COMMAND_STOP
+};
+
+//! QueuedCommand struct
+/*!
+ * @brief A command with the time it was submitted.
+ */
+struct QueuedCommand {
+    RobotCommand command;    /*!< Command to issue. */
+    long long submittedNs;   /*!< Steady clock time of submit(), in nanoseconds. */
+};
+
+//! CommandDispatcher class
+/*!
+ * @brief Issues motion commands on a dispatcher thread through a lock-free queue.
+ *
+ * submit() only writes the command into a bounded SPSC ring, so the caller never waits
+ * for the robot API or for console output. The dispatcher thread issues the commands
+ * in order. Motion commands set a state that lasts until the next one, so a command
+ * equal to the last one issued is redundant and is dropped instead of sent again
+ * (coalesced). For every command sent, the time from submit() to the API call is
+ * recorded in a latency histogram.
+ *
+ * submit() and flush() must be called from one thread. While the dispatcher runs it is
+ * the only caller of the motion functions of the API; sensor functions may still be
+ * called from other threads, as with SensorPipeline.
+ */
+class CommandDispatcher {
+public:
+    static const int QUEUE_SIZE = 64; /*!< Commands that can wait in the queue. */
+
+private:
+    RobotInterface* robotAPI;                          /*!< Robot API the commands are sent to. */
+    SpscRing<QueuedCommand, QUEUE_SIZE> queue;          /*!< Commands waiting for the dispatcher. */
+    std::thread worker;                                 /*!< Dispatcher thread. */
+    std::atomic<bool> running;                          /*!< Cleared to stop the dispatcher thread. */
+    std::atomic<unsigned long long> submitted;          /*!< Commands accepted by submit(). */
+    std::atomic<unsigned long long> handled;            /*!< Commands issued or coalesced. */
+    std::atomic<unsigned long long> issued;             /*!< Commands sent to the API. */
+    std::atomic<unsigned long long> coalesced;          /*!< Commands dropped as redundant. */
+    unsigned long long rejected;                        /*!< Commands refused because the queue was full. */
+    LatencyHistogram latency;                           /*!< Submit-to-API latency, written by the dispatcher. */
+    bool hasLast;                                       /*!< lastCommand holds a command. */
+    RobotCommand lastCommand;                           /*!< Last command sent to the API. */
+
+    //! dispatchLoop function
+    /*!
+    * Body of the dispatcher thread.
+    */
+    void dispatchLoop();
+
+    //! drain function
+    /*!
+    * Issues every queued command.
+    * @return the number of commands taken from the queue.
+    */
+    int drain();
+
+    CommandDispatcher(const CommandDispatcher&) = delete;
+    CommandDispatcher& operator=(const CommandDispatcher&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param api Robot API the commands are sent to.
+    */
+    CommandDispatcher(RobotInterface* api);
+
+    //! Destructor
+    /*!
+    * Issues the queued commands and stops the dispatcher thread.
+    */
+    ~CommandDispatcher();
+
+    //! start function
+    /*!
+    * Starts the dispatcher thread.
+    * @return true if the thread is running.
+    */
+    bool start();
+
+    //! stop function
+    /*!
+    * Issues the queued commands, then stops the dispatcher thread.
+    */
+    void stop();
+
+    //! isRunning function
+    bool isRunning() const;
+
+    //! submit function
+    /*!
+    * Queues a command without blocking.
+    * @return false if the dispatcher is not running or the queue is full.
+    */
+    bool submit(RobotCommand command);
+
+    //! flush function
+    /*!
+    * Waits until every submitted command has been issued or coalesced.
+    */
+    void flush();
+
+    //! issue function
+    /*!
+    * Sends one command to the API right away.
+    */
+    static void issue(RobotInterface* api, RobotCommand command);
+
+    //! getSubmittedCount function
+    unsigned long long getSubmittedCount() const;
+
+    //! getIssuedCount function
+    /*!
+    * @return the number of commands sent to the API.
+    */
+    unsigned long long getIssuedCount() const;
+
+    //! getCoalescedCount function
+    unsigned long long getCoalescedCount() const;
+
+    //! getRejectedCount function
+    unsigned long long getRejectedCount() const;
+
+    //! getLatency function
+    /*!
+    * @return the submit-to-API latency histogram; read it after flush() or stop().
+    */
+    const LatencyHistogram& getLatency() const;
+
+    //! resetLatency function
+    /*!
+    * Clears the latency histogram; call it after flush() or stop().
+    */
+    void resetLatency();
+};
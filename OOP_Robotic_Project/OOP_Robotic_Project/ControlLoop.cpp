@@ -0,0 +1,284 @@
+/**
+ * @file   ControlLoop.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the ControlLoop class.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include "ControlLoop.h"
+#include "Logger.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+using namespace std;
+
+/**
+ * @brief Default constructor. The loop has no tasks and runs without pinning or priority.
+ */
+ControlLoop::ControlLoop()
+    : running(false), cpu(-1), realtimePriority(0), pinned(false), realtime(false) {
+}
+
+/**
+ * @brief Destructor. Stops the loop thread.
+ */
+ControlLoop::~ControlLoop() {
+    stop();
+}
+
+/**
+ * @brief Registers a periodic task.
+ * @return the task number, or -1 if the period is not positive or the loop is running.
+ */
+int ControlLoop::addTask(const char* name, int periodMicroseconds, function<void()> body) {
+    if (periodMicroseconds <= 0 || !body || this->running.load()) {
+        LOG_ERROR("ControlLoop task needs a positive period and cannot be added while running.");
+        return -1;
+    }
+    Task task;
+    task.name = name;
+    task.periodNs = periodMicroseconds * 1000LL;
+    task.body = move(body);
+    task.nextReleaseNs = 0;
+    task.stats.runs = 0;
+    task.stats.overruns = 0;
+    task.stats.skipped = 0;
+    this->tasks.push_back(move(task));
+    return static_cast<int>(this->tasks.size()) - 1;
+}
+
+void ControlLoop::setCpu(int cpu) {
+    this->cpu = cpu >= 0 ? cpu : -1;
+}
+
+void ControlLoop::setRealtimePriority(int priority) {
+    this->realtimePriority = priority > 0 ? priority : 0;
+}
+
+/**
+ * @brief Runs the loop on the calling thread for a duration.
+ *
+ * The calling thread keeps its CPU and priority; setCpu() and setRealtimePriority()
+ * only apply to the thread of start().
+ */
+void ControlLoop::runFor(long long durationMicroseconds) {
+    if (this->running.exchange(true)) {
+        return;
+    }
+    loop(nowNs() + durationMicroseconds * 1000LL);
+    this->running.store(false);
+}
+
+/**
+ * @brief Starts the loop on its own thread.
+ * @return true if the loop is running.
+ */
+bool ControlLoop::start() {
+    if (this->running.load()) {
+        return true;
+    }
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+    this->running.store(true);
+    this->worker = thread([this]() {
+        applyThreadOptions();
+        loop(-1);
+    });
+    return true;
+}
+
+/**
+ * @brief Ends the loop after the tasks that are running and waits for its thread.
+ *
+ * The loop notices the request when it wakes up for the next release, so stop() waits
+ * at most one period of the fastest task.
+ */
+void ControlLoop::stop() {
+    this->running.store(false);
+    if (this->worker.joinable() && this->worker.get_id() != this_thread::get_id()) {
+        this->worker.join();
+    }
+}
+
+bool ControlLoop::isRunning() const {
+    return this->running.load();
+}
+
+bool ControlLoop::isPinned() const {
+    return this->pinned;
+}
+
+bool ControlLoop::isRealtime() const {
+    return this->realtime;
+}
+
+/**
+ * @brief Pins the calling thread to the configured CPU and gives it the configured
+ * SCHED_FIFO priority. A refused request is logged and the loop runs without it.
+ */
+void ControlLoop::applyThreadOptions() {
+    this->pinned = false;
+    this->realtime = false;
+#ifdef _WIN32
+    if (this->cpu >= 0 && this->cpu < 64) {
+        this->pinned = SetThreadAffinityMask(GetCurrentThread(), 1ULL << this->cpu) != 0;
+    }
+    if (this->realtimePriority > 0) {
+        this->realtime = SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0;
+    }
+#elif defined(__linux__)
+    if (this->cpu >= 0 && this->cpu < CPU_SETSIZE) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(this->cpu, &set);
+        this->pinned = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+    if (this->realtimePriority > 0) {
+        sched_param param;
+        param.sched_priority = this->realtimePriority;
+        this->realtime = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+#endif
+    if (this->cpu >= 0 && !this->pinned) {
+        LOG_WARNING("ControlLoop could not pin its thread to CPU {}.", this->cpu);
+    }
+    if (this->realtimePriority > 0 && !this->realtime) {
+        LOG_WARNING("ControlLoop could not set SCHED_FIFO priority {}, running with normal priority.", this->realtimePriority);
+    }
+}
+
+/**
+ * @brief Runs the tasks until endNs, or until stop() when endNs is negative.
+ *
+ * Every task is first released at the start of the loop. Each cycle sleeps until the
+ * earliest release, then runs every due task in priority order and moves its release
+ * one period on. A task that ends after that release has overrun: the releases that
+ * have already passed are skipped, so the task does not run several times in a row to
+ * catch up and its releases stay on the origin + k * period grid.
+ */
+void ControlLoop::loop(long long endNs) {
+    if (this->tasks.empty()) {
+        return;
+    }
+    long long origin = nowNs();
+    for (Task& task : this->tasks) {
+        task.nextReleaseNs = origin;
+    }
+
+    while (this->running.load(memory_order_relaxed)) {
+        long long wake = this->tasks[0].nextReleaseNs;
+        for (const Task& task : this->tasks) {
+            wake = task.nextReleaseNs < wake ? task.nextReleaseNs : wake;
+        }
+        if (endNs >= 0 && wake >= endNs) {
+            break;
+        }
+        sleepUntil(wake);
+
+        for (Task& task : this->tasks) {
+            long long release = task.nextReleaseNs;
+            long long start = nowNs();
+            // A release at or after the end belongs to the next window, even if the
+            // loop woke late enough to see it.
+            if (release > start || (endNs >= 0 && release >= endNs)) {
+                continue;
+            }
+            task.body();
+            long long finish = nowNs();
+            ControlTaskStats& stats = task.stats;
+            stats.runs++;
+            stats.jitter.record(start - release);
+            stats.duration.record(finish - start);
+
+            task.nextReleaseNs = release + task.periodNs;
+            if (finish > task.nextReleaseNs) {
+                long long missed = (finish - task.nextReleaseNs) / task.periodNs + 1;
+                stats.overruns++;
+                // Releases at or after the end of the window were never due.
+                long long due = missed;
+                if (endNs >= 0) {
+                    long long left = endNs - task.nextReleaseNs;
+                    due = left > 0 ? (left - 1) / task.periodNs + 1 : 0;
+                    due = due < missed ? due : missed;
+                }
+                stats.skipped += due;
+                task.nextReleaseNs += missed * task.periodNs;
+            }
+        }
+    }
+}
+
+int ControlLoop::getTaskCount() const {
+    return static_cast<int>(this->tasks.size());
+}
+
+const ControlTaskStats& ControlLoop::getStats(int task) const {
+    return this->tasks[task].stats;
+}
+
+void ControlLoop::resetStats() {
+    for (Task& task : this->tasks) {
+        task.stats.runs = 0;
+        task.stats.overruns = 0;
+        task.stats.skipped = 0;
+        task.stats.jitter.reset();
+        task.stats.duration.reset();
+    }
+}
+
+/**
+ * @brief Prints runs, overruns, jitter and execution time of every task.
+ */
+void ControlLoop::printStats() const {
+    for (const Task& task : this->tasks) {
+        const ControlTaskStats& stats = task.stats;
+        cout << task.name << " (" << task.periodNs / 1000 << " us): " << stats.runs << " runs, " << stats.overruns
+             << " overruns, " << stats.skipped << " skipped, jitter p99 " << stats.jitter.getPercentile(99.0)
+             << " ns max " << stats.jitter.getMax() << " ns, execution p99 " << stats.duration.getPercentile(99.0)
+             << " ns max " << stats.duration.getMax() << " ns" << endl;
+    }
+}
+
+/**
+ * @brief Returns the steady clock time in nanoseconds.
+ *
+ * On Linux this is CLOCK_MONOTONIC, the clock sleepUntil() waits on.
+ */
+long long ControlLoop::nowNs() {
+#if defined(__linux__)
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000LL + now.tv_nsec;
+#else
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/**
+ * @brief Sleeps until an absolute steady clock time.
+ *
+ * An absolute deadline is not shortened or lengthened by the time it takes to compute
+ * it, and a sleep interrupted by a signal is simply resumed with the same deadline.
+ */
+void ControlLoop::sleepUntil(long long deadlineNs) {
+#if defined(__linux__)
+    timespec deadline;
+    deadline.tv_sec = static_cast<time_t>(deadlineNs / 1000000000LL);
+    deadline.tv_nsec = static_cast<long>(deadlineNs % 1000000000LL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+#else
+    this_thread::sleep_until(chrono::steady_clock::time_point(chrono::nanoseconds(deadlineNs)));
+#endif
+}
@@ -0,0 +1,186 @@
+#pragma once
+/**
+ * @file   ControlLoop.h
+ * @date   October, 2026
+ * @brief  Header file for the ControlLoop class.
+ *
+ * This file contains the definition of the ControlLoop class, which runs the periodic
+ * tasks of the robot (sensor polling, safety checks, command dispatch, logging) at
+ * fixed rates on absolute deadlines.
+ */
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "LatencyHistogram.h"
+
+//! ControlTaskStats struct
+/*!
+ * @brief Timing statistics of one task of a ControlLoop.
+ */
+struct ControlTaskStats {
+    unsigned long long runs;      /*!< Times the task ran. */
+    unsigned long long overruns;  /*!< Runs that ended after the next release of the task. */
+    unsigned long long skipped;   /*!< Releases dropped to recover from overruns. */
+    LatencyHistogram jitter;      /*!< Start time minus release time (ns). */
+    LatencyHistogram duration;    /*!< Execution time (ns). */
+};
+
+//! ControlLoop class
+/*!
+ * @brief Fixed-rate executor of periodic tasks.
+ *
+ * Every task has a period and is released at origin + k * period, where origin is the
+ * time the loop started. The loop sleeps until the earliest release with an absolute
+ * deadline (clock_nanosleep with TIMER_ABSTIME on CLOCK_MONOTONIC on Linux), so time
+ * spent in the tasks and wake-up latency do not add up over the cycles the way a
+ * relative Sleep() between commands does.
+ *
+ * When several tasks are due, they run in the order they were added, so the first
+ * tasks have the highest priority: add the sensor poll before the safety check and the
+ * safety check before command dispatch. A run that ends after the next release of its
+ * task is an overrun; the releases that were missed are skipped, not run back to back,
+ * and the task stays on its grid of releases. For every run the jitter (start minus
+ * release) and the execution time are recorded.
+ *
+ * The loop runs either on the calling thread with runFor() or on its own thread with
+ * start() and stop(). The thread can be pinned to a CPU and given a SCHED_FIFO
+ * priority; both need privileges and are skipped with a warning when refused. Tasks
+ * must be added and statistics read while the loop is not running.
+ */
+class ControlLoop {
+private:
+    //! Task struct
+    /*!
+     * @brief A registered task and its next release.
+     */
+    struct Task {
+        const char* name;            /*!< Name shown in printStats(), a static string. */
+        long long periodNs;          /*!< Time between releases (ns). */
+        std::function<void()> body;  /*!< Work of one release. */
+        long long nextReleaseNs;     /*!< Steady clock time of the next release (ns). */
+        ControlTaskStats stats;      /*!< Timing statistics. */
+    };
+
+    std::vector<Task> tasks;         /*!< Registered tasks, in priority order. */
+    std::thread worker;              /*!< Loop thread started by start(). */
+    std::atomic<bool> running;       /*!< Cleared to end the loop. */
+    int cpu;                         /*!< CPU the loop thread is pinned to, -1 for none. */
+    int realtimePriority;            /*!< SCHED_FIFO priority of the loop thread, 0 for none. */
+    bool pinned;                     /*!< The loop thread was pinned to cpu. */
+    bool realtime;                   /*!< The loop thread got realtimePriority. */
+
+    //! loop function
+    /*!
+    * Runs the tasks until endNs, or until stop() when endNs is negative.
+    */
+    void loop(long long endNs);
+
+    //! applyThreadOptions function
+    /*!
+    * Pins the calling thread and raises its priority as configured.
+    */
+    void applyThreadOptions();
+
+    ControlLoop(const ControlLoop&) = delete;
+    ControlLoop& operator=(const ControlLoop&) = delete;
+
+public:
+    //! Default constructor
+    ControlLoop();
+
+    //! Destructor
+    /*!
+    * Stops the loop thread.
+    */
+    ~ControlLoop();
+
+    //! addTask function
+    /*!
+    * Registers a periodic task; tasks added first run first when several are due.
+    * @param name Name shown in printStats(), must outlive the loop (a string literal).
+    * @param periodMicroseconds Time between two runs of the task.
+    * @param body Work of one run.
+    * @return the task number, or -1 if the period is not positive or the loop is running.
+    */
+    int addTask(const char* name, int periodMicroseconds, std::function<void()> body);
+
+    //! setCpu function
+    /*!
+    * @param cpu CPU the loop thread started by start() is pinned to, -1 for none.
+    */
+    void setCpu(int cpu);
+
+    //! setRealtimePriority function
+    /*!
+    * @param priority SCHED_FIFO priority (1-99) of the loop thread started by start(), 0 for none.
+    */
+    void setRealtimePriority(int priority);
+
+    //! runFor function
+    /*!
+    * Runs the loop on the calling thread for a duration.
+    * @param durationMicroseconds Time to run.
+    */
+    void runFor(long long durationMicroseconds);
+
+    //! start function
+    /*!
+    * Starts the loop on its own thread.
+    * @return true if the loop is running.
+    */
+    bool start();
+
+    //! stop function
+    /*!
+    * Ends the loop after the tasks that are running and waits for its thread.
+    */
+    void stop();
+
+    //! isRunning function
+    bool isRunning() const;
+
+    //! isPinned function
+    /*!
+    * @return true if the last start() pinned the loop thread to the configured CPU.
+    */
+    bool isPinned() const;
+
+    //! isRealtime function
+    /*!
+    * @return true if the last start() gave the loop thread the configured SCHED_FIFO priority.
+    */
+    bool isRealtime() const;
+
+    //! getTaskCount function
+    int getTaskCount() const;
+
+    //! getStats function
+    /*!
+    * @return the statistics of a task; read them while the loop is not running.
+    */
+    const ControlTaskStats& getStats(int task) const;
+
+    //! resetStats function
+    void resetStats();
+
+    //! printStats function
+    /*!
+    * Prints runs, overruns, jitter and execution time of every task.
+    */
+    void printStats() const;
+
+    //! nowNs function
+    /*!
+    * @return the steady clock time in nanoseconds, the clock of every release.
+    */
+    static long long nowNs();
+
+    //! sleepUntil function
+    /*!
+    * Sleeps until an absolute steady clock time; returns at once if it has passed.
+    * @param deadlineNs Time returned by nowNs() to wake up at.
+    */
+    static void sleepUntil(long long deadlineNs);
+};
@@ -0,0 +1,217 @@
+/**
+ * @file   DistanceField.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the DistanceField class.
+ */
+
+#include <cmath>
+#include <limits>
+#include "DistanceField.h"
+#include "MAP.h"
+using namespace std;
+
+/** Squared distance used for "no obstacle on this line", large but safe to add to. */
+static const double FAR_AWAY = 1e20;
+
+/**
+ * @brief Default constructor. Starts with an empty grid.
+ */
+DistanceField::DistanceField() : width(0), height(0), resolution(1.0), limit(numeric_limits<double>::infinity()) {
+}
+
+/**
+ * @brief 1D squared distance transform of column[0..n) into line[0..n).
+ *
+ * Computes line[q] = min over p of (q - p)^2 + column[p] as the lower envelope of the
+ * parabolas rooted at every p.
+ */
+void DistanceField::transform1D(int n) {
+    int* v = this->vertices.data();
+    double* z = this->bounds.data();
+    const double* f = this->column.data();
+    int k = 0;
+    v[0] = 0;
+    z[0] = -FAR_AWAY;
+    z[1] = FAR_AWAY;
+    for (int q = 1; q < n; q++) {
+        double s;
+        while (true) {
+            int p = v[k];
+            s = ((f[q] + static_cast<double>(q) * q) - (f[p] + static_cast<double>(p) * p)) / (2.0 * (q - p));
+            if (s > z[k] || k == 0) {
+                break;
+            }
+            k--;
+        }
+        if (s <= z[k]) {
+            // Only possible for k == 0: q replaces the first parabola.
+            v[0] = q;
+            z[1] = FAR_AWAY;
+            continue;
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = FAR_AWAY;
+    }
+    k = 0;
+    for (int q = 0; q < n; q++) {
+        while (z[k + 1] < q) {
+            k++;
+        }
+        double d = q - v[k];
+        this->line[q] = d * d + f[v[k]];
+    }
+}
+
+/**
+ * @brief Two-pass distance transform of a window of the grid.
+ *
+ * Distances are clamped to the limit.
+ */
+void DistanceField::transform(const unsigned char* obstacles, size_t stride, int w, int h, float* out) {
+    // Columns: distance in cells to the nearest obstacle in the same column, found with
+    // a sweep down and a sweep up over whole rows so memory is read in order.
+    float none = static_cast<float>(FAR_AWAY);
+    for (int x = 0; x < w; x++) {
+        out[x] = obstacles[x] != 0 ? 0.0f : none;
+    }
+    for (int y = 1; y < h; y++) {
+        const unsigned char* flags = obstacles + y * stride;
+        float* row = out + static_cast<size_t>(y) * w;
+        const float* above = row - w;
+        for (int x = 0; x < w; x++) {
+            row[x] = flags[x] != 0 ? 0.0f : above[x] + 1.0f;
+        }
+    }
+    for (int y = h - 2; y >= 0; y--) {
+        float* row = out + static_cast<size_t>(y) * w;
+        const float* below = row + w;
+        for (int x = 0; x < w; x++) {
+            float candidate = below[x] + 1.0f;
+            row[x] = candidate < row[x] ? candidate : row[x];
+        }
+    }
+
+    // Rows: squared distance transform of the squared column distances, then meters.
+    float clamp = this->limit < FAR_AWAY ? static_cast<float>(this->limit) : none;
+    for (int y = 0; y < h; y++) {
+        float* row = out + static_cast<size_t>(y) * w;
+        for (int x = 0; x < w; x++) {
+            double cells = row[x];
+            this->column[x] = row[x] < none ? cells * cells : FAR_AWAY;
+        }
+        transform1D(w);
+        for (int x = 0; x < w; x++) {
+            float meters = static_cast<float>(sqrt(this->line[x]) * this->resolution);
+            row[x] = meters < clamp ? meters : clamp;
+        }
+    }
+}
+
+/**
+ * @brief Computes the field of a grid given as obstacle flags.
+ */
+void DistanceField::compute(int width, int height, const unsigned char* obstacles, double resolution) {
+    this->width = width > 0 ? width : 0;
+    this->height = height > 0 ? height : 0;
+    this->resolution = resolution > 0 ? resolution : 1.0;
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    int longest = this->width > this->height ? this->width : this->height;
+    this->distances.resize(cells);
+    this->column.resize(longest);
+    this->line.resize(longest);
+    this->vertices.resize(longest);
+    this->bounds.resize(longest + 1);
+    if (cells == 0) {
+        return;
+    }
+    transform(obstacles, this->width, this->width, this->height, this->distances.data());
+}
+
+/**
+ * @brief Recomputes a rectangle of the field after a local change of the grid.
+ *
+ * An obstacle further than the limit from every cell of the rectangle cannot change
+ * their clamped distances, so the transform only needs the rectangle grown by the
+ * limit plus one cell on each side. Values inside the window but outside the
+ * rectangle are discarded because obstacles beyond the window were not seen.
+ */
+void DistanceField::update(const unsigned char* obstacles, int x0, int y0, int x1, int y1) {
+    if (!(this->limit < FAR_AWAY)) {
+        compute(this->width, this->height, obstacles, this->resolution);
+        return;
+    }
+    x0 = x0 > 0 ? x0 : 0;
+    y0 = y0 > 0 ? y0 : 0;
+    x1 = x1 < this->width ? x1 : this->width;
+    y1 = y1 < this->height ? y1 : this->height;
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    int margin = static_cast<int>(ceil(this->limit / this->resolution)) + 1;
+    int wx0 = x0 - margin > 0 ? x0 - margin : 0;
+    int wy0 = y0 - margin > 0 ? y0 - margin : 0;
+    int wx1 = x1 + margin < this->width ? x1 + margin : this->width;
+    int wy1 = y1 + margin < this->height ? y1 + margin : this->height;
+    int w = wx1 - wx0;
+    int h = wy1 - wy0;
+    this->window.resize(static_cast<size_t>(w) * h);
+    transform(obstacles + static_cast<size_t>(wy0) * this->width + wx0, this->width, w, h, this->window.data());
+    for (int y = y0; y < y1; y++) {
+        const float* source = &this->window[static_cast<size_t>(y - wy0) * w + (x0 - wx0)];
+        float* target = &this->distances[static_cast<size_t>(y) * this->width + x0];
+        for (int x = 0; x < x1 - x0; x++) {
+            target[x] = source[x];
+        }
+    }
+}
+
+/**
+ * @brief Computes the field of the occupied cells of a map.
+ */
+void DistanceField::compute(const MAP& map, bool unknownIsObstacle) {
+    int w = map.getWidth();
+    int h = map.getHeight();
+    vector<unsigned char> obstacles(static_cast<size_t>(w) * h);
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            obstacles[static_cast<size_t>(y) * w + x] = map.isOccupied(x, y) || (unknownIsObstacle && !map.isFree(x, y));
+        }
+    }
+    compute(w, h, obstacles.data(), map.getResolution());
+}
+
+/**
+ * @brief Sets the distance beyond which values are clamped.
+ */
+void DistanceField::setLimit(double limit) {
+    this->limit = limit > 0 ? limit : 0.0;
+}
+
+double DistanceField::getLimit() const {
+    return this->limit;
+}
+
+float DistanceField::getDistance(int cx, int cy) const {
+    if (cx < 0 || cy < 0 || cx >= this->width || cy >= this->height) {
+        return 0.0f;
+    }
+    return this->distances[static_cast<size_t>(cy) * this->width + cx];
+}
+
+const float* DistanceField::getDistances() const {
+    return this->distances.data();
+}
+
+int DistanceField::getWidth() const {
+    return this->width;
+}
+
+int DistanceField::getHeight() const {
+    return this->height;
+}
+
+double DistanceField::getResolution() const {
+    return this->resolution;
+}
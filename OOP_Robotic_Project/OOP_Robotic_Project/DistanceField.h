@@ -0,0 +1,122 @@
+#pragma once
+/**
+ * @file   DistanceField.h
+ * @date   October, 2026
+ * @brief  Header file for the DistanceField class.
+ *
+ * This file contains the definition of the DistanceField class, the distance from every
+ * cell of a grid to the nearest obstacle.
+ */
+
+#include <vector>
+
+class MAP;
+
+//! DistanceField class
+/*!
+ * @brief Exact Euclidean distance transform of an obstacle grid.
+ *
+ * compute() runs a two-pass transform: the distance to the nearest obstacle in the same
+ * column comes from one sweep down and one sweep up the grid, then a squared distance
+ * transform along every row (Felzenszwalb and Huttenlocher's lower envelope of
+ * parabolas) combines the columns. Both passes read the grid row by row and are linear
+ * in the number of cells. Distances are measured between cell
+ * centers, so an obstacle cell has distance 0 and its neighbours one resolution.
+ *
+ * With a limit set, distances beyond it are stored as the limit. A field that only
+ * has to be right up to a limit can then be repaired after a local change: update()
+ * recomputes a rectangle from a window that extends the limit past it on every side,
+ * which is all the obstacles that can be within the limit of the rectangle.
+ *
+ * The buffers are kept between calls; recomputing a grid of the same size does not
+ * allocate.
+ */
+class DistanceField {
+private:
+    int width;                     /*!< Grid width in cells. */
+    int height;                    /*!< Grid height in cells. */
+    double resolution;             /*!< Cell side in meters. */
+    double limit;                  /*!< Larger distances are stored as this value (meters). */
+    std::vector<float> distances;  /*!< Distance of every cell to the nearest obstacle (meters), row major. */
+    std::vector<float> window;     /*!< Field of the window recomputed by update(). */
+    std::vector<double> column;    /*!< Squared distances along one row, in cells. */
+    std::vector<double> line;      /*!< Result of the 1D transform of one row. */
+    std::vector<int> vertices;     /*!< Parabola vertices of the lower envelope. */
+    std::vector<double> bounds;    /*!< Boundaries between envelope parabolas. */
+
+    //! transform1D function
+    /*!
+    * Squared distance transform of n samples of column, written to line.
+    */
+    void transform1D(int n);
+
+    //! transform function
+    /*!
+    * Distance transform of a w x h window of a grid, written to out row major.
+    * @param obstacles First flag of the window.
+    * @param stride Flags per grid row.
+    */
+    void transform(const unsigned char* obstacles, size_t stride, int w, int h, float* out);
+
+public:
+    //! Default constructor
+    DistanceField();
+
+    //! compute function
+    /*!
+    * Computes the field of a grid.
+    * @param width Grid width in cells.
+    * @param height Grid height in cells.
+    * @param obstacles width * height flags, row major, non-zero for an obstacle.
+    * @param resolution Cell side (meters).
+    */
+    void compute(int width, int height, const unsigned char* obstacles, double resolution);
+
+    //! compute function
+    /*!
+    * Computes the field of the occupied cells of a map.
+    * @param map Occupancy grid.
+    * @param unknownIsObstacle Treat cells that are neither free nor occupied as obstacles.
+    */
+    void compute(const MAP& map, bool unknownIsObstacle);
+
+    //! update function
+    /*!
+    * Recomputes the cells x0 <= x < x1, y0 <= y < y1 after the obstacles in or near
+    * them changed. Without a limit this recomputes the whole grid.
+    * @param obstacles The grid of the last compute(), with the changes applied.
+    */
+    void update(const unsigned char* obstacles, int x0, int y0, int x1, int y1);
+
+    //! setLimit function
+    /*!
+    * @param limit Distances beyond this are stored as the limit (meters), infinity for none.
+    * Takes effect at the next compute().
+    */
+    void setLimit(double limit);
+
+    //! getLimit function
+    double getLimit() const;
+
+    //! getDistance function
+    /*!
+    * @return the distance from cell (cx, cy) to the nearest obstacle (meters), or 0
+    * outside the grid. A grid without obstacles gives a very large value everywhere.
+    */
+    float getDistance(int cx, int cy) const;
+
+    //! getDistances function
+    /*!
+    * @return the distances of all cells, row major.
+    */
+    const float* getDistances() const;
+
+    //! getWidth function
+    int getWidth() const;
+
+    //! getHeight function
+    int getHeight() const;
+
+    //! getResolution function
+    double getResolution() const;
+};
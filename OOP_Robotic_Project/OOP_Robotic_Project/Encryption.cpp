@@ -0,0 +1,832 @@
+/**
+ * @file   Encryption.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the Encryption, EncryptedWriter and EncryptedReader classes.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include "Encryption.h"
+
+#if defined(__AVX2__)
+#define ENCRYPTION_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENCRYPTION_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+static const char ENCRYPTED_MAGIC[8] = { 'R', 'C', 'S', 'E', 'N', 'C', 0, 0 };
+
+static inline uint32_t load32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16
+        | static_cast<uint32_t>(p[3]) << 24;
+}
+
+static inline void store32(uint8_t* p, uint32_t v) {
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+static inline void store64(uint8_t* p, uint64_t v) {
+    store32(p, static_cast<uint32_t>(v));
+    store32(p + 4, static_cast<uint32_t>(v >> 32));
+}
+
+static inline uint32_t rotl(uint32_t v, int c) {
+    return (v << c) | (v >> (32 - c));
+}
+
+#define QUARTER_ROUND(a, b, c, d) \
+    a += b; d = rotl(d ^ a, 16);  \
+    c += d; b = rotl(b ^ c, 12);  \
+    a += b; d = rotl(d ^ a, 8);   \
+    c += d; b = rotl(b ^ c, 7);
+
+/**
+ * @brief Fills the ChaCha20 input state: constants, key, block counter and nonce.
+ */
+static void initState(uint32_t state[16], const uint32_t key[8], const uint8_t* nonce, uint32_t counter) {
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+    for (int i = 0; i < 8; i++) {
+        state[4 + i] = key[i];
+    }
+    state[12] = counter;
+    state[13] = load32(nonce);
+    state[14] = load32(nonce + 4);
+    state[15] = load32(nonce + 8);
+}
+
+/**
+ * @brief Computes one 64-byte key stream block.
+ */
+static void keyBlock(const uint32_t state[16], uint8_t out[64]) {
+    uint32_t x[16];
+    memcpy(x, state, sizeof(x));
+    for (int round = 0; round < 10; round++) {
+        QUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        QUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        QUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        QUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        QUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        QUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        QUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        QUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++) {
+        store32(out + 4 * i, x[i] + state[i]);
+    }
+}
+
+#if defined(ENCRYPTION_AVX2)
+static const int WIDE_BLOCKS = 8;
+
+static inline __m256i rotl16(__m256i v) {
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13));
+}
+
+static inline __m256i rotl8(__m256i v) {
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+        3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14));
+}
+
+#define VQUARTER_ROUND(a, b, c, d)                                                                         \
+    a = _mm256_add_epi32(a, b); d = rotl16(_mm256_xor_si256(d, a));                                        \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_slli_epi32(b, 12), _mm256_srli_epi32(b, 20));                               \
+    a = _mm256_add_epi32(a, b); d = rotl8(_mm256_xor_si256(d, a));                                         \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c);                                                \
+    b = _mm256_or_si256(_mm256_slli_epi32(b, 7), _mm256_srli_epi32(b, 25));
+
+/**
+ * @brief XORs 8 words of 8 blocks with the input: transposes the 8 x 8 matrix of
+ * rows = state words, columns = blocks, so each row becomes 32 bytes of one block.
+ */
+static inline void xorWords8(const __m256i* x, const uint8_t* in, uint8_t* out) {
+    __m256i t0 = _mm256_unpacklo_epi32(x[0], x[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(x[0], x[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(x[2], x[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(x[2], x[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(x[4], x[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(x[4], x[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(x[6], x[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(x[6], x[7]);
+    __m256i u[8];
+    u[0] = _mm256_unpacklo_epi64(t0, t2);
+    u[1] = _mm256_unpackhi_epi64(t0, t2);
+    u[2] = _mm256_unpacklo_epi64(t1, t3);
+    u[3] = _mm256_unpackhi_epi64(t1, t3);
+    u[4] = _mm256_unpacklo_epi64(t4, t6);
+    u[5] = _mm256_unpackhi_epi64(t4, t6);
+    u[6] = _mm256_unpacklo_epi64(t5, t7);
+    u[7] = _mm256_unpackhi_epi64(t5, t7);
+    for (int b = 0; b < 4; b++) {
+        __m256i low = _mm256_permute2x128_si256(u[b], u[b + 4], 0x20);
+        __m256i high = _mm256_permute2x128_si256(u[b], u[b + 4], 0x31);
+        const __m256i* lowIn = reinterpret_cast<const __m256i*>(in + 64 * b);
+        const __m256i* highIn = reinterpret_cast<const __m256i*>(in + 64 * (b + 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 64 * b), _mm256_xor_si256(_mm256_loadu_si256(lowIn), low));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 64 * (b + 4)), _mm256_xor_si256(_mm256_loadu_si256(highIn), high));
+    }
+}
+
+/**
+ * @brief XORs 8 consecutive key stream blocks with 512 bytes of input.
+ */
+static void xorBlocksWide(const uint32_t state[16], const uint8_t* in, uint8_t* out) {
+    __m256i v[16];
+    __m256i x[16];
+    for (int i = 0; i < 16; i++) {
+        v[i] = _mm256_set1_epi32(static_cast<int>(state[i]));
+    }
+    v[12] = _mm256_add_epi32(v[12], _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    for (int i = 0; i < 16; i++) {
+        x[i] = v[i];
+    }
+    for (int round = 0; round < 10; round++) {
+        VQUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        VQUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        VQUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        VQUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        VQUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        VQUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        VQUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        VQUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+    for (int i = 0; i < 16; i++) {
+        x[i] = _mm256_add_epi32(x[i], v[i]);
+    }
+    xorWords8(x, in, out);
+    xorWords8(x + 8, in + 32, out + 32);
+}
+#elif defined(ENCRYPTION_SSE)
+static const int WIDE_BLOCKS = 4;
+
+#define VROTL(v, c) _mm_or_si128(_mm_slli_epi32(v, c), _mm_srli_epi32(v, 32 - (c)))
+
+#define VQUARTER_ROUND(a, b, c, d)                                        \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = VROTL(d, 16);   \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = VROTL(b, 12);   \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = VROTL(d, 8);    \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = VROTL(b, 7);
+
+/**
+ * @brief XORs 4 consecutive key stream blocks with 256 bytes of input.
+ */
+static void xorBlocksWide(const uint32_t state[16], const uint8_t* in, uint8_t* out) {
+    __m128i v[16];
+    __m128i x[16];
+    for (int i = 0; i < 16; i++) {
+        v[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+    }
+    v[12] = _mm_add_epi32(v[12], _mm_setr_epi32(0, 1, 2, 3));
+    for (int i = 0; i < 16; i++) {
+        x[i] = v[i];
+    }
+    for (int round = 0; round < 10; round++) {
+        VQUARTER_ROUND(x[0], x[4], x[8], x[12]);
+        VQUARTER_ROUND(x[1], x[5], x[9], x[13]);
+        VQUARTER_ROUND(x[2], x[6], x[10], x[14]);
+        VQUARTER_ROUND(x[3], x[7], x[11], x[15]);
+        VQUARTER_ROUND(x[0], x[5], x[10], x[15]);
+        VQUARTER_ROUND(x[1], x[6], x[11], x[12]);
+        VQUARTER_ROUND(x[2], x[7], x[8], x[13]);
+        VQUARTER_ROUND(x[3], x[4], x[9], x[14]);
+    }
+    for (int g = 0; g < 4; g++) {
+        __m128i a0 = _mm_add_epi32(x[4 * g], v[4 * g]);
+        __m128i a1 = _mm_add_epi32(x[4 * g + 1], v[4 * g + 1]);
+        __m128i a2 = _mm_add_epi32(x[4 * g + 2], v[4 * g + 2]);
+        __m128i a3 = _mm_add_epi32(x[4 * g + 3], v[4 * g + 3]);
+        __m128i t0 = _mm_unpacklo_epi32(a0, a1);
+        __m128i t1 = _mm_unpacklo_epi32(a2, a3);
+        __m128i t2 = _mm_unpackhi_epi32(a0, a1);
+        __m128i t3 = _mm_unpackhi_epi32(a2, a3);
+        __m128i blocks[4] = { _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+            _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3) };
+        for (int b = 0; b < 4; b++) {
+            const __m128i* source = reinterpret_cast<const __m128i*>(in + 64 * b + 16 * g);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 64 * b + 16 * g), _mm_xor_si128(_mm_loadu_si128(source), blocks[b]));
+        }
+    }
+}
+#endif
+
+/**
+ * @brief XORs a message with the key stream, WIDE_BLOCKS blocks per step where a
+ * vector path is compiled in, then one block at a time.
+ */
+static void xorStream(const uint32_t key[8], const uint8_t* nonce, uint32_t counter, const uint8_t* in, uint8_t* out, size_t size) {
+    uint32_t state[16];
+    initState(state, key, nonce, counter);
+#if defined(ENCRYPTION_AVX2) || defined(ENCRYPTION_SSE)
+    while (size >= 64 * WIDE_BLOCKS) {
+        xorBlocksWide(state, in, out);
+        state[12] += WIDE_BLOCKS;
+        in += 64 * WIDE_BLOCKS;
+        out += 64 * WIDE_BLOCKS;
+        size -= 64 * WIDE_BLOCKS;
+    }
+#endif
+    uint8_t block[64];
+    while (size > 0) {
+        keyBlock(state, block);
+        size_t n = size < 64 ? size : 64;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = in[i] ^ block[i];
+        }
+        state[12]++;
+        in += n;
+        out += n;
+        size -= n;
+    }
+    memset(block, 0, sizeof(block));
+}
+
+/**
+ * @brief Incremental Poly1305 with five 26-bit limbs.
+ */
+class Poly1305 {
+private:
+    uint32_t r[5];         /*!< Clamped multiplier. */
+    uint32_t h[5];         /*!< Accumulator. */
+    uint32_t pad[4];       /*!< Final addend. */
+    uint8_t buffer[16];    /*!< Bytes of an incomplete block. */
+    size_t buffered;       /*!< Bytes in buffer. */
+
+    // Absorbs whole 16-byte blocks; hibit is 2^128 for full blocks, 0 for the final partial one.
+    void blocks(const uint8_t* m, size_t bytes, uint32_t hibit) {
+        const uint32_t mask = 0x3ffffff;
+        uint32_t r0 = r[0], r1 = r[1], r2 = r[2], r3 = r[3], r4 = r[4];
+        uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+        uint32_t h0 = h[0], h1 = h[1], h2 = h[2], h3 = h[3], h4 = h[4];
+        while (bytes >= 16) {
+            h0 += load32(m) & mask;
+            h1 += (load32(m + 3) >> 2) & mask;
+            h2 += (load32(m + 6) >> 4) & mask;
+            h3 += (load32(m + 9) >> 6) & mask;
+            h4 += (load32(m + 12) >> 8) | hibit;
+            uint64_t d0 = static_cast<uint64_t>(h0) * r0 + static_cast<uint64_t>(h1) * s4 + static_cast<uint64_t>(h2) * s3
+                + static_cast<uint64_t>(h3) * s2 + static_cast<uint64_t>(h4) * s1;
+            uint64_t d1 = static_cast<uint64_t>(h0) * r1 + static_cast<uint64_t>(h1) * r0 + static_cast<uint64_t>(h2) * s4
+                + static_cast<uint64_t>(h3) * s3 + static_cast<uint64_t>(h4) * s2;
+            uint64_t d2 = static_cast<uint64_t>(h0) * r2 + static_cast<uint64_t>(h1) * r1 + static_cast<uint64_t>(h2) * r0
+                + static_cast<uint64_t>(h3) * s4 + static_cast<uint64_t>(h4) * s3;
+            uint64_t d3 = static_cast<uint64_t>(h0) * r3 + static_cast<uint64_t>(h1) * r2 + static_cast<uint64_t>(h2) * r1
+                + static_cast<uint64_t>(h3) * r0 + static_cast<uint64_t>(h4) * s4;
+            uint64_t d4 = static_cast<uint64_t>(h0) * r4 + static_cast<uint64_t>(h1) * r3 + static_cast<uint64_t>(h2) * r2
+                + static_cast<uint64_t>(h3) * r1 + static_cast<uint64_t>(h4) * r0;
+            uint32_t c = static_cast<uint32_t>(d0 >> 26);
+            h0 = static_cast<uint32_t>(d0) & mask;
+            d1 += c; c = static_cast<uint32_t>(d1 >> 26); h1 = static_cast<uint32_t>(d1) & mask;
+            d2 += c; c = static_cast<uint32_t>(d2 >> 26); h2 = static_cast<uint32_t>(d2) & mask;
+            d3 += c; c = static_cast<uint32_t>(d3 >> 26); h3 = static_cast<uint32_t>(d3) & mask;
+            d4 += c; c = static_cast<uint32_t>(d4 >> 26); h4 = static_cast<uint32_t>(d4) & mask;
+            h0 += c * 5; c = h0 >> 26; h0 &= mask;
+            h1 += c;
+            m += 16;
+            bytes -= 16;
+        }
+        h[0] = h0; h[1] = h1; h[2] = h2; h[3] = h3; h[4] = h4;
+    }
+
+public:
+    explicit Poly1305(const uint8_t* key) {
+        r[0] = load32(key) & 0x3ffffff;
+        r[1] = (load32(key + 3) >> 2) & 0x3ffff03;
+        r[2] = (load32(key + 6) >> 4) & 0x3ffc0ff;
+        r[3] = (load32(key + 9) >> 6) & 0x3f03fff;
+        r[4] = (load32(key + 12) >> 8) & 0x00fffff;
+        for (int i = 0; i < 5; i++) {
+            h[i] = 0;
+        }
+        for (int i = 0; i < 4; i++) {
+            pad[i] = load32(key + 16 + 4 * i);
+        }
+        buffered = 0;
+    }
+
+    void update(const uint8_t* m, size_t bytes) {
+        // m may be null when bytes is 0, as for seal() without AAD.
+        if (bytes == 0) {
+            return;
+        }
+        if (buffered > 0) {
+            size_t n = min(bytes, 16 - buffered);
+            memcpy(buffer + buffered, m, n);
+            buffered += n;
+            m += n;
+            bytes -= n;
+            if (buffered < 16) {
+                return;
+            }
+            blocks(buffer, 16, 1u << 24);
+            buffered = 0;
+        }
+        size_t whole = bytes & ~static_cast<size_t>(15);
+        blocks(m, whole, 1u << 24);
+        memcpy(buffer, m + whole, bytes - whole);
+        buffered = bytes - whole;
+    }
+
+    // Feeds zeros up to the next multiple of 16 bytes, as the AEAD construction does.
+    void padToBlock() {
+        static const uint8_t zeros[16] = {};
+        if (buffered > 0) {
+            update(zeros, 16 - buffered);
+        }
+    }
+
+    void finish(uint8_t* tag) {
+        const uint32_t mask = 0x3ffffff;
+        if (buffered > 0) {
+            buffer[buffered] = 1;
+            memset(buffer + buffered + 1, 0, 15 - buffered);
+            blocks(buffer, 16, 0);
+        }
+        uint32_t h0 = h[0], h1 = h[1], h2 = h[2], h3 = h[3], h4 = h[4];
+        uint32_t c = h1 >> 26; h1 &= mask;
+        h2 += c; c = h2 >> 26; h2 &= mask;
+        h3 += c; c = h3 >> 26; h3 &= mask;
+        h4 += c; c = h4 >> 26; h4 &= mask;
+        h0 += c * 5; c = h0 >> 26; h0 &= mask;
+        h1 += c;
+
+        // h - p, kept if it does not go negative
+        uint32_t g0 = h0 + 5; c = g0 >> 26; g0 &= mask;
+        uint32_t g1 = h1 + c; c = g1 >> 26; g1 &= mask;
+        uint32_t g2 = h2 + c; c = g2 >> 26; g2 &= mask;
+        uint32_t g3 = h3 + c; c = g3 >> 26; g3 &= mask;
+        uint32_t g4 = h4 + c - (1u << 26);
+        uint32_t select = (g4 >> 31) - 1;
+        h0 = (h0 & ~select) | (g0 & select);
+        h1 = (h1 & ~select) | (g1 & select);
+        h2 = (h2 & ~select) | (g2 & select);
+        h3 = (h3 & ~select) | (g3 & select);
+        h4 = (h4 & ~select) | (g4 & select);
+
+        uint32_t w0 = h0 | (h1 << 26);
+        uint32_t w1 = (h1 >> 6) | (h2 << 20);
+        uint32_t w2 = (h2 >> 12) | (h3 << 14);
+        uint32_t w3 = (h3 >> 18) | (h4 << 8);
+        uint64_t f = static_cast<uint64_t>(w0) + pad[0];
+        store32(tag, static_cast<uint32_t>(f));
+        f = static_cast<uint64_t>(w1) + pad[1] + (f >> 32);
+        store32(tag + 4, static_cast<uint32_t>(f));
+        f = static_cast<uint64_t>(w2) + pad[2] + (f >> 32);
+        store32(tag + 8, static_cast<uint32_t>(f));
+        f = static_cast<uint64_t>(w3) + pad[3] + (f >> 32);
+        store32(tag + 12, static_cast<uint32_t>(f));
+    }
+};
+
+/**
+ * @brief Computes the AEAD tag of the associated data and the ciphertext (RFC 8439,
+ * section 2.8), with the one-time key taken from key stream block 0.
+ */
+static void aeadTag(const uint32_t key[8], const uint8_t* nonce, const uint8_t* aad, size_t aadSize,
+    const uint8_t* ciphertext, size_t size, uint8_t* tag) {
+    uint32_t state[16];
+    uint8_t block[64];
+    initState(state, key, nonce, 0);
+    keyBlock(state, block);
+    Poly1305 mac(block);
+    mac.update(aad, aadSize);
+    mac.padToBlock();
+    mac.update(ciphertext, size);
+    mac.padToBlock();
+    uint8_t lengths[16];
+    store64(lengths, aadSize);
+    store64(lengths + 8, size);
+    mac.update(lengths, 16);
+    mac.finish(tag);
+    memset(block, 0, sizeof(block));
+}
+
+/**
+ * @brief Parameterized Constructor.
+ */
+Encryption::Encryption(const uint8_t* key) {
+    for (int i = 0; i < 8; i++) {
+        this->key[i] = load32(key + 4 * i);
+    }
+}
+
+/**
+ * @brief Destructor. Overwrites the key through a volatile pointer so the stores
+ * are not optimized away.
+ */
+Encryption::~Encryption() {
+    volatile uint32_t* words = this->key;
+    for (int i = 0; i < 8; i++) {
+        words[i] = 0;
+    }
+}
+
+/**
+ * @brief Encrypts from key stream block 1 on, then tags the ciphertext.
+ */
+void Encryption::seal(const uint8_t* nonce, const uint8_t* aad, size_t aadSize, const uint8_t* in, size_t size, uint8_t* out) const {
+    xorStream(this->key, nonce, 1, in, out, size);
+    aeadTag(this->key, nonce, aad, aadSize, out, size, out + size);
+}
+
+/**
+ * @brief Compares the tags without an early exit, so the time taken does not tell how
+ * many bytes matched, and only then decrypts.
+ */
+bool Encryption::open(const uint8_t* nonce, const uint8_t* aad, size_t aadSize, const uint8_t* in, size_t sealedSize, uint8_t* out) const {
+    if (sealedSize < static_cast<size_t>(TAG_SIZE)) {
+        return false;
+    }
+    size_t size = sealedSize - TAG_SIZE;
+    uint8_t tag[TAG_SIZE];
+    aeadTag(this->key, nonce, aad, aadSize, in, size, tag);
+    uint8_t difference = 0;
+    for (int i = 0; i < TAG_SIZE; i++) {
+        difference |= tag[i] ^ in[size + i];
+    }
+    if (difference != 0) {
+        return false;
+    }
+    xorStream(this->key, nonce, 1, in, out, size);
+    return true;
+}
+
+void Encryption::makeNonce(uint32_t prefix, uint64_t counter, uint8_t* nonce) {
+    store32(nonce, prefix);
+    store64(nonce + 4, counter);
+}
+
+void Encryption::chacha20(const uint8_t* key, const uint8_t* nonce, uint32_t counter, const uint8_t* in, uint8_t* out, size_t size) {
+    uint32_t words[8];
+    for (int i = 0; i < 8; i++) {
+        words[i] = load32(key + 4 * i);
+    }
+    xorStream(words, nonce, counter, in, out, size);
+}
+
+void Encryption::poly1305(const uint8_t* key, const uint8_t* message, size_t size, uint8_t* tag) {
+    Poly1305 mac(key);
+    mac.update(message, size);
+    mac.finish(tag);
+}
+
+/**
+ * @brief Derives the key of a file: the first 32 bytes of the ChaCha20 key stream for
+ * the caller's key, with the first 12 salt bytes as nonce and the last 4 as counter.
+ */
+static void deriveFileKey(const uint8_t* key, const uint8_t* salt, uint8_t* fileKey) {
+    uint8_t zeros[Encryption::KEY_SIZE] = {};
+    Encryption::chacha20(key, salt, load32(salt + 12), zeros, fileKey, Encryption::KEY_SIZE);
+}
+
+/**
+ * @brief Builds the associated data of a chunk: the file header and the last-chunk flag.
+ */
+static void chunkAad(const EncryptedFileHeader& header, bool last, uint8_t* aad) {
+    memcpy(aad, &header, sizeof(EncryptedFileHeader));
+    aad[sizeof(EncryptedFileHeader)] = last ? 1 : 0;
+}
+
+/**
+ * @brief Default constructor. No file is open.
+ */
+EncryptedWriter::EncryptedWriter() {
+    memset(&this->header, 0, sizeof(this->header));
+    memset(this->fileKey, 0, sizeof(this->fileKey));
+    this->chunkSize = 0;
+    this->filling = -1;
+    this->chunkCount = 0;
+    this->bytesWritten = 0;
+    this->stallCount = 0;
+    this->stopping = false;
+    this->failed.store(false);
+}
+
+/**
+ * @brief Destructor. Closes the file if it is open.
+ */
+EncryptedWriter::~EncryptedWriter() {
+    close();
+}
+
+/**
+ * @brief Creates the file, writes its header with a fresh random salt and starts
+ * the background thread.
+ */
+bool EncryptedWriter::open(const string& path, const uint8_t* key, uint32_t chunkSize) {
+    if (isOpen()) {
+        cout << "Error: EncryptedWriter is already open." << endl;
+        return false;
+    }
+    this->file.open(path, ios::binary | ios::trunc);
+    if (!this->file) {
+        cout << "Error: cannot create encrypted file " << path << "." << endl;
+        return false;
+    }
+    memset(&this->header, 0, sizeof(this->header));
+    memcpy(this->header.magic, ENCRYPTED_MAGIC, sizeof(ENCRYPTED_MAGIC));
+    this->header.version = EncryptedFileHeader::VERSION;
+    this->header.headerSize = sizeof(EncryptedFileHeader);
+    this->header.chunkSize = chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE;
+    random_device device;
+    for (int i = 0; i < 16; i += 4) {
+        store32(this->header.salt + i, device());
+    }
+    deriveFileKey(key, this->header.salt, this->fileKey);
+    this->file.write(reinterpret_cast<const char*>(&this->header), sizeof(this->header));
+
+    this->chunkSize = this->header.chunkSize;
+    this->queue.clear();
+    this->freeChunks.clear();
+    for (int i = 0; i < BUFFER_COUNT; i++) {
+        this->chunks[i].data.resize(this->chunkSize);
+        this->chunks[i].size = 0;
+        this->freeChunks.push_back(i);
+    }
+    this->filling = -1;
+    this->chunkCount = 0;
+    this->bytesWritten = 0;
+    this->stallCount = 0;
+    this->stopping = false;
+    this->failed.store(!this->file);
+    this->sealer = thread(&EncryptedWriter::sealLoop, this);
+    return true;
+}
+
+/**
+ * @brief Takes a free chunk buffer, waiting for the background thread if all are queued.
+ */
+void EncryptedWriter::takeChunk() {
+    unique_lock<mutex> lock(this->queueLock);
+    if (this->freeChunks.empty()) {
+        this->stallCount++;
+        this->freed.wait(lock, [this] { return !this->freeChunks.empty(); });
+    }
+    this->filling = this->freeChunks.back();
+    this->freeChunks.pop_back();
+    this->chunks[this->filling].size = 0;
+}
+
+/**
+ * @brief Queues the chunk being filled, in file order.
+ */
+void EncryptedWriter::submitChunk(bool last) {
+    Chunk& chunk = this->chunks[this->filling];
+    chunk.index = this->chunkCount++;
+    chunk.last = last;
+    {
+        lock_guard<mutex> lock(this->queueLock);
+        this->queue.push_back(this->filling);
+    }
+    this->filling = -1;
+    this->wake.notify_one();
+}
+
+/**
+ * @brief Copies bytes into chunks, queueing each one as it fills.
+ */
+bool EncryptedWriter::write(const void* data, size_t size) {
+    if (!isOpen() || this->failed.load()) {
+        return false;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        if (this->filling < 0) {
+            takeChunk();
+        }
+        Chunk& chunk = this->chunks[this->filling];
+        size_t n = min(size, static_cast<size_t>(this->chunkSize) - chunk.size);
+        memcpy(chunk.data.data() + chunk.size, bytes, n);
+        chunk.size += n;
+        bytes += n;
+        size -= n;
+        this->bytesWritten += n;
+        if (chunk.size == this->chunkSize) {
+            submitChunk(false);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Seals queued chunks in order and appends them to the file. The lock is only
+ * held to take a chunk from the queue and to hand it back.
+ */
+void EncryptedWriter::sealLoop() {
+    Encryption cipher(this->fileKey);
+    vector<uint8_t> sealed(static_cast<size_t>(this->chunkSize) + Encryption::TAG_SIZE);
+    uint8_t aad[sizeof(EncryptedFileHeader) + 1];
+    uint8_t nonce[Encryption::NONCE_SIZE];
+    while (true) {
+        int index;
+        {
+            unique_lock<mutex> lock(this->queueLock);
+            this->wake.wait(lock, [this] { return !this->queue.empty() || this->stopping; });
+            if (this->queue.empty()) {
+                return;
+            }
+            index = this->queue.front();
+            this->queue.erase(this->queue.begin());
+        }
+        Chunk& chunk = this->chunks[index];
+        Encryption::makeNonce(0, chunk.index, nonce);
+        chunkAad(this->header, chunk.last, aad);
+        cipher.seal(nonce, aad, sizeof(aad), chunk.data.data(), chunk.size, sealed.data());
+        this->file.write(reinterpret_cast<const char*>(sealed.data()), chunk.size + Encryption::TAG_SIZE);
+        {
+            lock_guard<mutex> lock(this->queueLock);
+            if (!this->file) {
+                this->failed.store(true);
+            }
+            this->freeChunks.push_back(index);
+        }
+        this->freed.notify_one();
+    }
+}
+
+/**
+ * @brief Queues the final chunk, which may be empty, and waits until everything is written.
+ */
+bool EncryptedWriter::close() {
+    if (!isOpen()) {
+        return false;
+    }
+    if (this->filling < 0) {
+        takeChunk();
+    }
+    submitChunk(true);
+    {
+        lock_guard<mutex> lock(this->queueLock);
+        this->stopping = true;
+    }
+    this->wake.notify_one();
+    this->sealer.join();
+    this->file.flush();
+    bool ok = !this->failed.load() && static_cast<bool>(this->file);
+    this->file.close();
+    memset(this->fileKey, 0, sizeof(this->fileKey));
+    if (!ok) {
+        cout << "Error: writing the encrypted file failed." << endl;
+    }
+    return ok;
+}
+
+bool EncryptedWriter::isOpen() const {
+    return this->file.is_open();
+}
+
+uint64_t EncryptedWriter::getBytesWritten() const {
+    return this->bytesWritten;
+}
+
+uint64_t EncryptedWriter::getStallCount() const {
+    return this->stallCount;
+}
+
+/**
+ * @brief Default constructor. No file is open.
+ */
+EncryptedReader::EncryptedReader() {
+    memset(&this->header, 0, sizeof(this->header));
+    memset(this->fileKey, 0, sizeof(this->fileKey));
+    this->chunkCount = 0;
+    this->size = 0;
+    this->cachedChunk = -1;
+    this->failureCount = 0;
+}
+
+/**
+ * @brief Destructor. Clears the key and closes the file.
+ */
+EncryptedReader::~EncryptedReader() {
+    close();
+}
+
+/**
+ * @brief Reads the header and works out the chunk count and plaintext size from the
+ * file size; only the last chunk may be shorter than chunkSize.
+ */
+bool EncryptedReader::open(const string& path, const uint8_t* key) {
+    close();
+    this->file.open(path, ios::binary);
+    if (!this->file) {
+        cout << "Error: cannot open encrypted file " << path << "." << endl;
+        return false;
+    }
+    this->file.seekg(0, ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(this->file.tellg());
+    this->file.seekg(0, ios::beg);
+    this->file.read(reinterpret_cast<char*>(&this->header), sizeof(this->header));
+    if (!this->file || memcmp(this->header.magic, ENCRYPTED_MAGIC, sizeof(ENCRYPTED_MAGIC)) != 0
+        || this->header.version != EncryptedFileHeader::VERSION || this->header.headerSize != sizeof(EncryptedFileHeader)
+        || this->header.chunkSize == 0 || fileSize < sizeof(EncryptedFileHeader) + Encryption::TAG_SIZE) {
+        cout << "Error: " << path << " is not an encrypted file." << endl;
+        this->file.close();
+        return false;
+    }
+    uint64_t sealedChunk = static_cast<uint64_t>(this->header.chunkSize) + Encryption::TAG_SIZE;
+    uint64_t data = fileSize - sizeof(EncryptedFileHeader);
+    this->chunkCount = (data + sealedChunk - 1) / sealedChunk;
+    uint64_t lastSealed = data - (this->chunkCount - 1) * sealedChunk;
+    if (lastSealed < static_cast<uint64_t>(Encryption::TAG_SIZE)) {
+        this->chunkCount--;
+        lastSealed += sealedChunk;
+    }
+    this->size = (this->chunkCount - 1) * this->header.chunkSize + (lastSealed - Encryption::TAG_SIZE);
+    deriveFileKey(key, this->header.salt, this->fileKey);
+    this->sealed.resize(sealedChunk);
+    this->plain.resize(this->header.chunkSize);
+    this->cachedChunk = -1;
+    this->failureCount = 0;
+    return true;
+}
+
+/**
+ * @brief Clears the key and the decrypted chunk and closes the file.
+ */
+void EncryptedReader::close() {
+    memset(this->fileKey, 0, sizeof(this->fileKey));
+    fill(this->plain.begin(), this->plain.end(), 0);
+    this->cachedChunk = -1;
+    this->chunkCount = 0;
+    this->size = 0;
+    if (this->file.is_open()) {
+        this->file.close();
+    }
+}
+
+bool EncryptedReader::isOpen() const {
+    return this->file.is_open();
+}
+
+uint64_t EncryptedReader::getSize() const {
+    return this->size;
+}
+
+/**
+ * @brief Reads and opens one chunk. Only the final chunk is accepted with the last
+ * flag, and it must carry it.
+ */
+bool EncryptedReader::loadChunk(uint64_t index) {
+    if (static_cast<int64_t>(index) == this->cachedChunk) {
+        return true;
+    }
+    bool last = index + 1 == this->chunkCount;
+    uint64_t plainSize = last ? this->size - index * this->header.chunkSize : this->header.chunkSize;
+    uint64_t sealedChunk = static_cast<uint64_t>(this->header.chunkSize) + Encryption::TAG_SIZE;
+    this->file.clear();
+    this->file.seekg(static_cast<streamoff>(sizeof(EncryptedFileHeader) + index * sealedChunk));
+    this->file.read(reinterpret_cast<char*>(this->sealed.data()), static_cast<streamsize>(plainSize + Encryption::TAG_SIZE));
+    uint8_t aad[sizeof(EncryptedFileHeader) + 1];
+    uint8_t nonce[Encryption::NONCE_SIZE];
+    chunkAad(this->header, last, aad);
+    Encryption::makeNonce(0, index, nonce);
+    Encryption cipher(this->fileKey);
+    if (!this->file || !cipher.open(nonce, aad, sizeof(aad), this->sealed.data(), plainSize + Encryption::TAG_SIZE, this->plain.data())) {
+        this->failureCount++;
+        this->cachedChunk = -1;
+        return false;
+    }
+    this->cachedChunk = static_cast<int64_t>(index);
+    return true;
+}
+
+/**
+ * @brief Copies a byte range, chunk by chunk.
+ */
+size_t EncryptedReader::read(uint64_t offset, void* out, size_t count) {
+    if (!isOpen()) {
+        return 0;
+    }
+    uint8_t* bytes = static_cast<uint8_t*>(out);
+    size_t copied = 0;
+    while (copied < count && offset < this->size) {
+        uint64_t index = offset / this->header.chunkSize;
+        if (!loadChunk(index)) {
+            break;
+        }
+        uint64_t within = offset - index * this->header.chunkSize;
+        uint64_t chunkEnd = min(static_cast<uint64_t>(this->header.chunkSize), this->size - index * this->header.chunkSize);
+        size_t n = static_cast<size_t>(min(static_cast<uint64_t>(count - copied), chunkEnd - within));
+        memcpy(bytes + copied, this->plain.data() + within, n);
+        copied += n;
+        offset += n;
+    }
+    return copied;
+}
+
+uint64_t EncryptedReader::getFailureCount() const {
+    return this->failureCount;
+}
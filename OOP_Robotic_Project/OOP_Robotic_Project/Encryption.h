@@ -1 +1,309 @@
 #pragma once
+/**
+ * @file   Encryption.h
+ * @date   October, 2026
+ * @brief  Header file for the Encryption, EncryptedWriter and EncryptedReader classes.
+ *
+ * This file contains the definition of the ChaCha20-Poly1305 authenticated encryption
+ * (RFC 8439) used for operator commands and recorded runs, and of the chunked file
+ * format that lets a run be encrypted on a background thread and read back at any
+ * offset.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! Encryption class
+/*!
+ * @brief ChaCha20-Poly1305 authenticated encryption with associated data.
+ *
+ * seal() encrypts a message with ChaCha20 and appends a 16-byte Poly1305 tag over the
+ * associated data and the ciphertext; open() checks the tag in constant time before
+ * it decrypts anything, so a changed, truncated or misplaced message is rejected
+ * whole. A nonce must never be used twice with the same key: operator commands use
+ * makeNonce() with a per-direction prefix and the command sequence number, and
+ * encrypted files use a fresh key per file (see EncryptedWriter).
+ *
+ * ChaCha20 computes 8 blocks at once with AVX2 (4 with SSE2): each vector holds the
+ * same state word of consecutive blocks, so the rounds are plain vector additions,
+ * xors and rotations, and the blocks are transposed back to bytes at the end.
+ * Poly1305 uses 26-bit limbs and 64-bit products, which every compiler supports.
+ */
+class Encryption {
+public:
+    static const int KEY_SIZE = 32;   /*!< Key bytes. */
+    static const int NONCE_SIZE = 12; /*!< Nonce bytes. */
+    static const int TAG_SIZE = 16;   /*!< Authentication tag bytes appended by seal(). */
+
+private:
+    uint32_t key[8]; /*!< Key as little-endian words. */
+
+    Encryption(const Encryption&) = delete;
+    Encryption& operator=(const Encryption&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param key KEY_SIZE bytes of key.
+    */
+    Encryption(const uint8_t* key);
+
+    //! Destructor
+    /*!
+    * Clears the key.
+    */
+    ~Encryption();
+
+    //! seal function
+    /*!
+    * Encrypts and authenticates a message.
+    * @param nonce NONCE_SIZE bytes, never reused with this key.
+    * @param aad Associated data, authenticated but not encrypted; may be nullptr if aadSize is 0.
+    * @param aadSize Bytes of associated data.
+    * @param in Plaintext.
+    * @param size Bytes of plaintext.
+    * @param out Receives size bytes of ciphertext and then the tag; may be in.
+    */
+    void seal(const uint8_t* nonce, const uint8_t* aad, size_t aadSize, const uint8_t* in, size_t size, uint8_t* out) const;
+
+    //! open function
+    /*!
+    * Checks and decrypts a message sealed by seal().
+    * @param sealedSize Bytes of ciphertext and tag.
+    * @param out Receives sealedSize - TAG_SIZE bytes of plaintext; may be in.
+    * @return false, leaving out untouched, if the tag does not match.
+    */
+    bool open(const uint8_t* nonce, const uint8_t* aad, size_t aadSize, const uint8_t* in, size_t sealedSize, uint8_t* out) const;
+
+    //! makeNonce function
+    /*!
+    * Writes a nonce made of a 32-bit prefix and a 64-bit counter, both little endian.
+    */
+    static void makeNonce(uint32_t prefix, uint64_t counter, uint8_t* nonce);
+
+    //! chacha20 function
+    /*!
+    * XORs a message with the ChaCha20 key stream starting at block counter.
+    * @param key KEY_SIZE bytes.
+    * @param nonce NONCE_SIZE bytes.
+    */
+    static void chacha20(const uint8_t* key, const uint8_t* nonce, uint32_t counter, const uint8_t* in, uint8_t* out, size_t size);
+
+    //! poly1305 function
+    /*!
+    * Computes the Poly1305 tag of a message with a one-time key.
+    * @param key 32 bytes, used for one message only.
+    * @param tag Receives TAG_SIZE bytes.
+    */
+    static void poly1305(const uint8_t* key, const uint8_t* message, size_t size, uint8_t* tag);
+};
+
+//! EncryptedFileHeader struct
+/*!
+ * @brief First 64 bytes of an encrypted file, authenticated with every chunk.
+ */
+struct EncryptedFileHeader {
+    static const uint32_t VERSION = 1; /*!< Current file format version. */
+
+    char magic[8];        /*!< "RCSENC" followed by two zero bytes. */
+    uint32_t version;     /*!< File format version. */
+    uint32_t headerSize;  /*!< Size of this header, where the first chunk starts. */
+    uint32_t chunkSize;   /*!< Plaintext bytes per chunk; every chunk but the last is full. */
+    uint32_t reserved0;   /*!< Zero. */
+    uint8_t salt[16];     /*!< Random bytes the file key is derived from. */
+    uint32_t reserved[6]; /*!< Zero. */
+};
+
+//! EncryptedWriter class
+/*!
+ * @brief Writes a byte stream to a file as independently sealed chunks.
+ *
+ * The file key is derived from the caller's key and a random salt stored in the
+ * header, so every file has its own key and chunk i can simply use nonce i. Each
+ * chunk is sealed with the header and a last-chunk flag as associated data: a chunk
+ * cannot be moved to another position or file, and a file cut after a whole chunk is
+ * detected because its final chunk is missing.
+ *
+ * write() only copies into the chunk being filled. Full chunks are handed to a
+ * background thread that seals and writes them, through a small set of buffers; the
+ * writer only waits when all of them are queued, which is counted in
+ * getStallCount(). write() and close() must be called from the same thread.
+ */
+class EncryptedWriter {
+public:
+    static const uint32_t DEFAULT_CHUNK_SIZE = 1 << 20; /*!< Default plaintext bytes per chunk. */
+    static const int BUFFER_COUNT = 4;                  /*!< Chunks that can be filled or queued at once. */
+
+private:
+    //! Chunk struct
+    /*!
+     * @brief A plaintext chunk buffer.
+     */
+    struct Chunk {
+        std::vector<uint8_t> data; /*!< Plaintext, chunkSize bytes reserved. */
+        size_t size;               /*!< Bytes filled. */
+        uint64_t index;            /*!< Position of the chunk in the file. */
+        bool last;                 /*!< Final chunk of the file. */
+    };
+
+    std::ofstream file;              /*!< Output file, written by the background thread. */
+    EncryptedFileHeader header;      /*!< Header of the file. */
+    uint8_t fileKey[Encryption::KEY_SIZE]; /*!< Key derived for this file. */
+    uint32_t chunkSize;              /*!< Plaintext bytes per chunk. */
+    Chunk chunks[BUFFER_COUNT];      /*!< Chunk buffers. */
+    int filling;                     /*!< Chunk written by write(), -1 if none. */
+    uint64_t chunkCount;             /*!< Chunks handed to the background thread. */
+    uint64_t bytesWritten;           /*!< Plaintext bytes accepted by write(). */
+    uint64_t stallCount;             /*!< write() calls that waited for a free chunk. */
+
+    std::mutex queueLock;            /*!< Guards the fields below. */
+    std::condition_variable wake;    /*!< Wakes the background thread. */
+    std::condition_variable freed;   /*!< Signals that a chunk buffer is free again. */
+    std::vector<int> queue;          /*!< Full chunks in file order. */
+    std::vector<int> freeChunks;     /*!< Chunks that can be filled. */
+    bool stopping;                   /*!< Tells the background thread to exit once the queue is empty. */
+    std::atomic<bool> failed;        /*!< A write to the file failed; read by write() without the lock. */
+    std::thread sealer;              /*!< Background thread. */
+
+    //! takeChunk function
+    /*!
+    * Makes a free chunk the one being filled, waiting if there is none.
+    */
+    void takeChunk();
+
+    //! submitChunk function
+    /*!
+    * Queues the chunk being filled for the background thread.
+    */
+    void submitChunk(bool last);
+
+    //! sealLoop function
+    /*!
+    * Body of the background thread.
+    */
+    void sealLoop();
+
+    EncryptedWriter(const EncryptedWriter&) = delete;
+    EncryptedWriter& operator=(const EncryptedWriter&) = delete;
+
+public:
+    //! Default constructor
+    EncryptedWriter();
+
+    //! Destructor
+    /*!
+    * Closes the file if it is open.
+    */
+    ~EncryptedWriter();
+
+    //! open function
+    /*!
+    * Creates or truncates a file and starts the background thread.
+    * @param path File name.
+    * @param key Encryption::KEY_SIZE bytes of key.
+    * @param chunkSize Plaintext bytes per chunk.
+    * @return true on success.
+    */
+    bool open(const std::string& path, const uint8_t* key, uint32_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    //! write function
+    /*!
+    * Appends bytes to the stream.
+    * @return false if the file is not open or a write failed.
+    */
+    bool write(const void* data, size_t size);
+
+    //! close function
+    /*!
+    * Seals the final chunk, waits for the background thread and closes the file.
+    * @return false if any write failed.
+    */
+    bool close();
+
+    //! isOpen function
+    bool isOpen() const;
+
+    //! getBytesWritten function
+    /*!
+    * @return the plaintext bytes accepted so far.
+    */
+    uint64_t getBytesWritten() const;
+
+    //! getStallCount function
+    uint64_t getStallCount() const;
+};
+
+//! EncryptedReader class
+/*!
+ * @brief Reads any byte range of a file written by EncryptedWriter.
+ *
+ * Chunk i starts at a fixed offset, so read() only loads, checks and decrypts the
+ * chunks the range touches. The last chunk decrypted is kept, so reading a file in
+ * order decrypts every chunk once.
+ */
+class EncryptedReader {
+private:
+    std::ifstream file;            /*!< Input file. */
+    EncryptedFileHeader header;    /*!< Header of the file. */
+    uint8_t fileKey[Encryption::KEY_SIZE]; /*!< Key derived for this file. */
+    uint64_t chunkCount;           /*!< Chunks in the file. */
+    uint64_t size;                 /*!< Plaintext bytes in the file. */
+    std::vector<uint8_t> sealed;   /*!< Sealed chunk read from the file. */
+    std::vector<uint8_t> plain;    /*!< Decrypted chunk. */
+    int64_t cachedChunk;           /*!< Chunk held in plain, -1 if none. */
+    uint64_t failureCount;         /*!< Chunks that failed authentication. */
+
+    //! loadChunk function
+    /*!
+    * Reads, checks and decrypts chunk index into plain.
+    * @return false if the chunk cannot be read or fails authentication.
+    */
+    bool loadChunk(uint64_t index);
+
+    EncryptedReader(const EncryptedReader&) = delete;
+    EncryptedReader& operator=(const EncryptedReader&) = delete;
+
+public:
+    //! Default constructor
+    EncryptedReader();
+
+    //! Destructor
+    ~EncryptedReader();
+
+    //! open function
+    /*!
+    * Opens a file and derives its key.
+    * @return false if the file cannot be read or is not an encrypted file.
+    */
+    bool open(const std::string& path, const uint8_t* key);
+
+    //! close function
+    void close();
+
+    //! isOpen function
+    bool isOpen() const;
+
+    //! getSize function
+    /*!
+    * @return the plaintext bytes in the file.
+    */
+    uint64_t getSize() const;
+
+    //! read function
+    /*!
+    * Copies plaintext bytes [offset, offset + count) to out.
+    * @return the bytes copied, which is less than count at the end of the file or if a
+    * chunk fails authentication.
+    */
+    size_t read(uint64_t offset, void* out, size_t count);
+
+    //! getFailureCount function
+    uint64_t getFailureCount() const;
+};
@@ -0,0 +1,60 @@
+/**
+ * @file   FestoRobotInterface.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the FestoRobotInterface class.
+ */
+
+#include "FestoRobotInterface.h"
+
+#ifdef ROBOT_USE_FESTO_API
+
+/**
+ * @brief Parameterized Constructor.
+ * @param api Pointer to the FestoRobotAPI object to forward calls to.
+ */
+FestoRobotInterface::FestoRobotInterface(FestoRobotAPI* api) : robotAPI(api) {}
+
+/**
+ * @brief Returns the wrapped FestoRobotAPI object.
+ */
+FestoRobotAPI* FestoRobotInterface::getAPI() {
+    return this->robotAPI;
+}
+
+void FestoRobotInterface::connect() {
+    this->robotAPI->connect();
+}
+
+void FestoRobotInterface::disconnect() {
+    this->robotAPI->disconnect();
+}
+
+void FestoRobotInterface::move(DIRECTION direction) {
+    this->robotAPI->move(direction);
+}
+
+void FestoRobotInterface::rotate(DIRECTION direction) {
+    this->robotAPI->rotate(direction);
+}
+
+void FestoRobotInterface::stop() {
+    this->robotAPI->stop();
+}
+
+double FestoRobotInterface::getIRRange(int i) {
+    return this->robotAPI->getIRRange(i);
+}
+
+void FestoRobotInterface::getXYTh(double& X, double& Y, double& TH) {
+    this->robotAPI->getXYTh(X, Y, TH);
+}
+
+void FestoRobotInterface::getLidarRange(float* ranges) {
+    this->robotAPI->getLidarRange(ranges);
+}
+
+int FestoRobotInterface::getLidarRangeNumber() {
+    return this->robotAPI->getLidarRangeNumber();
+}
+
+#endif
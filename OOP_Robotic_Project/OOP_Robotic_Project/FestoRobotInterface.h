@@ -0,0 +1,50 @@
+#pragma once
+/**
+ * @file   FestoRobotInterface.h
+ * @date   October, 2026
+ * @brief  Header file for the FestoRobotInterface class.
+ *
+ * This file contains the definition of the FestoRobotInterface class, which adapts the
+ * prebuilt FestoRobotAPI to the RobotInterface abstraction.
+ */
+
+#include "RobotInterface.h"
+
+#ifdef ROBOT_USE_FESTO_API
+
+//! FestoRobotInterface class
+/*!
+ * @brief Forwards every RobotInterface call to a FestoRobotAPI object.
+ *
+ * The FestoRobotAPI object is not owned; the caller keeps it alive for the lifetime
+ * of the adapter, in the same way RobotControler uses it.
+ */
+class FestoRobotInterface : public RobotInterface {
+private:
+    FestoRobotAPI* robotAPI; /*!< Pointer to the wrapped FestoRobotAPI object. */
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param api Pointer to the FestoRobotAPI object to forward calls to.
+    */
+    FestoRobotInterface(FestoRobotAPI* api);
+
+    //! getAPI function
+    /*!
+    * @return the wrapped FestoRobotAPI object.
+    */
+    FestoRobotAPI* getAPI();
+
+    void connect() override;
+    void disconnect() override;
+    void move(DIRECTION direction) override;
+    void rotate(DIRECTION direction) override;
+    void stop() override;
+    double getIRRange(int i) override;
+    void getXYTh(double& X, double& Y, double& TH) override;
+    void getLidarRange(float* ranges) override;
+    int getLidarRangeNumber() override;
+};
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file   FleetManager.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the FleetManager class.
+ */
+
+#include <algorithm>
+#include "FleetManager.h"
+
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor. The fleet starts without robots.
+ */
+FleetManager::FleetManager(const SimulationWorld* world, int threadCount, int lidarCount, int lidarPeriod)
+    : world(world), pool(threadCount), lidarCount(max(lidarCount, 0)), lidarPeriod(max(lidarPeriod, 1)), grain(8),
+      robotSteps(0) {
+}
+
+/**
+ * @brief Destructor. Deletes the objects of every robot, controller first.
+ */
+FleetManager::~FleetManager() {
+    for (FleetRobot& slot : this->robots) {
+        delete slot.navigation;
+        slot.controler->disconnectRobot();
+        delete slot.controler;
+        delete slot.robot;
+        delete[] slot.scan;
+    }
+}
+
+/**
+ * @brief Creates a robot, its controller and its safety layer.
+ *
+ * The first step takes a lidar scan, so the initial scan of zeros is never used.
+ */
+int FleetManager::addRobot(double x, double y, double th) {
+    FleetRobot slot;
+    slot.robot = new SimulatedRobot(this->world, this->lidarCount);
+    slot.robot->setPose(x, y, th);
+    slot.controler = new RobotControler(slot.robot, Pose(x, y, th));
+    slot.navigation = new SafeNavigation(slot.controler);
+    slot.navigation->setLidarGeometry(LidarGeometry::fullCircle(this->lidarCount), this->lidarCount);
+    slot.scan = new float[max(this->lidarCount, 1)]();
+    fill(slot.ir, slot.ir + SimulatedRobot::IR_COUNT, SimulatedRobot::IR_MAX_RANGE);
+    slot.turn = COMMAND_TURN_LEFT;
+    slot.turnSteps = 0;
+    slot.steps = 0;
+    slot.blocked = 0;
+    this->robots.push_back(slot);
+    return static_cast<int>(this->robots.size()) - 1;
+}
+
+void FleetManager::setGrain(int robots) {
+    this->grain = max(robots, 1);
+}
+
+/**
+ * @brief Runs the sense-plan-act step of one robot.
+ *
+ * A blocked forward move starts a turn of 0.2 to 0.8 s; its side and length depend on
+ * the robot and its step count only, so the run is the same on any number of threads.
+ */
+void FleetManager::stepRobot(int index) {
+    FleetRobot& slot = this->robots[index];
+    SimulatedRobot* robot = slot.robot;
+
+    for (int i = 0; i < SimulatedRobot::IR_COUNT; i++) {
+        slot.ir[i] = robot->getIRRange(i);
+    }
+    if (slot.steps % this->lidarPeriod == 0) {
+        robot->getLidarRange(slot.scan);
+    }
+    slot.navigation->update(slot.ir, slot.scan, this->lidarCount);
+
+    RobotCommand wanted = slot.turnSteps > 0 ? slot.turn : COMMAND_MOVE_FORWARD;
+    RobotCommand running = slot.navigation->tick(wanted);
+    if (slot.turnSteps > 0) {
+        slot.turnSteps--;
+    }
+    else if (running != COMMAND_MOVE_FORWARD) {
+        slot.blocked++;
+        slot.turn = (index + slot.blocked) % 2 == 0 ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT;
+        slot.turnSteps = 20 + static_cast<int>((index * 7 + slot.steps) % 60);
+    }
+
+    robot->step();
+    slot.steps++;
+}
+
+/**
+ * @brief Runs one step of every robot on the pool.
+ */
+void FleetManager::step() {
+    this->pool.parallelFor(static_cast<int>(this->robots.size()), this->grain, [this](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            stepRobot(i);
+        }
+    });
+    this->robotSteps += this->robots.size();
+}
+
+void FleetManager::run(int steps) {
+    for (int i = 0; i < steps; i++) {
+        step();
+    }
+}
+
+int FleetManager::getRobotCount() const {
+    return static_cast<int>(this->robots.size());
+}
+
+const FleetRobot& FleetManager::getRobot(int index) const {
+    return this->robots[index];
+}
+
+unsigned long long FleetManager::getRobotStepCount() const {
+    return this->robotSteps;
+}
+
+const WorkStealingPool& FleetManager::getPool() const {
+    return this->pool;
+}
@@ -0,0 +1,132 @@
+#pragma once
+/**
+ * @file   FleetManager.h
+ * @date   October, 2026
+ * @brief  Header file for the FleetManager class.
+ *
+ * This file contains the definition of the FleetManager class, which hosts many
+ * simulated robots, each with its own RobotControler and SafeNavigation, and steps
+ * them on a WorkStealingPool.
+ */
+
+#include <vector>
+#include "RobotControler.h"
+#include "SafeNavigation.h"
+#include "SimulatedRobot.h"
+#include "WorkStealingPool.h"
+
+//! FleetRobot struct
+/*!
+ * @brief State of one robot of a fleet.
+ *
+ * The objects of a robot live on the heap and its state that changes every step is
+ * here, in a slot aligned to its own cache lines, so two workers stepping neighboring
+ * robots never write to the same line.
+ */
+struct alignas(64) FleetRobot {
+    SimulatedRobot* robot;        /*!< Simulated backend. */
+    RobotControler* controler;    /*!< Controller driving the backend. */
+    SafeNavigation* navigation;   /*!< Safety layer in front of the controller. */
+    float* scan;                  /*!< Last lidar scan. */
+    double ir[SimulatedRobot::IR_COUNT]; /*!< IR ranges of the last step. */
+    RobotCommand turn;            /*!< Turn the wander policy is making. */
+    int turnSteps;                /*!< Steps left in the current turn, 0 when driving forward. */
+    unsigned long long steps;     /*!< Steps taken. */
+    unsigned long long blocked;   /*!< Forward moves SafeNavigation did not let through. */
+};
+
+//! FleetManager class
+/*!
+ * @brief Runs the sense-plan-act step of many robots in parallel.
+ *
+ * All robots move in one SimulationWorld that the caller owns; robots do not see or hit
+ * each other. step() runs one step of every robot as a parallelFor() over the robots,
+ * grain robots per chunk:
+ * - sense: read the IR ranges and, every lidarPeriod steps, a lidar scan;
+ * - plan: drive forward, and after SafeNavigation blocks a forward move turn in place
+ *   for a while;
+ * - act: pass the command through SafeNavigation::tick() to the RobotControler, then
+ *   advance the SimulatedRobot by one time step.
+ *
+ * A robot's step only reads the shared world and writes its own objects, so steps of
+ * different robots run in any order on any worker and the fleet ends up in the same
+ * state whatever the number of threads.
+ */
+class FleetManager {
+private:
+    const SimulationWorld* world;  /*!< Walls the robots move among. */
+    WorkStealingPool pool;         /*!< Workers that run the steps. */
+    std::vector<FleetRobot> robots; /*!< One slot per robot. */
+    int lidarCount;                /*!< Beams per lidar scan. */
+    int lidarPeriod;               /*!< Steps between lidar scans. */
+    int grain;                     /*!< Robots per chunk of a step. */
+    unsigned long long robotSteps; /*!< Robot steps taken by step(). */
+
+    //! stepRobot function
+    /*!
+    * Runs the sense-plan-act step of one robot.
+    */
+    void stepRobot(int index);
+
+    FleetManager(const FleetManager&) = delete;
+    FleetManager& operator=(const FleetManager&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param world Walls the robots move among, prepared; it must outlive the fleet.
+    * @param threadCount Workers, the calling thread included; 0 for one per hardware thread.
+    * @param lidarCount Beams per lidar scan of every robot.
+    * @param lidarPeriod Steps between lidar scans.
+    */
+    FleetManager(const SimulationWorld* world, int threadCount = 0, int lidarCount = 90, int lidarPeriod = 10);
+
+    //! Destructor
+    /*!
+    * Disconnects and deletes the robots.
+    */
+    ~FleetManager();
+
+    //! addRobot function
+    /*!
+    * Creates a connected robot at a pose; robots must not be added during step().
+    * @return the index of the robot.
+    */
+    int addRobot(double x, double y, double th);
+
+    //! setGrain function
+    /*!
+    * @param robots Robots per chunk of a step, at least 1.
+    */
+    void setGrain(int robots);
+
+    //! step function
+    /*!
+    * Runs one step of every robot and returns when all of them are done.
+    */
+    void step();
+
+    //! run function
+    /*!
+    * Runs a number of steps.
+    */
+    void run(int steps);
+
+    //! getRobotCount function
+    int getRobotCount() const;
+
+    //! getRobot function
+    /*!
+    * @return the state of a robot; index must be valid.
+    */
+    const FleetRobot& getRobot(int index) const;
+
+    //! getRobotStepCount function
+    /*!
+    * @return the robot steps taken, the number of robots times the steps of the fleet.
+    */
+    unsigned long long getRobotStepCount() const;
+
+    //! getPool function
+    const WorkStealingPool& getPool() const;
+};
@@ -0,0 +1,242 @@
+/**
+ * @file   IRSensor.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the IRSensor class.
+ */
+
+#include "IRSensor.h"
+#include "Metrics.h"
+
+#if defined(__AVX__)
+#define IRSENSOR_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IRSENSOR_SSE
+#include <emmintrin.h>
+#endif
+
+const float IRSensor::OUT_OF_RANGE = 1.0e30f;
+
+/**
+ * @brief Sector of each sensor, indexed by sensor number.
+ */
+static const DIRECTION SENSOR_SECTOR[IRSensor::SENSOR_COUNT] = {
+    FORWARD, FORWARD, LEFT, LEFT, BACKWARD, BACKWARD, RIGHT, RIGHT, FORWARD
+};
+
+#if defined(IRSENSOR_AVX) || defined(IRSENSOR_SSE)
+/**
+ * @brief Folds a 16-lane padded bank into 4 lanes: lane k holds the minimum of lanes k, k+4, k+8, k+12.
+ */
+static inline __m128 foldBank(const float* values, const float* pad) {
+#if defined(IRSENSOR_AVX)
+    __m256 low = _mm256_add_ps(_mm256_load_ps(values), _mm256_load_ps(pad));
+    __m256 high = _mm256_add_ps(_mm256_load_ps(values + 8), _mm256_load_ps(pad + 8));
+    __m256 both = _mm256_min_ps(low, high);
+    return _mm_min_ps(_mm256_castps256_ps128(both), _mm256_extractf128_ps(both, 1));
+#else
+    __m128 a = _mm_add_ps(_mm_load_ps(values), _mm_load_ps(pad));
+    __m128 b = _mm_add_ps(_mm_load_ps(values + 4), _mm_load_ps(pad + 4));
+    __m128 c = _mm_add_ps(_mm_load_ps(values + 8), _mm_load_ps(pad + 8));
+    __m128 d = _mm_add_ps(_mm_load_ps(values + 12), _mm_load_ps(pad + 12));
+    return _mm_min_ps(_mm_min_ps(a, b), _mm_min_ps(c, d));
+#endif
+}
+
+/**
+ * @brief Folds a 16-lane bank without padding into 4 lanes.
+ */
+static inline __m128 foldValues(const float* values) {
+#if defined(IRSENSOR_AVX)
+    __m256 both = _mm256_min_ps(_mm256_load_ps(values), _mm256_load_ps(values + 8));
+    return _mm_min_ps(_mm256_castps256_ps128(both), _mm256_extractf128_ps(both, 1));
+#else
+    return _mm_min_ps(_mm_min_ps(_mm_load_ps(values), _mm_load_ps(values + 4)),
+                      _mm_min_ps(_mm_load_ps(values + 8), _mm_load_ps(values + 12)));
+#endif
+}
+
+/**
+ * @brief Minimum of the 4 lanes of v.
+ */
+static inline float horizontalMin(__m128 v) {
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(v);
+}
+
+/**
+ * @brief Minimum of every sector in one vector, lane d holds the sector of DIRECTION d.
+ */
+static inline __m128 sectorMinimums(const float* values, const float (*pad)[IRSensor::LANES]) {
+    __m128 s0 = foldBank(values, pad[0]);
+    __m128 s1 = foldBank(values, pad[1]);
+    __m128 s2 = foldBank(values, pad[2]);
+    __m128 s3 = foldBank(values, pad[3]);
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+    return _mm_min_ps(_mm_min_ps(s0, s1), _mm_min_ps(s2, s3));
+}
+#else
+/**
+ * @brief Scalar minimum of a padded bank.
+ */
+static inline float scalarMin(const float* values, const float* pad) {
+    float result = IRSensor::OUT_OF_RANGE;
+    for (int i = 0; i < IRSensor::LANES; i++) {
+        float v = values[i] + pad[i];
+        result = v < result ? v : result;
+    }
+    return result;
+}
+#endif
+
+/**
+ * @brief Parameterized Constructor.
+ * Fills the bank with OUT_OF_RANGE and builds the sector padding tables.
+ * @param api Robot API the ranges are read from.
+ */
+IRSensor::IRSensor(RobotInterface* api) {
+    this->robotAPI = api;
+    for (int i = 0; i < LANES; i++) {
+        this->ranges[i] = OUT_OF_RANGE;
+        this->angles[i] = i < SENSOR_COUNT ? i * 40.0f * 3.14159265f / 180.0f : 0.0f;
+        for (int d = 0; d < SECTOR_COUNT; d++) {
+            bool member = i < SENSOR_COUNT && SENSOR_SECTOR[i] == d;
+            this->sectorPad[d][i] = member ? 0.0f : OUT_OF_RANGE;
+        }
+    }
+}
+
+/**
+ * @brief Reads all 9 ranges from the robot API.
+ */
+void IRSensor::refresh() {
+    double values[SENSOR_COUNT];
+    {
+        METRIC_SCOPE("sensor_ir_read");
+        for (int i = 0; i < SENSOR_COUNT; i++) {
+            values[i] = this->robotAPI->getIRRange(i);
+        }
+    }
+    load(values);
+}
+
+/**
+ * @brief Fills the bank from ranges that were already read.
+ * @param values Array of SENSOR_COUNT ranges in meters.
+ */
+void IRSensor::load(const double* values) {
+#if defined(IRSENSOR_AVX) || defined(IRSENSOR_SSE)
+    // Whole-vector stores, so the following vector loads are forwarded from the store buffer.
+    __m128 last = _mm_cvtsd_ss(_mm_set1_ps(OUT_OF_RANGE), _mm_load_sd(values + 8));
+#if defined(IRSENSOR_AVX)
+    __m256 first = _mm256_castps128_ps256(_mm256_cvtpd_ps(_mm256_loadu_pd(values)));
+    _mm256_store_ps(this->ranges, _mm256_insertf128_ps(first, _mm256_cvtpd_ps(_mm256_loadu_pd(values + 4)), 1));
+    _mm256_store_ps(this->ranges + 8, _mm256_insertf128_ps(_mm256_castps128_ps256(last), _mm_set1_ps(OUT_OF_RANGE), 1));
+#else
+    _mm_store_ps(this->ranges, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(values)), _mm_cvtpd_ps(_mm_loadu_pd(values + 2))));
+    _mm_store_ps(this->ranges + 4, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(values + 4)), _mm_cvtpd_ps(_mm_loadu_pd(values + 6))));
+    _mm_store_ps(this->ranges + 8, last);
+#endif
+#else
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        this->ranges[i] = static_cast<float>(values[i]);
+    }
+#endif
+}
+
+float IRSensor::getRange(int i) const {
+    return this->ranges[i];
+}
+
+float IRSensor::getAngle(int i) const {
+    return this->angles[i];
+}
+
+/**
+ * @brief Returns the smallest range of all sensors.
+ */
+float IRSensor::minRange() const {
+#if defined(IRSENSOR_AVX) || defined(IRSENSOR_SSE)
+    return horizontalMin(foldValues(this->ranges));
+#else
+    float result = OUT_OF_RANGE;
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        result = this->ranges[i] < result ? this->ranges[i] : result;
+    }
+    return result;
+#endif
+}
+
+/**
+ * @brief Returns the smallest range in a sector.
+ * @param sector Sector to check.
+ */
+float IRSensor::sectorMin(DIRECTION sector) const {
+#if defined(IRSENSOR_AVX) || defined(IRSENSOR_SSE)
+    return horizontalMin(foldBank(this->ranges, this->sectorPad[sector]));
+#else
+    return scalarMin(this->ranges, this->sectorPad[sector]);
+#endif
+}
+
+/**
+ * @brief Checks whether any sensor reads less than threshold.
+ * @param threshold Distance in meters.
+ */
+bool IRSensor::anyBelow(float threshold) const {
+#if defined(IRSENSOR_AVX)
+    __m256 limit = _mm256_set1_ps(threshold);
+    __m256 low = _mm256_cmp_ps(_mm256_load_ps(this->ranges), limit, _CMP_LT_OQ);
+    __m256 high = _mm256_cmp_ps(_mm256_load_ps(this->ranges + 8), limit, _CMP_LT_OQ);
+    return _mm256_movemask_ps(_mm256_or_ps(low, high)) != 0;
+#elif defined(IRSENSOR_SSE)
+    __m128 limit = _mm_set1_ps(threshold);
+    __m128 a = _mm_cmplt_ps(_mm_load_ps(this->ranges), limit);
+    __m128 b = _mm_cmplt_ps(_mm_load_ps(this->ranges + 4), limit);
+    __m128 c = _mm_cmplt_ps(_mm_load_ps(this->ranges + 8), limit);
+    __m128 d = _mm_cmplt_ps(_mm_load_ps(this->ranges + 12), limit);
+    return _mm_movemask_ps(_mm_or_ps(_mm_or_ps(a, b), _mm_or_ps(c, d))) != 0;
+#else
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        if (this->ranges[i] < threshold) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+
+/**
+ * @brief Checks whether any sensor of a sector reads less than threshold.
+ * @param sector Sector to check.
+ * @param threshold Distance in meters.
+ */
+bool IRSensor::anyBelow(DIRECTION sector, float threshold) const {
+    return sectorMin(sector) < threshold;
+}
+
+/**
+ * @brief Computes the overall minimum, every sector minimum and the threshold check.
+ *
+ * The four sector minimums are reduced together with a 4x4 transpose, so the whole
+ * evaluation is a handful of vector instructions.
+ * @param threshold Distance in meters.
+ * @param result Receives the evaluation.
+ */
+void IRSensor::evaluate(float threshold, IREvaluation& result) const {
+#if defined(IRSENSOR_AVX) || defined(IRSENSOR_SSE)
+    __m128 sectors = sectorMinimums(this->ranges, this->sectorPad);
+    _mm_storeu_ps(result.sectorMin, sectors);
+    result.minRange = horizontalMin(sectors);
+    result.anyBelow = _mm_movemask_ps(_mm_cmplt_ps(sectors, _mm_set1_ps(threshold))) != 0;
+#else
+    float overall = OUT_OF_RANGE;
+    for (int d = 0; d < SECTOR_COUNT; d++) {
+        result.sectorMin[d] = scalarMin(this->ranges, this->sectorPad[d]);
+        overall = result.sectorMin[d] < overall ? result.sectorMin[d] : overall;
+    }
+    result.minRange = overall;
+    result.anyBelow = overall < threshold;
+#endif
+}
@@ -1 +1,120 @@
 #pragma once
+/**
+ * @file   IRSensor.h
+ * @date   October, 2026
+ * @brief  Header file for the IRSensor class.
+ *
+ * This file contains the definition of the IRSensor class, which keeps the ranges of
+ * the 9 IR sensors in one aligned bank and evaluates safety checks on it with SIMD.
+ */
+
+#include "RobotInterface.h"
+
+//! IREvaluation struct
+/*!
+ * @brief Result of one full evaluation of the IR bank.
+ */
+struct IREvaluation {
+    float minRange;       /*!< Smallest range of all sensors (meters). */
+    float sectorMin[4];   /*!< Smallest range per sector, indexed by DIRECTION (meters). */
+    bool anyBelow;        /*!< True if any sensor is below the threshold. */
+};
+
+//! IRSensor class
+/*!
+ * @brief Bank of the 9 IR ranges with vectorized min and threshold checks.
+ *
+ * The sensors sit 40 degrees apart, counterclockwise from sensor 0 at the front.
+ * They are grouped into sectors indexed by DIRECTION:
+ * FORWARD {8, 0, 1}, LEFT {2, 3}, BACKWARD {4, 5}, RIGHT {6, 7}.
+ *
+ * Ranges are stored as a structure of arrays: one aligned float array padded to
+ * LANES entries, with a per-sector padding array that pushes sensors outside the
+ * sector out of range. Every check then runs over whole vectors with no per-index
+ * branches. AVX is used when the compiler targets it, SSE2 otherwise, and a scalar
+ * loop on other targets.
+ */
+class IRSensor {
+public:
+    static const int SENSOR_COUNT = 9;  /*!< Number of IR sensors on the robot. */
+    static const int LANES = 16;        /*!< Padded bank size, two AVX or four SSE vectors. */
+    static const int SECTOR_COUNT = 4;  /*!< Number of sectors, one per DIRECTION. */
+
+private:
+    RobotInterface* robotAPI;                       /*!< Robot API the ranges are read from. */
+    alignas(32) float ranges[LANES];                /*!< Ranges in meters, padding lanes hold OUT_OF_RANGE. */
+    alignas(32) float angles[LANES];                /*!< Mounting angle of each sensor (radians, counterclockwise from the front). */
+    alignas(32) float sectorPad[SECTOR_COUNT][LANES]; /*!< 0 for sensors in the sector, OUT_OF_RANGE for the rest. */
+
+public:
+    static const float OUT_OF_RANGE; /*!< Value that is larger than any real range. */
+
+    //! Parameterized Constructor
+    /*!
+    * @param api Robot API the ranges are read from, may be nullptr if the bank is filled with load().
+    */
+    IRSensor(RobotInterface* api = nullptr);
+
+    //! refresh function
+    /*!
+    * Reads all 9 ranges from the robot API in one call.
+    */
+    void refresh();
+
+    //! load function
+    /*!
+    * Fills the bank from 9 ranges that were already read, e.g. SensorSnapshot::ir.
+    * @param values Array of SENSOR_COUNT ranges in meters.
+    */
+    void load(const double* values);
+
+    //! getRange function
+    /*!
+    * @param i Sensor index.
+    * @return the range of sensor i in meters.
+    */
+    float getRange(int i) const;
+
+    //! getAngle function
+    /*!
+    * @param i Sensor index.
+    * @return the mounting angle of sensor i in radians.
+    */
+    float getAngle(int i) const;
+
+    //! minRange function
+    /*!
+    * @return the smallest range of all sensors.
+    */
+    float minRange() const;
+
+    //! sectorMin function
+    /*!
+    * @param sector Sector to check.
+    * @return the smallest range in the sector.
+    */
+    float sectorMin(DIRECTION sector) const;
+
+    //! anyBelow function
+    /*!
+    * @param threshold Distance in meters.
+    * @return true if any sensor reads less than threshold.
+    */
+    bool anyBelow(float threshold) const;
+
+    //! anyBelow function
+    /*!
+    * @param sector Sector to check.
+    * @param threshold Distance in meters.
+    * @return true if any sensor of the sector reads less than threshold.
+    */
+    bool anyBelow(DIRECTION sector, float threshold) const;
+
+    //! evaluate function
+    /*!
+    * Computes the overall minimum, every sector minimum and the threshold check in one pass.
+    * @param threshold Distance in meters.
+    * @param result Receives the evaluation.
+    */
+    void evaluate(float threshold, IREvaluation& result) const;
+};
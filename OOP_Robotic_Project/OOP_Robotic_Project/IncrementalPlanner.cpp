@@ -0,0 +1,342 @@
+/**
+ * @file   IncrementalPlanner.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the IncrementalPlanner class.
+ */
+
+#include <cstdlib>
+#include "IncrementalPlanner.h"
+#include "Metrics.h"
+using namespace std;
+
+static const float DIAGONAL = 1.41421356f;
+
+/** Relative margin above the start key that is still expanded, see computeShortestPath(). */
+static const float KEY_SLACK = 1e-5f;
+
+/** Neighbour offsets: the four sides first, then the four corners. */
+static const int NEIGHBOUR_X[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+static const int NEIGHBOUR_Y[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+/**
+ * @brief Octile distance between two cells, the same heuristic as PathPlanner::plan().
+ */
+static float octile(int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int diagonal = dx < dy ? dx : dy;
+    return static_cast<float>(dx + dy) + (DIAGONAL - 2.0f) * diagonal;
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * The planner is not copied; its costs are read at every step of the search.
+ */
+IncrementalPlanner::IncrementalPlanner(PathPlanner& planner)
+    : planner(planner), epoch(0), updates(0), width(0), height(0), start{ -1, -1 }, goal{ -1, -1 },
+      goalIndex(-1), km(0.0f), expanded(0) {
+}
+
+/**
+ * @brief Returns the state of a cell, resetting it when it belongs to an older goal.
+ */
+IncrementalPlanner::Vertex& IncrementalPlanner::vertex(int index) {
+    Vertex& v = this->vertices[index];
+    if (v.stamp != this->epoch) {
+        v = Vertex{ PathPlanner::BLOCKED, PathPlanner::BLOCKED, this->epoch };
+    }
+    return v;
+}
+
+/**
+ * @brief D* Lite key of a cell for the current start and km.
+ */
+IncrementalPlanner::SearchKey IncrementalPlanner::calculateKey(int index) {
+    const Vertex& v = vertex(index);
+    float best = v.g < v.rhs ? v.g : v.rhs;
+    return SearchKey{ best + octile(this->start.x, this->start.y, index % this->width, index / this->width) + this->km, best };
+}
+
+/**
+ * @brief Cost of one 8-connected step, with the corner rule of PathPlanner::plan().
+ */
+float IncrementalPlanner::stepCost(int fromX, int fromY, int toX, int toY) const {
+    const float* cost = this->planner.getCosts();
+    float step = cost[toY * this->width + toX];
+    if (step == PathPlanner::BLOCKED) {
+        return PathPlanner::BLOCKED;
+    }
+    if (fromX != toX && fromY != toY) {
+        if (cost[fromY * this->width + toX] == PathPlanner::BLOCKED || cost[toY * this->width + fromX] == PathPlanner::BLOCKED) {
+            return PathPlanner::BLOCKED;
+        }
+        step *= DIAGONAL;
+    }
+    return step;
+}
+
+/**
+ * @brief Right-hand side of a cell: its cheapest step plus the cost to the goal from there.
+ */
+float IncrementalPlanner::lookahead(int index) {
+    int x = index % this->width;
+    int y = index / this->width;
+    float best = PathPlanner::BLOCKED;
+    for (int k = 0; k < 8; k++) {
+        int nx = x + NEIGHBOUR_X[k];
+        int ny = y + NEIGHBOUR_Y[k];
+        if (nx < 0 || ny < 0 || nx >= this->width || ny >= this->height) {
+            continue;
+        }
+        float step = stepCost(x, y, nx, ny);
+        if (step == PathPlanner::BLOCKED) {
+            continue;
+        }
+        float total = step + vertex(ny * this->width + nx).g;
+        best = total < best ? total : best;
+    }
+    return best;
+}
+
+void IncrementalPlanner::updateVertex(int index) {
+    const Vertex& v = vertex(index);
+    if (v.g != v.rhs) {
+        this->open.push(index, calculateKey(index));
+    }
+    else {
+        this->open.remove(index);
+    }
+}
+
+/**
+ * @brief Forgets the previous search and sets a new goal.
+ *
+ * The goal is queued by the first replan(), once the start is known.
+ */
+bool IncrementalPlanner::setGoal(const GridCell& goal) {
+    this->goalIndex = -1;
+    this->width = this->planner.getWidth();
+    this->height = this->planner.getHeight();
+    if (this->planner.getCost(goal.x, goal.y) == PathPlanner::BLOCKED) {
+        return false;
+    }
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    if (this->vertices.size() != cells) {
+        this->vertices.assign(cells, Vertex{ 0.0f, 0.0f, 0 });
+        this->touched.assign(cells, 0);
+        this->open.resize(static_cast<int>(cells));
+        this->epoch = 0;
+        this->updates = 0;
+    }
+    this->open.clear();
+    this->epoch++;
+    if (this->epoch == 0xFFFFFFFFu) {
+        for (Vertex& v : this->vertices) {
+            v.stamp = 0;
+        }
+        this->epoch = 1;
+    }
+    this->goal = goal;
+    this->goalIndex = goal.y * this->width + goal.x;
+    this->start = GridCell{ -1, -1 };
+    this->km = 0.0f;
+    vertex(this->goalIndex).rhs = 0.0f;
+    return true;
+}
+
+/**
+ * @brief Applies changed map cells to the planner's costs and queues the affected cells.
+ */
+size_t IncrementalPlanner::updateMap(const MAP& map, const vector<GridCell>& changed) {
+    size_t count = this->planner.updateMap(map, changed);
+    costsChanged(this->planner.getCostChanges());
+    return count;
+}
+
+/**
+ * @brief Queues the cells whose outgoing steps changed.
+ *
+ * A step into a cell costs what the cell costs, and a diagonal step is also allowed or
+ * forbidden by its two side cells. Both kinds of step start next to the changed cell,
+ * so its 3 x 3 neighbourhood is every cell whose right-hand side can change.
+ */
+void IncrementalPlanner::costsChanged(const vector<int>& cells) {
+    if (this->goalIndex < 0 || this->start.x < 0) {
+        return;
+    }
+    this->updates++;
+    if (this->updates == 0) {
+        this->touched.assign(this->touched.size(), 0);
+        this->updates = 1;
+    }
+    for (size_t i = 0; i < cells.size(); i++) {
+        int cx = cells[i] % this->width;
+        int cy = cells[i] / this->width;
+        for (int y = cy - 1; y <= cy + 1; y++) {
+            for (int x = cx - 1; x <= cx + 1; x++) {
+                if (x < 0 || y < 0 || x >= this->width || y >= this->height) {
+                    continue;
+                }
+                int index = y * this->width + x;
+                if (this->touched[index] == this->updates || index == this->goalIndex) {
+                    continue;
+                }
+                this->touched[index] = this->updates;
+                vertex(index).rhs = lookahead(index);
+                updateVertex(index);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Expands cells in key order until the start is settled.
+ *
+ * An overconsistent cell (g > rhs) gets its lower cost and offers it to its
+ * predecessors. An underconsistent cell (g < rhs) has become more expensive: its g is
+ * reset and every predecessor that relied on it looks for another step.
+ *
+ * Keys equal to the start key in exact arithmetic can round either side of it in
+ * float, and an unexpanded cell among them may still hold a stale, too low g that the
+ * path extraction would follow. Expanding slightly past the start key settles them.
+ */
+void IncrementalPlanner::computeShortestPath() {
+    const int startIndex = this->start.y * this->width + this->start.x;
+    while (!this->open.empty()) {
+        SearchKey top = this->open.topKey();
+        const Vertex& s = vertex(startIndex);
+        SearchKey limit = calculateKey(startIndex);
+        limit.k1 += KEY_SLACK * (limit.k1 > 1.0f ? limit.k1 : 1.0f);
+        if (!(top < limit) && !(s.rhs > s.g)) {
+            break;
+        }
+        int u = this->open.topId();
+        SearchKey fresh = calculateKey(u);
+        if (top < fresh) {
+            // Queued before the start moved: requeue with the current km.
+            this->open.push(u, fresh);
+            continue;
+        }
+        this->expanded++;
+        int ux = u % this->width;
+        int uy = u / this->width;
+        Vertex& vu = vertex(u);
+        if (vu.g > vu.rhs) {
+            vu.g = vu.rhs;
+            this->open.pop();
+            for (int k = 0; k < 8; k++) {
+                int px = ux + NEIGHBOUR_X[k];
+                int py = uy + NEIGHBOUR_Y[k];
+                if (px < 0 || py < 0 || px >= this->width || py >= this->height) {
+                    continue;
+                }
+                int p = py * this->width + px;
+                float step = stepCost(px, py, ux, uy);
+                if (p == this->goalIndex || step == PathPlanner::BLOCKED) {
+                    continue;
+                }
+                Vertex& vp = vertex(p);
+                float candidate = step + vu.g;
+                if (candidate < vp.rhs) {
+                    vp.rhs = candidate;
+                    updateVertex(p);
+                }
+            }
+        }
+        else {
+            float previous = vu.g;
+            vu.g = PathPlanner::BLOCKED;
+            if (u != this->goalIndex) {
+                vu.rhs = lookahead(u);
+            }
+            updateVertex(u);
+            for (int k = 0; k < 8; k++) {
+                int px = ux + NEIGHBOUR_X[k];
+                int py = uy + NEIGHBOUR_Y[k];
+                if (px < 0 || py < 0 || px >= this->width || py >= this->height) {
+                    continue;
+                }
+                int p = py * this->width + px;
+                float step = stepCost(px, py, ux, uy);
+                if (p == this->goalIndex || step == PathPlanner::BLOCKED) {
+                    continue;
+                }
+                Vertex& vp = vertex(p);
+                if (vp.rhs == step + previous) {
+                    vp.rhs = lookahead(p);
+                    updateVertex(p);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Repairs the search for the current start and extracts the path.
+ *
+ * The path follows the cheapest step plus cost to the goal from every cell, which the
+ * settled g values make a shortest path.
+ * @return the path cost in cells, or a negative value if the goal cannot be reached.
+ */
+double IncrementalPlanner::replan(const GridCell& start, vector<GridCell>& path) {
+    METRIC_SCOPE("planner_replan");
+    path.clear();
+    this->expanded = 0;
+    if (this->goalIndex < 0 || this->planner.getWidth() != this->width || this->planner.getHeight() != this->height) {
+        return -1.0;
+    }
+    if (this->planner.getCost(start.x, start.y) == PathPlanner::BLOCKED) {
+        return -1.0;
+    }
+    if (this->start.x < 0) {
+        this->start = start;
+        this->open.push(this->goalIndex, calculateKey(this->goalIndex));
+    }
+    else if (start.x != this->start.x || start.y != this->start.y) {
+        this->km += octile(this->start.x, this->start.y, start.x, start.y);
+        this->start = start;
+    }
+    computeShortestPath();
+    METRIC_COUNT("planner_expanded_total", this->expanded);
+
+    int current = start.y * this->width + start.x;
+    float cost = vertex(current).rhs;
+    if (cost == PathPlanner::BLOCKED) {
+        return -1.0;
+    }
+    path.push_back(start);
+    size_t limit = this->vertices.size();
+    while (current != this->goalIndex) {
+        int x = current % this->width;
+        int y = current / this->width;
+        int next = -1;
+        float best = PathPlanner::BLOCKED;
+        for (int k = 0; k < 8; k++) {
+            int nx = x + NEIGHBOUR_X[k];
+            int ny = y + NEIGHBOUR_Y[k];
+            if (nx < 0 || ny < 0 || nx >= this->width || ny >= this->height) {
+                continue;
+            }
+            float step = stepCost(x, y, nx, ny);
+            if (step == PathPlanner::BLOCKED) {
+                continue;
+            }
+            float total = step + vertex(ny * this->width + nx).g;
+            if (total < best) {
+                best = total;
+                next = ny * this->width + nx;
+            }
+        }
+        if (next < 0 || path.size() > limit) {
+            path.clear();
+            return -1.0;
+        }
+        current = next;
+        path.push_back(GridCell{ current % this->width, current / this->width });
+    }
+    return cost;
+}
+
+int IncrementalPlanner::getExpandedCount() const {
+    return this->expanded;
+}
@@ -0,0 +1,153 @@
+#pragma once
+/**
+ * @file   IncrementalPlanner.h
+ * @date   October, 2026
+ * @brief  Header file for the IncrementalPlanner class.
+ *
+ * This file contains the definition of the IncrementalPlanner class, a D* Lite planner
+ * that repairs its path when the costs of a PathPlanner change instead of planning again.
+ */
+
+#include <vector>
+#include "IndexedHeap.h"
+#include "PathPlanner.h"
+
+//! IncrementalPlanner class
+/*!
+ * @brief D* Lite on the cell costs of a PathPlanner.
+ *
+ * The search runs backwards from the goal, so every cell it has settled keeps its cost
+ * to the goal while the robot moves. When the map changes, the PathPlanner repairs the
+ * costs around the changed cells and updateMap() hands the cells whose cost changed to
+ * D* Lite, which only re-expands the cells whose cost to the goal those changes
+ * affect. Moving the start adds the heuristic distance moved to the key modifier km
+ * instead of reordering the open list (Koenig and Likhachev, D* Lite, 2002).
+ *
+ * Paths use the same 8-connected steps, costs and corner rule as PathPlanner::plan(),
+ * so a repaired path costs the same as a full A* plan on the updated grid, up to
+ * rounding. The search state of every cell lives in an arena sized to the grid and is
+ * invalidated by an epoch number, like the PathPlanner arenas.
+ */
+class IncrementalPlanner {
+public:
+    //! SearchKey struct
+    /*!
+     * @brief D* Lite priority, compared first by k1 then by k2.
+     */
+    struct SearchKey {
+        float k1; /*!< min(g, rhs) + heuristic to the start + km. */
+        float k2; /*!< min(g, rhs). */
+
+        bool operator<(const SearchKey& other) const {
+            return k1 < other.k1 || (k1 == other.k1 && k2 < other.k2);
+        }
+    };
+
+private:
+    //! Vertex struct
+    /*!
+     * @brief D* Lite state of one cell.
+     */
+    struct Vertex {
+        float g;            /*!< Cost to the goal as last expanded. */
+        float rhs;          /*!< One-step lookahead of the cost to the goal. */
+        unsigned int stamp; /*!< Epoch the values belong to. */
+    };
+
+    PathPlanner& planner;          /*!< Owner of the grid and the cell costs. */
+    IndexedHeap<SearchKey> open;   /*!< Inconsistent cells. */
+    std::vector<Vertex> vertices;  /*!< State of every cell. */
+    std::vector<unsigned int> touched; /*!< Update number of the last costsChanged() that visited a cell. */
+    unsigned int epoch;            /*!< Number of the current goal. */
+    unsigned int updates;          /*!< Number of the current costsChanged(). */
+    int width;                     /*!< Grid width when the goal was set. */
+    int height;                    /*!< Grid height when the goal was set. */
+    GridCell start;                /*!< Start of the last replan(). */
+    GridCell goal;                 /*!< Goal of the search. */
+    int goalIndex;                 /*!< Row-major index of the goal, -1 before setGoal(). */
+    float km;                      /*!< Heuristic distance the start has moved. */
+    int expanded;                  /*!< Cells expanded by the last replan(). */
+
+    //! vertex function
+    /*!
+    * @return the state of a cell, reset to unknown if it belongs to an older epoch.
+    */
+    Vertex& vertex(int index);
+
+    //! calculateKey function
+    SearchKey calculateKey(int index);
+
+    //! stepCost function
+    /*!
+    * @return the cost of the step from cell from to its neighbour to, BLOCKED if not allowed.
+    */
+    float stepCost(int fromX, int fromY, int toX, int toY) const;
+
+    //! lookahead function
+    /*!
+    * @return the cheapest step cost plus g over the neighbours of a cell.
+    */
+    float lookahead(int index);
+
+    //! updateVertex function
+    /*!
+    * Queues a cell whose g and rhs differ and dequeues one where they agree.
+    */
+    void updateVertex(int index);
+
+    //! computeShortestPath function
+    /*!
+    * Expands cells until the start is consistent and no queued key is below its key.
+    */
+    void computeShortestPath();
+
+    IncrementalPlanner(const IncrementalPlanner&) = delete;
+    IncrementalPlanner& operator=(const IncrementalPlanner&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param planner Planner whose grid and costs are searched; it must outlive this object.
+    */
+    explicit IncrementalPlanner(PathPlanner& planner);
+
+    //! setGoal function
+    /*!
+    * Forgets the previous search and plans towards a new goal from the next replan().
+    * Must be called again after the planner gets a new map.
+    * @return false if the goal is outside the grid or blocked.
+    */
+    bool setGoal(const GridCell& goal);
+
+    //! updateMap function
+    /*!
+    * Applies changed map cells to the planner's costs and queues the affected cells.
+    * @param map The planner's map, after the changes.
+    * @param changed Cells that may have changed, as given by MAP::takeChangedCells().
+    * @return the number of cells whose cost changed.
+    */
+    size_t updateMap(const MAP& map, const std::vector<GridCell>& changed);
+
+    //! costsChanged function
+    /*!
+    * Queues the cells whose outgoing steps the given cost changes affect. Use after
+    * PathPlanner::applyChanges() with its getCostChanges().
+    * @param cells Row-major indices of the cells whose cost changed.
+    */
+    void costsChanged(const std::vector<int>& cells);
+
+    //! replan function
+    /*!
+    * Repairs the search for the current start and extracts the path to the goal.
+    * @param start Current robot cell.
+    * @param path Receives the cells from start to goal.
+    * @return the path cost in cells, or a negative value if the goal cannot be reached.
+    */
+    double replan(const GridCell& start, std::vector<GridCell>& path);
+
+    //! getExpandedCount function
+    /*!
+    * @return the cells expanded by the last replan().
+    */
+    int getExpandedCount() const;
+};
@@ -0,0 +1,205 @@
+#pragma once
+/**
+ * @file   IndexedHeap.h
+ * @date   October, 2026
+ * @brief  Header file for the IndexedHeap class template.
+ *
+ * This file contains the definition of IndexedHeap, a binary min-heap of integer ids
+ * whose keys can be changed in place.
+ */
+
+#include <vector>
+
+//! IndexedHeap class template
+/*!
+ * @brief Binary min-heap over ids 0..capacity-1 with an index from id to heap slot.
+ *
+ * Each id is in the heap at most once. push() on an id that is already queued moves it
+ * to its new key instead of adding a second, stale entry, so the heap never grows past
+ * the number of open ids and pop() never returns an outdated key.
+ *
+ * resize() is the only call that allocates. clear() only resets the ids still queued,
+ * so a search that touches a small part of a large grid pays only for that part.
+ *
+ * @tparam Key Key type with operator<; the smallest key is on top.
+ */
+template <typename Key>
+class IndexedHeap {
+public:
+    static constexpr int ABSENT = -1; /*!< Slot of an id that is not queued. */
+
+private:
+    //! Entry struct
+    struct Entry {
+        Key key; /*!< Priority. */
+        int id;  /*!< Queued id. */
+    };
+
+    std::vector<Entry> entries; /*!< Heap array. */
+    std::vector<int> slots;     /*!< Heap slot of every id, ABSENT if not queued. */
+    int count;                  /*!< Entries in use. */
+
+    //! place function
+    void place(int slot, const Entry& entry) {
+        entries[slot] = entry;
+        slots[entry.id] = slot;
+    }
+
+    //! siftUp function
+    void siftUp(int slot) {
+        Entry entry = entries[slot];
+        while (slot > 0) {
+            int parent = (slot - 1) >> 1;
+            if (!(entry.key < entries[parent].key)) {
+                break;
+            }
+            place(slot, entries[parent]);
+            slot = parent;
+        }
+        place(slot, entry);
+    }
+
+    //! siftDown function
+    void siftDown(int slot) {
+        Entry entry = entries[slot];
+        while (true) {
+            int child = 2 * slot + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && entries[child + 1].key < entries[child].key) {
+                child++;
+            }
+            if (!(entries[child].key < entry.key)) {
+                break;
+            }
+            place(slot, entries[child]);
+            slot = child;
+        }
+        place(slot, entry);
+    }
+
+public:
+    //! Default constructor
+    IndexedHeap() : count(0) {}
+
+    //! resize function
+    /*!
+    * Empties the heap and makes room for ids 0..capacity-1.
+    */
+    void resize(int capacity) {
+        entries.assign(capacity, Entry());
+        slots.assign(capacity, ABSENT);
+        count = 0;
+    }
+
+    //! clear function
+    /*!
+    * Removes every queued id, in time proportional to their number.
+    */
+    void clear() {
+        for (int i = 0; i < count; i++) {
+            slots[entries[i].id] = ABSENT;
+        }
+        count = 0;
+    }
+
+    //! empty function
+    bool empty() const {
+        return count == 0;
+    }
+
+    //! size function
+    int size() const {
+        return count;
+    }
+
+    //! contains function
+    bool contains(int id) const {
+        return slots[id] != ABSENT;
+    }
+
+    //! push function
+    /*!
+    * Queues id with key, or moves it to key if it is already queued.
+    */
+    void push(int id, const Key& key) {
+        int slot = slots[id];
+        if (slot == ABSENT) {
+            slot = count++;
+            place(slot, Entry{ key, id });
+            siftUp(slot);
+        }
+        else if (key < entries[slot].key) {
+            entries[slot].key = key;
+            siftUp(slot);
+        }
+        else {
+            entries[slot].key = key;
+            siftDown(slot);
+        }
+    }
+
+    //! remove function
+    /*!
+    * Removes id if it is queued.
+    */
+    void remove(int id) {
+        int slot = slots[id];
+        if (slot == ABSENT) {
+            return;
+        }
+        slots[id] = ABSENT;
+        count--;
+        if (slot == count) {
+            return;
+        }
+        Key key = entries[slot].key;
+        place(slot, entries[count]);
+        if (entries[slot].key < key) {
+            siftUp(slot);
+        }
+        else {
+            siftDown(slot);
+        }
+    }
+
+    //! topId function
+    /*!
+    * @return the id with the smallest key; the heap must not be empty.
+    */
+    int topId() const {
+        return entries[0].id;
+    }
+
+    //! topKey function
+    /*!
+    * @return the smallest key; the heap must not be empty.
+    */
+    const Key& topKey() const {
+        return entries[0].key;
+    }
+
+    //! keyOf function
+    /*!
+    * @return the key of a queued id.
+    */
+    const Key& keyOf(int id) const {
+        return entries[slots[id]].key;
+    }
+
+    //! pop function
+    /*!
+    * Removes and returns the id with the smallest key; the heap must not be empty.
+    */
+    int pop() {
+        int id = entries[0].id;
+        slots[id] = ABSENT;
+        count--;
+        if (count > 0) {
+            place(0, entries[count]);
+            siftDown(0);
+        }
+        return id;
+    }
+};
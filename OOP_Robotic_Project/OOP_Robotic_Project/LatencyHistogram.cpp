@@ -0,0 +1,110 @@
+/**
+ * @file   LatencyHistogram.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the LatencyHistogram class.
+ */
+
+#include <iostream>
+#include "LatencyHistogram.h"
+using namespace std;
+
+/**
+ * @brief Default constructor. Starts with an empty histogram.
+ */
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+/**
+ * @brief Adds one sample.
+ * @param nanoseconds Latency to add; negative values count as 0.
+ */
+void LatencyHistogram::record(long long nanoseconds) {
+    if (nanoseconds < 0) {
+        nanoseconds = 0;
+    }
+    int bucket = 0;
+    unsigned long long value = static_cast<unsigned long long>(nanoseconds);
+    while (value != 0 && bucket < BUCKET_COUNT - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    this->buckets[bucket]++;
+    this->count++;
+    this->sum += static_cast<double>(nanoseconds);
+    if (nanoseconds < this->minimum) {
+        this->minimum = nanoseconds;
+    }
+    if (nanoseconds > this->maximum) {
+        this->maximum = nanoseconds;
+    }
+}
+
+/**
+ * @brief Removes all samples.
+ */
+void LatencyHistogram::reset() {
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        this->buckets[i] = 0;
+    }
+    this->count = 0;
+    this->minimum = 0x7fffffffffffffffLL;
+    this->maximum = 0;
+    this->sum = 0;
+}
+
+unsigned long long LatencyHistogram::getCount() const {
+    return this->count;
+}
+
+long long LatencyHistogram::getMin() const {
+    return this->count == 0 ? 0 : this->minimum;
+}
+
+long long LatencyHistogram::getMax() const {
+    return this->maximum;
+}
+
+double LatencyHistogram::getMean() const {
+    return this->count == 0 ? 0.0 : this->sum / this->count;
+}
+
+/**
+ * @brief Returns the upper bound of the bucket that holds the percentile.
+ * @param percentile Value in [0, 100].
+ */
+long long LatencyHistogram::getPercentile(double percentile) const {
+    if (this->count == 0) {
+        return 0;
+    }
+    unsigned long long rank = static_cast<unsigned long long>(percentile / 100.0 * this->count);
+    if (rank >= this->count) {
+        rank = this->count - 1;
+    }
+    unsigned long long seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        seen += this->buckets[i];
+        if (seen > rank) {
+            long long upper = i == 0 ? 0 : (1LL << i) - 1;
+            return upper < this->maximum ? upper : this->maximum;
+        }
+    }
+    return this->maximum;
+}
+
+/**
+ * @brief Prints a summary and one line per non-empty bucket.
+ * @param title Name printed above the histogram.
+ */
+void LatencyHistogram::print(const string& title) const {
+    cout << title << ": " << this->count << " samples, min " << getMin() << " ns, mean "
+        << getMean() << " ns, p50 " << getPercentile(50) << " ns, p99 " << getPercentile(99)
+        << " ns, p99.9 " << getPercentile(99.9) << " ns, max " << getMax() << " ns" << endl;
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        if (this->buckets[i] == 0) {
+            continue;
+        }
+        long long low = i == 0 ? 0 : (1LL << (i - 1));
+        cout << "  [" << low << " ns, " << (1LL << i) << " ns): " << this->buckets[i] << endl;
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+/**
+ * @file   LatencyHistogram.h
+ * @date   October, 2026
+ * @brief  Header file for the LatencyHistogram class.
+ *
+ * This file contains the definition of the LatencyHistogram class, which collects
+ * nanosecond latencies into power-of-two buckets.
+ */
+
+#include <string>
+
+//! LatencyHistogram class
+/*!
+ * @brief Fixed-size histogram of latencies in nanoseconds.
+ *
+ * Bucket b counts samples in [2^(b-1), 2^b) ns (bucket 0 holds 0 ns). Recording is a
+ * few integer operations and never allocates, so it can be called on the hot path.
+ * The class is not thread safe; use one histogram per thread.
+ */
+class LatencyHistogram {
+public:
+    static const int BUCKET_COUNT = 48; /*!< Covers up to about 39 hours. */
+
+private:
+    unsigned long long buckets[BUCKET_COUNT]; /*!< Sample count per bucket. */
+    unsigned long long count;                 /*!< Total number of samples. */
+    long long minimum;                        /*!< Smallest sample. */
+    long long maximum;                        /*!< Largest sample. */
+    double sum;                               /*!< Sum of all samples. */
+
+public:
+    //! Default constructor
+    LatencyHistogram();
+
+    //! record function
+    /*!
+    * @param nanoseconds Latency to add; negative values count as 0.
+    */
+    void record(long long nanoseconds);
+
+    //! reset function
+    void reset();
+
+    //! getCount function
+    unsigned long long getCount() const;
+
+    //! getMin function
+    long long getMin() const;
+
+    //! getMax function
+    long long getMax() const;
+
+    //! getMean function
+    double getMean() const;
+
+    //! getPercentile function
+    /*!
+    * @param percentile Value in [0, 100].
+    * @return the upper bound of the bucket that holds the percentile, in nanoseconds.
+    */
+    long long getPercentile(double percentile) const;
+
+    //! print function
+    /*!
+    * Prints a summary and one line per non-empty bucket.
+    * @param title Name printed above the histogram.
+    */
+    void print(const std::string& title) const;
+};
@@ -0,0 +1,258 @@
+/**
+ * @file   LidarFilter.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the lidar preprocessing stages.
+ */
+
+#include <algorithm>
+#include "LidarFilter.h"
+
+#if defined(__AVX__)
+#define LIDARFILTER_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LIDARFILTER_SSE
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+#if defined(LIDARFILTER_AVX)
+typedef __m256 Vec;
+static const int LANES = 8;
+static inline Vec vset(float v) { return _mm256_set1_ps(v); }
+static inline Vec vloadu(const float* p) { return _mm256_loadu_ps(p); }
+static inline void vstoreu(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+static inline Vec vadd(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+static inline Vec vmin(Vec a, Vec b) { return _mm256_min_ps(a, b); }
+static inline Vec vmax(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+static inline Vec vand(Vec a, Vec b) { return _mm256_and_ps(a, b); }
+static inline Vec vandnot(Vec a, Vec b) { return _mm256_andnot_ps(a, b); }
+static inline Vec vor(Vec a, Vec b) { return _mm256_or_ps(a, b); }
+static inline Vec vgreater(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+static inline Vec vless(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline int vmask(Vec v) { return _mm256_movemask_ps(v); }
+#elif defined(LIDARFILTER_SSE)
+typedef __m128 Vec;
+static const int LANES = 4;
+static inline Vec vset(float v) { return _mm_set1_ps(v); }
+static inline Vec vloadu(const float* p) { return _mm_loadu_ps(p); }
+static inline void vstoreu(float* p, Vec v) { _mm_storeu_ps(p, v); }
+static inline Vec vadd(Vec a, Vec b) { return _mm_add_ps(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+static inline Vec vmin(Vec a, Vec b) { return _mm_min_ps(a, b); }
+static inline Vec vmax(Vec a, Vec b) { return _mm_max_ps(a, b); }
+static inline Vec vand(Vec a, Vec b) { return _mm_and_ps(a, b); }
+static inline Vec vandnot(Vec a, Vec b) { return _mm_andnot_ps(a, b); }
+static inline Vec vor(Vec a, Vec b) { return _mm_or_ps(a, b); }
+static inline Vec vgreater(Vec a, Vec b) { return _mm_cmpgt_ps(a, b); }
+static inline Vec vless(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+static inline int vmask(Vec v) { return _mm_movemask_ps(v); }
+#else
+static const int LANES = 1;
+#endif
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero mask.
+ */
+static inline int lowestBit(unsigned int mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * @brief Parameterized Constructor.
+ */
+RangeClamp::RangeClamp(float minRange, float maxRange) {
+    this->minRange = minRange;
+    this->maxRange = maxRange;
+}
+
+/**
+ * @brief Replaces every reading outside (minRange, maxRange) with maxRange.
+ *
+ * The comparisons are ordered, so they are false for NaN and NaN readings take the
+ * maximum range along with the rest.
+ */
+int RangeClamp::process(float* ranges, int count) {
+    int i = 0;
+#if defined(LIDARFILTER_AVX) || defined(LIDARFILTER_SSE)
+    Vec low = vset(this->minRange);
+    Vec high = vset(this->maxRange);
+    for (; i + LANES <= count; i += LANES) {
+        Vec r = vloadu(ranges + i);
+        Vec valid = vand(vgreater(r, low), vless(r, high));
+        vstoreu(ranges + i, vor(vand(valid, r), vandnot(valid, high)));
+    }
+#endif
+    for (; i < count; i++) {
+        float r = ranges[i];
+        ranges[i] = r > this->minRange && r < this->maxRange ? r : this->maxRange;
+    }
+    return count;
+}
+
+LidarGeometry RangeClamp::geometry(const LidarGeometry& input) const {
+    LidarGeometry output = input;
+    output.maxRange = this->maxRange;
+    return output;
+}
+
+#if defined(LIDARFILTER_AVX) || defined(LIDARFILTER_SSE)
+/**
+ * @brief Puts the smaller value of each lane in a and the larger in b.
+ */
+static inline void exchange(Vec& a, Vec& b) {
+    Vec smaller = vmin(a, b);
+    b = vmax(a, b);
+    a = smaller;
+}
+#endif
+
+/**
+ * @brief Returns the median of the window of 2 * radius + 1 readings centered on i,
+ * repeating the end readings.
+ */
+static float medianAt(const float* in, int count, int radius, int i) {
+    float window[5];
+    int size = 2 * radius + 1;
+    for (int k = 0; k < size; k++) {
+        window[k] = in[min(max(i - radius + k, 0), count - 1)];
+    }
+    nth_element(window, window + radius, window + size);
+    return window[radius];
+}
+
+/**
+ * @brief Computes the windowed median of a scan.
+ *
+ * Away from the ends, LANES windows are filtered at once: the k-th reading of each
+ * window is one unaligned load, and a sorting network of min and max operations
+ * brings the middle value of every lane into place. A window of 3 takes 3 exchanges,
+ * a window of 5 the 9 of the optimal 5-input network (Knuth, TAOCP vol. 3). The
+ * windows that reach past the ends are done one at a time.
+ */
+void medianFilter(const float* in, float* out, int count, int radius) {
+    if (count <= 0) {
+        return;
+    }
+    radius = radius <= 1 ? 1 : 2;
+    int i = 0;
+    for (; i < radius && i < count; i++) {
+        out[i] = medianAt(in, count, radius, i);
+    }
+#if defined(LIDARFILTER_AVX) || defined(LIDARFILTER_SSE)
+    if (radius == 1) {
+        for (; i + LANES + 1 <= count; i += LANES) {
+            Vec a = vloadu(in + i - 1);
+            Vec b = vloadu(in + i);
+            Vec c = vloadu(in + i + 1);
+            exchange(a, b);
+            exchange(b, c);
+            exchange(a, b);
+            vstoreu(out + i, b);
+        }
+    }
+    else {
+        for (; i + LANES + 2 <= count; i += LANES) {
+            Vec v0 = vloadu(in + i - 2);
+            Vec v1 = vloadu(in + i - 1);
+            Vec v2 = vloadu(in + i);
+            Vec v3 = vloadu(in + i + 1);
+            Vec v4 = vloadu(in + i + 2);
+            exchange(v0, v1);
+            exchange(v3, v4);
+            exchange(v2, v4);
+            exchange(v2, v3);
+            exchange(v0, v3);
+            exchange(v0, v2);
+            exchange(v1, v4);
+            exchange(v1, v3);
+            exchange(v1, v2);
+            vstoreu(out + i, v2);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = medianAt(in, count, radius, i);
+    }
+}
+
+/**
+ * @brief Parameterized Constructor.
+ */
+RangeJumpSegmenter::RangeJumpSegmenter(float threshold, float ratio) {
+    this->threshold = threshold;
+    this->ratio = ratio;
+    this->segmentCount = 0;
+}
+
+/**
+ * @brief Records the first beam of every segment.
+ *
+ * Each vector step compares LANES pairs of neighbors and turns the result into a bit
+ * mask; most masks are zero, and the set bits of the others are the segment starts.
+ */
+int RangeJumpSegmenter::process(float* ranges, int count) {
+    if (static_cast<int>(this->starts.size()) < count) {
+        this->starts.resize(count);
+    }
+    this->segmentCount = 0;
+    if (count <= 0) {
+        return count;
+    }
+    int* out = this->starts.data();
+    int segments = 0;
+    out[segments++] = 0;
+    int i = 1;
+#if defined(LIDARFILTER_AVX) || defined(LIDARFILTER_SSE)
+    Vec base = vset(this->threshold);
+    Vec slope = vset(this->ratio);
+    Vec signBit = vset(-0.0f);
+    for (; i + LANES <= count; i += LANES) {
+        Vec previous = vloadu(ranges + i - 1);
+        Vec r = vloadu(ranges + i);
+        Vec jump = vandnot(signBit, vsub(r, previous));
+        Vec allowed = vadd(base, vmul(slope, vmin(previous, r)));
+        unsigned int mask = static_cast<unsigned int>(vmask(vgreater(jump, allowed)));
+        while (mask != 0) {
+            out[segments++] = i + lowestBit(mask);
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        float previous = ranges[i - 1];
+        float r = ranges[i];
+        float jump = r > previous ? r - previous : previous - r;
+        if (jump > this->threshold + this->ratio * (r < previous ? r : previous)) {
+            out[segments++] = i;
+        }
+    }
+    this->segmentCount = segments;
+    return count;
+}
+
+LidarGeometry RangeJumpSegmenter::geometry(const LidarGeometry& input) const {
+    return input;
+}
+
+int RangeJumpSegmenter::getSegmentCount() const {
+    return this->segmentCount;
+}
+
+const int* RangeJumpSegmenter::getSegmentStarts() const {
+    return this->starts.data();
+}
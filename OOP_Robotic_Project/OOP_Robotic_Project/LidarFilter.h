@@ -0,0 +1,261 @@
+#pragma once
+/**
+ * @file   LidarFilter.h
+ * @date   October, 2026
+ * @brief  Header file for the lidar preprocessing stages and the LidarPipeline class template.
+ *
+ * This file contains the stages that clean up a lidar scan before it is used (range
+ * clamping, median filtering, angular downsampling and range-jump segmentation) and
+ * LidarPipeline, which chains a fixed list of stages chosen at compile time.
+ */
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "LidarSensor.h"
+
+//! RangeClamp class
+/*!
+ * @brief Replaces readings that are not valid ranges with the maximum range.
+ *
+ * NaN, infinite, negative and zero readings, readings below the minimum range and
+ * readings at or beyond the maximum range all become maxRange, the value every
+ * consumer already treats as "no return". The scan is processed 8 floats at a time
+ * with AVX, 4 with SSE2.
+ */
+class RangeClamp {
+private:
+    float minRange; /*!< Shortest valid range (meters). */
+    float maxRange; /*!< Largest valid range, exclusive (meters). */
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param minRange Shortest valid range (meters).
+    * @param maxRange Readings at or beyond this did not hit anything (meters).
+    */
+    RangeClamp(float minRange = 0.0f, float maxRange = 10.0f);
+
+    //! process function
+    /*!
+    * @return count; the scan keeps its length.
+    */
+    int process(float* ranges, int count);
+
+    //! geometry function
+    LidarGeometry geometry(const LidarGeometry& input) const;
+};
+
+//! medianFilter function
+/*!
+ * Writes the median of each window of 2 * radius + 1 readings to out, repeating the
+ * first and last readings past the ends of the scan.
+ * @param radius 1 or 2.
+ */
+void medianFilter(const float* in, float* out, int count, int radius);
+
+//! MedianFilter class template
+/*!
+ * @brief Sliding-window median, which removes isolated spikes and dropouts but keeps edges.
+ *
+ * The median of the window is computed with a min/max sorting network on whole
+ * vectors of readings, each lane a different window. The filtered scan goes to a
+ * scratch buffer that is sized by the first scan and reused, then is copied back.
+ *
+ * @tparam Radius Readings on each side of the center, 1 or 2.
+ */
+template <int Radius>
+class MedianFilter {
+    static_assert(Radius == 1 || Radius == 2, "MedianFilter supports windows of 3 and 5 readings");
+
+private:
+    std::vector<float> scratch; /*!< Filtered scan before it is copied back. */
+
+public:
+    //! process function
+    /*!
+    * @return count; the scan keeps its length.
+    */
+    int process(float* ranges, int count) {
+        if (static_cast<int>(this->scratch.size()) < count) {
+            this->scratch.resize(count);
+        }
+        medianFilter(ranges, this->scratch.data(), count, Radius);
+        std::copy(this->scratch.begin(), this->scratch.begin() + count, ranges);
+        return count;
+    }
+
+    //! geometry function
+    LidarGeometry geometry(const LidarGeometry& input) const {
+        return input;
+    }
+};
+
+//! AngleDownsampler class template
+/*!
+ * @brief Keeps the shortest reading of every Factor consecutive beams.
+ *
+ * Taking the minimum keeps every obstacle the full scan saw, at the cost of angular
+ * resolution. The output beam points at the middle of its group; a last, incomplete
+ * group still produces a beam. Because Factor is a constant the inner loop is fully
+ * unrolled and the compiler vectorizes the groups.
+ *
+ * @tparam Factor Beams per group, at least 2.
+ */
+template <int Factor>
+class AngleDownsampler {
+    static_assert(Factor >= 2, "AngleDownsampler needs at least 2 beams per group");
+
+public:
+    //! process function
+    /*!
+    * Works in place: group j is written to ranges[j].
+    * @return the number of groups, count / Factor rounded up.
+    */
+    int process(float* ranges, int count) {
+        int whole = count / Factor;
+        for (int j = 0; j < whole; j++) {
+            float shortest = ranges[j * Factor];
+            for (int k = 1; k < Factor; k++) {
+                float value = ranges[j * Factor + k];
+                shortest = value < shortest ? value : shortest;
+            }
+            ranges[j] = shortest;
+        }
+        if (whole * Factor < count) {
+            float shortest = ranges[whole * Factor];
+            for (int i = whole * Factor + 1; i < count; i++) {
+                shortest = ranges[i] < shortest ? ranges[i] : shortest;
+            }
+            ranges[whole++] = shortest;
+        }
+        return whole;
+    }
+
+    //! geometry function
+    /*!
+    * @return the geometry of the downsampled beams.
+    */
+    LidarGeometry geometry(const LidarGeometry& input) const {
+        LidarGeometry output = input;
+        output.startAngle = input.startAngle + 0.5 * (Factor - 1) * input.angleIncrement;
+        output.angleIncrement = input.angleIncrement * Factor;
+        return output;
+    }
+};
+
+//! RangeJumpSegmenter class
+/*!
+ * @brief Splits a scan into segments wherever the range jumps between neighboring beams.
+ *
+ * Beams i - 1 and i belong to different segments when
+ * |r[i] - r[i-1]| > threshold + ratio * min(r[i-1], r[i]), so the allowed jump grows
+ * with distance, as the gap between beams on a surface does. The jumps are found a
+ * vector of beams at a time; only the beams that start a segment are visited one by
+ * one. The scan itself is not changed. The segment starts are kept in a buffer that
+ * grows with the scans and is then reused.
+ */
+class RangeJumpSegmenter {
+private:
+    float threshold;                  /*!< Jump allowed at zero range (meters). */
+    float ratio;                      /*!< Extra jump allowed per meter of range. */
+    std::vector<int> starts;          /*!< First beam of each segment, capacity kept between scans. */
+    int segmentCount;                 /*!< Segments of the last scan. */
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param threshold Jump allowed at zero range (meters).
+    * @param ratio Extra jump allowed per meter of range.
+    */
+    RangeJumpSegmenter(float threshold = 0.1f, float ratio = 0.1f);
+
+    //! process function
+    /*!
+    * @return count; the scan is not changed.
+    */
+    int process(float* ranges, int count);
+
+    //! geometry function
+    LidarGeometry geometry(const LidarGeometry& input) const;
+
+    //! getSegmentCount function
+    int getSegmentCount() const;
+
+    //! getSegmentStarts function
+    /*!
+    * @return the first beam of each segment of the last scan, in increasing order.
+    */
+    const int* getSegmentStarts() const;
+};
+
+//! LidarPipeline class template
+/*!
+ * @brief A fixed chain of preprocessing stages applied to scans in place.
+ *
+ * The stages are members of the pipeline and are called in the order given, each one
+ * on the output of the previous. The list is part of the type, so the calls are
+ * resolved and inlined at compile time and a stage that is not listed adds no code
+ * and no branch. A stage is any class with
+ * - int process(float* ranges, int count), returning the new number of readings, and
+ * - LidarGeometry geometry(const LidarGeometry&) const, the beams after the stage.
+ *
+ * After the first scan no stage allocates. A typical chain is
+ * LidarPipeline<RangeClamp, MedianFilter<1>, AngleDownsampler<2>, RangeJumpSegmenter>.
+ *
+ * @tparam Stages Stage types, in processing order.
+ */
+template <typename... Stages>
+class LidarPipeline {
+private:
+    std::tuple<Stages...> stages; /*!< The stages, in processing order. */
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param stages The stages, in processing order.
+    */
+    explicit LidarPipeline(Stages... stages) : stages(std::move(stages)...) {}
+
+    //! stage function
+    /*!
+    * @return stage I, to read its results or change its settings.
+    */
+    template <size_t I>
+    typename std::tuple_element<I, std::tuple<Stages...>>::type& stage() {
+        return std::get<I>(this->stages);
+    }
+
+    //! process function
+    /*!
+    * Runs every stage on a scan in place.
+    * @return the number of readings left.
+    */
+    int process(float* ranges, int count) {
+        std::apply([ranges, &count](Stages&... stage) {
+            ((count = stage.process(ranges, count)), ...);
+        }, this->stages);
+        return count;
+    }
+
+    //! process function
+    /*!
+    * Runs every stage on a scan of a LidarSensor and updates its count.
+    */
+    void process(LidarScan& scan) {
+        scan.count = process(scan.ranges, scan.count);
+    }
+
+    //! geometry function
+    /*!
+    * @return the geometry of the scans the pipeline produces from scans of input.
+    */
+    LidarGeometry geometry(const LidarGeometry& input) const {
+        LidarGeometry output = input;
+        std::apply([&output](const Stages&... stage) {
+            ((output = stage.geometry(output)), ...);
+        }, this->stages);
+        return output;
+    }
+};
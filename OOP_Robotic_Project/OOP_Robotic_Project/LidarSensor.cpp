@@ -0,0 +1,161 @@
+/**
+ * @file   LidarSensor.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the LidarSensor class.
+ */
+
+#include <iostream>
+#include <new>
+#include "LidarSensor.h"
+#include "Metrics.h"
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor.
+ * The buffers are allocated on the first read, when the lidar size is known.
+ * @param api Robot API the scans are read from.
+ * @param poolSize Number of scan buffers that can be held at the same time.
+ */
+LidarSensor::LidarSensor(RobotInterface* api, int poolSize) {
+    this->robotAPI = api;
+    this->poolSize = poolSize > 0 ? poolSize : 1;
+    this->rangeNumber = 0;
+    this->stride = 0;
+    this->storage = nullptr;
+    this->scans = new LidarScan[this->poolSize];
+    this->freeList = new int[this->poolSize];
+    this->freeCount = 0;
+    this->inUse = new bool[this->poolSize]();
+    this->sequence = 0;
+}
+
+/**
+ * @brief Destructor.
+ * Frees the buffer pool and the scan descriptors.
+ */
+LidarSensor::~LidarSensor() {
+    if (this->storage != nullptr) {
+        ::operator delete[](this->storage, align_val_t(CACHE_LINE_SIZE));
+    }
+    delete[] this->scans;
+    delete[] this->freeList;
+    delete[] this->inUse;
+}
+
+/**
+ * @brief Allocates one aligned block for all buffers.
+ * Each buffer is padded to a whole number of cache lines so that two scans never
+ * share a line.
+ * @return true if the pool is ready.
+ */
+bool LidarSensor::allocatePool() {
+    if (this->robotAPI == nullptr) {
+        cout << "Error: LidarSensor has no robot API." << endl;
+        return false;
+    }
+    int number = this->robotAPI->getLidarRangeNumber();
+    if (number <= 0) {
+        return false;
+    }
+
+    const int floatsPerLine = CACHE_LINE_SIZE / sizeof(float);
+    this->rangeNumber = number;
+    this->stride = (number + floatsPerLine - 1) / floatsPerLine * floatsPerLine;
+    this->storage = static_cast<float*>(::operator new[](
+        sizeof(float) * this->stride * this->poolSize, align_val_t(CACHE_LINE_SIZE)));
+
+    for (int i = 0; i < this->poolSize; i++) {
+        this->scans[i].ranges = this->storage + i * this->stride;
+        this->scans[i].count = 0;
+        this->scans[i].sequence = 0;
+        this->freeList[i] = this->poolSize - 1 - i;
+    }
+    this->freeCount = this->poolSize;
+    return true;
+}
+
+/**
+ * @brief Reads a new scan into a free buffer.
+ * @return the scan, or nullptr if every buffer is held or the lidar reports no values.
+ */
+LidarScan* LidarSensor::acquireScan() {
+    if (this->storage == nullptr && !allocatePool()) {
+        return nullptr;
+    }
+    if (this->freeCount == 0) {
+        return nullptr;
+    }
+
+    int index = this->freeList[--this->freeCount];
+    this->inUse[index] = true;
+    LidarScan* scan = &this->scans[index];
+    {
+        METRIC_SCOPE("sensor_lidar_read");
+        this->robotAPI->getLidarRange(scan->ranges);
+    }
+    scan->count = this->rangeNumber;
+    scan->sequence = this->sequence++;
+    return scan;
+}
+
+/**
+ * @brief Reads up to n scans back to back.
+ * @param out Array receiving the scans.
+ * @param n Maximum number of scans to read.
+ * @return the number of scans written to out.
+ */
+int LidarSensor::acquireScans(LidarScan** out, int n) {
+    int read = 0;
+    while (read < n) {
+        LidarScan* scan = acquireScan();
+        if (scan == nullptr) {
+            break;
+        }
+        out[read++] = scan;
+    }
+    return read;
+}
+
+/**
+ * @brief Hands a scan back to the pool.
+ * Each buffer is marked while it is handed out, so releasing a scan twice cannot put
+ * its buffer on the free list twice and give it to two later readers.
+ * @param scan A scan returned by acquireScan() of this sensor.
+ */
+void LidarSensor::releaseScan(LidarScan* scan) {
+    if (scan == nullptr) {
+        return;
+    }
+    int index = static_cast<int>(scan - this->scans);
+    if (index < 0 || index >= this->poolSize || this->freeCount == this->poolSize) {
+        cout << "Error: scan does not belong to this LidarSensor." << endl;
+        return;
+    }
+    if (!this->inUse[index]) {
+        cout << "Error: scan was already released." << endl;
+        return;
+    }
+    this->inUse[index] = false;
+    this->freeList[this->freeCount++] = index;
+}
+
+/**
+ * @brief Returns the number of values per scan.
+ */
+int LidarSensor::getRangeNumber() const {
+    return this->rangeNumber;
+}
+
+/**
+ * @brief Returns the number of buffers in the pool.
+ */
+int LidarSensor::getPoolSize() const {
+    return this->poolSize;
+}
+
+/**
+ * @brief Returns the number of buffers that are not handed out.
+ */
+int LidarSensor::getFreeCount() const {
+    return this->storage == nullptr ? this->poolSize : this->freeCount;
+}
@@ -1 +1,142 @@
 #pragma once
+/**
+ * @file   LidarSensor.h
+ * @date   October, 2026
+ * @brief  Header file for the LidarSensor class.
+ *
+ * This file contains the definition of the LidarSensor class, which reads lidar scans
+ * from the robot into a fixed pool of preallocated buffers.
+ */
+
+#include "RobotInterface.h"
+
+//! LidarScan struct
+/*!
+ * @brief One lidar scan stored in a buffer owned by a LidarSensor pool.
+ */
+struct LidarScan {
+    float* ranges;                /*!< Range values in meters, aligned to a cache line. */
+    int count;                    /*!< Number of valid values in ranges. */
+    unsigned long long sequence;  /*!< Increasing scan number assigned by the sensor. */
+};
+
+//! LidarGeometry struct
+/*!
+ * @brief Direction and range limit of the lidar beams.
+ *
+ * Beam i points at startAngle + i * angleIncrement radians, counterclockwise from
+ * the robot heading. Readings at or beyond maxRange did not hit anything.
+ */
+struct LidarGeometry {
+    double startAngle;      /*!< Angle of beam 0 relative to the heading (radians). */
+    double angleIncrement;  /*!< Angle between two consecutive beams (radians). */
+    double maxRange;        /*!< Largest valid range (meters). */
+
+    //! fullCircle function
+    /*!
+    * @param count Number of beams in a scan.
+    * @param maxRange Largest valid range in meters.
+    * @return a geometry whose beams cover a full turn, beam 0 pointing backwards.
+    */
+    static LidarGeometry fullCircle(int count, double maxRange = 10.0) {
+        const double pi = 3.14159265358979323846;
+        LidarGeometry geometry;
+        geometry.startAngle = -pi;
+        geometry.angleIncrement = count > 0 ? 2.0 * pi / count : 0.0;
+        geometry.maxRange = maxRange;
+        return geometry;
+    }
+};
+
+//! LidarSensor class
+/*!
+ * @brief Reads lidar scans into a fixed pool of reusable, cache-aligned buffers.
+ *
+ * All buffers are allocated as one contiguous block the first time a scan is read.
+ * After that, acquireScan() only picks a free buffer and calls getLidarRange on it, so
+ * steady-state acquisition does no heap allocation. A scan stays valid until it is
+ * handed back with releaseScan(). The class is not thread safe.
+ */
+class LidarSensor {
+public:
+    static const int CACHE_LINE_SIZE = 64;  /*!< Alignment of every scan buffer in bytes. */
+    static const int DEFAULT_POOL_SIZE = 4; /*!< Number of buffers used by the default constructor. */
+
+private:
+    RobotInterface* robotAPI; /*!< Robot API the scans are read from. */
+    int poolSize;             /*!< Number of scan buffers in the pool. */
+    int rangeNumber;          /*!< Values per scan, 0 until the pool is allocated. */
+    int stride;               /*!< Floats between two buffers, a whole number of cache lines. */
+    float* storage;           /*!< Contiguous aligned block holding every buffer. */
+    LidarScan* scans;         /*!< Scan descriptors, one per buffer. */
+    int* freeList;            /*!< Stack of indices of scans that are not handed out. */
+    int freeCount;            /*!< Number of entries in freeList. */
+    bool* inUse;              /*!< True for each scan handed out and not released yet. */
+    unsigned long long sequence; /*!< Sequence number given to the next scan. */
+
+    //! allocatePool function
+    /*!
+    * Queries getLidarRangeNumber() and allocates the buffers.
+    * @return true if the pool is ready.
+    */
+    bool allocatePool();
+
+    LidarSensor(const LidarSensor&) = delete;
+    LidarSensor& operator=(const LidarSensor&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param api Robot API the scans are read from.
+    * @param poolSize Number of scan buffers that can be held at the same time.
+    */
+    LidarSensor(RobotInterface* api, int poolSize = DEFAULT_POOL_SIZE);
+
+    //! Destructor
+    /*!
+    * Frees the buffer pool. Scans that are still held become invalid.
+    */
+    ~LidarSensor();
+
+    //! acquireScan function
+    /*!
+    * Reads a new scan into a free buffer of the pool.
+    * @return the scan, or nullptr if every buffer is still held or the lidar reports no values.
+    */
+    LidarScan* acquireScan();
+
+    //! acquireScans function
+    /*!
+    * Reads up to n scans back to back into free buffers.
+    * @param out Array receiving the scans.
+    * @param n Maximum number of scans to read.
+    * @return the number of scans written to out.
+    */
+    int acquireScans(LidarScan** out, int n);
+
+    //! releaseScan function
+    /*!
+    * Hands a scan back to the pool so its buffer can be reused. A scan that is not
+    * held, for example one released twice, is rejected.
+    * @param scan A scan returned by acquireScan() of this sensor.
+    */
+    void releaseScan(LidarScan* scan);
+
+    //! getRangeNumber function
+    /*!
+    * @return values per scan, or 0 if no scan has been read yet.
+    */
+    int getRangeNumber() const;
+
+    //! getPoolSize function
+    /*!
+    * @return the number of buffers in the pool.
+    */
+    int getPoolSize() const;
+
+    //! getFreeCount function
+    /*!
+    * @return the number of buffers that are not handed out.
+    */
+    int getFreeCount() const;
+};
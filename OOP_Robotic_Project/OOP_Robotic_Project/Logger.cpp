@@ -0,0 +1,261 @@
+/**
+ * @file   Logger.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the Logger class.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "Logger.h"
+using namespace std;
+
+thread_local Logger::LogRing* Logger::localRing = nullptr;
+
+/**
+ * @brief Default constructor. Starts the writer thread.
+ */
+Logger::Logger()
+    : output(nullptr), passes(0), written(0), dropped(0), flushRequested(false), stopping(false), startNs(now()) {
+    this->text.reserve(1 << 16);
+    this->writer = thread(&Logger::writeLoop, this);
+}
+
+/**
+ * @brief Destructor. Writes the records still queued and stops the writer thread.
+ */
+Logger::~Logger() {
+    {
+        lock_guard<mutex> guard(this->lock);
+        this->stopping = true;
+    }
+    this->wake.notify_one();
+    this->writer.join();
+}
+
+/**
+ * @brief Closes the ring of a thread that exits; the writer frees it once it is empty.
+ */
+Logger::RingOwner::~RingOwner() {
+    if (this->ring) {
+        this->ring->closed.store(true, memory_order_release);
+    }
+    Logger::localRing = nullptr;
+}
+
+/**
+ * @brief Returns the process-wide logger, starting it on first use.
+ */
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+/**
+ * @brief Creates the ring of the calling thread and hands it to the writer.
+ */
+Logger::LogRing* Logger::registerThread() {
+    Logger& logger = instance();
+    thread_local RingOwner owner;
+    owner.ring = make_shared<LogRing>();
+    {
+        lock_guard<mutex> guard(logger.lock);
+        logger.rings.push_back(owner.ring);
+    }
+    localRing = owner.ring.get();
+    return localRing;
+}
+
+/**
+ * @brief Body of the writer thread.
+ *
+ * The writer makes a pass over every ring, then sleeps for WRITE_INTERVAL_MS unless
+ * the pass found records or a caller is waiting in flush().
+ */
+void Logger::writeLoop() {
+    const chrono::milliseconds interval(WRITE_INTERVAL_MS);
+    unique_lock<mutex> guard(this->lock);
+    while (true) {
+        bool stop = this->stopping;
+        unsigned long long before = this->written;
+        writePass();
+        this->passes++;
+        this->passed.notify_all();
+        if (stop) {
+            break;
+        }
+        if (this->written == before && !this->flushRequested) {
+            this->wake.wait_for(guard, interval,
+                [this] { return this->flushRequested || this->stopping; });
+        }
+        this->flushRequested = false;
+    }
+}
+
+/**
+ * @brief Takes every queued record, formats the batch in time order and writes it.
+ * Rings of threads that have exited are freed once they are empty.
+ */
+void Logger::writePass() {
+    this->batch.clear();
+    this->text.clear();
+    for (size_t r = 0; r < this->rings.size();) {
+        LogRing& ring = *this->rings[r];
+        // Read closed first: a ring that was closed before it was drained is empty for good.
+        bool closed = ring.closed.load(memory_order_acquire);
+        LogRecord* record;
+        while ((record = ring.records.front()) != nullptr) {
+            this->batch.push_back(*record);
+            ring.records.pop();
+        }
+        unsigned long long lost = ring.dropped.load(memory_order_relaxed);
+        if (lost != ring.reported) {
+            char line[96];
+            snprintf(line, sizeof(line), "[%12.6f] WARNING %llu log records dropped, ring full\n",
+                (now() - this->startNs) / 1e9, lost - ring.reported);
+            this->text += line;
+            this->dropped += lost - ring.reported;
+            ring.reported = lost;
+        }
+        if (closed) {
+            this->rings.erase(this->rings.begin() + r);
+        }
+        else {
+            r++;
+        }
+    }
+    if (this->batch.empty() && this->text.empty()) {
+        return;
+    }
+
+    stable_sort(this->batch.begin(), this->batch.end(),
+        [](const LogRecord& a, const LogRecord& b) { return a.timestampNs < b.timestampNs; });
+    for (const LogRecord& record : this->batch) {
+        format(record);
+    }
+    if (this->output != nullptr) {
+        this->output->write(this->text.data(), static_cast<streamsize>(this->text.size()));
+        this->output->flush();
+    }
+    else {
+        fwrite(this->text.data(), 1, this->text.size(), stdout);
+        fflush(stdout);
+    }
+    this->written += this->batch.size();
+}
+
+/**
+ * @brief Appends one record as a line: time in seconds, level and message.
+ * Each {} in the format is replaced by the next argument; extra arguments are ignored.
+ */
+void Logger::format(const LogRecord& record) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "[%12.6f] %-7s ", (record.timestampNs - this->startNs) / 1e9, levelName(record.level));
+    this->text += buffer;
+
+    int argument = 0;
+    const char* p = record.format;
+    while (*p != '\0') {
+        if (p[0] == '{' && p[1] == '}' && argument < record.argumentCount) {
+            const LogRecord::Value& value = record.values[argument];
+            switch (record.types[argument]) {
+            case LogRecord::SIGNED:
+                snprintf(buffer, sizeof(buffer), "%lld", value.i);
+                break;
+            case LogRecord::UNSIGNED:
+                snprintf(buffer, sizeof(buffer), "%llu", value.u);
+                break;
+            case LogRecord::REAL:
+                snprintf(buffer, sizeof(buffer), "%g", value.d);
+                break;
+            case LogRecord::BOOLEAN:
+                snprintf(buffer, sizeof(buffer), "%s", value.i ? "true" : "false");
+                break;
+            case LogRecord::CHARACTER:
+                snprintf(buffer, sizeof(buffer), "%c", static_cast<char>(value.i));
+                break;
+            case LogRecord::TEXT:
+                buffer[0] = '\0';
+                this->text += value.s != nullptr ? value.s : "(null)";
+                break;
+            }
+            this->text += buffer;
+            argument++;
+            p += 2;
+        }
+        else {
+            const char* end = strchr(p + 1, '{');
+            size_t length = end != nullptr ? static_cast<size_t>(end - p) : strlen(p);
+            this->text.append(p, length);
+            p += length;
+        }
+    }
+    this->text += '\n';
+}
+
+/**
+ * @brief Waits until every record queued before the call has been written.
+ *
+ * The pass running when flush() is called may have missed those records, so it waits
+ * for the end of the pass after it.
+ */
+void Logger::flush() {
+    Logger& logger = instance();
+    unique_lock<mutex> guard(logger.lock);
+    unsigned long long target = logger.passes + 2;
+    logger.flushRequested = true;
+    logger.wake.notify_one();
+    logger.passed.wait(guard, [&logger, target] {
+        if (logger.passes < target) {
+            logger.flushRequested = true;
+            logger.wake.notify_one();
+            return false;
+        }
+        return true;
+    });
+}
+
+/**
+ * @brief Flushes, then sends the following records to stream.
+ * @param stream Destination, or nullptr for standard output.
+ */
+void Logger::setOutput(ostream* stream) {
+    flush();
+    Logger& logger = instance();
+    lock_guard<mutex> guard(logger.lock);
+    logger.output = stream;
+}
+
+unsigned long long Logger::getWrittenCount() {
+    Logger& logger = instance();
+    lock_guard<mutex> guard(logger.lock);
+    return logger.written;
+}
+
+/**
+ * @brief Returns the records lost because a ring was full, as reported so far by the writer.
+ * Call flush() first to include the latest drops.
+ */
+unsigned long long Logger::getDroppedCount() {
+    Logger& logger = instance();
+    lock_guard<mutex> guard(logger.lock);
+    return logger.dropped;
+}
+
+/**
+ * @brief Returns the name printed for a level.
+ */
+const char* Logger::levelName(int level) {
+    switch (level) {
+    case LOG_LEVEL_DEBUG:
+        return "DEBUG";
+    case LOG_LEVEL_INFO:
+        return "INFO";
+    case LOG_LEVEL_WARNING:
+        return "WARNING";
+    case LOG_LEVEL_ERROR:
+        return "ERROR";
+    default:
+        return "?";
+    }
+}
@@ -0,0 +1,281 @@
+#pragma once
+/**
+ * @file   Logger.h
+ * @date   October, 2026
+ * @brief  Header file for the Logger class and the LOG_* macros.
+ *
+ * This file contains the definition of the logging subsystem: log calls store a small
+ * binary record in a ring owned by the calling thread, and a background thread formats
+ * and writes the records.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SpscRing.h"
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_OFF 4
+
+// Calls below LOG_MIN_LEVEL are removed by the preprocessor and their arguments are
+// never evaluated. Define it on the compiler command line to change it.
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) Logger::log(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(...) Logger::log(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARNING
+#define LOG_WARNING(...) Logger::log(LOG_LEVEL_WARNING, __VA_ARGS__)
+#else
+#define LOG_WARNING(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) Logger::log(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+//! LogRecord struct
+/*!
+ * @brief One log call, stored unformatted.
+ *
+ * The format string is kept as a pointer and the arguments as raw values, so a log call
+ * copies a few words instead of building text. Text arguments are also kept as
+ * pointers and must outlive the record: string literals and other static strings only.
+ */
+struct LogRecord {
+    static const int MAX_ARGUMENTS = 5; /*!< Arguments a log call can carry. */
+
+    //! ArgumentType enum
+    enum ArgumentType : uint8_t {
+        SIGNED = 0,
+        UNSIGNED,
+        REAL,
+        TEXT,
+        BOOLEAN,
+        CHARACTER
+    };
+
+    //! Value union
+    union Value {
+        long long i;          /*!< SIGNED, BOOLEAN and CHARACTER arguments. */
+        unsigned long long u; /*!< UNSIGNED arguments. */
+        double d;             /*!< REAL arguments. */
+        const char* s;        /*!< TEXT arguments. */
+    };
+
+    long long timestampNs;              /*!< Steady clock time of the call, in nanoseconds. */
+    const char* format;                 /*!< Message with a {} for each argument. */
+    uint8_t level;                      /*!< One of the LOG_LEVEL_* values. */
+    uint8_t argumentCount;              /*!< Arguments stored in values. */
+    uint8_t types[MAX_ARGUMENTS];       /*!< ArgumentType of each argument. */
+    Value values[MAX_ARGUMENTS];        /*!< Argument values. */
+
+    //! set functions
+    /*!
+    * Store argument i.
+    */
+    void set(int i, int value) { types[i] = SIGNED; values[i].i = value; }
+    void set(int i, long value) { types[i] = SIGNED; values[i].i = value; }
+    void set(int i, long long value) { types[i] = SIGNED; values[i].i = value; }
+    void set(int i, unsigned int value) { types[i] = UNSIGNED; values[i].u = value; }
+    void set(int i, unsigned long value) { types[i] = UNSIGNED; values[i].u = value; }
+    void set(int i, unsigned long long value) { types[i] = UNSIGNED; values[i].u = value; }
+    void set(int i, float value) { types[i] = REAL; values[i].d = value; }
+    void set(int i, double value) { types[i] = REAL; values[i].d = value; }
+    void set(int i, bool value) { types[i] = BOOLEAN; values[i].i = value; }
+    void set(int i, char value) { types[i] = CHARACTER; values[i].i = value; }
+    void set(int i, const char* value) { types[i] = TEXT; values[i].s = value; }
+};
+
+static_assert(sizeof(LogRecord) <= 64, "LogRecord should fit in a cache line");
+
+//! Logger class
+/*!
+ * @brief Asynchronous logger with one lock-free ring per thread.
+ *
+ * The first log call of a thread registers a ring for it; after that a call reads the
+ * clock and copies a LogRecord into that ring, without locks, allocation or system
+ * calls. If the ring is full the record is dropped and counted rather than blocking
+ * the caller. A writer thread collects the records of all threads, orders each batch
+ * by time, formats it and writes it with one call, so the output is flushed once per
+ * batch instead of once per line.
+ *
+ * Output goes to standard output unless setOutput() is given a stream. Records still
+ * queued when the program exits are written by the logger's destructor.
+ */
+class Logger {
+public:
+    static const int RING_SIZE = 1024;         /*!< Records each thread can queue. */
+    static const int WRITE_INTERVAL_MS = 1;    /*!< Time the writer sleeps when every ring is empty. */
+
+private:
+    //! LogRing struct
+    /*!
+     * @brief Records of one thread.
+     */
+    struct LogRing {
+        SpscRing<LogRecord, RING_SIZE> records;     /*!< Records waiting for the writer. */
+        std::atomic<unsigned long long> dropped;    /*!< Records lost because the ring was full. */
+        unsigned long long reported;                /*!< Drops already written, owned by the writer. */
+        std::atomic<bool> closed;                   /*!< The thread has exited. */
+
+        LogRing() : dropped(0), reported(0), closed(false) {}
+    };
+
+    //! RingOwner struct
+    /*!
+     * @brief Thread-local handle that closes the ring when its thread exits.
+     */
+    struct RingOwner {
+        std::shared_ptr<LogRing> ring; /*!< Ring of this thread. */
+        ~RingOwner();
+    };
+
+    static thread_local LogRing* localRing;     /*!< Ring of the calling thread, nullptr until its first call. */
+
+    std::mutex lock;                            /*!< Guards the fields below. */
+    std::condition_variable wake;               /*!< Wakes the writer. */
+    std::condition_variable passed;             /*!< Signals the end of a writer pass. */
+    std::vector<std::shared_ptr<LogRing>> rings; /*!< Rings of every thread that logged. */
+    std::vector<LogRecord> batch;               /*!< Records taken in the current pass. */
+    std::string text;                           /*!< Formatted batch. */
+    std::ostream* output;                       /*!< Destination, nullptr for standard output. */
+    unsigned long long passes;                  /*!< Completed writer passes. */
+    unsigned long long written;                 /*!< Records written. */
+    unsigned long long dropped;                 /*!< Drops reported by the writer. */
+    bool flushRequested;                        /*!< A caller is waiting in flush(). */
+    bool stopping;                              /*!< Tells the writer to exit. */
+    long long startNs;                          /*!< Time printed as 0. */
+    std::thread writer;                         /*!< Writer thread. */
+
+    Logger();
+    ~Logger();
+
+    //! instance function
+    static Logger& instance();
+
+    //! registerThread function
+    /*!
+    * Creates the ring of the calling thread.
+    */
+    static LogRing* registerThread();
+
+    //! writeLoop function
+    /*!
+    * Body of the writer thread.
+    */
+    void writeLoop();
+
+    //! writePass function
+    /*!
+    * Takes every queued record, formats and writes them. Called with lock held.
+    */
+    void writePass();
+
+    //! format function
+    /*!
+    * Appends one record as a line of text.
+    */
+    void format(const LogRecord& record);
+
+    //! store functions
+    /*!
+    * Copy the arguments of a log call into a record.
+    */
+    static void store(LogRecord&, int) {}
+
+    template <typename First, typename... Rest>
+    static void store(LogRecord& record, int i, const First& first, const Rest&... rest) {
+        record.set(i, first);
+        store(record, i + 1, rest...);
+    }
+
+    //! now function
+    /*!
+    * @return the steady clock time in nanoseconds.
+    */
+    static long long now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+public:
+    //! log function
+    /*!
+    * Queues a record for the writer. Use the LOG_* macros instead, so calls below
+    * LOG_MIN_LEVEL compile to nothing.
+    * @param level One of the LOG_LEVEL_* values.
+    * @param format Message with a {} for each argument; must be a static string.
+    * @param arguments Up to LogRecord::MAX_ARGUMENTS numbers, characters, booleans or static strings.
+    */
+    template <typename... Args>
+    static void log(int level, const char* format, const Args&... arguments) {
+        static_assert(sizeof...(Args) <= LogRecord::MAX_ARGUMENTS, "too many log arguments");
+        LogRing* ring = localRing;
+        if (ring == nullptr) {
+            ring = registerThread();
+        }
+        LogRecord* record = ring->records.beginWrite();
+        if (record == nullptr) {
+            ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        record->timestampNs = now();
+        record->format = format;
+        record->level = static_cast<uint8_t>(level);
+        record->argumentCount = static_cast<uint8_t>(sizeof...(Args));
+        store(*record, 0, arguments...);
+        ring->records.commitWrite();
+    }
+
+    //! flush function
+    /*!
+    * Waits until every record queued before the call has been written.
+    */
+    static void flush();
+
+    //! setOutput function
+    /*!
+    * Flushes, then sends the following records to stream.
+    * @param stream Destination, or nullptr for standard output. It must stay valid
+    * until it is replaced.
+    */
+    static void setOutput(std::ostream* stream);
+
+    //! getWrittenCount function
+    static unsigned long long getWrittenCount();
+
+    //! getDroppedCount function
+    /*!
+    * @return the records lost by every thread because its ring was full.
+    */
+    static unsigned long long getDroppedCount();
+
+    //! levelName function
+    static const char* levelName(int level);
+};
@@ -0,0 +1,339 @@
+/**
+ * @file   MAP.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the MAP class.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include "MAP.h"
+#include "RayCaster.h"
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor.
+ * Creates an empty map centered on the world origin.
+ */
+MAP::MAP(double widthMeters, double heightMeters, double resolution)
+    : MAP(widthMeters, heightMeters, resolution, -widthMeters / 2.0, -heightMeters / 2.0) {
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * The size is rounded up to a whole number of tiles. Only the tile index is allocated.
+ */
+MAP::MAP(double widthMeters, double heightMeters, double resolution, double originX, double originY) {
+    this->resolution = resolution > 0 ? resolution : 0.05;
+    this->originX = originX;
+    this->originY = originY;
+    int cellsX = static_cast<int>(ceil(widthMeters / this->resolution));
+    int cellsY = static_cast<int>(ceil(heightMeters / this->resolution));
+    this->tilesX = cellsX > 0 ? (cellsX + TILE_SIZE - 1) / TILE_SIZE : 1;
+    this->tilesY = cellsY > 0 ? (cellsY + TILE_SIZE - 1) / TILE_SIZE : 1;
+    this->width = this->tilesX * TILE_SIZE;
+    this->height = this->tilesY * TILE_SIZE;
+    this->tileIndex = new Tile*[this->tilesX * this->tilesY]();
+    this->usedInBlock = TILES_PER_BLOCK;
+    this->tileCount = 0;
+    this->rayCaster = nullptr;
+    this->trackChanges = false;
+    setUpdateModel(0.85f, -0.4f, -5.0f, 5.0f);
+}
+
+/**
+ * @brief Destructor. Frees every tile block.
+ */
+MAP::~MAP() {
+    for (size_t i = 0; i < this->blocks.size(); i++) {
+        delete[] this->blocks[i];
+    }
+    delete[] this->tileIndex;
+    delete this->rayCaster;
+}
+
+/**
+ * @brief Returns the tile at (tx, ty), allocating it from the current block if needed.
+ */
+MAP::Tile* MAP::tileFor(int tx, int ty) {
+    Tile*& tile = this->tileIndex[ty * this->tilesX + tx];
+    if (tile == nullptr) {
+        if (this->usedInBlock == TILES_PER_BLOCK) {
+            Tile* block = new Tile[TILES_PER_BLOCK];
+            for (int i = 0; i < TILES_PER_BLOCK; i++) {
+                for (int c = 0; c < TILE_CELLS; c++) {
+                    block[i].cells[c] = 0.0f;
+                }
+            }
+            this->blocks.push_back(block);
+            this->usedInBlock = 0;
+        }
+        tile = &this->blocks.back()[this->usedInBlock++];
+        this->tileCount++;
+    }
+    return tile;
+}
+
+/**
+ * @brief Classifies log-odds with the same thresholds as isOccupied() and isFree().
+ */
+inline int MAP::classify(float logOdds) const {
+    return (logOdds > this->occupiedLogOdds ? 1 : 0) - (logOdds < this->freeLogOdds ? 1 : 0);
+}
+
+/**
+ * @brief Writes a cell, recording it when tracking is on and its classification changed.
+ */
+inline void MAP::store(float& cell, float value, int cx, int cy) {
+    if (this->trackChanges && classify(cell) != classify(value)) {
+        this->changedCells.push_back(GridCell{ cx, cy });
+    }
+    cell = value;
+}
+
+/**
+ * @brief Converts a world point to the cell that contains it.
+ * @return true if the point lies inside the map.
+ */
+bool MAP::worldToCell(double x, double y, int& cx, int& cy) const {
+    cx = static_cast<int>(floor((x - this->originX) / this->resolution));
+    cy = static_cast<int>(floor((y - this->originY) / this->resolution));
+    return isInside(cx, cy);
+}
+
+/**
+ * @brief Converts a cell to the world coordinates of its center.
+ */
+void MAP::cellToWorld(int cx, int cy, double& x, double& y) const {
+    x = this->originX + (cx + 0.5) * this->resolution;
+    y = this->originY + (cy + 0.5) * this->resolution;
+}
+
+bool MAP::isInside(int cx, int cy) const {
+    return cx >= 0 && cy >= 0 && cx < this->width && cy < this->height;
+}
+
+/**
+ * @brief Returns the log-odds of a cell, 0 if it is unknown or outside the map.
+ */
+float MAP::getLogOdds(int cx, int cy) const {
+    if (!isInside(cx, cy)) {
+        return 0.0f;
+    }
+    const Tile* tile = this->tileIndex[(cy >> TILE_SHIFT) * this->tilesX + (cx >> TILE_SHIFT)];
+    if (tile == nullptr) {
+        return 0.0f;
+    }
+    return tile->cells[((cy & TILE_MASK) << TILE_SHIFT) | (cx & TILE_MASK)];
+}
+
+/**
+ * @brief Returns the occupancy probability of a cell.
+ */
+double MAP::getProbability(int cx, int cy) const {
+    return 1.0 - 1.0 / (1.0 + exp(static_cast<double>(getLogOdds(cx, cy))));
+}
+
+bool MAP::isOccupied(int cx, int cy) const {
+    return getLogOdds(cx, cy) > this->occupiedLogOdds;
+}
+
+bool MAP::isFree(int cx, int cy) const {
+    return getLogOdds(cx, cy) < this->freeLogOdds;
+}
+
+/**
+ * @brief Adds delta to the log-odds of a cell, clamped to the allowed range.
+ */
+void MAP::updateCell(int cx, int cy, float delta) {
+    if (!isInside(cx, cy)) {
+        return;
+    }
+    Tile* tile = tileFor(cx >> TILE_SHIFT, cy >> TILE_SHIFT);
+    float& cell = tile->cells[((cy & TILE_MASK) << TILE_SHIFT) | (cx & TILE_MASK)];
+    float value = cell + delta;
+    store(cell, value < this->minLogOdds ? this->minLogOdds : (value > this->maxLogOdds ? this->maxLogOdds : value), cx, cy);
+}
+
+/**
+ * @brief Traces one beam with Bresenham's line algorithm.
+ *
+ * The current tile pointer is kept across steps and only looked up again when the
+ * ray crosses into another tile.
+ */
+void MAP::traceRay(int x0, int y0, int x1, int y1, bool hit) {
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+    int currentTx = -1;
+    int currentTy = -1;
+    Tile* tile = nullptr;
+
+    while (x0 != x1 || y0 != y1) {
+        if (!isInside(x0, y0)) {
+            return;
+        }
+        int tx = x0 >> TILE_SHIFT;
+        int ty = y0 >> TILE_SHIFT;
+        if (tx != currentTx || ty != currentTy) {
+            tile = tileFor(tx, ty);
+            currentTx = tx;
+            currentTy = ty;
+        }
+        float& cell = tile->cells[((y0 & TILE_MASK) << TILE_SHIFT) | (x0 & TILE_MASK)];
+        float value = cell + this->missLogOdds;
+        store(cell, value < this->minLogOdds ? this->minLogOdds : value, x0, y0);
+
+        int doubled = 2 * error;
+        if (doubled >= dy) {
+            error += dy;
+            x0 += sx;
+        }
+        if (doubled <= dx) {
+            error += dx;
+            y0 += sy;
+        }
+    }
+    if (hit) {
+        updateCell(x1, y1, this->hitLogOdds);
+    }
+}
+
+/**
+ * @brief Adds one lidar scan taken at the given pose.
+ *
+ * Beams with a non-positive or NaN range are skipped. Beams at or beyond the maximum
+ * range only clear cells up to the maximum range. Each lane of the ray caster keeps
+ * its own current tile, so neighbouring beams do not evict each other's tile.
+ * A map too large for the fixed-point positions of the ray caster traces one beam at
+ * a time with traceRay().
+ */
+void MAP::integrateScan(const Pose& pose, const float* ranges, int count, const LidarGeometry& geometry) {
+    int robotX;
+    int robotY;
+    if (!worldToCell(pose.getX(), pose.getY(), robotX, robotY)) {
+        cout << "Error: scan pose is outside the map." << endl;
+        return;
+    }
+    if (this->width > RayCaster::MAX_CELLS || this->height > RayCaster::MAX_CELLS) {
+        for (int i = 0; i < count; i++) {
+            if (!(ranges[i] > 0.0f)) {
+                continue;
+            }
+            bool hit = ranges[i] < geometry.maxRange;
+            double length = hit ? ranges[i] : geometry.maxRange;
+            double angle = pose.getTh() + geometry.startAngle + i * geometry.angleIncrement;
+            int endX;
+            int endY;
+            worldToCell(pose.getX() + length * cos(angle), pose.getY() + length * sin(angle), endX, endY);
+            traceRay(robotX, robotY, endX, endY, hit);
+        }
+        return;
+    }
+    if (this->rayCaster == nullptr || !this->rayCaster->matches(geometry, count)) {
+        delete this->rayCaster;
+        this->rayCaster = new RayCaster(geometry, count);
+    }
+
+    float startX = static_cast<float>((pose.getX() - this->originX) / this->resolution);
+    float startY = static_cast<float>((pose.getY() - this->originY) / this->resolution);
+    this->rayCaster->computeEndpoints(startX, startY, pose.getTh(), static_cast<float>(1.0 / this->resolution), ranges);
+
+    Tile* laneTile[RayCaster::TRACE_LANES];
+    int laneTileIndex[RayCaster::TRACE_LANES];
+    for (int lane = 0; lane < RayCaster::TRACE_LANES; lane++) {
+        laneTile[lane] = nullptr;
+        laneTileIndex[lane] = -1;
+    }
+    auto visit = [&](int lane, int cx, int cy, bool hit) -> bool {
+        if (static_cast<unsigned>(cx) >= static_cast<unsigned>(this->width)
+            || static_cast<unsigned>(cy) >= static_cast<unsigned>(this->height)) {
+            return false;
+        }
+        int index = (cy >> TILE_SHIFT) * this->tilesX + (cx >> TILE_SHIFT);
+        if (index != laneTileIndex[lane]) {
+            laneTile[lane] = tileFor(cx >> TILE_SHIFT, cy >> TILE_SHIFT);
+            laneTileIndex[lane] = index;
+        }
+        float& cell = laneTile[lane]->cells[((cy & TILE_MASK) << TILE_SHIFT) | (cx & TILE_MASK)];
+        float value = cell + (hit ? this->hitLogOdds : this->missLogOdds);
+        store(cell, value < this->minLogOdds ? this->minLogOdds : (value > this->maxLogOdds ? this->maxLogOdds : value), cx, cy);
+        return true;
+    };
+    this->rayCaster->trace(visit);
+}
+
+/**
+ * @brief Sets the log-odds update model.
+ * Cells count as occupied above hit / 2 and as free below miss / 2.
+ */
+void MAP::setUpdateModel(float hit, float miss, float minimum, float maximum) {
+    this->hitLogOdds = hit;
+    this->missLogOdds = miss;
+    this->minLogOdds = minimum;
+    this->maxLogOdds = maximum;
+    this->occupiedLogOdds = hit / 2.0f;
+    this->freeLogOdds = miss / 2.0f;
+}
+
+/**
+ * @brief Starts or stops recording cells whose classification changes.
+ */
+void MAP::setChangeTracking(bool enabled) {
+    this->trackChanges = enabled;
+    if (!enabled) {
+        this->changedCells.clear();
+    }
+}
+
+bool MAP::isChangeTracking() const {
+    return this->trackChanges;
+}
+
+/**
+ * @brief Hands the recorded cells to the caller, sorted row by row without repeats.
+ *
+ * The internal vector is swapped with the caller's, so both keep their capacity and a
+ * caller that takes the set after every scan does not allocate once warmed up.
+ */
+size_t MAP::takeChangedCells(vector<GridCell>& cells) {
+    cells.clear();
+    cells.swap(this->changedCells);
+    sort(cells.begin(), cells.end(), [](const GridCell& a, const GridCell& b) {
+        return a.y < b.y || (a.y == b.y && a.x < b.x);
+    });
+    cells.erase(unique(cells.begin(), cells.end(), [](const GridCell& a, const GridCell& b) {
+        return a.x == b.x && a.y == b.y;
+    }), cells.end());
+    return cells.size();
+}
+
+size_t MAP::getChangedCount() const {
+    return this->changedCells.size();
+}
+
+int MAP::getWidth() const {
+    return this->width;
+}
+
+int MAP::getHeight() const {
+    return this->height;
+}
+
+double MAP::getResolution() const {
+    return this->resolution;
+}
+
+int MAP::getTileCount() const {
+    return this->tileCount;
+}
+
+/**
+ * @brief Returns bytes used by tile blocks and the tile index.
+ */
+size_t MAP::getMemoryUsage() const {
+    return this->blocks.size() * TILES_PER_BLOCK * sizeof(Tile) + this->tilesX * this->tilesY * sizeof(Tile*);
+}
@@ -1 +1,254 @@
 #pragma once
+/**
+ * @file   MAP.h
+ * @date   October, 2026
+ * @brief  Header file for the MAP class.
+ *
+ * This file contains the definition of the MAP class, a 2D occupancy grid built from
+ * lidar scans taken at known robot poses.
+ */
+
+#include <vector>
+#include "Pose.h"
+#include "LidarSensor.h"
+
+class RayCaster;
+
+//! GridCell struct
+/*!
+ * @brief Column and row of a map cell.
+ */
+struct GridCell {
+    int x; /*!< Column. */
+    int y; /*!< Row. */
+};
+
+//! MAP class
+/*!
+ * @brief Occupancy grid with log-odds cells stored in lazily allocated tiles.
+ *
+ * The map covers a fixed rectangle of the world, split into square cells of
+ * resolution meters. Cells are grouped into TILE_SIZE x TILE_SIZE tiles; the cells of
+ * a tile are contiguous in memory so a ray that crosses a few tiles stays in a few
+ * cache-friendly blocks. A tile is only allocated the first time one of its cells is
+ * updated, so memory grows with the area the robot has seen, not with the map size.
+ * Tiles are allocated TILES_PER_BLOCK at a time.
+ *
+ * Each cell holds the log-odds of being occupied; 0 means unknown. integrateScan()
+ * lowers the cells a beam passes through and raises the cell where it ends. Scans are
+ * placed and traced in batches by a RayCaster. Its fixed-point positions only hold
+ * RayCaster::MAX_CELLS cells on a side, so a larger map traces each beam with
+ * traceRay() instead.
+ *
+ * With change tracking on, every write that moves a cell between unknown, free and
+ * occupied records the cell. takeChangedCells() hands that set to a consumer such as
+ * an IncrementalPlanner, which then only has to look at what the last scans changed.
+ *
+ * Headings are the values reported by FestoRobotAPI::getXYTh, in radians.
+ */
+class MAP {
+public:
+    static const int TILE_SHIFT = 6;                      /*!< log2 of the tile side. */
+    static const int TILE_SIZE = 1 << TILE_SHIFT;         /*!< Cells per tile side. */
+    static const int TILE_MASK = TILE_SIZE - 1;           /*!< Cell offset inside a tile. */
+    static const int TILE_CELLS = TILE_SIZE * TILE_SIZE;  /*!< Cells per tile. */
+    static const int TILES_PER_BLOCK = 16;                /*!< Tiles allocated together. */
+
+    //! Tile struct
+    /*!
+     * @brief TILE_SIZE x TILE_SIZE cells, row major, aligned to a cache line.
+     */
+    struct alignas(64) Tile {
+        float cells[TILE_CELLS]; /*!< Log-odds of each cell. */
+    };
+
+private:
+    double resolution;     /*!< Cell side in meters. */
+    double originX;        /*!< World x of the corner of cell (0, 0) (meters). */
+    double originY;        /*!< World y of the corner of cell (0, 0) (meters). */
+    int width;             /*!< Map width in cells, a whole number of tiles. */
+    int height;            /*!< Map height in cells, a whole number of tiles. */
+    int tilesX;            /*!< Number of tile columns. */
+    int tilesY;            /*!< Number of tile rows. */
+    Tile** tileIndex;      /*!< tilesX * tilesY tile pointers, nullptr until the tile is used. */
+    std::vector<Tile*> blocks; /*!< Allocated tile blocks. */
+    int usedInBlock;       /*!< Tiles handed out from the last block. */
+    int tileCount;         /*!< Number of allocated tiles. */
+
+    float hitLogOdds;      /*!< Added to the cell where a beam ends. */
+    float missLogOdds;     /*!< Added to each cell a beam passes through. */
+    float minLogOdds;      /*!< Lower clamp of a cell. */
+    float maxLogOdds;      /*!< Upper clamp of a cell. */
+    float occupiedLogOdds; /*!< Cells above this value are occupied. */
+    float freeLogOdds;     /*!< Cells below this value are free. */
+    RayCaster* rayCaster;  /*!< Batched ray caster, rebuilt when the lidar geometry changes. */
+    bool trackChanges;     /*!< Record cells whose classification changes. */
+    std::vector<GridCell> changedCells; /*!< Cells recorded since the last takeChangedCells(). */
+
+    //! tileFor function
+    /*!
+    * @return the tile at (tx, ty), allocating it if needed.
+    */
+    Tile* tileFor(int tx, int ty);
+
+    //! classify function
+    /*!
+    * @return 1 for occupied, -1 for free, 0 for unknown log-odds.
+    */
+    int classify(float logOdds) const;
+
+    //! store function
+    /*!
+    * Writes a new log-odds to a cell and records the cell if its classification changed.
+    */
+    void store(float& cell, float value, int cx, int cy);
+
+    MAP(const MAP&) = delete;
+    MAP& operator=(const MAP&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * Creates an empty map centered on the world origin.
+    * @param widthMeters Width of the mapped area (meters).
+    * @param heightMeters Height of the mapped area (meters).
+    * @param resolution Cell side (meters).
+    */
+    MAP(double widthMeters, double heightMeters, double resolution);
+
+    //! Parameterized Constructor
+    /*!
+    * @param widthMeters Width of the mapped area (meters).
+    * @param heightMeters Height of the mapped area (meters).
+    * @param resolution Cell side (meters).
+    * @param originX World x of the lower left corner (meters).
+    * @param originY World y of the lower left corner (meters).
+    */
+    MAP(double widthMeters, double heightMeters, double resolution, double originX, double originY);
+
+    //! Destructor
+    /*!
+    * Frees every tile block.
+    */
+    ~MAP();
+
+    //! worldToCell function
+    /*!
+    * @param x World x (meters).
+    * @param y World y (meters).
+    * @param cx Receives the cell column.
+    * @param cy Receives the cell row.
+    * @return true if the point lies inside the map.
+    */
+    bool worldToCell(double x, double y, int& cx, int& cy) const;
+
+    //! cellToWorld function
+    /*!
+    * @param cx Cell column.
+    * @param cy Cell row.
+    * @param x Receives the world x of the cell center (meters).
+    * @param y Receives the world y of the cell center (meters).
+    */
+    void cellToWorld(int cx, int cy, double& x, double& y) const;
+
+    //! isInside function
+    bool isInside(int cx, int cy) const;
+
+    //! getLogOdds function
+    /*!
+    * @return the log-odds of the cell, 0 if it is unknown or outside the map.
+    */
+    float getLogOdds(int cx, int cy) const;
+
+    //! getProbability function
+    /*!
+    * @return the occupancy probability of the cell, 0.5 if it is unknown.
+    */
+    double getProbability(int cx, int cy) const;
+
+    //! isOccupied function
+    bool isOccupied(int cx, int cy) const;
+
+    //! isFree function
+    bool isFree(int cx, int cy) const;
+
+    //! updateCell function
+    /*!
+    * Adds delta to the log-odds of a cell, clamped to the allowed range.
+    */
+    void updateCell(int cx, int cy, float delta);
+
+    //! traceRay function
+    /*!
+    * Lowers every cell on the line from (x0, y0) up to (x1, y1) and, if hit is true,
+    * raises the end cell. Cells outside the map end the ray.
+    */
+    void traceRay(int x0, int y0, int x1, int y1, bool hit);
+
+    //! integrateScan function
+    /*!
+    * Adds one lidar scan taken at the given pose. All beams are placed with SIMD and
+    * traced several at a time by the RayCaster.
+    * @param pose Robot pose when the scan was taken.
+    * @param ranges Lidar ranges in meters.
+    * @param count Number of ranges.
+    * @param geometry Beam directions and range limit.
+    */
+    void integrateScan(const Pose& pose, const float* ranges, int count, const LidarGeometry& geometry);
+
+    //! setUpdateModel function
+    /*!
+    * @param hit Log-odds added where a beam ends.
+    * @param miss Log-odds added where a beam passes (negative).
+    * @param minimum Lower clamp.
+    * @param maximum Upper clamp.
+    */
+    void setUpdateModel(float hit, float miss, float minimum, float maximum);
+
+    //! setChangeTracking function
+    /*!
+    * Starts or stops recording the cells whose classification changes. Stopping
+    * discards the cells recorded so far. Tracking is off by default.
+    */
+    void setChangeTracking(bool enabled);
+
+    //! isChangeTracking function
+    bool isChangeTracking() const;
+
+    //! takeChangedCells function
+    /*!
+    * Moves the cells recorded since the last call to cells, row by row and each once,
+    * and starts a new set. A cell that changed and changed back is still reported.
+    * @param cells Receives the changed cells; its previous content is discarded.
+    * @return the number of changed cells.
+    */
+    size_t takeChangedCells(std::vector<GridCell>& cells);
+
+    //! getChangedCount function
+    /*!
+    * @return the number of changes recorded since the last takeChangedCells(),
+    * counting a cell again each time it changes.
+    */
+    size_t getChangedCount() const;
+
+    //! getWidth function
+    int getWidth() const;
+
+    //! getHeight function
+    int getHeight() const;
+
+    //! getResolution function
+    double getResolution() const;
+
+    //! getTileCount function
+    /*!
+    * @return the number of allocated tiles.
+    */
+    int getTileCount() const;
+
+    //! getMemoryUsage function
+    /*!
+    * @return bytes used by tile blocks and the tile index.
+    */
+    size_t getMemoryUsage() const;
+};
@@ -0,0 +1,484 @@
+/**
+ * @file   Metrics.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the Metrics class.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "Metrics.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+atomic<bool> Metrics::enabled(false);
+atomic<bool> Metrics::tracing(false);
+thread_local Metrics::MetricShard* Metrics::localShard = nullptr;
+
+static const long long NO_MINIMUM = 0x7fffffffffffffffLL;
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero value.
+ */
+static inline int highestBit(unsigned long long value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(value);
+#endif
+}
+
+/**
+ * @brief Parameterized Constructor. Starts with zero counters, no histograms and an empty ring.
+ */
+Metrics::MetricShard::MetricShard(int thread) : traceDropped(0), thread(thread) {
+    for (int i = 0; i < MAX_COUNTERS; i++) {
+        this->counters[i].store(0, memory_order_relaxed);
+    }
+    for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+        this->histograms[i].store(nullptr, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Destructor. Frees the histograms.
+ */
+Metrics::MetricShard::~MetricShard() {
+    for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+        delete this->histograms[i].load(memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Default constructor.
+ */
+Metrics::Metrics() : eventsDropped(0), startNs(nowNs()) {
+}
+
+/**
+ * @brief Returns the process-wide metrics, created on first use.
+ */
+Metrics& Metrics::instance() {
+    static Metrics metrics;
+    return metrics;
+}
+
+/**
+ * @brief Creates the shard of the calling thread and adds it to the shards read by exports.
+ * The shard is shared with the registry, so it outlives its thread.
+ */
+Metrics::MetricShard* Metrics::registerThread() {
+    Metrics& metrics = instance();
+    thread_local shared_ptr<MetricShard> owner;
+    lock_guard<mutex> guard(metrics.lock);
+    owner = make_shared<MetricShard>(static_cast<int>(metrics.shards.size()));
+    metrics.shards.push_back(owner);
+    localShard = owner.get();
+    return localShard;
+}
+
+void Metrics::setEnabled(bool on) {
+    enabled.store(on);
+}
+
+void Metrics::setTracing(bool on) {
+    tracing.store(on);
+}
+
+/**
+ * @brief Returns the index of a name, adding it if there is room.
+ */
+int Metrics::registerName(vector<string>& names, const char* name, int limit) {
+    lock_guard<mutex> guard(this->lock);
+    for (size_t i = 0; i < names.size(); i++) {
+        if (names[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    if (static_cast<int>(names.size()) >= limit) {
+        cout << "Error: no room to register metric " << name << "." << endl;
+        return -1;
+    }
+    names.push_back(name);
+    return static_cast<int>(names.size()) - 1;
+}
+
+int Metrics::counter(const char* name) {
+    Metrics& metrics = instance();
+    return metrics.registerName(metrics.counterNames, name, MAX_COUNTERS);
+}
+
+int Metrics::histogram(const char* name) {
+    Metrics& metrics = instance();
+    return metrics.registerName(metrics.histogramNames, name, MAX_HISTOGRAMS);
+}
+
+/**
+ * @brief Returns the bucket of a value: values below 2^SUB_BUCKET_BITS are their own
+ * bucket, larger ones are placed by their highest bit and the SUB_BUCKET_BITS bits below it.
+ */
+int Metrics::bucketOf(long long nanoseconds) {
+    const long long subCount = 1LL << SUB_BUCKET_BITS;
+    if (nanoseconds < subCount) {
+        return nanoseconds > 0 ? static_cast<int>(nanoseconds) : 0;
+    }
+    int exponent = highestBit(static_cast<unsigned long long>(nanoseconds));
+    if (exponent >= MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    int shift = exponent - SUB_BUCKET_BITS;
+    int sub = static_cast<int>((nanoseconds >> shift) & (subCount - 1));
+    return ((shift + 1) << SUB_BUCKET_BITS) + sub;
+}
+
+/**
+ * @brief Returns the largest value of a bucket; larger values also land in the last one.
+ */
+long long Metrics::bucketUpper(int bucket) {
+    const int subCount = 1 << SUB_BUCKET_BITS;
+    if (bucket < subCount) {
+        return bucket;
+    }
+    int shift = (bucket >> SUB_BUCKET_BITS) - 1;
+    long long lower = static_cast<long long>(subCount + (bucket & (subCount - 1))) << shift;
+    return lower + (1LL << shift) - 1;
+}
+
+/**
+ * @brief Adds a sample to a histogram of the calling thread.
+ * The first sample of a histogram on a thread allocates its shard.
+ */
+void Metrics::record(int histogram, long long nanoseconds) {
+    if (histogram < 0) {
+        return;
+    }
+    if (nanoseconds < 0) {
+        nanoseconds = 0;
+    }
+    MetricShard* local = shard();
+    HistogramShard* h = local->histograms[histogram].load(memory_order_relaxed);
+    if (h == nullptr) {
+        h = new HistogramShard();
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            h->buckets[i].store(0, memory_order_relaxed);
+        }
+        h->count.store(0, memory_order_relaxed);
+        h->sum.store(0, memory_order_relaxed);
+        h->minimum.store(NO_MINIMUM, memory_order_relaxed);
+        h->maximum.store(0, memory_order_relaxed);
+        local->histograms[histogram].store(h, memory_order_release);
+    }
+    atomic<unsigned long long>& bucket = h->buckets[bucketOf(nanoseconds)];
+    bucket.store(bucket.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    h->count.store(h->count.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    h->sum.store(h->sum.load(memory_order_relaxed) + nanoseconds, memory_order_relaxed);
+    if (nanoseconds < h->minimum.load(memory_order_relaxed)) {
+        h->minimum.store(nanoseconds, memory_order_relaxed);
+    }
+    if (nanoseconds > h->maximum.load(memory_order_relaxed)) {
+        h->maximum.store(nanoseconds, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Queues a trace event in the ring of the calling thread, or counts it as dropped.
+ */
+void Metrics::trace(int histogram, long long startNs, long long durationNs) {
+    if (histogram < 0) {
+        return;
+    }
+    MetricShard* local = shard();
+    TraceEvent* event = local->trace.beginWrite();
+    if (event == nullptr) {
+        local->traceDropped.store(local->traceDropped.load(memory_order_relaxed) + 1, memory_order_relaxed);
+        return;
+    }
+    event->startNs = startNs;
+    event->durationNs = durationNs;
+    event->histogram = histogram;
+    event->thread = local->thread;
+    local->trace.commitWrite();
+}
+
+/**
+ * @brief Moves the events of every ring to the shared buffer. Called with lock held.
+ */
+void Metrics::collect() {
+    for (const shared_ptr<MetricShard>& s : this->shards) {
+        TraceEvent* event;
+        while ((event = s->trace.front()) != nullptr) {
+            if (this->events.size() < MAX_TRACE_EVENTS) {
+                this->events.push_back(*event);
+            }
+            else {
+                this->eventsDropped++;
+            }
+            s->trace.pop();
+        }
+    }
+}
+
+/**
+ * @brief Sums one histogram over every shard. Called with lock held.
+ */
+HistogramSnapshot Metrics::merge(int histogram) const {
+    HistogramSnapshot snapshot;
+    snapshot.buckets.assign(BUCKET_COUNT, 0);
+    snapshot.count = 0;
+    snapshot.sum = 0;
+    snapshot.minimum = NO_MINIMUM;
+    snapshot.maximum = 0;
+    for (const shared_ptr<MetricShard>& s : this->shards) {
+        const HistogramShard* h = s->histograms[histogram].load(memory_order_acquire);
+        if (h == nullptr) {
+            continue;
+        }
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            snapshot.buckets[i] += h->buckets[i].load(memory_order_relaxed);
+        }
+        snapshot.count += h->count.load(memory_order_relaxed);
+        snapshot.sum += h->sum.load(memory_order_relaxed);
+        snapshot.minimum = min(snapshot.minimum, h->minimum.load(memory_order_relaxed));
+        snapshot.maximum = max(snapshot.maximum, h->maximum.load(memory_order_relaxed));
+    }
+    if (snapshot.count == 0) {
+        snapshot.minimum = 0;
+    }
+    return snapshot;
+}
+
+/**
+ * @brief Sums one counter over every shard. Called with lock held.
+ */
+unsigned long long Metrics::sumCounter(int counter) const {
+    unsigned long long total = 0;
+    for (const shared_ptr<MetricShard>& s : this->shards) {
+        total += s->counters[counter].load(memory_order_relaxed);
+    }
+    return total;
+}
+
+unsigned long long Metrics::getCounter(const string& name) {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    for (size_t i = 0; i < metrics.counterNames.size(); i++) {
+        if (metrics.counterNames[i] == name) {
+            return metrics.sumCounter(static_cast<int>(i));
+        }
+    }
+    return 0;
+}
+
+HistogramSnapshot Metrics::getHistogram(const string& name) {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    for (size_t i = 0; i < metrics.histogramNames.size(); i++) {
+        if (metrics.histogramNames[i] == name) {
+            return metrics.merge(static_cast<int>(i));
+        }
+    }
+    HistogramSnapshot empty;
+    empty.buckets.assign(BUCKET_COUNT, 0);
+    empty.count = 0;
+    empty.sum = 0;
+    empty.minimum = 0;
+    empty.maximum = 0;
+    return empty;
+}
+
+void Metrics::collectTrace() {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    metrics.collect();
+}
+
+size_t Metrics::getTraceEventCount() {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    metrics.collect();
+    return metrics.events.size();
+}
+
+unsigned long long Metrics::getTraceDroppedCount() {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    unsigned long long total = metrics.eventsDropped;
+    for (const shared_ptr<MetricShard>& s : metrics.shards) {
+        total += s->traceDropped.load(memory_order_relaxed);
+    }
+    return total;
+}
+
+/**
+ * @brief Formats a number of nanoseconds as seconds for the Prometheus text.
+ */
+static string seconds(long long nanoseconds) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.9g", nanoseconds / 1e9);
+    return text;
+}
+
+/**
+ * @brief Returns every metric in the Prometheus text exposition format.
+ *
+ * A histogram is exported in seconds as <name>_seconds. Its cumulative buckets are
+ * end one below each power of two from 16 ns up to the maximum; the finer HDR
+ * buckets stay available through getHistogram().
+ */
+string Metrics::prometheusText() {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    ostringstream text;
+
+    for (size_t i = 0; i < metrics.counterNames.size(); i++) {
+        const string& name = metrics.counterNames[i];
+        text << "# TYPE " << name << " counter\n";
+        text << name << " " << metrics.sumCounter(static_cast<int>(i)) << "\n";
+    }
+
+    for (size_t i = 0; i < metrics.histogramNames.size(); i++) {
+        string name = metrics.histogramNames[i] + "_seconds";
+        HistogramSnapshot snapshot = metrics.merge(static_cast<int>(i));
+        text << "# TYPE " << name << " histogram\n";
+        unsigned long long cumulative = 0;
+        int bucket = 0;
+        for (int exponent = SUB_BUCKET_BITS; exponent < MAX_EXPONENT; exponent++) {
+            long long bound = (1LL << exponent) - 1;
+            while (bucket < BUCKET_COUNT - 1 && bucketUpper(bucket) <= bound) {
+                cumulative += snapshot.buckets[bucket++];
+            }
+            text << name << "_bucket{le=\"" << seconds(bound) << "\"} " << cumulative << "\n";
+            if (cumulative == snapshot.count) {
+                break;
+            }
+        }
+        text << name << "_bucket{le=\"+Inf\"} " << snapshot.count << "\n";
+        text << name << "_sum " << seconds(snapshot.sum) << "\n";
+        text << name << "_count " << snapshot.count << "\n";
+    }
+
+    unsigned long long dropped = metrics.eventsDropped;
+    for (const shared_ptr<MetricShard>& s : metrics.shards) {
+        dropped += s->traceDropped.load(memory_order_relaxed);
+    }
+    text << "# TYPE metrics_trace_dropped_total counter\n";
+    text << "metrics_trace_dropped_total " << dropped << "\n";
+    return text.str();
+}
+
+bool Metrics::writePrometheus(const string& path) {
+    string text = prometheusText();
+    ofstream file(path, ios::binary | ios::trunc);
+    if (!file) {
+        cout << "Error: cannot write " << path << "." << endl;
+        return false;
+    }
+    file << text;
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Writes the collected events as complete ("X") events of one process, with
+ * times in microseconds from the start of the metrics, then clears them.
+ */
+bool Metrics::writeChromeTrace(const string& path) {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    metrics.collect();
+
+    ofstream file(path, ios::binary | ios::trunc);
+    if (!file) {
+        cout << "Error: cannot write " << path << "." << endl;
+        return false;
+    }
+    sort(metrics.events.begin(), metrics.events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.startNs < b.startNs;
+    });
+    // A scope can start before the first registration created the metrics.
+    long long base = metrics.events.empty() ? metrics.startNs : min(metrics.startNs, metrics.events.front().startNs);
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const shared_ptr<MetricShard>& s : metrics.shards) {
+        file << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << s->thread
+            << ",\"args\":{\"name\":\"thread " << s->thread << "\"}}";
+        first = false;
+    }
+    char number[64];
+    for (const TraceEvent& event : metrics.events) {
+        file << (first ? "\n" : ",\n") << "{\"name\":\"" << metrics.histogramNames[event.histogram]
+            << "\",\"cat\":\"robot\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread;
+        snprintf(number, sizeof(number), ",\"ts\":%.3f,\"dur\":%.3f}", (event.startNs - base) / 1000.0,
+            event.durationNs / 1000.0);
+        file << number;
+        first = false;
+    }
+    file << "\n]}\n";
+    metrics.events.clear();
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Zeroes every counter and histogram and discards trace events.
+ */
+void Metrics::reset() {
+    Metrics& metrics = instance();
+    lock_guard<mutex> guard(metrics.lock);
+    for (const shared_ptr<MetricShard>& s : metrics.shards) {
+        for (int i = 0; i < MAX_COUNTERS; i++) {
+            s->counters[i].store(0, memory_order_relaxed);
+        }
+        for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+            HistogramShard* h = s->histograms[i].load(memory_order_acquire);
+            if (h == nullptr) {
+                continue;
+            }
+            for (int b = 0; b < BUCKET_COUNT; b++) {
+                h->buckets[b].store(0, memory_order_relaxed);
+            }
+            h->count.store(0, memory_order_relaxed);
+            h->sum.store(0, memory_order_relaxed);
+            h->minimum.store(NO_MINIMUM, memory_order_relaxed);
+            h->maximum.store(0, memory_order_relaxed);
+        }
+        while (s->trace.front() != nullptr) {
+            s->trace.pop();
+        }
+        s->traceDropped.store(0, memory_order_relaxed);
+    }
+    metrics.events.clear();
+    metrics.eventsDropped = 0;
+}
+
+/**
+ * @brief Returns the mean of the samples, 0 without samples.
+ */
+double HistogramSnapshot::getMean() const {
+    return this->count > 0 ? static_cast<double>(this->sum) / this->count : 0.0;
+}
+
+/**
+ * @brief Returns the upper bound of the bucket that holds a percentile.
+ */
+long long HistogramSnapshot::getPercentile(double percentile) const {
+    if (this->count == 0) {
+        return 0;
+    }
+    double target = percentile / 100.0 * this->count;
+    unsigned long long seen = 0;
+    for (size_t i = 0; i < this->buckets.size(); i++) {
+        seen += this->buckets[i];
+        if (seen > 0 && seen >= target) {
+            return min(Metrics::bucketUpper(static_cast<int>(i)), this->maximum);
+        }
+    }
+    return this->maximum;
+}
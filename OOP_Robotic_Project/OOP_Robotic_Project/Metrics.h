@@ -0,0 +1,399 @@
+#pragma once
+/**
+ * @file   Metrics.h
+ * @date   October, 2026
+ * @brief  Header file for the Metrics class and the METRIC_* macros.
+ *
+ * This file contains the definition of the Metrics class, which keeps per-thread
+ * counters and latency histograms, records trace events of timed sections, and
+ * exports them as a Prometheus text snapshot and a Chrome trace.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "SpscRing.h"
+
+// Set ROBOT_METRICS to 0 on the compiler command line to remove every METRIC_* call.
+#ifndef ROBOT_METRICS
+#define ROBOT_METRICS 1
+#endif
+
+#define METRIC_CONCAT_(a, b) a##b
+#define METRIC_CONCAT(a, b) METRIC_CONCAT_(a, b)
+
+#if ROBOT_METRICS
+// Adds amount to the counter called name (a static string, e.g. "planner_expanded_total").
+#define METRIC_COUNT(name, amount) \
+    do { \
+        if (Metrics::isEnabled()) { \
+            static std::atomic<int> metricId_(-1); \
+            Metrics::add(Metrics::resolve(metricId_, name, false), static_cast<unsigned long long>(amount)); \
+        } \
+    } while (0)
+// Times the rest of the enclosing block into the histogram called name and, while
+// tracing, records it as a trace event.
+#define METRIC_SCOPE(name) \
+    static std::atomic<int> METRIC_CONCAT(metricScopeId_, __LINE__)(-1); \
+    MetricScope METRIC_CONCAT(metricScope_, __LINE__)(METRIC_CONCAT(metricScopeId_, __LINE__), name)
+#else
+#define METRIC_COUNT(name, amount) ((void)0)
+#define METRIC_SCOPE(name) ((void)0)
+#endif
+
+//! TraceEvent struct
+/*!
+ * @brief One timed section, as written to the Chrome trace.
+ */
+struct TraceEvent {
+    long long startNs;     /*!< Steady clock time the section started, in nanoseconds. */
+    long long durationNs;  /*!< Length of the section in nanoseconds. */
+    int histogram;         /*!< Histogram the section was recorded in, which gives its name. */
+    int thread;            /*!< Number of the thread, in the order threads first recorded a metric. */
+};
+
+//! HistogramSnapshot struct
+/*!
+ * @brief A histogram merged over every thread.
+ */
+struct HistogramSnapshot {
+    std::vector<unsigned long long> buckets; /*!< Sample count per bucket, see Metrics::bucketOf(). */
+    unsigned long long count;                /*!< Total number of samples. */
+    long long sum;                           /*!< Sum of all samples (nanoseconds). */
+    long long minimum;                       /*!< Smallest sample, 0 without samples. */
+    long long maximum;                       /*!< Largest sample. */
+
+    //! getMean function
+    double getMean() const;
+
+    //! getPercentile function
+    /*!
+    * @param percentile Value in [0, 100].
+    * @return the upper bound of the bucket that holds the percentile, at most the maximum (nanoseconds).
+    */
+    long long getPercentile(double percentile) const;
+};
+
+//! Metrics class
+/*!
+ * @brief Process-wide counters, latency histograms and trace events.
+ *
+ * Metrics are registered by name on first use and get an index. Each thread that
+ * records a metric gets its own shard, so a counter update or a histogram sample is
+ * a plain load and store on memory no other thread writes, without locks or atomic
+ * read-modify-write operations. Readers sum the shards; shards stay after their thread
+ * exits, so nothing counted is lost.
+ *
+ * Histograms are HDR-style: values below 2^SUB_BUCKET_BITS ns have a bucket each, and
+ * every larger power of two is split into 2^SUB_BUCKET_BITS buckets, so a percentile
+ * is within 1/16 of the true value from nanoseconds up to about half an hour.
+ *
+ * Recording is off until setEnabled(true). While it is off, METRIC_COUNT and
+ * METRIC_SCOPE cost one load of the enabled flag and one branch; with ROBOT_METRICS
+ * set to 0 they compile to nothing. While tracing is on as well, every METRIC_SCOPE
+ * also copies a TraceEvent into a ring of its thread; collectTrace() moves the events
+ * to a shared buffer and writeChromeTrace() writes that buffer as trace-event JSON,
+ * which chrome://tracing and Perfetto open. A full ring drops the event and counts it.
+ *
+ * The control stack records robot_api_command and robot_api_pose around robot API
+ * calls, sensor_ir_read, sensor_lidar_read and sensor_pipeline_read around sensor
+ * reads, planner_plan and planner_replan around planner searches, and the counters
+ * planner_expanded_total, robot_commands_queued_total and robot_command_queue_full_total.
+ */
+class Metrics {
+public:
+    static const int MAX_COUNTERS = 64;                 /*!< Counters that can be registered. */
+    static const int MAX_HISTOGRAMS = 32;               /*!< Histograms that can be registered. */
+    static const int SUB_BUCKET_BITS = 4;               /*!< Buckets per power of two: 2^SUB_BUCKET_BITS. */
+    static const int MAX_EXPONENT = 41;                 /*!< Values from 2^MAX_EXPONENT ns go to the last bucket. */
+    static const int BUCKET_COUNT = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS; /*!< Buckets per histogram. */
+    static const int TRACE_RING_SIZE = 4096;            /*!< Trace events each thread can hold until collectTrace(). */
+    static const size_t MAX_TRACE_EVENTS = 1 << 20;     /*!< Trace events kept by collectTrace(). */
+
+private:
+    //! HistogramShard struct
+    /*!
+     * @brief One thread's samples of one histogram.
+     */
+    struct HistogramShard {
+        std::atomic<unsigned long long> buckets[BUCKET_COUNT]; /*!< Sample count per bucket. */
+        std::atomic<unsigned long long> count;                 /*!< Number of samples. */
+        std::atomic<long long> sum;                            /*!< Sum of the samples. */
+        std::atomic<long long> minimum;                        /*!< Smallest sample. */
+        std::atomic<long long> maximum;                        /*!< Largest sample. */
+    };
+
+    //! MetricShard struct
+    /*!
+     * @brief Metrics recorded by one thread; only that thread writes them.
+     */
+    struct MetricShard {
+        std::atomic<unsigned long long> counters[MAX_COUNTERS];     /*!< Counter values. */
+        std::atomic<HistogramShard*> histograms[MAX_HISTOGRAMS];    /*!< Histograms, allocated on first sample. */
+        SpscRing<TraceEvent, TRACE_RING_SIZE> trace;                /*!< Events waiting for collectTrace(). */
+        std::atomic<unsigned long long> traceDropped;               /*!< Events lost because the ring was full. */
+        int thread;                                                 /*!< Thread number written to the trace. */
+
+        MetricShard(int thread);
+        ~MetricShard();
+    };
+
+    static std::atomic<bool> enabled;                   /*!< Recording is on. */
+    static std::atomic<bool> tracing;                   /*!< Scopes also record trace events. */
+    static thread_local MetricShard* localShard;        /*!< Shard of the calling thread, nullptr until its first sample. */
+
+    std::mutex lock;                                    /*!< Guards the fields below. */
+    std::vector<std::string> counterNames;              /*!< Name of each counter. */
+    std::vector<std::string> histogramNames;            /*!< Name of each histogram. */
+    std::vector<std::shared_ptr<MetricShard>> shards;   /*!< Shards of every thread that recorded. */
+    std::vector<TraceEvent> events;                     /*!< Collected trace events. */
+    unsigned long long eventsDropped;                   /*!< Events lost because the buffer was full. */
+    long long startNs;                                  /*!< Time written as 0 in the trace. */
+
+    Metrics();
+
+    //! instance function
+    static Metrics& instance();
+
+    //! registerThread function
+    /*!
+    * Creates the shard of the calling thread.
+    */
+    static MetricShard* registerThread();
+
+    //! shard function
+    /*!
+    * @return the shard of the calling thread.
+    */
+    static MetricShard* shard() {
+        MetricShard* local = localShard;
+        return local != nullptr ? local : registerThread();
+    }
+
+    //! registerName function
+    /*!
+    * @return the index of a name in names, adding it if there is room, or -1.
+    */
+    int registerName(std::vector<std::string>& names, const char* name, int limit);
+
+    //! collect function
+    /*!
+    * Moves the events of every ring to the shared buffer. Called with lock held.
+    */
+    void collect();
+
+    //! merge function
+    /*!
+    * Sums one histogram over every shard. Called with lock held.
+    */
+    HistogramSnapshot merge(int histogram) const;
+
+    //! sumCounter function
+    /*!
+    * Sums one counter over every shard. Called with lock held.
+    */
+    unsigned long long sumCounter(int counter) const;
+
+    Metrics(const Metrics&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+
+public:
+    //! setEnabled function
+    /*!
+    * Turns recording on or off; samples already recorded are kept.
+    */
+    static void setEnabled(bool on);
+
+    //! isEnabled function
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    //! setTracing function
+    /*!
+    * Turns recording of trace events on or off; they are only recorded while enabled.
+    */
+    static void setTracing(bool on);
+
+    //! isTracing function
+    static bool isTracing() {
+        return tracing.load(std::memory_order_relaxed);
+    }
+
+    //! counter function
+    /*!
+    * Registers a counter, or finds it if it exists.
+    * @return its index, or -1 if MAX_COUNTERS are registered.
+    */
+    static int counter(const char* name);
+
+    //! histogram function
+    /*!
+    * Registers a histogram, or finds it if it exists.
+    * @return its index, or -1 if MAX_HISTOGRAMS are registered.
+    */
+    static int histogram(const char* name);
+
+    //! resolve function
+    /*!
+    * Returns the index cached in id, registering name the first time. Used by the macros.
+    * @param isHistogram true for a histogram, false for a counter.
+    */
+    static int resolve(std::atomic<int>& id, const char* name, bool isHistogram) {
+        int index = id.load(std::memory_order_relaxed);
+        if (index < 0) {
+            index = isHistogram ? histogram(name) : counter(name);
+            id.store(index, std::memory_order_relaxed);
+        }
+        return index;
+    }
+
+    //! add function
+    /*!
+    * Adds to a counter of the calling thread; an index of -1 is ignored.
+    */
+    static void add(int counter, unsigned long long amount) {
+        if (counter < 0) {
+            return;
+        }
+        std::atomic<unsigned long long>& value = shard()->counters[counter];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    //! record function
+    /*!
+    * Adds a sample to a histogram of the calling thread; an index of -1 is ignored.
+    * @param nanoseconds Sample; negative values count as 0.
+    */
+    static void record(int histogram, long long nanoseconds);
+
+    //! trace function
+    /*!
+    * Queues a trace event of the calling thread; an index of -1 is ignored.
+    */
+    static void trace(int histogram, long long startNs, long long durationNs);
+
+    //! getCounter function
+    /*!
+    * @return the counter summed over every thread, 0 if it is not registered.
+    */
+    static unsigned long long getCounter(const std::string& name);
+
+    //! getHistogram function
+    /*!
+    * @return the histogram merged over every thread, empty if it is not registered.
+    */
+    static HistogramSnapshot getHistogram(const std::string& name);
+
+    //! collectTrace function
+    /*!
+    * Moves the queued trace events of every thread to the shared buffer. Call it
+    * periodically when more than TRACE_RING_SIZE events per thread are expected.
+    */
+    static void collectTrace();
+
+    //! getTraceEventCount function
+    /*!
+    * @return the events in the shared buffer after collecting.
+    */
+    static size_t getTraceEventCount();
+
+    //! getTraceDroppedCount function
+    /*!
+    * @return the events lost because a ring or the shared buffer was full.
+    */
+    static unsigned long long getTraceDroppedCount();
+
+    //! prometheusText function
+    /*!
+    * @return every registered metric in the Prometheus text exposition format.
+    */
+    static std::string prometheusText();
+
+    //! writePrometheus function
+    /*!
+    * Writes prometheusText() to a file, replacing it.
+    * @return false if the file cannot be written.
+    */
+    static bool writePrometheus(const std::string& path);
+
+    //! writeChromeTrace function
+    /*!
+    * Collects the trace events and writes them as Chrome trace-event JSON, then
+    * clears the buffer.
+    * @return false if the file cannot be written.
+    */
+    static bool writeChromeTrace(const std::string& path);
+
+    //! reset function
+    /*!
+    * Zeroes every counter and histogram and discards trace events, keeping the
+    * registered names. Call it while no other thread records.
+    */
+    static void reset();
+
+    //! bucketOf function
+    /*!
+    * @return the histogram bucket of a value in nanoseconds.
+    */
+    static int bucketOf(long long nanoseconds);
+
+    //! bucketUpper function
+    /*!
+    * @return the largest value of a bucket in nanoseconds.
+    */
+    static long long bucketUpper(int bucket);
+
+    //! nowNs function
+    /*!
+    * @return the steady clock time in nanoseconds.
+    */
+    static long long nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+//! MetricScope class
+/*!
+ * @brief Times its lifetime into a histogram; created by METRIC_SCOPE.
+ *
+ * The constructor reads the enabled flag once; a scope started while recording is off
+ * does nothing more than test that result when it ends.
+ */
+class MetricScope {
+private:
+    std::atomic<int>* id;   /*!< Cached histogram index of the call site. */
+    const char* name;       /*!< Histogram name, registered on the first sample. */
+    long long startNs;      /*!< Start time, 0 if recording was off. */
+
+    MetricScope(const MetricScope&) = delete;
+    MetricScope& operator=(const MetricScope&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param id Histogram index cache of the call site, -1 until resolved.
+    * @param name Histogram name, a static string.
+    */
+    MetricScope(std::atomic<int>& id, const char* name)
+        : id(&id), name(name), startNs(Metrics::isEnabled() ? Metrics::nowNs() : 0) {
+    }
+
+    //! Destructor
+    /*!
+    * Records the elapsed time and, while tracing, a trace event.
+    */
+    ~MetricScope() {
+        if (this->startNs != 0) {
+            long long duration = Metrics::nowNs() - this->startNs;
+            int histogram = Metrics::resolve(*this->id, this->name, true);
+            Metrics::record(histogram, duration);
+            if (Metrics::isTracing()) {
+                Metrics::trace(histogram, this->startNs, duration);
+            }
+        }
+    }
+};
@@ -1,22 +1,113 @@
 // OOP_Robotics_Console.cpp : This file contains the 'main' function. Program execution begins and ends there.
 //
 
+#include <cstring>
 #include <iostream>
 #include "Pose.h"
 //#include "RobotControler.h"
-#include "../../oop_project/Project_Packet/FestoRobotAPI.h"
+#include "RobotPlatform.h"
 #include "TestRobotControler.h"
 #include "TestPose.h"
+#include "TestLidarSensor.h"
+#include "TestSensorPipeline.h"
+#include "TestIRSensor.h"
+#include "TestMAP.h"
+#include "TestRayCaster.h"
+#include "TestRecord.h"
+#include "TestReplayRobot.h"
+#include "TestCommandDispatcher.h"
+#include "TestLogger.h"
+#include "TestPathPlanner.h"
+#include "TestIncrementalPlanner.h"
+#include "TestSafeNavigation.h"
+#include "TestControlLoop.h"
+#include "TestSimulatedRobot.h"
+#include "TestFleetManager.h"
+#include "TestScanMatcher.h"
+#include "TestParticleFilter.h"
+#include "TestEncryption.h"
+#include "TestRobotOperator.h"
+#include "TestPoseCache.h"
+#include "TestMetrics.h"
 
 // buras uygulamann alaca konsol ksm
 // burada u anlk testler altrlabilir. Daha sonra konsol uygulamas
 // yazlacak ve burada arlacak. Aada rnek bir test ars var.
 
-int main() {
+/**
+ * @brief Creates a test class and runs all of its tests.
+ */
+template <class T>
+static void runTests() {
+	T test;
+	test.runAllTests();
+}
+
+//! TestSuite struct
+/*!
+ * @brief A test class that can be run by name from the command line.
+ */
+struct TestSuite {
+	const char* name; /*!< Class name without the Test prefix. */
+	void (*run)();    /*!< Runs all tests of the class. */
+};
+
+static const TestSuite SUITES[] = {
+	{ "RobotControler", runTests<TestRobotControler> },
+	{ "Pose", runTests<TestPose> },
+	{ "LidarSensor", runTests<TestLidarSensor> },
+	{ "SensorPipeline", runTests<TestSensorPipeline> },
+	{ "IRSensor", runTests<TestIRSensor> },
+	{ "MAP", runTests<TestMAP> },
+	{ "RayCaster", runTests<TestRayCaster> },
+	{ "Record", runTests<TestRecord> },
+	{ "ReplayRobot", runTests<TestReplayRobot> },
+	{ "CommandDispatcher", runTests<TestCommandDispatcher> },
+	{ "Logger", runTests<TestLogger> },
+	{ "PathPlanner", runTests<TestPathPlanner> },
+	{ "IncrementalPlanner", runTests<TestIncrementalPlanner> },
+	{ "SafeNavigation", runTests<TestSafeNavigation> },
+	{ "ControlLoop", runTests<TestControlLoop> },
+	{ "SimulatedRobot", runTests<TestSimulatedRobot> },
+	{ "FleetManager", runTests<TestFleetManager> },
+	{ "ScanMatcher", runTests<TestScanMatcher> },
+	{ "ParticleFilter", runTests<TestParticleFilter> },
+	{ "Encryption", runTests<TestEncryption> },
+	{ "RobotOperator", runTests<TestRobotOperator> },
+	{ "PoseCache", runTests<TestPoseCache> },
+	{ "Metrics", runTests<TestMetrics> },
+};
 
-	TestRobotControler testRobotControler;
-	testRobotControler.runAllTests();
+/**
+ * @brief Runs the test classes named on the command line.
+ *
+ * Without arguments only TestRobotControler runs. "all" runs every class and "list"
+ * prints the names.
+ * @return 0, or 1 if a name is unknown.
+ */
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		runTests<TestRobotControler>();
+		return 0;
+	}
 
-	/*TestPose testPose;
-	testPose.runAllTests();*/
+	int status = 0;
+	for (int a = 1; a < argc; a++) {
+		bool found = false;
+		for (const TestSuite& suite : SUITES) {
+			if (strcmp(argv[a], "list") == 0) {
+				cout << suite.name << endl;
+				found = true;
+			}
+			else if (strcmp(argv[a], "all") == 0 || strcmp(argv[a], suite.name) == 0) {
+				suite.run();
+				found = true;
+			}
+		}
+		if (!found) {
+			cout << "Error: unknown test class " << argv[a] << "." << endl;
+			status = 1;
+		}
+	}
+	return status;
 }
@@ -0,0 +1,507 @@
+/**
+ * @file   ParticleFilter.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the ParticleFilter class.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include "DistanceField.h"
+#include "MAP.h"
+#include "ParticleFilter.h"
+#include "ScanMatcher.h"
+
+#if defined(__AVX2__)
+#define PARTICLEFILTER_AVX2
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+static const int ALIGNMENT = 32;   // byte alignment of the end point arrays
+static const int LANES = 8;        // end points per gather; the arrays are padded to a multiple
+
+/**
+ * @brief Noise generator of one particle in one call: splitmix64 seeded by the filter
+ * seed, the call count and the particle index, so the draws do not depend on which
+ * worker moves the particle.
+ */
+class ParticleRandom {
+private:
+    unsigned long long state; /*!< Generator state. */
+    double spare;             /*!< Second normal of the last Box-Muller pair. */
+    bool hasSpare;            /*!< spare has not been returned yet. */
+
+public:
+    ParticleRandom(unsigned long long seed, unsigned long long draw, unsigned long long index) {
+        this->state = seed ^ (draw * 0x9E3779B97F4A7C15ULL) ^ (index * 0xD1B54A32D192ED03ULL);
+        this->spare = 0.0;
+        this->hasSpare = false;
+    }
+
+    unsigned long long next() {
+        unsigned long long z = (this->state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, 1).
+    double uniform() {
+        return (next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Standard normal, two at a time with Box-Muller.
+    double normal() {
+        if (this->hasSpare) {
+            this->hasSpare = false;
+            return this->spare;
+        }
+        double radius = sqrt(-2.0 * log(1.0 - uniform()));
+        double angle = 2.0 * PI * uniform();
+        this->spare = radius * sin(angle);
+        this->hasSpare = true;
+        return radius * cos(angle);
+    }
+};
+
+/**
+ * @brief Parameterized Constructor. Builds the likelihood field and reserves every
+ * buffer the filter uses.
+ */
+ParticleFilter::ParticleFilter(const MAP& map, int particleCount, int threadCount, double sigma,
+    double randomWeight, unsigned long long seed) : pool(threadCount) {
+    this->particleCount = max(particleCount, 1);
+    this->current = 0;
+    this->particles[0].reserve(this->particleCount);
+    this->particles[1].reserve(this->particleCount);
+    this->logWeights.assign(this->particleCount, 0.0);
+    this->weights.assign(this->particleCount, 1.0 / this->particleCount);
+    this->translationNoise = 0.1;
+    this->rotationNoise = 0.1;
+    this->driftNoise = 0.05;
+    this->hasOdometry = false;
+    this->seed = seed;
+    this->draws = 0;
+    this->beamCount = 0;
+    this->beamStep = 1;
+    this->maxRange = 0.0;
+    this->endX = nullptr;
+    this->endY = nullptr;
+    this->endCount = 0;
+    this->resampleThreshold = 0.5;
+    this->resamples = 0;
+    buildField(map, sigma > 0.0 ? sigma : 0.2, 1.0, max(randomWeight, 1e-6));
+}
+
+/**
+ * @brief Destructor. Frees the end point arrays.
+ */
+ParticleFilter::~ParticleFilter() {
+    if (this->endX != nullptr) {
+        ::operator delete[](this->endX, align_val_t(ALIGNMENT));
+    }
+}
+
+/**
+ * @brief Computes the likelihood field from the distance of each cell to the nearest
+ * occupied cell. Distances are clamped at 4 sigma, where the hit term is already
+ * negligible, which keeps the distance transform short.
+ */
+void ParticleFilter::buildField(const MAP& map, double sigma, double hitWeight, double randomWeight) {
+    this->width = map.getWidth();
+    this->height = map.getHeight();
+    this->resolution = map.getResolution();
+    double cx = 0.0;
+    double cy = 0.0;
+    map.cellToWorld(0, 0, cx, cy);
+    this->originX = cx - 0.5 * this->resolution;
+    this->originY = cy - 0.5 * this->resolution;
+
+    DistanceField distances;
+    distances.setLimit(4.0 * sigma);
+    distances.compute(map, false);
+    const float* d = distances.getDistances();
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    this->field.resize(cells);
+    this->freeCells.clear();
+    double scale = -0.5 / (sigma * sigma);
+    for (size_t i = 0; i < cells; i++) {
+        double distance = d[i];
+        this->field[i] = static_cast<float>(log(hitWeight * exp(scale * distance * distance) + randomWeight));
+    }
+    this->outside = static_cast<float>(log(randomWeight));
+    for (int y = 0; y < this->height; y++) {
+        for (int x = 0; x < this->width; x++) {
+            if (map.isFree(x, y)) {
+                this->freeCells.push_back(y * this->width + x);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Precomputes the beam directions and allocates the end point arrays for
+ * every beam of a scan.
+ */
+void ParticleFilter::setLidarGeometry(const LidarGeometry& geometry, int count, int step) {
+    this->beamCount = max(count, 0);
+    this->beamStep = max(step, 1);
+    this->maxRange = geometry.maxRange;
+    this->beamCos.resize(this->beamCount);
+    this->beamSin.resize(this->beamCount);
+    for (int i = 0; i < this->beamCount; i++) {
+        double angle = geometry.startAngle + i * geometry.angleIncrement;
+        this->beamCos[i] = cos(angle);
+        this->beamSin[i] = sin(angle);
+    }
+    if (this->endX != nullptr) {
+        ::operator delete[](this->endX, align_val_t(ALIGNMENT));
+    }
+    int padded = (this->beamCount + LANES - 1) / LANES * LANES + LANES;
+    this->endX = static_cast<float*>(::operator new[](sizeof(float) * 2 * padded, align_val_t(ALIGNMENT)));
+    this->endY = this->endX + padded;
+    memset(this->endX, 0, sizeof(float) * 2 * padded);
+    this->endCount = 0;
+}
+
+void ParticleFilter::setMotionNoise(double translation, double rotation, double drift) {
+    this->translationNoise = max(translation, 0.0);
+    this->rotationNoise = max(rotation, 0.0);
+    this->driftNoise = max(drift, 0.0);
+}
+
+void ParticleFilter::setResampleThreshold(double fraction) {
+    this->resampleThreshold = max(fraction, 0.0);
+}
+
+/**
+ * @brief Draws the particles from a Gaussian around mean and resets the weights.
+ */
+void ParticleFilter::initialize(const Pose& mean, double sigmaXY, double sigmaTh) {
+    PoseArray& target = this->particles[this->current];
+    target.clear();
+    for (int i = 0; i < this->particleCount; i++) {
+        ParticleRandom random(this->seed, this->draws, i);
+        double x = mean.getX() + sigmaXY * random.normal();
+        double y = mean.getY() + sigmaXY * random.normal();
+        double th = remainder(mean.getTh() + sigmaTh * random.normal(), 2.0 * PI);
+        target.append(Pose(x, y, th));
+    }
+    this->draws++;
+    fill(this->logWeights.begin(), this->logWeights.end(), 0.0);
+    fill(this->weights.begin(), this->weights.end(), 1.0 / this->particleCount);
+    this->hasOdometry = false;
+}
+
+/**
+ * @brief Draws the particles uniformly over the free cells, for global localization.
+ */
+void ParticleFilter::initializeUniform() {
+    if (this->freeCells.empty()) {
+        cout << "Error: the map has no free cells to spread the particles over." << endl;
+        return;
+    }
+    PoseArray& target = this->particles[this->current];
+    target.clear();
+    for (int i = 0; i < this->particleCount; i++) {
+        ParticleRandom random(this->seed, this->draws, i);
+        int cell = this->freeCells[random.next() % this->freeCells.size()];
+        double x = this->originX + (cell % this->width + random.uniform()) * this->resolution;
+        double y = this->originY + (cell / this->width + random.uniform()) * this->resolution;
+        target.append(Pose(x, y, 2.0 * PI * random.uniform() - PI));
+    }
+    this->draws++;
+    fill(this->logWeights.begin(), this->logWeights.end(), 0.0);
+    fill(this->weights.begin(), this->weights.end(), 1.0 / this->particleCount);
+    this->hasOdometry = false;
+}
+
+/**
+ * @brief Samples the motion model.
+ *
+ * The odometry change is taken in the frame of the previous odometry pose, so it
+ * applies to every particle whatever its heading. Each particle adds its own noise to
+ * the change and composes it with its pose.
+ */
+void ParticleFilter::predict(const Pose& odometry) {
+    if (!this->hasOdometry) {
+        this->lastOdometry = odometry;
+        this->hasOdometry = true;
+        return;
+    }
+    Pose delta = ScanMatcher::between(this->lastOdometry, odometry);
+    this->lastOdometry = odometry;
+    double translation = hypot(delta.getX(), delta.getY());
+    double rotation = fabs(delta.getTh());
+    if (translation == 0.0 && rotation == 0.0) {
+        return;
+    }
+    double sigmaXY = this->translationNoise * translation + 0.5 * this->driftNoise * rotation;
+    double sigmaTh = this->rotationNoise * rotation + this->driftNoise * translation;
+    PoseArray& target = this->particles[this->current];
+    unsigned long long draw = this->draws++;
+    this->pool.parallelFor(target.size(), PARTICLE_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            ParticleRandom random(this->seed, draw, i);
+            double dx = delta.getX() + sigmaXY * random.normal();
+            double dy = delta.getY() + sigmaXY * random.normal();
+            double dth = delta.getTh() + sigmaTh * random.normal();
+            target.set(i, ScanMatcher::compose(target.get(i), Pose(dx, dy, dth)));
+        }
+    });
+}
+
+/**
+ * @brief Scores the particles against a scan.
+ *
+ * The end points of the scored beams are computed once in the robot frame, in cells,
+ * so a particle only rotates them, adds its own cell position and looks the cells up.
+ */
+void ParticleFilter::update(const float* ranges) {
+    if (this->endX == nullptr) {
+        cout << "Error: the lidar geometry of the particle filter is not set." << endl;
+        return;
+    }
+    int count = 0;
+    double toCells = 1.0 / this->resolution;
+    for (int i = 0; i < this->beamCount; i += this->beamStep) {
+        double range = ranges[i];
+        if (range > 0.0 && range < this->maxRange) {
+            this->endX[count] = static_cast<float>(range * this->beamCos[i] * toCells);
+            this->endY[count] = static_cast<float>(range * this->beamSin[i] * toCells);
+            count++;
+        }
+    }
+    this->endCount = count;
+    if (count == 0) {
+        return;
+    }
+    this->pool.parallelFor(this->particles[this->current].size(), PARTICLE_GRAIN, [this](int begin, int end) {
+        scoreParticles(begin, end);
+    });
+    normalize();
+    if (getEffectiveSampleSize() < this->resampleThreshold * this->particleCount) {
+        resample();
+    }
+}
+
+/**
+ * @brief Returns the cell coordinates of the robot-frame origin of a pose and the
+ * rotation of its end points, in the single precision both scoring paths use.
+ */
+static inline void particleFrame(double x, double y, double th, double originX, double originY,
+    double toCells, float& cx, float& cy, float& c, float& s) {
+    cx = static_cast<float>((x - originX) * toCells);
+    cy = static_cast<float>((y - originY) * toCells);
+    c = static_cast<float>(cos(th));
+    s = static_cast<float>(sin(th));
+}
+
+/**
+ * @brief Adds the field values of the end points to particles begin..end-1.
+ *
+ * With AVX2 eight end points are moved per instruction and their cells fetched with a
+ * masked gather; cells outside the map are masked off and read as the outside value.
+ * The last block masks off the padding end points as well.
+ */
+void ParticleFilter::scoreParticles(int begin, int end) {
+    const PoseArray& current = this->particles[this->current];
+    const double* xs = current.getXs();
+    const double* ys = current.getYs();
+    const double* ths = current.getThs();
+    double toCells = 1.0 / this->resolution;
+    const float* values = this->field.data();
+    int count = this->endCount;
+#if defined(PARTICLEFILTER_AVX2)
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i minusOne = _mm256_set1_epi32(-1);
+    const __m256i vwidth = _mm256_set1_epi32(this->width);
+    const __m256i vheight = _mm256_set1_epi32(this->height);
+    const __m256 voutside = _mm256_set1_ps(this->outside);
+    __m256 tail = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(count % LANES == 0 ? LANES : count % LANES), lane));
+    int last = (count - 1) / LANES * LANES;
+    for (int p = begin; p < end; p++) {
+        float cx, cy, c, s;
+        particleFrame(xs[p], ys[p], ths[p], this->originX, this->originY, toCells, cx, cy, c, s);
+        __m256 vcx = _mm256_set1_ps(cx);
+        __m256 vcy = _mm256_set1_ps(cy);
+        __m256 vc = _mm256_set1_ps(c);
+        __m256 vs = _mm256_set1_ps(s);
+        __m256 sum = _mm256_setzero_ps();
+        for (int i = 0; i < count; i += LANES) {
+            __m256 ex = _mm256_load_ps(this->endX + i);
+            __m256 ey = _mm256_load_ps(this->endY + i);
+            __m256 fx = _mm256_add_ps(vcx, _mm256_sub_ps(_mm256_mul_ps(vc, ex), _mm256_mul_ps(vs, ey)));
+            __m256 fy = _mm256_add_ps(vcy, _mm256_add_ps(_mm256_mul_ps(vs, ex), _mm256_mul_ps(vc, ey)));
+            __m256i ix = _mm256_cvttps_epi32(_mm256_floor_ps(fx));
+            __m256i iy = _mm256_cvttps_epi32(_mm256_floor_ps(fy));
+            __m256i inside = _mm256_and_si256(
+                _mm256_and_si256(_mm256_cmpgt_epi32(ix, minusOne), _mm256_cmpgt_epi32(vwidth, ix)),
+                _mm256_and_si256(_mm256_cmpgt_epi32(iy, minusOne), _mm256_cmpgt_epi32(vheight, iy)));
+            __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(iy, vwidth), ix);
+            __m256 value = _mm256_mask_i32gather_ps(voutside, values, index, _mm256_castsi256_ps(inside), 4);
+            if (i == last) {
+                value = _mm256_and_ps(value, tail);
+            }
+            sum = _mm256_add_ps(sum, value);
+        }
+        __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+        half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+        half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+        this->logWeights[p] += _mm_cvtss_f32(half);
+    }
+#else
+    for (int p = begin; p < end; p++) {
+        float cx, cy, c, s;
+        particleFrame(xs[p], ys[p], ths[p], this->originX, this->originY, toCells, cx, cy, c, s);
+        float sum = 0.0f;
+        for (int i = 0; i < count; i++) {
+            float fx = cx + (c * this->endX[i] - s * this->endY[i]);
+            float fy = cy + (s * this->endX[i] + c * this->endY[i]);
+            bool inside = fx >= 0.0f && fy >= 0.0f && fx < this->width && fy < this->height;
+            sum += inside ? values[static_cast<int>(fy) * this->width + static_cast<int>(fx)] : this->outside;
+        }
+        this->logWeights[p] += sum;
+    }
+#endif
+}
+
+/**
+ * @brief Scores one pose one beam at a time, with the same single-precision cell
+ * arithmetic as scoreParticles().
+ */
+double ParticleFilter::logLikelihood(const Pose& pose) const {
+    float cx, cy, c, s;
+    particleFrame(pose.getX(), pose.getY(), pose.getTh(), this->originX, this->originY, 1.0 / this->resolution,
+        cx, cy, c, s);
+    double sum = 0.0;
+    for (int i = 0; i < this->endCount; i++) {
+        float fx = cx + (c * this->endX[i] - s * this->endY[i]);
+        float fy = cy + (s * this->endX[i] + c * this->endY[i]);
+        if (fx >= 0.0f && fy >= 0.0f && fx < this->width && fy < this->height) {
+            sum += this->field[static_cast<size_t>(floor(fy)) * this->width + static_cast<size_t>(floor(fx))];
+        }
+        else {
+            sum += this->outside;
+        }
+    }
+    return sum;
+}
+
+/**
+ * @brief Normalizes the weights, subtracting the largest log weight first so the
+ * exponentials cannot all underflow.
+ */
+void ParticleFilter::normalize() {
+    int n = this->particles[this->current].size();
+    double largest = *max_element(this->logWeights.begin(), this->logWeights.begin() + n);
+    double total = 0.0;
+    for (int i = 0; i < n; i++) {
+        this->logWeights[i] -= largest;
+        this->weights[i] = exp(this->logWeights[i]);
+        total += this->weights[i];
+    }
+    for (int i = 0; i < n; i++) {
+        this->weights[i] /= total;
+    }
+}
+
+/**
+ * @brief Low-variance resampling: one random offset, then particleCount equally spaced
+ * pointers walk the cumulative weights. A particle of weight w gets floor(w * n) or
+ * ceil(w * n) copies. The copies go to the second array, which then becomes current.
+ */
+void ParticleFilter::resample() {
+    const PoseArray& source = this->particles[this->current];
+    PoseArray& target = this->particles[1 - this->current];
+    int n = source.size();
+    if (n == 0) {
+        return;
+    }
+    ParticleRandom random(this->seed, this->draws++, 0);
+    double step = 1.0 / n;
+    double pointer = random.uniform() * step;
+    double cumulative = this->weights[0];
+    int i = 0;
+    target.clear();
+    for (int m = 0; m < n; m++) {
+        while (pointer > cumulative && i < n - 1) {
+            i++;
+            cumulative += this->weights[i];
+        }
+        target.append(source.get(i));
+        pointer += step;
+    }
+    this->current = 1 - this->current;
+    fill(this->logWeights.begin(), this->logWeights.end(), 0.0);
+    fill(this->weights.begin(), this->weights.end(), step);
+    this->resamples++;
+}
+
+/**
+ * @brief Returns the weighted mean pose; the heading is the direction of the weighted
+ * sum of unit vectors, so headings on both sides of +-pi average correctly.
+ */
+Pose ParticleFilter::getEstimate() const {
+    const PoseArray& current = this->particles[this->current];
+    const double* xs = current.getXs();
+    const double* ys = current.getYs();
+    const double* ths = current.getThs();
+    double x = 0.0;
+    double y = 0.0;
+    double c = 0.0;
+    double s = 0.0;
+    for (int i = 0; i < current.size(); i++) {
+        double w = this->weights[i];
+        x += w * xs[i];
+        y += w * ys[i];
+        c += w * cos(ths[i]);
+        s += w * sin(ths[i]);
+    }
+    return Pose(x, y, atan2(s, c));
+}
+
+double ParticleFilter::getEffectiveSampleSize() const {
+    double sum = 0.0;
+    for (int i = 0; i < this->particles[this->current].size(); i++) {
+        sum += this->weights[i] * this->weights[i];
+    }
+    return sum > 0.0 ? 1.0 / sum : 0.0;
+}
+
+const PoseArray& ParticleFilter::getParticles() const {
+    return this->particles[this->current];
+}
+
+const double* ParticleFilter::getWeights() const {
+    return this->weights.data();
+}
+
+int ParticleFilter::getParticleCount() const {
+    return this->particleCount;
+}
+
+int ParticleFilter::getScoredBeamCount() const {
+    return this->endCount;
+}
+
+unsigned long long ParticleFilter::getResampleCount() const {
+    return this->resamples;
+}
+
+/**
+ * @brief Returns the field value of the cell containing (x, y).
+ */
+float ParticleFilter::getFieldValue(double x, double y) const {
+    double fx = (x - this->originX) / this->resolution;
+    double fy = (y - this->originY) / this->resolution;
+    if (fx < 0.0 || fy < 0.0 || fx >= this->width || fy >= this->height) {
+        return this->outside;
+    }
+    return this->field[static_cast<size_t>(fy) * this->width + static_cast<size_t>(fx)];
+}
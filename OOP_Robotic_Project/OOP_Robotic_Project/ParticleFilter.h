@@ -0,0 +1,230 @@
+#pragma once
+/**
+ * @file   ParticleFilter.h
+ * @date   October, 2026
+ * @brief  Header file for the ParticleFilter class.
+ *
+ * This file contains the definition of the ParticleFilter class, Monte Carlo
+ * localization in a known MAP with odometry and lidar scans.
+ */
+
+#include <vector>
+#include "LidarSensor.h"
+#include "PoseArray.h"
+#include "WorkStealingPool.h"
+
+class MAP;
+
+//! ParticleFilter class
+/*!
+ * @brief Monte Carlo localization against a likelihood field of a MAP.
+ *
+ * The constructor turns the occupied cells of the map into a likelihood field: every
+ * cell stores log(hitWeight * exp(-d^2 / (2 sigma^2)) + randomWeight), where d is the
+ * DistanceField distance to the nearest occupied cell. Scoring a particle is then one
+ * table lookup per beam: the beam end point is placed at the particle pose, its cell
+ * is looked up and the values are summed. End points outside the map score as if
+ * they were far from every obstacle, and maximum-range readings are not scored.
+ *
+ * The particles live in a PoseArray, so x, y and th are separate arrays. update()
+ * scores them on a WorkStealingPool, PARTICLE_GRAIN particles per chunk; inside a
+ * particle the beams are scored LANES at a time, with AVX2 gathers fetching the
+ * field values of 8 end points at once. Weights are kept as logarithms and
+ * normalized after subtracting the largest, so long scans do not underflow.
+ *
+ * predict() moves every particle by the odometry change since the previous call, as
+ * reported by FestoRobotAPI::getXYTh, plus Gaussian noise that grows with the
+ * distance and angle travelled. Each particle draws its noise from its own generator
+ * seeded by the seed, the call count and the particle index, so the filter gives the
+ * same particles on any number of threads.
+ *
+ * After update() the particles are resampled with the low-variance method when the
+ * effective sample size drops below half the particles, or the fraction set with
+ * setResampleThreshold(). Resampling copies into a
+ * second PoseArray of the same capacity and swaps, so nothing is allocated once the
+ * filter is built.
+ */
+class ParticleFilter {
+public:
+    static const int PARTICLE_GRAIN = 128; /*!< Particles per chunk of predict() and update(). */
+
+private:
+    int width;                     /*!< Field width in cells. */
+    int height;                    /*!< Field height in cells. */
+    double resolution;             /*!< Cell side (meters). */
+    double originX;                /*!< World x of the corner of cell (0, 0) (meters). */
+    double originY;                /*!< World y of the corner of cell (0, 0) (meters). */
+    std::vector<float> field;      /*!< Log-likelihood of a beam ending in each cell, row major. */
+    float outside;                 /*!< Log-likelihood of a beam ending outside the map. */
+    std::vector<int> freeCells;    /*!< Row-major indices of the free cells, for initializeUniform(). */
+
+    int particleCount;             /*!< Particles in the filter. */
+    PoseArray particles[2];        /*!< Current particles and the resampling target. */
+    int current;                   /*!< Index of the current particles. */
+    std::vector<double> logWeights; /*!< Log weight of each particle, up to a constant. */
+    std::vector<double> weights;   /*!< Normalized weight of each particle. */
+
+    double translationNoise;       /*!< Position noise per meter travelled. */
+    double rotationNoise;          /*!< Heading noise per radian turned. */
+    double driftNoise;             /*!< Heading noise per meter travelled. */
+    Pose lastOdometry;             /*!< Odometry of the previous predict(). */
+    bool hasOdometry;              /*!< predict() has been called since the last initialization. */
+    unsigned long long seed;       /*!< Seed of the noise generators. */
+    unsigned long long draws;      /*!< Calls that drew random numbers, mixed into the seeds. */
+
+    int beamCount;                 /*!< Beams per scan of the lidar geometry. */
+    int beamStep;                  /*!< Only every beamStep-th beam is scored. */
+    double maxRange;               /*!< Largest valid range (meters). */
+    std::vector<double> beamCos;   /*!< Cosine of each beam angle. */
+    std::vector<double> beamSin;   /*!< Sine of each beam angle. */
+    float* endX;                   /*!< End points of the scored beams in the robot frame (cells), padded. */
+    float* endY;                   /*!< End points of the scored beams in the robot frame (cells), padded. */
+    int endCount;                  /*!< Scored beams of the last update(). */
+
+    WorkStealingPool pool;         /*!< Workers for predict() and update(). */
+    double resampleThreshold;      /*!< update() resamples below this fraction of particles effective. */
+    unsigned long long resamples;  /*!< Resampling steps taken. */
+
+    //! buildField function
+    /*!
+    * Computes the likelihood field and the free cells of a map.
+    */
+    void buildField(const MAP& map, double sigma, double hitWeight, double randomWeight);
+
+    //! scoreParticles function
+    /*!
+    * Adds the log-likelihood of the current end points to particles begin..end-1.
+    */
+    void scoreParticles(int begin, int end);
+
+    //! normalize function
+    /*!
+    * Computes the normalized weights from the log weights.
+    */
+    void normalize();
+
+    ParticleFilter(const ParticleFilter&) = delete;
+    ParticleFilter& operator=(const ParticleFilter&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param map Map to localize in; only read by the constructor.
+    * @param particleCount Number of particles.
+    * @param threadCount Workers, the calling thread included; 0 for one per hardware thread.
+    * @param sigma Standard deviation of the range error (meters).
+    * @param randomWeight Weight of readings that match nothing in the map.
+    * @param seed Seed of the noise generators.
+    */
+    ParticleFilter(const MAP& map, int particleCount, int threadCount = 0, double sigma = 0.2,
+        double randomWeight = 0.05, unsigned long long seed = 1);
+
+    //! Destructor
+    ~ParticleFilter();
+
+    //! setLidarGeometry function
+    /*!
+    * @param geometry Beam directions of the scans passed to update().
+    * @param count Beams per scan.
+    * @param step Score only every step-th beam.
+    */
+    void setLidarGeometry(const LidarGeometry& geometry, int count, int step = 1);
+
+    //! setMotionNoise function
+    /*!
+    * @param translation Position noise (standard deviation) per meter travelled.
+    * @param rotation Heading noise per radian turned.
+    * @param drift Heading noise per meter travelled.
+    */
+    void setMotionNoise(double translation, double rotation, double drift);
+
+    //! setResampleThreshold function
+    /*!
+    * @param fraction update() resamples when fewer than this fraction of the particles
+    * are effective; 0 leaves resampling to the caller.
+    */
+    void setResampleThreshold(double fraction);
+
+    //! initialize function
+    /*!
+    * Spreads the particles around a pose with equal weights.
+    * @param mean Center of the distribution.
+    * @param sigmaXY Standard deviation of the position (meters).
+    * @param sigmaTh Standard deviation of the heading (radians).
+    */
+    void initialize(const Pose& mean, double sigmaXY, double sigmaTh);
+
+    //! initializeUniform function
+    /*!
+    * Spreads the particles over the free cells of the map with random headings.
+    */
+    void initializeUniform();
+
+    //! predict function
+    /*!
+    * Moves the particles by the odometry change since the previous call; the first
+    * call after an initialization only stores the odometry.
+    * @param odometry Pose reported by the robot.
+    */
+    void predict(const Pose& odometry);
+
+    //! update function
+    /*!
+    * Weights the particles by a scan and resamples them if needed.
+    * @param ranges Lidar ranges (meters) of the configured geometry.
+    */
+    void update(const float* ranges);
+
+    //! resample function
+    /*!
+    * Draws a new set of equally weighted particles with the low-variance method.
+    */
+    void resample();
+
+    //! logLikelihood function
+    /*!
+    * Scores one pose against the end points of the last update(), one beam at a
+    * time; the reference for the vectorized scoring.
+    * @return the sum of the field values of the beam end points.
+    */
+    double logLikelihood(const Pose& pose) const;
+
+    //! getEstimate function
+    /*!
+    * @return the weighted mean of the particles, with a circular mean of the headings.
+    */
+    Pose getEstimate() const;
+
+    //! getEffectiveSampleSize function
+    /*!
+    * @return 1 / sum(w^2) of the normalized weights.
+    */
+    double getEffectiveSampleSize() const;
+
+    //! getParticles function
+    const PoseArray& getParticles() const;
+
+    //! getWeights function
+    /*!
+    * @return the normalized weight of each particle.
+    */
+    const double* getWeights() const;
+
+    //! getParticleCount function
+    int getParticleCount() const;
+
+    //! getScoredBeamCount function
+    /*!
+    * @return the beams scored by the last update().
+    */
+    int getScoredBeamCount() const;
+
+    //! getResampleCount function
+    unsigned long long getResampleCount() const;
+
+    //! getFieldValue function
+    /*!
+    * @return the log-likelihood of a beam ending at a world position.
+    */
+    float getFieldValue(double x, double y) const;
+};
@@ -0,0 +1,514 @@
+/**
+ * @file   PathPlanner.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the PathPlanner class.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include "MAP.h"
+#include "Metrics.h"
+#include "PathPlanner.h"
+using namespace std;
+
+const float PathPlanner::BLOCKED = numeric_limits<float>::infinity();
+
+static const double PI = 3.14159265358979323846;
+static const float DIAGONAL = 1.41421356f;
+
+/** Neighbour offsets: the four sides first, then the four corners. */
+static const int NEIGHBOUR_X[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+static const int NEIGHBOUR_Y[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+/**
+ * @brief Wraps an angle to [-pi, pi).
+ */
+static double wrapAngle(double angle) {
+    angle = fmod(angle + PI, 2.0 * PI);
+    if (angle < 0) {
+        angle += 2.0 * PI;
+    }
+    return angle - PI;
+}
+
+/**
+ * @brief Octile distance between two cells: the cost of the shortest 8-connected path
+ * through cells of cost 1.
+ */
+static float octile(int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int diagonal = dx < dy ? dx : dy;
+    return static_cast<float>(dx + dy) + (DIAGONAL - 2.0f) * diagonal;
+}
+
+/**
+ * @brief Default constructor.
+ * Robot radius 0.2 m, inflation radius 0.5 m, inflation penalty 4, A*.
+ */
+PathPlanner::PathPlanner()
+    : width(0), height(0), resolution(1.0), originX(0.0), originY(0.0), robotRadius(0.2), inflationRadius(0.5),
+      inflationPenalty(4.0), heuristicWeight(1.0), unknownIsObstacle(false), search(0), expanded(0) {
+}
+
+/**
+ * @brief Sets the clearance model used by the next setMap().
+ */
+void PathPlanner::setRobotRadius(double robotRadius, double inflationRadius, double inflationPenalty) {
+    this->robotRadius = robotRadius > 0 ? robotRadius : 0.0;
+    this->inflationRadius = inflationRadius > this->robotRadius ? inflationRadius : this->robotRadius;
+    this->inflationPenalty = inflationPenalty > 0 ? inflationPenalty : 0.0;
+}
+
+void PathPlanner::setHeuristicWeight(double weight) {
+    this->heuristicWeight = weight > 0 ? weight : 0.0;
+}
+
+void PathPlanner::setUnknownIsObstacle(bool unknownIsObstacle) {
+    this->unknownIsObstacle = unknownIsObstacle;
+}
+
+/**
+ * @brief Computes the distance field and cell costs of a map and sizes the search arenas.
+ */
+void PathPlanner::setMap(const MAP& map) {
+    double x;
+    double y;
+    map.cellToWorld(0, 0, x, y);
+    this->width = map.getWidth();
+    this->height = map.getHeight();
+    this->resolution = map.getResolution();
+    this->originX = x - this->resolution / 2.0;
+    this->originY = y - this->resolution / 2.0;
+    this->obstacles.resize(static_cast<size_t>(this->width) * this->height);
+    for (int cy = 0; cy < this->height; cy++) {
+        unsigned char* row = &this->obstacles[static_cast<size_t>(cy) * this->width];
+        for (int cx = 0; cx < this->width; cx++) {
+            row[cx] = map.isOccupied(cx, cy) || (this->unknownIsObstacle && !map.isFree(cx, cy));
+        }
+    }
+    updateCosts();
+}
+
+/**
+ * @brief Computes the distance field and cell costs of an obstacle grid and sizes the search arenas.
+ */
+void PathPlanner::setGrid(int width, int height, const unsigned char* obstacles, double resolution, double originX, double originY) {
+    this->width = width > 0 ? width : 0;
+    this->height = height > 0 ? height : 0;
+    this->resolution = resolution > 0 ? resolution : 1.0;
+    this->originX = originX;
+    this->originY = originY;
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    this->obstacles.resize(cells);
+    for (size_t i = 0; i < cells; i++) {
+        this->obstacles[i] = obstacles[i] != 0;
+    }
+    updateCosts();
+}
+
+/**
+ * @brief Returns the cost of a cell at a distance from the nearest obstacle.
+ *
+ * The extra cost falls linearly from inflationPenalty at the robot radius to 0 at the
+ * inflation radius. Obstacle cells are always blocked, even with a zero robot radius.
+ */
+float PathPlanner::costAt(double distance) const {
+    if (distance <= 0.0 || distance < this->robotRadius) {
+        return BLOCKED;
+    }
+    double band = this->inflationRadius - this->robotRadius;
+    if (distance < this->inflationRadius && band > 0) {
+        return static_cast<float>(1.0 + this->inflationPenalty * (this->inflationRadius - distance) / band);
+    }
+    return 1.0f;
+}
+
+/**
+ * @brief Computes the distance field and the cell costs and sizes the search arenas.
+ *
+ * The field is clamped one cell past the inflation radius, so applyChanges() can
+ * repair it from a small window around each change.
+ */
+void PathPlanner::updateCosts() {
+    size_t cells = static_cast<size_t>(this->width) * this->height;
+    this->field.setLimit(this->inflationRadius + this->resolution);
+    this->field.compute(this->width, this->height, this->obstacles.data(), this->resolution);
+    const float* distances = this->field.getDistances();
+    this->costs.resize(cells);
+    for (size_t i = 0; i < cells; i++) {
+        this->costs[i] = costAt(distances[i]);
+    }
+
+    int blocksX = (this->width + UPDATE_BLOCK - 1) / UPDATE_BLOCK;
+    int blocksY = (this->height + UPDATE_BLOCK - 1) / UPDATE_BLOCK;
+    this->dirty.assign(static_cast<size_t>(blocksX) * blocksY, 0);
+    this->dirtyBlocks.clear();
+    this->costChanges.clear();
+
+    if (this->nodes.size() != cells) {
+        this->nodes.assign(cells, SearchNode{ 0.0f, -1, 0 });
+        this->open.resize(static_cast<int>(cells));
+        this->search = 0;
+    }
+}
+
+/**
+ * @brief Changes one obstacle flag and marks the update blocks whose costs it can reach.
+ */
+void PathPlanner::setObstacle(const GridCell& cell, bool obstacle) {
+    if (cell.x < 0 || cell.y < 0 || cell.x >= this->width || cell.y >= this->height) {
+        return;
+    }
+    unsigned char& flag = this->obstacles[static_cast<size_t>(cell.y) * this->width + cell.x];
+    if ((flag != 0) == obstacle) {
+        return;
+    }
+    flag = obstacle;
+
+    // Costs depend on distances up to the field limit, so that is how far a change reaches.
+    int reach = static_cast<int>(ceil(this->field.getLimit() / this->resolution));
+    int blocksX = (this->width + UPDATE_BLOCK - 1) / UPDATE_BLOCK;
+    int bx0 = (cell.x - reach > 0 ? cell.x - reach : 0) / UPDATE_BLOCK;
+    int by0 = (cell.y - reach > 0 ? cell.y - reach : 0) / UPDATE_BLOCK;
+    int bx1 = (cell.x + reach < this->width ? cell.x + reach : this->width - 1) / UPDATE_BLOCK;
+    int by1 = (cell.y + reach < this->height ? cell.y + reach : this->height - 1) / UPDATE_BLOCK;
+    for (int by = by0; by <= by1; by++) {
+        for (int bx = bx0; bx <= bx1; bx++) {
+            int block = by * blocksX + bx;
+            if (this->dirty[block] == 0) {
+                this->dirty[block] = 1;
+                this->dirtyBlocks.push_back(block);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Recomputes the distance field and costs of every marked update block.
+ * @return the number of cells whose cost changed.
+ */
+size_t PathPlanner::applyChanges() {
+    this->costChanges.clear();
+    int blocksX = (this->width + UPDATE_BLOCK - 1) / UPDATE_BLOCK;
+    const float* distances = this->field.getDistances();
+    for (size_t i = 0; i < this->dirtyBlocks.size(); i++) {
+        int block = this->dirtyBlocks[i];
+        this->dirty[block] = 0;
+        int x0 = (block % blocksX) * UPDATE_BLOCK;
+        int y0 = (block / blocksX) * UPDATE_BLOCK;
+        int x1 = x0 + UPDATE_BLOCK < this->width ? x0 + UPDATE_BLOCK : this->width;
+        int y1 = y0 + UPDATE_BLOCK < this->height ? y0 + UPDATE_BLOCK : this->height;
+        this->field.update(this->obstacles.data(), x0, y0, x1, y1);
+        for (int cy = y0; cy < y1; cy++) {
+            for (int cx = x0; cx < x1; cx++) {
+                int index = cy * this->width + cx;
+                float cost = costAt(distances[index]);
+                if (cost != this->costs[index]) {
+                    this->costs[index] = cost;
+                    this->costChanges.push_back(index);
+                }
+            }
+        }
+    }
+    this->dirtyBlocks.clear();
+    return this->costChanges.size();
+}
+
+/**
+ * @brief Reads changed cells of the map again and repairs the costs around them.
+ */
+size_t PathPlanner::updateMap(const MAP& map, const vector<GridCell>& changed) {
+    for (size_t i = 0; i < changed.size(); i++) {
+        const GridCell& cell = changed[i];
+        setObstacle(cell, map.isOccupied(cell.x, cell.y) || (this->unknownIsObstacle && !map.isFree(cell.x, cell.y)));
+    }
+    return applyChanges();
+}
+
+const vector<int>& PathPlanner::getCostChanges() const {
+    return this->costChanges;
+}
+
+/**
+ * @brief Finds the cheapest 8-connected cell path between two cells.
+ * @return the path cost in cells, or a negative value if the goal cannot be reached.
+ */
+double PathPlanner::plan(const GridCell& start, const GridCell& goal, vector<GridCell>& path) {
+    METRIC_SCOPE("planner_plan");
+    path.clear();
+    this->expanded = 0;
+    if (getCost(start.x, start.y) == BLOCKED || getCost(goal.x, goal.y) == BLOCKED) {
+        return -1.0;
+    }
+
+    // A new search number invalidates every g, parent and closed flag at once.
+    this->search++;
+    if (this->search >= 0x7FFFFFFFu) {
+        for (SearchNode& node : this->nodes) {
+            node.stamp = 0;
+        }
+        this->search = 1;
+    }
+    const unsigned int reached = 2 * this->search;
+    const unsigned int closed = reached + 1;
+    const float weight = static_cast<float>(this->heuristicWeight);
+    const int w = this->width;
+    const float* cost = this->costs.data();
+    SearchNode* node = this->nodes.data();
+
+    int startIndex = start.y * w + start.x;
+    int goalIndex = goal.y * w + goal.x;
+    this->open.clear();
+    node[startIndex] = SearchNode{ 0.0f, -1, reached };
+    this->open.push(startIndex, SearchKey{ weight * octile(start.x, start.y, goal.x, goal.y), 0.0f });
+
+    while (!this->open.empty()) {
+        int current = this->open.pop();
+        node[current].stamp = closed;
+        this->expanded++;
+        if (current == goalIndex) {
+            break;
+        }
+        int cx = current % w;
+        int cy = current / w;
+        float base = node[current].g;
+        for (int k = 0; k < 8; k++) {
+            int nx = cx + NEIGHBOUR_X[k];
+            int ny = cy + NEIGHBOUR_Y[k];
+            if (nx < 0 || ny < 0 || nx >= w || ny >= this->height) {
+                continue;
+            }
+            int next = ny * w + nx;
+            if (node[next].stamp == closed || cost[next] == BLOCKED) {
+                continue;
+            }
+            float step = cost[next];
+            if (k >= 4) {
+                // No corner cutting: both side cells of a diagonal step must be enterable.
+                if (cost[cy * w + nx] == BLOCKED || cost[ny * w + cx] == BLOCKED) {
+                    continue;
+                }
+                step *= DIAGONAL;
+            }
+            float tentative = base + step;
+            if (node[next].stamp != reached || tentative < node[next].g) {
+                node[next] = SearchNode{ tentative, current, reached };
+                this->open.push(next, SearchKey{ tentative + weight * octile(nx, ny, goal.x, goal.y), tentative });
+            }
+        }
+    }
+    METRIC_COUNT("planner_expanded_total", this->expanded);
+    if (node[goalIndex].stamp != closed) {
+        return -1.0;
+    }
+
+    for (int cell = goalIndex; cell != -1; cell = node[cell].parent) {
+        path.push_back(GridCell{ cell % w, cell / w });
+    }
+    for (size_t i = 0, j = path.size() - 1; i < j; i++, j--) {
+        GridCell swap = path[i];
+        path[i] = path[j];
+        path[j] = swap;
+    }
+    return node[goalIndex].g;
+}
+
+/**
+ * @brief Returns true if every cell on the line from a to b can be entered.
+ * Diagonal steps of the line also check both side cells, as plan() does.
+ */
+bool PathPlanner::isLineClear(const GridCell& a, const GridCell& b) const {
+    int x = a.x;
+    int y = a.y;
+    int dx = abs(b.x - a.x);
+    int dy = -abs(b.y - a.y);
+    int sx = a.x < b.x ? 1 : -1;
+    int sy = a.y < b.y ? 1 : -1;
+    int error = dx + dy;
+    while (true) {
+        if (getCost(x, y) == BLOCKED) {
+            return false;
+        }
+        if (x == b.x && y == b.y) {
+            return true;
+        }
+        int doubled = 2 * error;
+        bool stepX = doubled >= dy;
+        bool stepY = doubled <= dx;
+        if (stepX && stepY && (getCost(x + sx, y) == BLOCKED || getCost(x, y + sy) == BLOCKED)) {
+            return false;
+        }
+        if (stepX) {
+            error += dy;
+            x += sx;
+        }
+        if (stepY) {
+            error += dx;
+            y += sy;
+        }
+    }
+}
+
+/**
+ * @brief Shortens a cell path to the cells where it has to change direction.
+ *
+ * Walks the path keeping the last cell that can still be reached in a straight line
+ * from the current corner, and starts a new segment when the line is blocked.
+ */
+void PathPlanner::simplifyPath(vector<GridCell>& path) const {
+    if (path.size() < 3) {
+        return;
+    }
+    size_t kept = 1;
+    size_t anchor = 0;
+    for (size_t i = 2; i < path.size(); i++) {
+        if (!isLineClear(path[anchor], path[i])) {
+            path[kept++] = path[i - 1];
+            anchor = i - 1;
+        }
+    }
+    path[kept++] = path.back();
+    // Corners are written in place, never past the cells still to be read.
+    path.resize(kept);
+}
+
+/**
+ * @brief Converts waypoints to motion steps.
+ *
+ * The robot is omnidirectional, so each segment is driven with the move command whose
+ * direction is nearest to it (forward, left, backward or right of the heading), after
+ * a turn of at most 45 degrees for the remaining angle. Consecutive steps with the same
+ * command are merged.
+ * @return the robot heading after the last step.
+ */
+double PathPlanner::toCommands(double heading, const double* xs, const double* ys, int count, vector<MotionStep>& steps) {
+    static const RobotCommand MOVES[4] = { COMMAND_MOVE_FORWARD, COMMAND_MOVE_LEFT, COMMAND_MOVE_BACKWARD, COMMAND_MOVE_RIGHT };
+    for (int i = 1; i < count; i++) {
+        double dx = xs[i] - xs[i - 1];
+        double dy = ys[i] - ys[i - 1];
+        double length = sqrt(dx * dx + dy * dy);
+        if (length < 1e-9) {
+            continue;
+        }
+        double relative = wrapAngle(atan2(dy, dx) - heading);
+        int quadrant = static_cast<int>(floor(relative / (PI / 2.0) + 0.5));
+        double residual = wrapAngle(relative - quadrant * (PI / 2.0));
+        RobotCommand move = MOVES[(quadrant % 4 + 4) % 4];
+
+        if (fabs(residual) > 1e-6) {
+            RobotCommand turn = residual > 0 ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT;
+            if (!steps.empty() && steps.back().command == turn) {
+                steps.back().amount += fabs(residual);
+            }
+            else {
+                steps.push_back(MotionStep{ turn, fabs(residual) });
+            }
+            heading = wrapAngle(heading + residual);
+        }
+        if (!steps.empty() && steps.back().command == move) {
+            steps.back().amount += length;
+        }
+        else {
+            steps.push_back(MotionStep{ move, length });
+        }
+    }
+    return heading;
+}
+
+/**
+ * @brief Plans from a pose to a goal pose and converts the path to motion steps.
+ * The path starts and ends at the exact poses; the cells in between are replaced by
+ * their centers.
+ */
+bool PathPlanner::planCommands(const Pose& start, const Pose& goal, vector<MotionStep>& steps) {
+    steps.clear();
+    GridCell from;
+    GridCell to;
+    if (!worldToCell(start.getX(), start.getY(), from) || !worldToCell(goal.getX(), goal.getY(), to)) {
+        return false;
+    }
+    if (plan(from, to, this->cellPath) < 0) {
+        return false;
+    }
+    simplifyPath(this->cellPath);
+
+    // The first and last cells are the ones the poses lie in, so the exact poses are used.
+    size_t cells = this->cellPath.size();
+    size_t count = cells > 2 ? cells : 2;
+    this->waypointXs.resize(count);
+    this->waypointYs.resize(count);
+    this->waypointXs[0] = start.getX();
+    this->waypointYs[0] = start.getY();
+    for (size_t i = 1; i + 1 < cells; i++) {
+        cellToWorld(this->cellPath[i], this->waypointXs[i], this->waypointYs[i]);
+    }
+    this->waypointXs[count - 1] = goal.getX();
+    this->waypointYs[count - 1] = goal.getY();
+
+    double heading = toCommands(start.getTh(), this->waypointXs.data(), this->waypointYs.data(), static_cast<int>(count), steps);
+    double turn = wrapAngle(goal.getTh() - heading);
+    if (fabs(turn) > 1e-6) {
+        steps.push_back(MotionStep{ turn > 0 ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT, fabs(turn) });
+    }
+    return true;
+}
+
+/**
+ * @brief Converts a world point to the grid cell that contains it.
+ * @return true if the point lies inside the grid.
+ */
+bool PathPlanner::worldToCell(double x, double y, GridCell& cell) const {
+    double fx = (x - this->originX) / this->resolution;
+    double fy = (y - this->originY) / this->resolution;
+    if (fx < 0 || fy < 0 || fx >= this->width || fy >= this->height) {
+        return false;
+    }
+    cell.x = static_cast<int>(fx);
+    cell.y = static_cast<int>(fy);
+    return true;
+}
+
+/**
+ * @brief Gives the world coordinates of the center of a cell.
+ */
+void PathPlanner::cellToWorld(const GridCell& cell, double& x, double& y) const {
+    x = this->originX + (cell.x + 0.5) * this->resolution;
+    y = this->originY + (cell.y + 0.5) * this->resolution;
+}
+
+float PathPlanner::getCost(int cx, int cy) const {
+    if (cx < 0 || cy < 0 || cx >= this->width || cy >= this->height) {
+        return BLOCKED;
+    }
+    return this->costs[static_cast<size_t>(cy) * this->width + cx];
+}
+
+const float* PathPlanner::getCosts() const {
+    return this->costs.data();
+}
+
+int PathPlanner::getWidth() const {
+    return this->width;
+}
+
+int PathPlanner::getHeight() const {
+    return this->height;
+}
+
+const DistanceField& PathPlanner::getDistanceField() const {
+    return this->field;
+}
+
+int PathPlanner::getExpandedCount() const {
+    return this->expanded;
+}
+
+/**
+ * @brief Returns the bytes held by the cost grid and the search arenas.
+ */
+size_t PathPlanner::getArenaBytes() const {
+    size_t cells = this->costs.capacity();
+    return cells * (sizeof(float) + sizeof(unsigned char)) + this->nodes.capacity() * sizeof(SearchNode) + cells * (sizeof(SearchKey) + 2 * sizeof(int));
+}
@@ -0,0 +1,291 @@
+#pragma once
+/**
+ * @file   PathPlanner.h
+ * @date   October, 2026
+ * @brief  Header file for the PathPlanner class.
+ *
+ * This file contains the definition of the PathPlanner class, an A* / Dijkstra grid
+ * planner over a MAP that turns a goal pose into RobotControler motion commands.
+ */
+
+#include <vector>
+#include "CommandDispatcher.h"
+#include "DistanceField.h"
+#include "IndexedHeap.h"
+#include "MAP.h"
+#include "Pose.h"
+
+//! MotionStep struct
+/*!
+ * @brief One RobotControler primitive of a plan.
+ */
+struct MotionStep {
+    RobotCommand command; /*!< Primitive to run. */
+    double amount;        /*!< Meters for a move, radians for a turn. */
+};
+
+//! PathPlanner class
+/*!
+ * @brief Shortest paths on an inflated occupancy grid.
+ *
+ * setMap() computes the obstacle DistanceField of a MAP once and derives a cost for
+ * every cell from it: cells closer to an obstacle than the robot radius are blocked,
+ * cells within the inflation radius cost up to 1 + inflationPenalty times more, and
+ * the rest cost 1. plan() then runs an 8-connected search on those costs. With
+ * heuristic weight 1 it is A* with the octile distance, which is admissible because no
+ * cell costs less than 1; with weight 0 it is Dijkstra's algorithm. Diagonal steps may
+ * not cut the corner of a blocked cell.
+ *
+ * The open list is an IndexedHeap, so a cell whose cost improves is moved in the heap
+ * rather than pushed again. The per-cell search state lives in arenas sized by
+ * setMap() and is invalidated by bumping a search number rather than cleared, so
+ * repeated plan() calls on the same map do not allocate once the output vectors have
+ * grown to the path length.
+ *
+ * A map that changes by a few cells does not need a new setMap(). setObstacle()
+ * or updateMap() change cells of the obstacle grid, and applyChanges() repairs the
+ * distance field and the costs only in the UPDATE_BLOCK x UPDATE_BLOCK blocks within
+ * the inflation radius of a change. The field is clamped just past the inflation
+ * radius, which is all the costs depend on, so the repaired costs equal those of a
+ * full setMap(). getCostChanges() lists the cells whose cost changed, the input an
+ * IncrementalPlanner needs to repair its plan.
+ *
+ * planCommands() shortens the cell path to straight segments that keep clear of
+ * blocked cells and converts it to motion steps for the omnidirectional robot: each
+ * segment is driven with whichever of forward, backward, left or right is closest to
+ * its direction, after turning by the small remaining angle.
+ */
+class PathPlanner {
+public:
+    //! SearchKey struct
+    /*!
+     * @brief Open list priority: f = g + h, ties broken towards larger g.
+     */
+    struct SearchKey {
+        float f; /*!< Estimated total cost. */
+        float g; /*!< Cost from the start. */
+
+        bool operator<(const SearchKey& other) const {
+            return f < other.f || (f == other.f && g > other.g);
+        }
+    };
+
+    static const float BLOCKED;   /*!< Cost of a cell the robot cannot enter. */
+    static const int UPDATE_BLOCK = 32; /*!< Side of the blocks applyChanges() recomputes (cells). */
+
+private:
+    int width;                     /*!< Grid width in cells. */
+    int height;                    /*!< Grid height in cells. */
+    double resolution;             /*!< Cell side in meters. */
+    double originX;                /*!< World x of the corner of cell (0, 0) (meters). */
+    double originY;                /*!< World y of the corner of cell (0, 0) (meters). */
+    double robotRadius;            /*!< Cells nearer an obstacle than this are blocked (meters). */
+    double inflationRadius;        /*!< Cells nearer than this cost more (meters). */
+    double inflationPenalty;       /*!< Extra cost of a cell next to the blocked zone. */
+    double heuristicWeight;        /*!< 1 for A*, 0 for Dijkstra. */
+    bool unknownIsObstacle;        /*!< Unknown map cells are treated as obstacles. */
+    DistanceField field;           /*!< Distance of every cell to the nearest obstacle. */
+    std::vector<unsigned char> obstacles; /*!< Obstacle flag of every cell. */
+    std::vector<float> costs;      /*!< Cost of entering each cell, BLOCKED if it cannot be entered. */
+    std::vector<unsigned char> dirty; /*!< Flag of every update block with pending obstacle changes. */
+    std::vector<int> dirtyBlocks;  /*!< Update blocks with pending obstacle changes. */
+    std::vector<int> costChanges;  /*!< Cells whose cost the last applyChanges() changed. */
+
+    //! SearchNode struct
+    /*!
+     * @brief Search state of one cell, kept together so a neighbour costs one cache line.
+     */
+    struct SearchNode {
+        float g;            /*!< Cost from the start, valid if stamp matches the search. */
+        int parent;         /*!< Predecessor on the best known path. */
+        unsigned int stamp; /*!< 2 * search once reached, 2 * search + 1 once closed. */
+    };
+
+    IndexedHeap<SearchKey> open;   /*!< Open list. */
+    std::vector<SearchNode> nodes; /*!< Search state of every cell. */
+    unsigned int search;           /*!< Number of the current search. */
+    std::vector<GridCell> cellPath; /*!< Cell path of the last planCommands(). */
+    std::vector<double> waypointXs; /*!< Waypoint x of the last planCommands() (meters). */
+    std::vector<double> waypointYs; /*!< Waypoint y of the last planCommands() (meters). */
+    int expanded;                  /*!< Cells closed by the last search. */
+
+    //! updateCosts function
+    /*!
+    * Computes the distance field of the obstacle grid and derives the cell costs from it.
+    */
+    void updateCosts();
+
+    //! costAt function
+    /*!
+    * @return the cost of a cell at the given distance from the nearest obstacle (meters).
+    */
+    float costAt(double distance) const;
+
+    //! isLineClear function
+    /*!
+    * @return true if every cell on the line from a to b can be entered.
+    */
+    bool isLineClear(const GridCell& a, const GridCell& b) const;
+
+public:
+    //! Default constructor
+    /*!
+    * Robot radius 0.2 m, inflation radius 0.5 m, inflation penalty 4, A*.
+    */
+    PathPlanner();
+
+    //! setRobotRadius function
+    /*!
+    * @param robotRadius Minimum clearance to obstacles (meters).
+    * @param inflationRadius Clearance below which cells cost more (meters).
+    * @param inflationPenalty Extra cost at the robot radius, falling to 0 at the inflation radius.
+    * Takes effect at the next setMap().
+    */
+    void setRobotRadius(double robotRadius, double inflationRadius, double inflationPenalty);
+
+    //! setHeuristicWeight function
+    /*!
+    * @param weight 1 for A*, 0 for Dijkstra, above 1 for faster, suboptimal plans.
+    */
+    void setHeuristicWeight(double weight);
+
+    //! setUnknownIsObstacle function
+    /*!
+    * Takes effect at the next setMap().
+    */
+    void setUnknownIsObstacle(bool unknownIsObstacle);
+
+    //! setMap function
+    /*!
+    * Computes the distance field and cell costs of a map and sizes the search arenas.
+    */
+    void setMap(const MAP& map);
+
+    //! setGrid function
+    /*!
+    * Same as setMap() for an obstacle grid.
+    * @param width Grid width in cells.
+    * @param height Grid height in cells.
+    * @param obstacles width * height flags, row major, non-zero for an obstacle.
+    * @param resolution Cell side (meters).
+    * @param originX World x of the corner of cell (0, 0) (meters).
+    * @param originY World y of the corner of cell (0, 0) (meters).
+    */
+    void setGrid(int width, int height, const unsigned char* obstacles, double resolution, double originX, double originY);
+
+    //! setObstacle function
+    /*!
+    * Marks or clears one cell of the obstacle grid. The costs follow at the next applyChanges().
+    */
+    void setObstacle(const GridCell& cell, bool obstacle);
+
+    //! applyChanges function
+    /*!
+    * Repairs the distance field and the costs around the cells changed since the last call.
+    * @return the number of cells whose cost changed, listed by getCostChanges().
+    */
+    size_t applyChanges();
+
+    //! updateMap function
+    /*!
+    * Reads the given cells of the map set by setMap() again and applies the changes.
+    * @param map The map, after the changes.
+    * @param changed Cells that may have changed, as given by MAP::takeChangedCells().
+    * @return the number of cells whose cost changed.
+    */
+    size_t updateMap(const MAP& map, const std::vector<GridCell>& changed);
+
+    //! getCostChanges function
+    /*!
+    * @return the row-major indices of the cells whose cost the last applyChanges() changed.
+    */
+    const std::vector<int>& getCostChanges() const;
+
+    //! plan function
+    /*!
+    * Finds the cheapest 8-connected cell path between two cells.
+    * @param start First cell.
+    * @param goal Last cell.
+    * @param path Receives the cells from start to goal.
+    * @return the path cost in cells, or a negative value if the goal cannot be reached.
+    */
+    double plan(const GridCell& start, const GridCell& goal, std::vector<GridCell>& path);
+
+    //! planCommands function
+    /*!
+    * Plans from a pose to a goal pose and converts the path to motion steps, ending
+    * with a turn to the goal heading.
+    * @param start Current robot pose.
+    * @param goal Goal pose.
+    * @param steps Receives the motion steps.
+    * @return false if either pose is outside the map, blocked, or the goal cannot be reached.
+    */
+    bool planCommands(const Pose& start, const Pose& goal, std::vector<MotionStep>& steps);
+
+    //! simplifyPath function
+    /*!
+    * Replaces a cell path by the fewest cells it can be shortened to while every
+    * straight segment between them stays on enterable cells.
+    */
+    void simplifyPath(std::vector<GridCell>& path) const;
+
+    //! toCommands function
+    /*!
+    * Converts waypoints in world coordinates to motion steps.
+    * @param heading Robot heading at the first waypoint (radians).
+    * @param xs World x of the waypoints (meters).
+    * @param ys World y of the waypoints (meters).
+    * @param count Number of waypoints.
+    * @param steps Receives the motion steps.
+    * @return the robot heading after the last step.
+    */
+    static double toCommands(double heading, const double* xs, const double* ys, int count, std::vector<MotionStep>& steps);
+
+    //! worldToCell function
+    /*!
+    * @return true if the point lies inside the grid.
+    */
+    bool worldToCell(double x, double y, GridCell& cell) const;
+
+    //! cellToWorld function
+    /*!
+    * Gives the world coordinates of the center of a cell.
+    */
+    void cellToWorld(const GridCell& cell, double& x, double& y) const;
+
+    //! getCost function
+    /*!
+    * @return the cost of entering a cell, BLOCKED if it cannot be entered or is outside the grid.
+    */
+    float getCost(int cx, int cy) const;
+
+    //! getCosts function
+    /*!
+    * @return the costs of all cells, row major.
+    */
+    const float* getCosts() const;
+
+    //! getWidth function
+    int getWidth() const;
+
+    //! getHeight function
+    int getHeight() const;
+
+    //! getDistanceField function
+    /*!
+    * Distances are exact up to the inflation radius plus one cell and clamped beyond it.
+    */
+    const DistanceField& getDistanceField() const;
+
+    //! getExpandedCount function
+    /*!
+    * @return the cells closed by the last search.
+    */
+    int getExpandedCount() const;
+
+    //! getArenaBytes function
+    /*!
+    * @return bytes held by the cost grid and the search arenas.
+    */
+    size_t getArenaBytes() const;
+};
@@ -0,0 +1,166 @@
+/**
+ * @file   Point.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the PointCloud class.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <utility>
+#include "Point.h"
+
+using namespace std;
+
+/**
+ * @brief Default constructor. The cloud starts empty.
+ */
+PointCloud::PointCloud() {
+    this->xs = nullptr;
+    this->ys = nullptr;
+    this->count = 0;
+    this->capacity = 0;
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * @param capacity Number of points to reserve room for.
+ */
+PointCloud::PointCloud(int capacity) : PointCloud() {
+    reserve(capacity);
+}
+
+/**
+ * @brief Destructor. Frees the coordinate arrays.
+ */
+PointCloud::~PointCloud() {
+    if (this->xs != nullptr) {
+        ::operator delete[](this->xs, align_val_t(ALIGNMENT));
+    }
+}
+
+/**
+ * @brief Makes room for at least capacity points.
+ * Both arrays share one aligned block; the padding lanes are kept at zero.
+ */
+void PointCloud::reserve(int capacity) {
+    if (capacity <= this->capacity) {
+        return;
+    }
+    int rounded = (capacity + PADDING - 1) / PADDING * PADDING;
+    double* block = static_cast<double*>(::operator new[](sizeof(double) * 2 * rounded, align_val_t(ALIGNMENT)));
+    memset(block, 0, sizeof(double) * 2 * rounded);
+    if (this->xs != nullptr) {
+        memcpy(block, this->xs, sizeof(double) * this->count);
+        memcpy(block + rounded, this->ys, sizeof(double) * this->count);
+        ::operator delete[](this->xs, align_val_t(ALIGNMENT));
+    }
+    this->xs = block;
+    this->ys = block + rounded;
+    this->capacity = rounded;
+}
+
+/**
+ * @brief Removes every point, zeroing the lanes that held them.
+ */
+void PointCloud::clear() {
+    if (this->count > 0) {
+        memset(this->xs, 0, sizeof(double) * this->count);
+        memset(this->ys, 0, sizeof(double) * this->count);
+    }
+    this->count = 0;
+}
+
+/**
+ * @brief Adds a point at the end, growing the arrays when full.
+ */
+void PointCloud::append(double x, double y) {
+    if (this->count == this->capacity) {
+        reserve(this->capacity > 0 ? this->capacity * 2 : 64);
+    }
+    this->xs[this->count] = x;
+    this->ys[this->count] = y;
+    this->count++;
+}
+
+void PointCloud::append(const Point& point) {
+    append(point.getX(), point.getY());
+}
+
+int PointCloud::size() const {
+    return this->count;
+}
+
+/**
+ * @brief Returns point i.
+ */
+Point PointCloud::get(int i) const {
+    if (i < 0 || i >= this->count) {
+        cout << "Error: point index " << i << " is out of range." << endl;
+        return Point();
+    }
+    return Point(this->xs[i], this->ys[i]);
+}
+
+const double* PointCloud::getXs() const {
+    return this->xs;
+}
+
+const double* PointCloud::getYs() const {
+    return this->ys;
+}
+
+/**
+ * @brief Replaces the points with those of another cloud.
+ */
+void PointCloud::copyFrom(const PointCloud& other) {
+    if (&other == this) {
+        return;
+    }
+    clear();
+    reserve(other.count);
+    if (other.count > 0) {
+        memcpy(this->xs, other.xs, sizeof(double) * other.count);
+        memcpy(this->ys, other.ys, sizeof(double) * other.count);
+    }
+    this->count = other.count;
+}
+
+/**
+ * @brief Exchanges the arrays of two clouds.
+ */
+void PointCloud::swap(PointCloud& other) {
+    std::swap(this->xs, other.xs);
+    std::swap(this->ys, other.ys);
+    std::swap(this->count, other.count);
+    std::swap(this->capacity, other.capacity);
+}
+
+/**
+ * @brief Writes every point moved into the frame's parent coordinates to out.
+ *
+ * The points are independent and stored as separate x and y arrays, so the compiler
+ * vectorizes the loop.
+ */
+void PointCloud::transform(const Pose& frame, PointCloud& out) const {
+    if (&out == this) {
+        cout << "Error: a point cloud cannot be transformed into itself." << endl;
+        return;
+    }
+    out.clear();
+    out.reserve(this->count);
+    double c = cos(frame.getTh());
+    double s = sin(frame.getTh());
+    double tx = frame.getX();
+    double ty = frame.getY();
+    const double* inX = this->xs;
+    const double* inY = this->ys;
+    double* outX = out.xs;
+    double* outY = out.ys;
+    for (int i = 0; i < this->count; i++) {
+        outX[i] = tx + c * inX[i] - s * inY[i];
+        outY[i] = ty + s * inX[i] + c * inY[i];
+    }
+    out.count = this->count;
+}
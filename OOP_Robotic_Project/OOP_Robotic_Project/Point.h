@@ -1 +1,183 @@
 #pragma once
+/**
+ * @file   Point.h
+ * @date   October, 2026
+ * @brief  Header file for the Point and PointCloud classes.
+ *
+ * This file contains the definition of the Point class, a position in a 2D space, and
+ * of the PointCloud class, a structure-of-arrays container of points such as the
+ * returns of a lidar scan.
+ */
+
+#include <cmath>
+#include <type_traits>
+#include "Pose.h"
+
+//! Point class
+/*!
+ * @brief Represents a position in a 2D space.
+ *
+ * Like Pose, Point is a trivially copyable value type defined entirely in this header.
+ */
+class Point {
+private:
+    double x; /*!< x-coordinate (meters). */
+    double y; /*!< y-coordinate (meters). */
+
+public:
+    //! Default constructor
+    constexpr Point() : x(0), y(0) {}
+
+    //! Parameterized constructor
+    /*!
+     * @param x x-coordinate (in meters).
+     * @param y y-coordinate (in meters).
+     */
+    constexpr Point(double x, double y) : x(x), y(y) {}
+
+    //! Getter for x-coordinate
+    constexpr double getX() const {
+        return x;
+    }
+
+    //! Setter for x-coordinate
+    constexpr void setX(double x) {
+        this->x = x;
+    }
+
+    //! Getter for y-coordinate
+    constexpr double getY() const {
+        return y;
+    }
+
+    //! Setter for y-coordinate
+    constexpr void setY(double y) {
+        this->y = y;
+    }
+
+    /**
+     * @brief Equality operator to compare two Point objects.
+     */
+    constexpr bool operator==(const Point& other) const {
+        return x == other.x && y == other.y;
+    }
+
+    /**
+     * @brief Calculates the squared Euclidean distance to another Point.
+     * @return The squared distance (in square meters).
+     */
+    constexpr double findSquaredDistanceTo(const Point& point) const {
+        return (point.x - x) * (point.x - x) + (point.y - y) * (point.y - y);
+    }
+
+    /**
+     * @brief Calculates the Euclidean distance to another Point.
+     * @return The distance (in meters).
+     */
+    double findDistanceTo(const Point& point) const {
+        return std::sqrt(findSquaredDistanceTo(point));
+    }
+
+    /**
+     * @brief Moves the point from the coordinates of frame into the coordinates frame is
+     * expressed in.
+     * @param frame Pose of the local frame.
+     * @return the point rotated by frame's orientation and shifted by its position.
+     */
+    Point transformed(const Pose& frame) const {
+        double c = std::cos(frame.getTh());
+        double s = std::sin(frame.getTh());
+        return Point(frame.getX() + c * x - s * y, frame.getY() + s * x + c * y);
+    }
+};
+
+static_assert(std::is_trivially_copyable<Point>::value, "Point must stay a plain value type");
+
+//! PointCloud class
+/*!
+ * @brief Many points stored as two aligned arrays of x and y.
+ *
+ * The layout matches PoseArray: storage grows like a vector, each coordinate is
+ * contiguous and aligned, and the capacity is padded to a multiple of PADDING points
+ * whose padding lanes stay zero, so loops over the arrays can use full vectors.
+ */
+class PointCloud {
+public:
+    static const int ALIGNMENT = 32; /*!< Byte alignment of the coordinate arrays. */
+    static const int PADDING = 4;    /*!< Capacity is a multiple of this many points. */
+
+private:
+    double* xs;   /*!< x-coordinates (meters). */
+    double* ys;   /*!< y-coordinates (meters). */
+    int count;    /*!< Number of points stored. */
+    int capacity; /*!< Number of points the arrays can hold. */
+
+    PointCloud(const PointCloud&) = delete;
+    PointCloud& operator=(const PointCloud&) = delete;
+
+public:
+    //! Default constructor
+    PointCloud();
+
+    //! Parameterized Constructor
+    /*!
+    * @param capacity Number of points to reserve room for.
+    */
+    PointCloud(int capacity);
+
+    //! Destructor
+    ~PointCloud();
+
+    //! reserve function
+    /*!
+    * Makes room for at least capacity points, keeping the ones stored.
+    */
+    void reserve(int capacity);
+
+    //! clear function
+    void clear();
+
+    //! append function
+    /*!
+    * Adds a point at the end.
+    */
+    void append(double x, double y);
+
+    //! append function
+    void append(const Point& point);
+
+    //! size function
+    int size() const;
+
+    //! get function
+    /*!
+    * @return point i.
+    */
+    Point get(int i) const;
+
+    //! getXs function
+    const double* getXs() const;
+
+    //! getYs function
+    const double* getYs() const;
+
+    //! copyFrom function
+    /*!
+    * Replaces the points with those of another cloud.
+    */
+    void copyFrom(const PointCloud& other);
+
+    //! swap function
+    /*!
+    * Exchanges the points of two clouds without copying them.
+    */
+    void swap(PointCloud& other);
+
+    //! transform function
+    /*!
+    * Writes every point moved by Point::transformed(frame) to out.
+    * @param frame Pose of the local frame.
+    * @param out Receives size() points; must not be this cloud.
+    */
+    void transform(const Pose& frame, PointCloud& out) const;
+};
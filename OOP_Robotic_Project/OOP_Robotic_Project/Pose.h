@@ -8,147 +8,208 @@
  * This file contains the definition of the Pose class, which is used to represent
  * the position and orientation of a robot in a 2D space.
  */
-#pragma once
 
-#include <iostream>
-#include <string>
+#include <cmath>
+#include <type_traits>
 
  //! Pose class
  /*!
   * @brief Represents the position and orientation of a robot in a 2D space.
   *
   * The Pose class stores the x and y coordinates (in meters) and the orientation
-  * (theta, in degrees) of a robot in a 2D space. It provides functionalities for
-  * setting and retrieving these values, as well as performing operations such as
-  * distance and angle calculations.
+  * (theta, in radians as returned by getXYTh) of a robot in a 2D space. It provides
+  * functionalities for setting and retrieving these values, as well as performing
+  * operations such as distance and angle calculations.
+  *
+  * Pose is a trivially copyable value type defined entirely in this header; every
+  * member is inline and, except for the functions that need the math library,
+  * usable in constant expressions. PoseArray holds many poses for batch operations.
   */
 class Pose {
 private:
     double x;  /*!< x-coordinate of the robot in the 2D space (meters). */
     double y;  /*!< y-coordinate of the robot in the 2D space (meters). */
-    double th; /*!< Orientation of the robot in the 2D space (degrees). */
+    double th; /*!< Orientation of the robot in the 2D space (radians). */
 
 public:
     //! Default constructor
     /*!
      * Initializes the Pose object with default values (x = 0, y = 0, th = 0).
      */
-    Pose();
+    constexpr Pose() : x(0), y(0), th(0) {}
 
     //! Parameterized constructor
     /*!
      * Initializes the Pose object with specified values.
      * @param x Initial x-coordinate (in meters).
      * @param y Initial y-coordinate (in meters).
-     * @param th Initial orientation (in degrees).
+     * @param th Initial orientation (in radians).
      */
-    Pose(double x, double y, double th);
+    constexpr Pose(double x, double y, double th) : x(x), y(y), th(th) {}
 
     //! Getter for x-coordinate
     /*!
      * @return The x-coordinate of the Pose (in meters).
      */
-    double getX();
+    constexpr double getX() const {
+        return x;
+    }
 
     //! Setter for x-coordinate
     /*!
      * @param x New x-coordinate to set (in meters).
      */
-    void setX(double x);
+    constexpr void setX(double x) {
+        this->x = x;
+    }
 
     //! Getter for y-coordinate
     /*!
      * @return The y-coordinate of the Pose (in meters).
      */
-    double getY();
+    constexpr double getY() const {
+        return y;
+    }
 
     //! Setter for y-coordinate
     /*!
      * @param y New y-coordinate to set (in meters).
      */
-    void setY(double y);
+    constexpr void setY(double y) {
+        this->y = y;
+    }
 
     //! Getter for orientation
     /*!
-     * @return The orientation (theta) of the Pose (in degrees).
+     * @return The orientation (theta) of the Pose (in radians).
      */
-    double getTh();
+    constexpr double getTh() const {
+        return th;
+    }
 
     //! Setter for orientation
     /*!
-     * @param th New orientation to set (in degrees).
+     * @param th New orientation to set (in radians).
      */
-    void setTh(double th);
+    constexpr void setTh(double th) {
+        this->th = th;
+    }
 
     /**
      * @brief Equality operator to compare two Pose objects.
      * @param other Another Pose object to compare with.
      * @return True if both Pose objects are equal, otherwise false.
      */
-    bool operator==(const Pose& other);
+    constexpr bool operator==(const Pose& other) const {
+        return x == other.x && y == other.y && th == other.th;
+    }
 
     /**
      * @brief Addition operator to add two Pose objects.
      * @param other Another Pose object to add.
      * @return A new Pose object with the result of the addition.
      */
-    Pose operator+(const Pose& other);
+    constexpr Pose operator+(const Pose& other) const {
+        return Pose(x + other.x, y + other.y, th + other.th);
+    }
 
     /**
      * @brief Subtraction operator to subtract one Pose from another.
      * @param other Another Pose object to subtract.
      * @return A new Pose object with the result of the subtraction.
      */
-    Pose operator-(const Pose& other);
+    constexpr Pose operator-(const Pose& other) const {
+        return Pose(x - other.x, y - other.y, th - other.th);
+    }
 
     /**
      * @brief Addition and assignment operator to update this Pose by adding a scalar value.
      * @param other A scalar value to add to the current Pose.
      * @return A reference to the updated Pose object.
      */
-    Pose& operator+=(const double& other);
+    constexpr Pose& operator+=(const double& other) {
+        x += other;
+        y += other;
+        th += other;
+        return *this;
+    }
 
     /**
      * @brief Subtraction and assignment operator to update this Pose by subtracting a scalar value.
      * @param other A scalar value to subtract from the current Pose.
      * @return A reference to the updated Pose object.
      */
-    Pose& operator-=(const double& other);
+    constexpr Pose& operator-=(const double& other) {
+        x -= other;
+        y -= other;
+        th -= other;
+        return *this;
+    }
 
     /**
      * @brief Less-than operator to compare two Pose objects.
+     *
+     * Compares the x, y, and th values lexicographically.
      * @param other Another Pose object to compare with.
      * @return True if this Pose is less than the other Pose, otherwise false.
      */
-    bool operator<(const Pose& other);
+    constexpr bool operator<(const Pose& other) const {
+        if (x < other.x) return true;
+        if (x == other.x && y < other.y) return true;
+        if (x == other.x && y == other.y && th < other.th) return true;
+        return false;
+    }
 
     /**
      * @brief Retrieves the current Pose values.
      * @param _x Reference to store the x-coordinate (in meters).
      * @param _y Reference to store the y-coordinate (in meters).
-     * @param _th Reference to store the orientation (in degrees).
+     * @param _th Reference to store the orientation (in radians).
      */
-    void getPose(double& _x, double& _y, double& _th);
+    constexpr void getPose(double& _x, double& _y, double& _th) const {
+        _x = x;
+        _y = y;
+        _th = th;
+    }
 
     /**
      * @brief Sets the Pose values.
      * @param _x New x-coordinate (in meters).
      * @param _y New y-coordinate (in meters).
-     * @param _th New orientation (in degrees).
+     * @param _th New orientation (in radians).
      */
-    void setPose(double _x, double _y, double _th);
+    constexpr void setPose(double _x, double _y, double _th) {
+        x = _x;
+        y = _y;
+        th = _th;
+    }
+
+    /**
+     * @brief Calculates the squared Euclidean distance to another Pose.
+     * @param pos Another Pose object to calculate the distance to.
+     * @return The squared distance to the specified Pose (in square meters).
+     */
+    constexpr double findSquaredDistanceTo(const Pose& pos) const {
+        return (pos.x - x) * (pos.x - x) + (pos.y - y) * (pos.y - y);
+    }
 
     /**
      * @brief Calculates the Euclidean distance to another Pose.
      * @param pos Another Pose object to calculate the distance to.
      * @return The distance to the specified Pose (in meters).
      */
-    double findDistanceTo(const Pose& pos);
+    double findDistanceTo(const Pose& pos) const {
+        return std::sqrt(findSquaredDistanceTo(pos));
+    }
 
     /**
      * @brief Calculates the angle between this Pose and another Pose.
      * @param pos Another Pose object to calculate the angle to.
      * @return The angle to the specified Pose in radians.
      */
-    double findAngleTo(const Pose& pos);
-};
\ No newline at end of file
+    double findAngleTo(const Pose& pos) const {
+        return std::atan2(pos.y - y, pos.x - x);
+    }
+};
+
+static_assert(std::is_trivially_copyable<Pose>::value, "Pose must stay a plain value type");
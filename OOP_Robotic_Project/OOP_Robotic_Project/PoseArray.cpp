@@ -0,0 +1,339 @@
+/**
+ * @file   PoseArray.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the PoseArray class.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include "PoseArray.h"
+
+#if defined(POSEARRAY_AVX)
+#include <immintrin.h>
+#elif defined(POSEARRAY_SSE)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+#if defined(POSEARRAY_AVX) || defined(POSEARRAY_SSE)
+
+// Thin wrappers so each kernel is written once for both vector widths.
+#if defined(POSEARRAY_AVX)
+typedef __m256d Vec;
+static const int LANES = 4;
+static inline Vec vset(double v) { return _mm256_set1_pd(v); }
+static inline Vec vload(const double* p) { return _mm256_load_pd(p); }
+static inline Vec vloadu(const double* p) { return _mm256_loadu_pd(p); }
+static inline void vstoreu(double* p, Vec v) { _mm256_storeu_pd(p, v); }
+static inline void vstore(double* p, Vec v) { _mm256_store_pd(p, v); }
+static inline Vec vadd(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm256_sub_pd(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm256_mul_pd(a, b); }
+static inline Vec vdiv(Vec a, Vec b) { return _mm256_div_pd(a, b); }
+static inline Vec vsqrt(Vec a) { return _mm256_sqrt_pd(a); }
+static inline Vec vand(Vec a, Vec b) { return _mm256_and_pd(a, b); }
+static inline Vec vandnot(Vec a, Vec b) { return _mm256_andnot_pd(a, b); }
+static inline Vec vor(Vec a, Vec b) { return _mm256_or_pd(a, b); }
+static inline Vec vgreater(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+static inline Vec vequal(Vec a, Vec b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+static inline Vec vselect(Vec mask, Vec a, Vec b) { return _mm256_blendv_pd(b, a, mask); }
+static inline Vec vsignmask(Vec v) { return v; } // blendv only looks at the sign bit
+static inline double vsum(Vec v) {
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+#else
+typedef __m128d Vec;
+static const int LANES = 2;
+static inline Vec vset(double v) { return _mm_set1_pd(v); }
+static inline Vec vload(const double* p) { return _mm_load_pd(p); }
+static inline Vec vloadu(const double* p) { return _mm_loadu_pd(p); }
+static inline void vstoreu(double* p, Vec v) { _mm_storeu_pd(p, v); }
+static inline void vstore(double* p, Vec v) { _mm_store_pd(p, v); }
+static inline Vec vadd(Vec a, Vec b) { return _mm_add_pd(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm_sub_pd(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm_mul_pd(a, b); }
+static inline Vec vdiv(Vec a, Vec b) { return _mm_div_pd(a, b); }
+static inline Vec vsqrt(Vec a) { return _mm_sqrt_pd(a); }
+static inline Vec vand(Vec a, Vec b) { return _mm_and_pd(a, b); }
+static inline Vec vandnot(Vec a, Vec b) { return _mm_andnot_pd(a, b); }
+static inline Vec vor(Vec a, Vec b) { return _mm_or_pd(a, b); }
+static inline Vec vgreater(Vec a, Vec b) { return _mm_cmpgt_pd(a, b); }
+static inline Vec vequal(Vec a, Vec b) { return _mm_cmpeq_pd(a, b); }
+static inline Vec vselect(Vec mask, Vec a, Vec b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+static inline Vec vsignmask(Vec v) {
+    return _mm_castsi128_pd(_mm_srai_epi32(_mm_shuffle_epi32(_mm_castpd_si128(v), _MM_SHUFFLE(3, 3, 1, 1)), 31));
+}
+static inline double vsum(Vec v) {
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+#endif
+
+/**
+ * @brief Vector atan2(y, x).
+ * The ratio of the smaller to the larger magnitude is reduced to |t| <= 0.66 and fed
+ * to the Cephes rational approximation of atan; the octant is restored afterwards.
+ */
+static inline Vec vatan2(Vec y, Vec x) {
+    const Vec signBit = vset(-0.0);
+    const Vec zero = vset(0.0);
+    const Vec one = vset(1.0);
+    Vec ax = vandnot(signBit, x);
+    Vec ay = vandnot(signBit, y);
+
+    Vec swap = vgreater(ay, ax);
+    Vec numerator = vselect(swap, ax, ay);
+    Vec denominator = vselect(swap, ay, ax);
+    Vec t = vdiv(numerator, denominator);
+    t = vandnot(vequal(denominator, zero), t); // atan2(0, 0) = 0
+
+    Vec reduce = vgreater(t, vset(0.66));
+    Vec base = vand(reduce, vset(PI / 4.0));
+    Vec correction = vand(reduce, vset(0.5 * 6.123233995736765886130e-17));
+    t = vselect(reduce, vdiv(vsub(t, one), vadd(t, one)), t);
+
+    Vec z = vmul(t, t);
+    Vec p = vset(-8.750608600031904122785e-1);
+    p = vadd(vmul(p, z), vset(-1.615753718733365076637e1));
+    p = vadd(vmul(p, z), vset(-7.500855792314704667340e1));
+    p = vadd(vmul(p, z), vset(-1.228866684490136173410e2));
+    p = vadd(vmul(p, z), vset(-6.485021904942025371773e1));
+    Vec q = vadd(z, vset(2.485846490142306297962e1));
+    q = vadd(vmul(q, z), vset(1.650270098316988542046e2));
+    q = vadd(vmul(q, z), vset(4.328810604912902668951e2));
+    q = vadd(vmul(q, z), vset(4.853903996359136964868e2));
+    q = vadd(vmul(q, z), vset(1.945506571482613964425e2));
+    Vec angle = vadd(base, vadd(vadd(t, vmul(vmul(t, z), vdiv(p, q))), correction));
+
+    angle = vselect(swap, vsub(vset(PI / 2.0), angle), angle);
+    angle = vselect(vsignmask(x), vsub(vset(PI), angle), angle);
+    return vor(angle, vand(y, signBit));
+}
+
+#endif
+
+/**
+ * @brief Default constructor. The array starts empty.
+ */
+PoseArray::PoseArray() {
+    this->xs = nullptr;
+    this->ys = nullptr;
+    this->ths = nullptr;
+    this->count = 0;
+    this->capacity = 0;
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * @param capacity Number of poses to reserve room for.
+ */
+PoseArray::PoseArray(int capacity) : PoseArray() {
+    reserve(capacity);
+}
+
+/**
+ * @brief Destructor. Frees the coordinate arrays.
+ */
+PoseArray::~PoseArray() {
+    if (this->xs != nullptr) {
+        ::operator delete[](this->xs, align_val_t(ALIGNMENT));
+    }
+}
+
+/**
+ * @brief Makes room for at least capacity poses.
+ * The three arrays share one aligned block; the padding lanes are kept at zero.
+ */
+void PoseArray::reserve(int capacity) {
+    if (capacity <= this->capacity) {
+        return;
+    }
+    int rounded = (capacity + PADDING - 1) / PADDING * PADDING;
+    double* block = static_cast<double*>(::operator new[](sizeof(double) * 3 * rounded, align_val_t(ALIGNMENT)));
+    memset(block, 0, sizeof(double) * 3 * rounded);
+    if (this->xs != nullptr) {
+        memcpy(block, this->xs, sizeof(double) * this->count);
+        memcpy(block + rounded, this->ys, sizeof(double) * this->count);
+        memcpy(block + 2 * rounded, this->ths, sizeof(double) * this->count);
+        ::operator delete[](this->xs, align_val_t(ALIGNMENT));
+    }
+    this->xs = block;
+    this->ys = block + rounded;
+    this->ths = block + 2 * rounded;
+    this->capacity = rounded;
+}
+
+/**
+ * @brief Removes every pose.
+ */
+void PoseArray::clear() {
+    this->count = 0;
+}
+
+/**
+ * @brief Adds a pose at the end, growing the arrays when full.
+ */
+void PoseArray::append(const Pose& pose) {
+    if (this->count == this->capacity) {
+        reserve(this->capacity > 0 ? this->capacity * 2 : 64);
+    }
+    this->xs[this->count] = pose.getX();
+    this->ys[this->count] = pose.getY();
+    this->ths[this->count] = pose.getTh();
+    this->count++;
+}
+
+/**
+ * @brief Returns the number of poses stored.
+ */
+int PoseArray::size() const {
+    return this->count;
+}
+
+/**
+ * @brief Returns pose i.
+ */
+Pose PoseArray::get(int i) const {
+    if (i < 0 || i >= this->count) {
+        cout << "Error: pose index " << i << " is out of range." << endl;
+        return Pose();
+    }
+    return Pose(this->xs[i], this->ys[i], this->ths[i]);
+}
+
+/**
+ * @brief Replaces pose i.
+ */
+void PoseArray::set(int i, const Pose& pose) {
+    if (i < 0 || i >= this->count) {
+        cout << "Error: pose index " << i << " is out of range." << endl;
+        return;
+    }
+    this->xs[i] = pose.getX();
+    this->ys[i] = pose.getY();
+    this->ths[i] = pose.getTh();
+}
+
+/**
+ * @brief Returns the x-coordinates.
+ */
+const double* PoseArray::getXs() const {
+    return this->xs;
+}
+
+/**
+ * @brief Returns the y-coordinates.
+ */
+const double* PoseArray::getYs() const {
+    return this->ys;
+}
+
+/**
+ * @brief Returns the orientations.
+ */
+const double* PoseArray::getThs() const {
+    return this->ths;
+}
+
+/**
+ * @brief Computes the distance from every pose to target.
+ * @param target Pose to measure the distances to.
+ * @param out Receives size() distances in meters.
+ */
+void PoseArray::distancesTo(const Pose& target, double* out) const {
+    int i = 0;
+#if defined(POSEARRAY_AVX) || defined(POSEARRAY_SSE)
+    Vec tx = vset(target.getX());
+    Vec ty = vset(target.getY());
+    for (; i + LANES <= this->count; i += LANES) {
+        Vec dx = vsub(tx, vload(this->xs + i));
+        Vec dy = vsub(ty, vload(this->ys + i));
+        vstoreu(out + i, vsqrt(vadd(vmul(dx, dx), vmul(dy, dy))));
+    }
+#endif
+    for (; i < this->count; i++) {
+        double dx = target.getX() - this->xs[i];
+        double dy = target.getY() - this->ys[i];
+        out[i] = sqrt(dx * dx + dy * dy);
+    }
+}
+
+/**
+ * @brief Computes the angle from every pose to target.
+ * @param target Pose to measure the angles to.
+ * @param out Receives size() angles in radians.
+ */
+void PoseArray::anglesTo(const Pose& target, double* out) const {
+    int i = 0;
+#if defined(POSEARRAY_AVX) || defined(POSEARRAY_SSE)
+    Vec tx = vset(target.getX());
+    Vec ty = vset(target.getY());
+    for (; i + LANES <= this->count; i += LANES) {
+        vstoreu(out + i, vatan2(vsub(ty, vload(this->ys + i)), vsub(tx, vload(this->xs + i))));
+    }
+#endif
+    for (; i < this->count; i++) {
+        out[i] = atan2(target.getY() - this->ys[i], target.getX() - this->xs[i]);
+    }
+}
+
+/**
+ * @brief Moves every pose from the coordinates of frame into the parent coordinates.
+ * @param frame Pose of the local frame.
+ */
+void PoseArray::transform(const Pose& frame) {
+    double c = cos(frame.getTh());
+    double s = sin(frame.getTh());
+    int i = 0;
+#if defined(POSEARRAY_AVX) || defined(POSEARRAY_SSE)
+    Vec vc = vset(c);
+    Vec vs = vset(s);
+    Vec fx = vset(frame.getX());
+    Vec fy = vset(frame.getY());
+    Vec fth = vset(frame.getTh());
+    for (; i + LANES <= this->count; i += LANES) {
+        Vec x = vload(this->xs + i);
+        Vec y = vload(this->ys + i);
+        vstore(this->xs + i, vadd(fx, vsub(vmul(vc, x), vmul(vs, y))));
+        vstore(this->ys + i, vadd(fy, vadd(vmul(vs, x), vmul(vc, y))));
+        vstore(this->ths + i, vadd(fth, vload(this->ths + i)));
+    }
+#endif
+    for (; i < this->count; i++) {
+        double x = this->xs[i];
+        double y = this->ys[i];
+        this->xs[i] = frame.getX() + (c * x - s * y);
+        this->ys[i] = frame.getY() + (s * x + c * y);
+        this->ths[i] = frame.getTh() + this->ths[i];
+    }
+}
+
+/**
+ * @brief Returns the length of the path through the poses in order.
+ * The vector path keeps one partial sum per lane, so the result may differ from a
+ * sequential sum in the last bits.
+ */
+double PoseArray::pathLength() const {
+    double length = 0.0;
+    int i = 0;
+#if defined(POSEARRAY_AVX) || defined(POSEARRAY_SSE)
+    Vec sum = vset(0.0);
+    for (; i + LANES < this->count; i += LANES) {
+        Vec dx = vsub(vloadu(this->xs + i + 1), vload(this->xs + i));
+        Vec dy = vsub(vloadu(this->ys + i + 1), vload(this->ys + i));
+        sum = vadd(sum, vsqrt(vadd(vmul(dx, dx), vmul(dy, dy))));
+    }
+    length = vsum(sum);
+#endif
+    for (; i + 1 < this->count; i++) {
+        double dx = this->xs[i + 1] - this->xs[i];
+        double dy = this->ys[i + 1] - this->ys[i];
+        length += sqrt(dx * dx + dy * dy);
+    }
+    return length;
+}
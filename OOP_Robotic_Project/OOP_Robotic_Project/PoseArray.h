@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file   PoseArray.h
+ * @date   October, 2026
+ * @brief  Header file for the PoseArray class.
+ *
+ * This file contains the definition of the PoseArray class, a structure-of-arrays
+ * container of poses with SIMD batch operations.
+ */
+
+#include "Pose.h"
+
+#if defined(__AVX__)
+#define POSEARRAY_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define POSEARRAY_SSE
+#endif
+
+//! PoseArray class
+/*!
+ * @brief Many poses stored as three aligned arrays of x, y and th.
+ *
+ * Keeping each coordinate contiguous lets the batch operations load several poses
+ * per instruction: 4 with AVX, 2 with SSE2, one at a time otherwise. The results
+ * match the Pose member functions; anglesTo() uses its own vector arctangent,
+ * which agrees with std::atan2 to within a few ulps.
+ *
+ * Storage grows like a vector and is aligned for vector loads; results are written
+ * to caller buffers, which need no alignment.
+ */
+class PoseArray {
+public:
+    static const int ALIGNMENT = 32; /*!< Byte alignment of the coordinate arrays. */
+    static const int PADDING = 4;    /*!< Capacity is a multiple of this many poses. */
+
+private:
+    double* xs;   /*!< x-coordinates (meters). */
+    double* ys;   /*!< y-coordinates (meters). */
+    double* ths;  /*!< Orientations (radians). */
+    int count;    /*!< Number of poses stored. */
+    int capacity; /*!< Number of poses the arrays can hold. */
+
+    PoseArray(const PoseArray&) = delete;
+    PoseArray& operator=(const PoseArray&) = delete;
+
+public:
+    //! Default constructor
+    PoseArray();
+
+    //! Parameterized Constructor
+    /*!
+    * @param capacity Number of poses to reserve room for.
+    */
+    PoseArray(int capacity);
+
+    //! Destructor
+    ~PoseArray();
+
+    //! reserve function
+    /*!
+    * Makes room for at least capacity poses, keeping the ones stored.
+    */
+    void reserve(int capacity);
+
+    //! clear function
+    void clear();
+
+    //! append function
+    /*!
+    * Adds a pose at the end.
+    */
+    void append(const Pose& pose);
+
+    //! size function
+    int size() const;
+
+    //! get function
+    /*!
+    * @return pose i.
+    */
+    Pose get(int i) const;
+
+    //! set function
+    /*!
+    * Replaces pose i.
+    */
+    void set(int i, const Pose& pose);
+
+    //! getXs function
+    const double* getXs() const;
+
+    //! getYs function
+    const double* getYs() const;
+
+    //! getThs function
+    const double* getThs() const;
+
+    //! distancesTo function
+    /*!
+    * Computes get(i).findDistanceTo(target) for every pose.
+    * @param target Pose to measure the distances to.
+    * @param out Receives size() distances in meters.
+    */
+    void distancesTo(const Pose& target, double* out) const;
+
+    //! anglesTo function
+    /*!
+    * Computes get(i).findAngleTo(target) for every pose.
+    * @param target Pose to measure the angles to.
+    * @param out Receives size() angles in radians.
+    */
+    void anglesTo(const Pose& target, double* out) const;
+
+    //! transform function
+    /*!
+    * Moves every pose from the coordinates of frame into the coordinates frame is
+    * expressed in: the position is rotated by frame's orientation and shifted by its
+    * position, and frame's orientation is added to th.
+    * @param frame Pose of the local frame.
+    */
+    void transform(const Pose& frame);
+
+    //! pathLength function
+    /*!
+    * @return the sum of the distances between consecutive poses (meters).
+    */
+    double pathLength() const;
+};
@@ -0,0 +1,212 @@
+/**
+ * @file   PoseCache.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the PoseCache class.
+ */
+
+#include <chrono>
+#include "ControlLoop.h"
+#include "Logger.h"
+#include "Metrics.h"
+#include "PoseCache.h"
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor.
+ * @param api Robot API the pose is read from.
+ * @param maxAgeMicroseconds Oldest pose get() returns without reading the robot.
+ * @param refreshMicroseconds Time between two refreshes, 0 to refresh as fast as possible.
+ */
+PoseCache::PoseCache(RobotInterface* api, int maxAgeMicroseconds, int refreshMicroseconds)
+    : robotAPI(api), version(0), x(0.0), y(0.0), th(0.0), stampNs(0),
+      maxAgeNs(maxAgeMicroseconds > 0 ? maxAgeMicroseconds * 1000LL : 0),
+      periodNs(refreshMicroseconds > 0 ? refreshMicroseconds * 1000LL : 0), running(false), refreshes(0) {
+    resetCounters();
+}
+
+/**
+ * @brief Destructor. Stops the refresher thread.
+ */
+PoseCache::~PoseCache() {
+    stop();
+}
+
+/**
+ * @brief Starts the refresher thread.
+ * @return true if the thread is running.
+ */
+bool PoseCache::start() {
+    if (this->running.load()) {
+        return true;
+    }
+    if (this->robotAPI == nullptr) {
+        LOG_ERROR("PoseCache has no robot API.");
+        return false;
+    }
+    this->running.store(true);
+    this->worker = thread(&PoseCache::refreshLoop, this);
+    return true;
+}
+
+/**
+ * @brief Stops the refresher thread and waits for it to finish.
+ */
+void PoseCache::stop() {
+    this->running.store(false);
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+bool PoseCache::isRunning() const {
+    return this->running.load();
+}
+
+/**
+ * @brief Body of the refresher thread.
+ *
+ * Each cycle reads the robot and publishes the pose. With a period set, cycles are
+ * started on absolute deadlines so timing does not drift.
+ */
+void PoseCache::refreshLoop() {
+    long long deadline = nowNs();
+
+    while (this->running.load(memory_order_relaxed)) {
+        {
+            lock_guard<mutex> guard(this->readLock);
+            double X, Y, TH;
+            METRIC_SCOPE("robot_api_pose");
+            this->robotAPI->getXYTh(X, Y, TH);
+            store(X, Y, TH, nowNs());
+        }
+        this->refreshes.fetch_add(1, memory_order_relaxed);
+
+        if (this->periodNs > 0) {
+            deadline += this->periodNs;
+            ControlLoop::sleepUntil(deadline);
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Copies the published pose, retrying while it is being written.
+ *
+ * The values are atomics read relaxed; the acquire fence orders them before the second
+ * read of the version, so an unchanged even version means they belong to one store().
+ */
+long long PoseCache::load(double& X, double& Y, double& TH) const {
+    while (true) {
+        unsigned before = this->version.load(memory_order_acquire);
+        if ((before & 1) != 0) {
+            this_thread::yield();
+            continue;
+        }
+        X = this->x.load(memory_order_relaxed);
+        Y = this->y.load(memory_order_relaxed);
+        TH = this->th.load(memory_order_relaxed);
+        long long time = this->stampNs.load(memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+        if (this->version.load(memory_order_relaxed) == before) {
+            return time;
+        }
+    }
+}
+
+/**
+ * @brief Publishes a pose; the caller holds readLock, so there is one writer at a time.
+ */
+void PoseCache::store(double X, double Y, double TH, long long timeNs) {
+    unsigned current = this->version.load(memory_order_relaxed);
+    this->version.store(current + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    this->x.store(X, memory_order_relaxed);
+    this->y.store(Y, memory_order_relaxed);
+    this->th.store(TH, memory_order_relaxed);
+    this->stampNs.store(timeNs, memory_order_relaxed);
+    this->version.store(current + 2, memory_order_release);
+}
+
+/**
+ * @brief Returns the counter stripe of the calling thread.
+ * Threads take stripes in the order they first count, so up to COUNTER_STRIPES
+ * readers each have their own.
+ */
+PoseCache::CounterStripe& PoseCache::stripe() {
+    static atomic<unsigned> nextStripe(0);
+    thread_local int index = -1;
+    if (index < 0) {
+        index = static_cast<int>(nextStripe.fetch_add(1, memory_order_relaxed) % COUNTER_STRIPES);
+    }
+    return this->counters[index];
+}
+
+/**
+ * @brief Returns a pose at most the max age old.
+ *
+ * A miss takes readLock and checks the cache again, since the refresher or another
+ * reader may have published a fresh pose while it waited; only then it reads the robot.
+ */
+void PoseCache::get(double& X, double& Y, double& TH) {
+    long long limit = this->maxAgeNs.load(memory_order_relaxed);
+    long long time = load(X, Y, TH);
+    if (time != 0 && nowNs() - time <= limit) {
+        stripe().hits.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+
+    stripe().misses.fetch_add(1, memory_order_relaxed);
+    lock_guard<mutex> guard(this->readLock);
+    time = load(X, Y, TH);
+    if (time != 0 && nowNs() - time <= limit) {
+        return;
+    }
+    METRIC_SCOPE("robot_api_pose");
+    this->robotAPI->getXYTh(X, Y, TH);
+    store(X, Y, TH, nowNs());
+}
+
+void PoseCache::setMaxAge(int maxAgeMicroseconds) {
+    this->maxAgeNs.store(maxAgeMicroseconds > 0 ? maxAgeMicroseconds * 1000LL : 0, memory_order_relaxed);
+}
+
+int PoseCache::getMaxAge() const {
+    return static_cast<int>(this->maxAgeNs.load(memory_order_relaxed) / 1000);
+}
+
+unsigned long long PoseCache::getHitCount() const {
+    unsigned long long total = 0;
+    for (const CounterStripe& counter : this->counters) {
+        total += counter.hits.load(memory_order_relaxed);
+    }
+    return total;
+}
+
+unsigned long long PoseCache::getMissCount() const {
+    unsigned long long total = 0;
+    for (const CounterStripe& counter : this->counters) {
+        total += counter.misses.load(memory_order_relaxed);
+    }
+    return total;
+}
+
+unsigned long long PoseCache::getRefreshCount() const {
+    return this->refreshes.load(memory_order_relaxed);
+}
+
+void PoseCache::resetCounters() {
+    for (CounterStripe& counter : this->counters) {
+        counter.hits.store(0, memory_order_relaxed);
+        counter.misses.store(0, memory_order_relaxed);
+    }
+    this->refreshes.store(0, memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the steady clock time in nanoseconds.
+ */
+long long PoseCache::nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
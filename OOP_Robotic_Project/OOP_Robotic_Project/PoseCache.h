@@ -0,0 +1,165 @@
+#pragma once
+/**
+ * @file   PoseCache.h
+ * @date   October, 2026
+ * @brief  Header file for the PoseCache class.
+ *
+ * This file contains the definition of the PoseCache class, which keeps the last pose
+ * read from the robot for readers on any thread and refreshes it on a background thread.
+ */
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "RobotInterface.h"
+
+//! PoseCache class
+/*!
+ * @brief Pose read from the robot with a staleness budget, shared by any number of readers.
+ *
+ * get() returns the cached pose if it is at most the max age old (a hit); otherwise it
+ * reads the robot itself and publishes the result (a miss). The pose is published
+ * under a seqlock: the writer makes the version odd, stores x, y, th and the time, and
+ * makes it even again, and a reader retries if the version was odd or changed while
+ * it copied the values. A hit therefore takes no lock and writes no shared memory
+ * except its counter, and readers never hold up each other or the writer.
+ *
+ * After start(), a refresher thread reads the robot every refresh period so that
+ * readers find a fresh pose; a period of half the max age leaves room for a slow
+ * read. Reads of the robot, by the refresher or on a miss, are serialized by a
+ * mutex, so the robot API is only called from one thread at a time, and a reader that
+ * waited for the mutex uses the pose the previous holder published if it is fresh.
+ *
+ * Hit and miss counters are split over cache-line sized stripes, one per reader thread
+ * up to COUNTER_STRIPES threads, so that counting does not make readers contend.
+ */
+class PoseCache {
+public:
+    static const int COUNTER_STRIPES = 16; /*!< Counter stripes; threads beyond this share them. */
+
+private:
+    //! CounterStripe struct
+    /*!
+    * @brief Hits and misses of the threads mapped to one stripe.
+    */
+    struct alignas(64) CounterStripe {
+        std::atomic<unsigned long long> hits;   /*!< Reads served from the cache. */
+        std::atomic<unsigned long long> misses; /*!< Reads that went to the robot. */
+    };
+
+    RobotInterface* robotAPI;                     /*!< Robot API the pose is read from. */
+    alignas(64) std::atomic<unsigned> version;    /*!< Seqlock version, odd while the pose is written. */
+    std::atomic<double> x;                        /*!< Cached position (meters). */
+    std::atomic<double> y;                        /*!< Cached position (meters). */
+    std::atomic<double> th;                       /*!< Cached heading (radians). */
+    std::atomic<long long> stampNs;               /*!< Steady clock time of the cached pose, 0 before the first read. */
+    std::atomic<long long> maxAgeNs;              /*!< Oldest pose a reader accepts. */
+    alignas(64) std::mutex readLock;              /*!< Serializes reads of the robot and publishing. */
+    long long periodNs;                           /*!< Time between two refreshes, 0 to refresh continuously. */
+    std::thread worker;                           /*!< Refresher thread. */
+    std::atomic<bool> running;                    /*!< Cleared to stop the refresher thread. */
+    std::atomic<unsigned long long> refreshes;    /*!< Reads of the robot by the refresher. */
+    CounterStripe counters[COUNTER_STRIPES];      /*!< Hit and miss counters. */
+
+    //! refreshLoop function
+    /*!
+    * Body of the refresher thread.
+    */
+    void refreshLoop();
+
+    //! load function
+    /*!
+    * Copies the published pose, retrying while it is being written.
+    * @return the time of the copied pose, 0 if none was published.
+    */
+    long long load(double& X, double& Y, double& TH) const;
+
+    //! store function
+    /*!
+    * Publishes a pose; the caller holds readLock.
+    */
+    void store(double X, double Y, double TH, long long timeNs);
+
+    //! stripe function
+    /*!
+    * @return the counter stripe of the calling thread.
+    */
+    CounterStripe& stripe();
+
+    PoseCache(const PoseCache&) = delete;
+    PoseCache& operator=(const PoseCache&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param api Robot API the pose is read from.
+    * @param maxAgeMicroseconds Oldest pose get() returns without reading the robot.
+    * @param refreshMicroseconds Time between two refreshes, 0 to refresh as fast as possible.
+    */
+    PoseCache(RobotInterface* api, int maxAgeMicroseconds, int refreshMicroseconds);
+
+    //! Destructor
+    /*!
+    * Stops the refresher thread.
+    */
+    ~PoseCache();
+
+    //! start function
+    /*!
+    * Starts the refresher thread.
+    * @return true if the thread is running.
+    */
+    bool start();
+
+    //! stop function
+    /*!
+    * Stops the refresher thread; get() then reads the robot whenever the pose is too old.
+    */
+    void stop();
+
+    //! isRunning function
+    bool isRunning() const;
+
+    //! get function
+    /*!
+    * Returns a pose at most the max age old, from the cache or from the robot.
+    * May be called from any thread.
+    */
+    void get(double& X, double& Y, double& TH);
+
+    //! setMaxAge function
+    /*!
+    * @param maxAgeMicroseconds Oldest pose get() returns without reading the robot, 0 or more.
+    */
+    void setMaxAge(int maxAgeMicroseconds);
+
+    //! getMaxAge function
+    /*!
+    * @return the max age in microseconds.
+    */
+    int getMaxAge() const;
+
+    //! getHitCount function
+    /*!
+    * @return the reads served from the cache, summed over the stripes.
+    */
+    unsigned long long getHitCount() const;
+
+    //! getMissCount function
+    /*!
+    * @return the reads that went to the robot, summed over the stripes.
+    */
+    unsigned long long getMissCount() const;
+
+    //! getRefreshCount function
+    unsigned long long getRefreshCount() const;
+
+    //! resetCounters function
+    void resetCounters();
+
+    //! nowNs function
+    /*!
+    * @return the steady clock time in nanoseconds, the clock of the pose time.
+    */
+    static long long nowNs();
+};
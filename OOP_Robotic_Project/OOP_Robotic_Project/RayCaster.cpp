@@ -0,0 +1,296 @@
+/**
+ * @file   RayCaster.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the RayCaster class.
+ */
+
+#include <cmath>
+#include <new>
+#include "RayCaster.h"
+using namespace std;
+
+/**
+ * @brief Allocates a 32-byte aligned array of n elements.
+ */
+template <typename T>
+static T* allocateAligned(int n) {
+    return static_cast<T*>(::operator new[](sizeof(T) * n, align_val_t(32)));
+}
+
+template <typename T>
+static void freeAligned(T* p) {
+    ::operator delete[](p, align_val_t(32));
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * Builds the sine and cosine tables and the per-beam output arrays.
+ * @param geometry Beam directions and range limit.
+ * @param count Number of beams per scan.
+ */
+RayCaster::RayCaster(const LidarGeometry& geometry, int count) {
+    this->beamCount = count > 0 ? count : 0;
+    this->paddedCount = (this->beamCount + 7) / 8 * 8;
+    if (this->paddedCount == 0) {
+        this->paddedCount = 8;
+    }
+    this->maxRange = geometry.maxRange;
+    this->cosTable = allocateAligned<float>(this->paddedCount);
+    this->sinTable = allocateAligned<float>(this->paddedCount);
+    this->incrementX = allocateAligned<int>(this->paddedCount);
+    this->incrementY = allocateAligned<int>(this->paddedCount);
+    this->steps = allocateAligned<int>(this->paddedCount);
+    this->endX = allocateAligned<int>(this->paddedCount);
+    this->endY = allocateAligned<int>(this->paddedCount);
+    this->hit = allocateAligned<int>(this->paddedCount);
+    this->endGridX = allocateAligned<float>(this->paddedCount);
+    this->endGridY = allocateAligned<float>(this->paddedCount);
+    this->startFixedX = 0;
+    this->startFixedY = 0;
+    this->order = allocateAligned<int>(this->paddedCount);
+    this->orderCount = 0;
+    this->bucketCounts = allocateAligned<int>(SORT_BUCKETS);
+
+    for (int i = 0; i < this->paddedCount; i++) {
+        double angle = geometry.startAngle + i * geometry.angleIncrement;
+        this->cosTable[i] = static_cast<float>(cos(angle));
+        this->sinTable[i] = static_cast<float>(sin(angle));
+        this->incrementX[i] = 0;
+        this->incrementY[i] = 0;
+        this->steps[i] = -1;
+        this->endX[i] = 0;
+        this->endY[i] = 0;
+        this->hit[i] = 0;
+        this->endGridX[i] = 0.0f;
+        this->endGridY[i] = 0.0f;
+    }
+}
+
+/**
+ * @brief Destructor. Frees the tables.
+ */
+RayCaster::~RayCaster() {
+    freeAligned(this->cosTable);
+    freeAligned(this->sinTable);
+    freeAligned(this->incrementX);
+    freeAligned(this->incrementY);
+    freeAligned(this->steps);
+    freeAligned(this->endX);
+    freeAligned(this->endY);
+    freeAligned(this->hit);
+    freeAligned(this->endGridX);
+    freeAligned(this->endGridY);
+    freeAligned(this->order);
+    freeAligned(this->bucketCounts);
+}
+
+int RayCaster::getBeamCount() const {
+    return this->beamCount;
+}
+
+/**
+ * @brief Checks whether the caster was built for this geometry and beam count.
+ */
+bool RayCaster::matches(const LidarGeometry& geometry, int count) const {
+    if (count != this->beamCount || geometry.maxRange != this->maxRange) {
+        return false;
+    }
+    double angle = geometry.startAngle + geometry.angleIncrement;
+    return this->beamCount < 2
+        || (this->cosTable[0] == static_cast<float>(cos(geometry.startAngle))
+            && this->sinTable[0] == static_cast<float>(sin(geometry.startAngle))
+            && this->cosTable[1] == static_cast<float>(cos(angle))
+            && this->sinTable[1] == static_cast<float>(sin(angle)));
+}
+
+/**
+ * @brief Counting sort of the traced beams by number of steps.
+ * Skipped beams are left out of the order.
+ */
+void RayCaster::sortBeams() {
+    for (int b = 0; b < SORT_BUCKETS; b++) {
+        this->bucketCounts[b] = 0;
+    }
+    for (int i = 0; i < this->beamCount; i++) {
+        if (this->steps[i] >= 0) {
+            this->bucketCounts[this->steps[i] < SORT_BUCKETS ? this->steps[i] : SORT_BUCKETS - 1]++;
+        }
+    }
+    int position = 0;
+    for (int b = 0; b < SORT_BUCKETS; b++) {
+        int count = this->bucketCounts[b];
+        this->bucketCounts[b] = position;
+        position += count;
+    }
+    this->orderCount = position;
+    for (int i = 0; i < this->beamCount; i++) {
+        if (this->steps[i] >= 0) {
+            this->order[this->bucketCounts[this->steps[i] < SORT_BUCKETS ? this->steps[i] : SORT_BUCKETS - 1]++] = i;
+        }
+    }
+}
+
+/**
+ * @brief Derives the end cell and DDA step of beam i from its end point.
+ *
+ * The beam visits one cell per step along its major axis, so the number of steps is
+ * the larger of the column and row distances between the start and end cells.
+ */
+void RayCaster::finishBeam(int i, float startX, float startY) {
+    float cellX = floor(this->endGridX[i]);
+    float cellY = floor(this->endGridY[i]);
+    float distanceX = fabs(cellX - floor(startX));
+    float distanceY = fabs(cellY - floor(startY));
+    float count = distanceX > distanceY ? distanceX : distanceY;
+    this->endX[i] = static_cast<int>(cellX);
+    this->endY[i] = static_cast<int>(cellY);
+    this->steps[i] = static_cast<int>(count);
+    if (count > 0.0f) {
+        this->incrementX[i] = static_cast<int>(lrintf((this->endGridX[i] - startX) / count * 65536.0f));
+        this->incrementY[i] = static_cast<int>(lrintf((this->endGridY[i] - startY) / count * 65536.0f));
+    }
+    else {
+        this->incrementX[i] = 0;
+        this->incrementY[i] = 0;
+    }
+}
+
+/**
+ * @brief Places beam i: end point, hit flag, end cell and DDA step.
+ * Beams with a non-positive or NaN range are skipped.
+ */
+void RayCaster::placeBeam(int i, float range, float startX, float startY, float cosHeading, float sinHeading, float cellsPerMeter) {
+    if (!(range > 0.0f)) {
+        this->steps[i] = -1;
+        this->hit[i] = 0;
+        return;
+    }
+    float limit = static_cast<float>(this->maxRange);
+    float directionX = this->cosTable[i] * cosHeading - this->sinTable[i] * sinHeading;
+    float directionY = this->cosTable[i] * sinHeading + this->sinTable[i] * cosHeading;
+    float length = (range < limit ? range : limit) * cellsPerMeter;
+    this->endGridX[i] = startX + length * directionX;
+    this->endGridY[i] = startY + length * directionY;
+    this->hit[i] = range < limit ? -1 : 0;
+    finishBeam(i, startX, startY);
+}
+
+/**
+ * @brief Reference version of computeEndpoints(), one beam at a time.
+ */
+void RayCaster::computeEndpointsScalar(float startX, float startY, double heading, float cellsPerMeter, const float* ranges) {
+    this->startFixedX = static_cast<int>(static_cast<double>(startX) * 65536.0);
+    this->startFixedY = static_cast<int>(static_cast<double>(startY) * 65536.0);
+    float cosHeading = static_cast<float>(cos(heading));
+    float sinHeading = static_cast<float>(sin(heading));
+
+    for (int i = 0; i < this->beamCount; i++) {
+        placeBeam(i, ranges[i], startX, startY, cosHeading, sinHeading, cellsPerMeter);
+    }
+    sortBeams();
+}
+
+#if defined(RAYCASTER_AVX2) || defined(RAYCASTER_SSE)
+/**
+ * @brief Lane-wise floor with SSE2 only.
+ */
+static inline __m128 floorVector(__m128 v) {
+    __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+    return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, v), _mm_set1_ps(1.0f)));
+}
+#endif
+
+/**
+ * @brief Places a scan in the grid with SIMD, four beams per iteration.
+ *
+ * The beam directions are the precomputed tables rotated by the heading, so the only
+ * trigonometry is one sin and one cos of the heading. Beams past the last multiple
+ * of four are finished by the scalar code.
+ */
+void RayCaster::computeEndpoints(float startX, float startY, double heading, float cellsPerMeter, const float* ranges) {
+#if defined(RAYCASTER_AVX2) || defined(RAYCASTER_SSE)
+    this->startFixedX = static_cast<int>(static_cast<double>(startX) * 65536.0);
+    this->startFixedY = static_cast<int>(static_cast<double>(startY) * 65536.0);
+    float cosHeading = static_cast<float>(cos(heading));
+    float sinHeading = static_cast<float>(sin(heading));
+    float limit = static_cast<float>(this->maxRange);
+
+    const __m128 cosH = _mm_set1_ps(cosHeading);
+    const __m128 sinH = _mm_set1_ps(sinHeading);
+    const __m128 limitV = _mm_set1_ps(limit);
+    const __m128 scale = _mm_set1_ps(cellsPerMeter);
+    const __m128 sx = _mm_set1_ps(startX);
+    const __m128 sy = _mm_set1_ps(startY);
+    const __m128 startCellX = _mm_set1_ps(floor(startX));
+    const __m128 startCellY = _mm_set1_ps(floor(startY));
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 fixedOne = _mm_set1_ps(65536.0f);
+
+    int i = 0;
+    for (; i + 4 <= this->beamCount; i += 4) {
+        __m128 range = _mm_loadu_ps(ranges + i);
+        __m128 cosA = _mm_load_ps(this->cosTable + i);
+        __m128 sinA = _mm_load_ps(this->sinTable + i);
+        __m128 directionX = _mm_sub_ps(_mm_mul_ps(cosA, cosH), _mm_mul_ps(sinA, sinH));
+        __m128 directionY = _mm_add_ps(_mm_mul_ps(cosA, sinH), _mm_mul_ps(sinA, cosH));
+
+        __m128 valid = _mm_cmpgt_ps(range, zero);
+        __m128 hitMask = _mm_and_ps(valid, _mm_cmplt_ps(range, limitV));
+        __m128 length = _mm_mul_ps(_mm_min_ps(range, limitV), scale);
+        __m128 endPointX = _mm_add_ps(sx, _mm_mul_ps(length, directionX));
+        __m128 endPointY = _mm_add_ps(sy, _mm_mul_ps(length, directionY));
+        _mm_store_ps(this->endGridX + i, endPointX);
+        _mm_store_ps(this->endGridY + i, endPointY);
+
+        __m128 cellX = floorVector(endPointX);
+        __m128 cellY = floorVector(endPointY);
+        __m128 distanceX = _mm_and_ps(_mm_sub_ps(cellX, startCellX), absMask);
+        __m128 distanceY = _mm_and_ps(_mm_sub_ps(cellY, startCellY), absMask);
+        __m128 count = _mm_max_ps(distanceX, distanceY);
+        __m128 moving = _mm_cmpgt_ps(count, zero);
+        __m128 stepX = _mm_and_ps(moving, _mm_mul_ps(_mm_div_ps(_mm_sub_ps(endPointX, sx), count), fixedOne));
+        __m128 stepY = _mm_and_ps(moving, _mm_mul_ps(_mm_div_ps(_mm_sub_ps(endPointY, sy), count), fixedOne));
+
+        __m128i validInt = _mm_castps_si128(valid);
+        __m128i stepCount = _mm_or_si128(_mm_and_si128(validInt, _mm_cvttps_epi32(count)), _mm_andnot_si128(validInt, _mm_set1_epi32(-1)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->steps + i), stepCount);
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->hit + i), _mm_castps_si128(hitMask));
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->endX + i), _mm_cvttps_epi32(cellX));
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->endY + i), _mm_cvttps_epi32(cellY));
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->incrementX + i), _mm_cvtps_epi32(stepX));
+        _mm_store_si128(reinterpret_cast<__m128i*>(this->incrementY + i), _mm_cvtps_epi32(stepY));
+    }
+
+    for (; i < this->beamCount; i++) {
+        placeBeam(i, ranges[i], startX, startY, cosHeading, sinHeading, cellsPerMeter);
+    }
+    sortBeams();
+#else
+    computeEndpointsScalar(startX, startY, heading, cellsPerMeter, ranges);
+#endif
+}
+
+int RayCaster::getEndX(int beam) const {
+    return this->endX[beam];
+}
+
+int RayCaster::getEndY(int beam) const {
+    return this->endY[beam];
+}
+
+float RayCaster::getEndGridX(int beam) const {
+    return this->endGridX[beam];
+}
+
+float RayCaster::getEndGridY(int beam) const {
+    return this->endGridY[beam];
+}
+
+int RayCaster::getSteps(int beam) const {
+    return this->steps[beam];
+}
+
+bool RayCaster::isHit(int beam) const {
+    return this->hit[beam] != 0;
+}
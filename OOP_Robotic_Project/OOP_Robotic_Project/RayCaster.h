@@ -0,0 +1,268 @@
+#pragma once
+/**
+ * @file   RayCaster.h
+ * @date   October, 2026
+ * @brief  Header file for the RayCaster class.
+ *
+ * This file contains the definition of the RayCaster class, which turns a whole lidar
+ * scan into grid traversals several beams at a time.
+ */
+
+#include "LidarSensor.h"
+
+#if defined(__AVX2__)
+#define RAYCASTER_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAYCASTER_SSE
+#include <emmintrin.h>
+#endif
+
+//! RayCaster class
+/*!
+ * @brief Batched lidar ray casting on a grid.
+ *
+ * The constructor builds sine and cosine tables of the beam angles, so placing a scan
+ * at a pose needs no trigonometry per beam: computeEndpoints() rotates the tables by
+ * the heading and scales them by the ranges with SIMD, giving every beam its end cell
+ * and a fixed-point DDA step. The beams are then bucket sorted by length, and trace()
+ * walks TRACE_LANES beams of similar length in lockstep, one cell per step along the
+ * major axis, advancing all lane positions with one vector add. Sorting keeps the
+ * lanes of a group busy until they all finish, so the per-lane checks only run for
+ * the last few steps.
+ *
+ * Grid coordinates are in cells: x = (worldX - originX) / resolution. Positions use
+ * 16.16 fixed point, so the grid may be at most MAX_CELLS cells on a side.
+ *
+ * The scalar functions computeEndpointsScalar() and traceScalar() produce the same
+ * traversal one beam at a time and serve as the reference in tests.
+ */
+class RayCaster {
+public:
+#if defined(RAYCASTER_AVX2)
+    static const int TRACE_LANES = 8; /*!< Beams traced in lockstep. */
+#else
+    static const int TRACE_LANES = 4; /*!< Beams traced in lockstep. */
+#endif
+    static const int FIXED_SHIFT = 16; /*!< Fraction bits of grid positions. */
+    static const int MAX_CELLS = 32767; /*!< Largest grid side the fixed-point positions hold. */
+    static const int SORT_BUCKETS = 1024; /*!< Longer beams share the last sort bucket. */
+
+private:
+    int beamCount;        /*!< Beams per scan. */
+    int paddedCount;      /*!< beamCount rounded up to 8. */
+    double maxRange;      /*!< Largest valid range (meters). */
+    float* cosTable;      /*!< cos of each beam angle relative to the heading. */
+    float* sinTable;      /*!< sin of each beam angle relative to the heading. */
+    int* incrementX;      /*!< Fixed-point x step per beam. */
+    int* incrementY;      /*!< Fixed-point y step per beam. */
+    int* steps;           /*!< Cells before the end cell, -1 for beams that are skipped. */
+    int* endX;            /*!< End cell column per beam. */
+    int* endY;            /*!< End cell row per beam. */
+    int* hit;             /*!< Non-zero if the beam ended on an obstacle. */
+    float* endGridX;      /*!< End point x in grid units, kept for tests. */
+    float* endGridY;      /*!< End point y in grid units, kept for tests. */
+    int startFixedX;      /*!< Fixed-point x of the scan origin. */
+    int startFixedY;      /*!< Fixed-point y of the scan origin. */
+    int* order;           /*!< Traced beams sorted by number of steps. */
+    int orderCount;       /*!< Number of entries in order. */
+    int* bucketCounts;    /*!< Counting sort buckets, SORT_BUCKETS entries. */
+
+    //! placeBeam function
+    /*!
+    * Scalar end point, hit flag and DDA step of beam i.
+    */
+    void placeBeam(int i, float range, float startX, float startY, float cosHeading, float sinHeading, float cellsPerMeter);
+
+    //! sortBeams function
+    /*!
+    * Fills order with the traced beams sorted by number of steps.
+    */
+    void sortBeams();
+
+    //! finishBeam function
+    /*!
+    * Derives the end cell and DDA step of beam i from its end point.
+    */
+    void finishBeam(int i, float startX, float startY);
+
+    RayCaster(const RayCaster&) = delete;
+    RayCaster& operator=(const RayCaster&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param geometry Beam directions and range limit.
+    * @param count Number of beams per scan.
+    */
+    RayCaster(const LidarGeometry& geometry, int count);
+
+    //! Destructor
+    ~RayCaster();
+
+    //! getBeamCount function
+    int getBeamCount() const;
+
+    //! matches function
+    /*!
+    * @return true if the caster was built for this geometry and beam count.
+    */
+    bool matches(const LidarGeometry& geometry, int count) const;
+
+    //! computeEndpoints function
+    /*!
+    * Places a scan in the grid with SIMD.
+    * @param startX Scan origin x in grid units.
+    * @param startY Scan origin y in grid units.
+    * @param heading Robot heading (radians).
+    * @param cellsPerMeter Inverse of the grid resolution.
+    * @param ranges Lidar ranges in meters, getBeamCount() values.
+    */
+    void computeEndpoints(float startX, float startY, double heading, float cellsPerMeter, const float* ranges);
+
+    //! computeEndpointsScalar function
+    /*!
+    * Reference version of computeEndpoints() that handles one beam at a time.
+    */
+    void computeEndpointsScalar(float startX, float startY, double heading, float cellsPerMeter, const float* ranges);
+
+    //! getEndX function
+    int getEndX(int beam) const;
+
+    //! getEndY function
+    int getEndY(int beam) const;
+
+    //! getEndGridX function
+    float getEndGridX(int beam) const;
+
+    //! getEndGridY function
+    float getEndGridY(int beam) const;
+
+    //! getSteps function
+    /*!
+    * @return cells visited before the end cell, -1 if the beam is skipped.
+    */
+    int getSteps(int beam) const;
+
+    //! isHit function
+    bool isHit(int beam) const;
+
+    //! trace function
+    /*!
+    * Walks the beams of the last computeEndpoints() call TRACE_LANES at a time.
+    *
+    * visit(lane, cx, cy, hit) is called for every cell a beam passes (hit == false)
+    * and then for its end cell if the beam hit an obstacle (hit == true). lane is the
+    * position of the beam inside its group, so the visitor can keep per-lane state.
+    * Returning false stops that beam, and its end cell is not visited.
+    */
+    template <typename Visitor>
+    void trace(Visitor& visit) const;
+
+    //! traceScalar function
+    /*!
+    * Reference version of trace() that walks one beam at a time, always with lane 0.
+    */
+    template <typename Visitor>
+    void traceScalar(Visitor& visit) const;
+};
+
+template <typename Visitor>
+void RayCaster::traceScalar(Visitor& visit) const {
+    for (int beam = 0; beam < this->beamCount; beam++) {
+        if (this->steps[beam] < 0) {
+            continue;
+        }
+        int x = this->startFixedX;
+        int y = this->startFixedY;
+        bool alive = true;
+        for (int k = 0; k < this->steps[beam]; k++) {
+            if (!visit(0, x >> FIXED_SHIFT, y >> FIXED_SHIFT, false)) {
+                alive = false;
+                break;
+            }
+            x += this->incrementX[beam];
+            y += this->incrementY[beam];
+        }
+        if (alive && this->hit[beam]) {
+            visit(0, this->endX[beam], this->endY[beam], true);
+        }
+    }
+}
+
+template <typename Visitor>
+void RayCaster::trace(Visitor& visit) const {
+#if defined(RAYCASTER_AVX2) || defined(RAYCASTER_SSE)
+    alignas(32) int cellX[TRACE_LANES];
+    alignas(32) int cellY[TRACE_LANES];
+    alignas(32) int laneStepX[TRACE_LANES];
+    alignas(32) int laneStepY[TRACE_LANES];
+    int laneBeam[TRACE_LANES];
+    int remaining[TRACE_LANES];
+    bool alive[TRACE_LANES];
+
+    for (int base = 0; base < this->orderCount; base += TRACE_LANES) {
+        // Beams come in order of length, so the lanes of a group finish together.
+        int minSteps = 0x7fffffff;
+        int maxSteps = 0;
+        for (int lane = 0; lane < TRACE_LANES; lane++) {
+            int beam = base + lane < this->orderCount ? this->order[base + lane] : -1;
+            laneBeam[lane] = beam;
+            remaining[lane] = beam >= 0 ? this->steps[beam] : 0;
+            laneStepX[lane] = beam >= 0 ? this->incrementX[beam] : 0;
+            laneStepY[lane] = beam >= 0 ? this->incrementY[beam] : 0;
+            alive[lane] = beam >= 0;
+            minSteps = remaining[lane] < minSteps ? remaining[lane] : minSteps;
+            maxSteps = remaining[lane] > maxSteps ? remaining[lane] : maxSteps;
+        }
+
+#if defined(RAYCASTER_AVX2)
+        __m256i x = _mm256_set1_epi32(this->startFixedX);
+        __m256i y = _mm256_set1_epi32(this->startFixedY);
+        __m256i stepX = _mm256_load_si256(reinterpret_cast<const __m256i*>(laneStepX));
+        __m256i stepY = _mm256_load_si256(reinterpret_cast<const __m256i*>(laneStepY));
+#else
+        __m128i x = _mm_set1_epi32(this->startFixedX);
+        __m128i y = _mm_set1_epi32(this->startFixedY);
+        __m128i stepX = _mm_load_si128(reinterpret_cast<const __m128i*>(laneStepX));
+        __m128i stepY = _mm_load_si128(reinterpret_cast<const __m128i*>(laneStepY));
+#endif
+        for (int k = 0; k < maxSteps; k++) {
+#if defined(RAYCASTER_AVX2)
+            _mm256_store_si256(reinterpret_cast<__m256i*>(cellX), _mm256_srai_epi32(x, FIXED_SHIFT));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(cellY), _mm256_srai_epi32(y, FIXED_SHIFT));
+            x = _mm256_add_epi32(x, stepX);
+            y = _mm256_add_epi32(y, stepY);
+#else
+            _mm_store_si128(reinterpret_cast<__m128i*>(cellX), _mm_srai_epi32(x, FIXED_SHIFT));
+            _mm_store_si128(reinterpret_cast<__m128i*>(cellY), _mm_srai_epi32(y, FIXED_SHIFT));
+            x = _mm_add_epi32(x, stepX);
+            y = _mm_add_epi32(y, stepY);
+#endif
+            if (k < minSteps) {
+                for (int lane = 0; lane < TRACE_LANES; lane++) {
+                    if (alive[lane] && !visit(lane, cellX[lane], cellY[lane], false)) {
+                        alive[lane] = false;
+                    }
+                }
+            }
+            else {
+                for (int lane = 0; lane < TRACE_LANES; lane++) {
+                    if (alive[lane] && k < remaining[lane] && !visit(lane, cellX[lane], cellY[lane], false)) {
+                        alive[lane] = false;
+                    }
+                }
+            }
+        }
+
+        for (int lane = 0; lane < TRACE_LANES; lane++) {
+            int beam = laneBeam[lane];
+            if (alive[lane] && this->hit[beam]) {
+                visit(lane, this->endX[beam], this->endY[beam], true);
+            }
+        }
+    }
+#else
+    traceScalar(visit);
+#endif
+}
@@ -0,0 +1,595 @@
+/**
+ * @file   Record.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the Record and RecordReader classes.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "Record.h"
+#include "SensorPipeline.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static const size_t MAPPING_GRANULE = 1 << 20; /*!< Segments are whole MiB, a multiple of every page and allocation granularity. */
+static const size_t PAGE_BYTES = 4096;         /*!< Stride used to prefault new segments. */
+static const char RECORD_MAGIC[8] = { 'R', 'C', 'S', 'R', 'E', 'C', 0, 0 };
+
+/**
+ * @brief Default constructor. The record starts closed.
+ */
+Record::Record() : committed(0) {
+#ifdef _WIN32
+    this->fileHandle = INVALID_HANDLE_VALUE;
+#else
+    this->fileDescriptor = -1;
+#endif
+    this->segmentBytes = 0;
+    this->flushIntervalMs = DEFAULT_FLUSH_INTERVAL_MS;
+    this->current = { nullptr, 0 };
+    this->writeOffset = 0;
+    this->frameCount = 0;
+    this->stallCount = 0;
+    this->next = { nullptr, 0 };
+    this->nextRequested = false;
+    this->mapFailed = false;
+    this->flushTarget = { nullptr, 0 };
+    this->stopping = false;
+}
+
+/**
+ * @brief Destructor. Closes the file if it is open.
+ */
+Record::~Record() {
+    close();
+}
+
+/**
+ * @brief Extends the file and maps the segment starting at offset.
+ * Every page is touched once here, so the writer does not take page faults later.
+ * @return the mapped segment, with base == nullptr on failure.
+ */
+Record::Segment Record::mapSegment(size_t offset) {
+    Segment segment = { nullptr, offset };
+    size_t end = offset + this->segmentBytes;
+#ifdef _WIN32
+    // A mapping larger than the file extends the file.
+    LARGE_INTEGER size;
+    size.QuadPart = static_cast<LONGLONG>(end);
+    HANDLE mapping = CreateFileMappingA(this->fileHandle, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+    if (mapping == nullptr) {
+        cout << "Error: cannot map record file." << endl;
+        return segment;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, static_cast<DWORD>(static_cast<unsigned long long>(offset) >> 32),
+        static_cast<DWORD>(offset), this->segmentBytes);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+        cout << "Error: cannot map record file." << endl;
+        return segment;
+    }
+    segment.base = static_cast<char*>(view);
+#else
+    if (ftruncate(this->fileDescriptor, static_cast<off_t>(end)) != 0) {
+        cout << "Error: cannot extend record file." << endl;
+        return segment;
+    }
+    void* view = mmap(nullptr, this->segmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->fileDescriptor, static_cast<off_t>(offset));
+    if (view == MAP_FAILED) {
+        cout << "Error: cannot map record file." << endl;
+        return segment;
+    }
+    segment.base = static_cast<char*>(view);
+#endif
+    for (size_t i = 0; i < this->segmentBytes; i += PAGE_BYTES) {
+        static_cast<volatile char*>(segment.base)[i] = 0;
+    }
+    return segment;
+}
+
+/**
+ * @brief Starts writing back bytes [from, to) of a segment.
+ */
+void Record::flushRange(const Segment& segment, size_t from, size_t to) {
+    if (segment.base == nullptr || to <= from) {
+        return;
+    }
+    from &= ~(PAGE_BYTES - 1);
+#ifdef _WIN32
+    FlushViewOfFile(segment.base + from, to - from);
+#else
+    msync(segment.base + from, to - from, MS_ASYNC);
+#endif
+}
+
+/**
+ * @brief Unmaps a segment.
+ */
+void Record::unmapSegment(Segment& segment) {
+    if (segment.base == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(segment.base);
+#else
+    munmap(segment.base, this->segmentBytes);
+#endif
+    segment.base = nullptr;
+}
+
+/**
+ * @brief Creates or truncates a record file and starts the background thread.
+ * @param path File name.
+ * @param segmentBytes Mapping size, rounded up to whole MiB.
+ * @param flushIntervalMs Time between background flushes.
+ * @return true on success.
+ */
+bool Record::open(const string& path, size_t segmentBytes, int flushIntervalMs) {
+    if (isOpen()) {
+        cout << "Error: Record is already open." << endl;
+        return false;
+    }
+    this->segmentBytes = (segmentBytes + MAPPING_GRANULE - 1) / MAPPING_GRANULE * MAPPING_GRANULE;
+    if (this->segmentBytes == 0) {
+        this->segmentBytes = MAPPING_GRANULE;
+    }
+    this->flushIntervalMs = flushIntervalMs > 0 ? flushIntervalMs : DEFAULT_FLUSH_INTERVAL_MS;
+
+#ifdef _WIN32
+    this->fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+        nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (this->fileHandle == INVALID_HANDLE_VALUE) {
+        cout << "Error: cannot create record file " << path << "." << endl;
+        return false;
+    }
+#else
+    this->fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (this->fileDescriptor < 0) {
+        cout << "Error: cannot create record file " << path << "." << endl;
+        return false;
+    }
+#endif
+
+    this->current = mapSegment(0);
+    if (this->current.base == nullptr) {
+#ifdef _WIN32
+        CloseHandle(this->fileHandle);
+        this->fileHandle = INVALID_HANDLE_VALUE;
+#else
+        ::close(this->fileDescriptor);
+        this->fileDescriptor = -1;
+#endif
+        return false;
+    }
+
+    RecordFileHeader* header = reinterpret_cast<RecordFileHeader*>(this->current.base);
+    memset(header, 0, sizeof(RecordFileHeader));
+    memcpy(header->magic, RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    header->version = RecordFileHeader::VERSION;
+    header->headerSize = sizeof(RecordFileHeader);
+    header->irCount = RecordFrame::IR_COUNT;
+
+    this->writeOffset = sizeof(RecordFileHeader);
+    this->frameCount = 0;
+    this->stallCount = 0;
+    this->committed.store(this->writeOffset, memory_order_release);
+    this->next = { nullptr, 0 };
+    this->nextRequested = true;
+    this->mapFailed = false;
+    this->flushTarget = this->current;
+    this->retired.clear();
+    this->retired.reserve(8);
+    this->stopping = false;
+    this->flusher = thread(&Record::flushLoop, this);
+    return true;
+}
+
+/**
+ * @brief Body of the background thread.
+ * Unmaps retired segments, maps the next segment when the writer took the previous
+ * one and flushes newly written pages of the current segment.
+ */
+void Record::flushLoop() {
+    vector<Segment> done;
+    size_t flushed = 0;
+    unique_lock<mutex> lock(this->segmentLock);
+    while (true) {
+        this->wake.wait_for(lock, chrono::milliseconds(this->flushIntervalMs), [this] {
+            return this->stopping || this->nextRequested || !this->retired.empty();
+        });
+        bool stop = this->stopping;
+        bool mapNext = this->nextRequested && !stop;
+        this->nextRequested = false;
+        done.assign(this->retired.begin(), this->retired.end());
+        this->retired.clear();
+        Segment target = this->flushTarget;
+        lock.unlock();
+
+        for (size_t i = 0; i < done.size(); i++) {
+            flushRange(done[i], 0, this->segmentBytes);
+            unmapSegment(done[i]);
+        }
+        if (mapNext) {
+            Segment segment = mapSegment(target.offset + this->segmentBytes);
+            lock.lock();
+            this->next = segment;
+            this->mapFailed = segment.base == nullptr;
+            lock.unlock();
+            this->ready.notify_all();
+        }
+
+        size_t end = this->committed.load(memory_order_acquire);
+        if (target.base != nullptr && end > target.offset) {
+            size_t from = flushed > target.offset ? flushed - target.offset : 0;
+            size_t to = end - target.offset < this->segmentBytes ? end - target.offset : this->segmentBytes;
+            flushRange(target, from, to);
+            flushed = end;
+        }
+
+        lock.lock();
+        if (stop) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Pads the rest of the current segment and moves to the next one.
+ * @return false if the background thread could not map the next segment.
+ */
+bool Record::switchSegment() {
+    size_t remaining = this->segmentBytes - this->writeOffset;
+    if (remaining > 0) {
+        RecordFrame* padding = reinterpret_cast<RecordFrame*>(this->current.base + this->writeOffset);
+        padding->flags = RecordFrame::PADDING;
+        atomic_thread_fence(memory_order_release);
+        padding->size = static_cast<uint32_t>(remaining);
+    }
+
+    unique_lock<mutex> lock(this->segmentLock);
+    if (this->next.base == nullptr && !this->mapFailed) {
+        this->stallCount++;
+        this->ready.wait(lock, [this] { return this->next.base != nullptr || this->mapFailed; });
+    }
+    if (this->next.base == nullptr) {
+        cout << "Error: record segment is not mapped." << endl;
+        return false;
+    }
+    this->retired.push_back(this->current);
+    this->current = this->next;
+    this->next = { nullptr, 0 };
+    this->nextRequested = true;
+    this->flushTarget = this->current;
+    lock.unlock();
+    this->wake.notify_one();
+
+    this->writeOffset = 0;
+    this->committed.store(this->current.offset, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Appends a frame.
+ * @param timestampNs Time of the sample in nanoseconds.
+ * @param pose Robot pose.
+ * @param ir RecordFrame::IR_COUNT IR ranges.
+ * @param lidar Lidar ranges, may be nullptr if lidarCount is 0.
+ * @param lidarCount Number of lidar ranges.
+ * @return false if the file is not open or the frame cannot fit in a segment.
+ */
+bool Record::write(long long timestampNs, const Pose& pose, const double* ir, const float* lidar, int lidarCount) {
+    if (this->current.base == nullptr) {
+        cout << "Error: Record is not open." << endl;
+        return false;
+    }
+    if (lidarCount < 0 || (lidarCount > 0 && lidar == nullptr) ||
+        RecordFrame::bytesFor(lidarCount) > this->segmentBytes - sizeof(RecordFileHeader)) {
+        cout << "Error: lidar scan does not fit in a record segment." << endl;
+        return false;
+    }
+    uint32_t bytes = RecordFrame::bytesFor(lidarCount);
+    if (this->writeOffset + bytes > this->segmentBytes && !switchSegment()) {
+        return false;
+    }
+
+    RecordFrame* frame = reinterpret_cast<RecordFrame*>(this->current.base + this->writeOffset);
+    frame->flags = 0;
+    frame->sequence = this->frameCount;
+    frame->timestampNs = timestampNs;
+    frame->x = pose.getX();
+    frame->y = pose.getY();
+    frame->th = pose.getTh();
+    if (ir != nullptr) {
+        memcpy(frame->ir, ir, sizeof(frame->ir));
+    }
+    else {
+        memset(frame->ir, 0, sizeof(frame->ir));
+    }
+    frame->lidarCount = static_cast<uint32_t>(lidarCount);
+    frame->reserved = 0;
+    if (lidarCount > 0) {
+        memcpy(frame + 1, lidar, sizeof(float) * lidarCount);
+    }
+    atomic_thread_fence(memory_order_release);
+    frame->size = bytes;
+
+    this->writeOffset += bytes;
+    this->frameCount++;
+    this->committed.store(this->current.offset + this->writeOffset, memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Appends a sensor snapshot.
+ */
+bool Record::write(const SensorSnapshot& snapshot) {
+    return write(snapshot.timestampNs, Pose(snapshot.x, snapshot.y, snapshot.th), snapshot.ir, snapshot.lidar, snapshot.lidarCount);
+}
+
+/**
+ * @brief Stops the background thread, writes the header and trims the file.
+ */
+void Record::close() {
+    if (!isOpen()) {
+        return;
+    }
+    if (this->flusher.joinable()) {
+        {
+            lock_guard<mutex> lock(this->segmentLock);
+            this->stopping = true;
+        }
+        this->wake.notify_one();
+        this->flusher.join();
+    }
+
+    for (size_t i = 0; i < this->retired.size(); i++) {
+        flushRange(this->retired[i], 0, this->segmentBytes);
+        unmapSegment(this->retired[i]);
+    }
+    this->retired.clear();
+    flushRange(this->current, 0, this->writeOffset);
+    unmapSegment(this->current);
+    unmapSegment(this->next);
+    this->flushTarget = { nullptr, 0 };
+
+    RecordFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    header.version = RecordFileHeader::VERSION;
+    header.headerSize = sizeof(RecordFileHeader);
+    header.dataEnd = this->committed.load(memory_order_acquire);
+    header.frameCount = this->frameCount;
+    header.irCount = RecordFrame::IR_COUNT;
+
+#ifdef _WIN32
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(header.dataEnd);
+    SetFilePointerEx(this->fileHandle, position, nullptr, FILE_BEGIN);
+    SetEndOfFile(this->fileHandle);
+    position.QuadPart = 0;
+    SetFilePointerEx(this->fileHandle, position, nullptr, FILE_BEGIN);
+    DWORD written = 0;
+    if (!WriteFile(this->fileHandle, &header, sizeof(header), &written, nullptr) || written != sizeof(header)) {
+        cout << "Error: cannot write record header." << endl;
+    }
+    FlushFileBuffers(this->fileHandle);
+    CloseHandle(this->fileHandle);
+    this->fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (ftruncate(this->fileDescriptor, static_cast<off_t>(header.dataEnd)) != 0 ||
+        pwrite(this->fileDescriptor, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        cout << "Error: cannot write record header." << endl;
+    }
+    fsync(this->fileDescriptor);
+    ::close(this->fileDescriptor);
+    this->fileDescriptor = -1;
+#endif
+}
+
+/**
+ * @brief Returns true if a file is open for writing.
+ */
+bool Record::isOpen() const {
+#ifdef _WIN32
+    return this->fileHandle != INVALID_HANDLE_VALUE;
+#else
+    return this->fileDescriptor >= 0;
+#endif
+}
+
+/**
+ * @brief Returns the number of frames written.
+ */
+uint64_t Record::getFrameCount() const {
+    return this->frameCount;
+}
+
+/**
+ * @brief Returns the file size the log will have once closed.
+ */
+uint64_t Record::getBytesWritten() const {
+    return this->committed.load(memory_order_acquire);
+}
+
+/**
+ * @brief Returns how often the writer had to wait for a segment.
+ */
+uint64_t Record::getStallCount() const {
+    return this->stallCount;
+}
+
+/**
+ * @brief Default constructor. The reader starts closed.
+ */
+RecordReader::RecordReader() {
+    this->base = nullptr;
+    this->mappedBytes = 0;
+    this->dataEnd = 0;
+    this->frameCount = 0;
+}
+
+/**
+ * @brief Destructor. Unmaps the file.
+ */
+RecordReader::~RecordReader() {
+    close();
+}
+
+/**
+ * @brief Maps a record file read-only.
+ * @param path File name.
+ * @return false if the file cannot be mapped or is not a record file.
+ */
+bool RecordReader::open(const string& path) {
+    close();
+    size_t size = 0;
+    const void* view = nullptr;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        cout << "Error: cannot open record file " << path << "." << endl;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= static_cast<LONGLONG>(sizeof(RecordFileHeader))) {
+        size = static_cast<size_t>(fileSize.QuadPart);
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        cout << "Error: cannot open record file " << path << "." << endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(RecordFileHeader))) {
+        size = static_cast<size_t>(info.st_size);
+        view = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+        if (view == MAP_FAILED) {
+            view = nullptr;
+        }
+    }
+    ::close(file);
+#endif
+    if (view == nullptr) {
+        cout << "Error: cannot map record file " << path << "." << endl;
+        return false;
+    }
+    this->base = static_cast<const char*>(view);
+    this->mappedBytes = size;
+
+    const RecordFileHeader* header = reinterpret_cast<const RecordFileHeader*>(this->base);
+    if (memcmp(header->magic, RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0 || header->version != RecordFileHeader::VERSION ||
+        header->irCount != RecordFrame::IR_COUNT) {
+        cout << "Error: " << path << " is not a record file." << endl;
+        close();
+        return false;
+    }
+
+    if (header->dataEnd != 0 && header->dataEnd <= size) {
+        this->dataEnd = static_cast<size_t>(header->dataEnd);
+        this->frameCount = header->frameCount;
+    }
+    else {
+        // Not closed: count complete frames up to the first one without a size.
+        this->dataEnd = size;
+        this->frameCount = 0;
+        for (const RecordFrame* frame = first(); frame != nullptr; frame = next(frame)) {
+            this->frameCount++;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Unmaps the file.
+ */
+void RecordReader::close() {
+    if (this->base == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(this->base);
+#else
+    munmap(const_cast<char*>(this->base), this->mappedBytes);
+#endif
+    this->base = nullptr;
+    this->mappedBytes = 0;
+    this->dataEnd = 0;
+    this->frameCount = 0;
+}
+
+/**
+ * @brief Returns true if a file is mapped.
+ */
+bool RecordReader::isOpen() const {
+    return this->base != nullptr;
+}
+
+/**
+ * @brief Returns the number of frames in the log.
+ */
+uint64_t RecordReader::getFrameCount() const {
+    return this->frameCount;
+}
+
+/**
+ * @brief Returns the first non-padding frame at or after offset.
+ * @return the frame, or nullptr at the end of the data or at an incomplete frame.
+ */
+const RecordFrame* RecordReader::skipPadding(size_t offset) const {
+    while (offset + 2 * sizeof(uint32_t) <= this->dataEnd) {
+        const RecordFrame* frame = reinterpret_cast<const RecordFrame*>(this->base + offset);
+        uint32_t size = frame->size;
+        if (size == 0 || size > this->dataEnd - offset) {
+            return nullptr;
+        }
+        if ((frame->flags & RecordFrame::PADDING) == 0) {
+            if (size < sizeof(RecordFrame) || size < RecordFrame::bytesFor(frame->lidarCount)) {
+                return nullptr;
+            }
+            return frame;
+        }
+        offset += size;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Returns the first frame, or nullptr if the log is empty.
+ */
+const RecordFrame* RecordReader::first() const {
+    if (this->base == nullptr) {
+        return nullptr;
+    }
+    return skipPadding(sizeof(RecordFileHeader));
+}
+
+/**
+ * @brief Returns the frame after frame, or nullptr at the end of the log.
+ */
+const RecordFrame* RecordReader::next(const RecordFrame* frame) const {
+    if (frame == nullptr) {
+        return nullptr;
+    }
+    size_t offset = reinterpret_cast<const char*>(frame) - this->base;
+    return skipPadding(offset + frame->size);
+}
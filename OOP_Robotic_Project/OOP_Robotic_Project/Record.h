@@ -1 +1,278 @@
 #pragma once
+/**
+ * @file   Record.h
+ * @date   October, 2026
+ * @brief  Header file for the Record and RecordReader classes.
+ *
+ * This file contains the definition of the binary run log: fixed-layout frames of pose,
+ * IR and lidar data appended to a memory-mapped file and read back in place.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Pose.h"
+
+struct SensorSnapshot;
+
+//! RecordFileHeader struct
+/*!
+ * @brief First 64 bytes of a record file.
+ */
+struct RecordFileHeader {
+    static const uint32_t VERSION = 1; /*!< Current file format version. */
+
+    char magic[8];        /*!< "RCSREC" followed by two zero bytes. */
+    uint32_t version;     /*!< File format version. */
+    uint32_t headerSize;  /*!< Size of this header, where the first frame starts. */
+    uint64_t dataEnd;     /*!< File offset after the last frame, 0 if the file was not closed. */
+    uint64_t frameCount;  /*!< Number of frames, 0 if the file was not closed. */
+    uint32_t irCount;     /*!< IR ranges per frame. */
+    uint32_t reserved[7]; /*!< Zero. */
+};
+
+//! RecordFrame struct
+/*!
+ * @brief One logged sample, followed in the file by lidarCount floats.
+ *
+ * Frames are 8-byte aligned and size is written last, so a frame with size 0 marks the
+ * end of the data in a file that was not closed.
+ */
+struct RecordFrame {
+    static const int IR_COUNT = 9;          /*!< Number of IR sensors on the robot. */
+    static const uint32_t PADDING = 1;      /*!< flags bit of a filler frame at the end of a segment. */
+
+    uint32_t size;          /*!< Bytes from the start of this frame to the next one. */
+    uint32_t flags;         /*!< PADDING for filler frames, 0 otherwise. */
+    uint64_t sequence;      /*!< Frame number, starting at 0. */
+    int64_t timestampNs;    /*!< Steady clock time of the sample, in nanoseconds. */
+    double x;               /*!< X position (meters). */
+    double y;               /*!< Y position (meters). */
+    double th;              /*!< Heading. */
+    double ir[IR_COUNT];    /*!< IR ranges in meters. */
+    uint32_t lidarCount;    /*!< Number of lidar ranges after the frame. */
+    uint32_t reserved;      /*!< Zero. */
+
+    //! lidar function
+    /*!
+    * @return the lidar ranges stored right after the frame.
+    */
+    const float* lidar() const {
+        return reinterpret_cast<const float*>(this + 1);
+    }
+
+    //! bytesFor function
+    /*!
+    * @return the size of a frame carrying lidarCount ranges.
+    */
+    static uint32_t bytesFor(int lidarCount) {
+        return static_cast<uint32_t>((sizeof(RecordFrame) + sizeof(float) * lidarCount + 7) & ~static_cast<size_t>(7));
+    }
+};
+
+//! Record class
+/*!
+ * @brief Append-only binary log written through a memory-mapped file.
+ *
+ * The file is mapped in segments of segmentBytes. write() only copies a frame into the
+ * current segment, so the calling thread never formats text or makes a system call.
+ * A background thread maps the next segment ahead of time, flushes written pages
+ * every flushIntervalMs and unmaps full segments. When a frame does not fit in what is
+ * left of a segment, the rest is filled with a padding frame and the writer switches
+ * to the segment prepared in the background; it only waits if that segment is not
+ * mapped yet, which is counted in getStallCount().
+ *
+ * write() and close() must be called from the same thread.
+ */
+class Record {
+public:
+    static const size_t DEFAULT_SEGMENT_BYTES = 16 << 20; /*!< Default mapping size, rounded to whole MiB. */
+    static const int DEFAULT_FLUSH_INTERVAL_MS = 200;     /*!< Default time between background flushes. */
+
+private:
+    //! Segment struct
+    /*!
+     * @brief A mapped window of the file.
+     */
+    struct Segment {
+        char* base;     /*!< Start of the mapping, nullptr if none. */
+        size_t offset;  /*!< File offset of the mapping. */
+    };
+
+#ifdef _WIN32
+    void* fileHandle;                     /*!< Windows file handle. */
+#else
+    int fileDescriptor;                   /*!< POSIX file descriptor. */
+#endif
+    size_t segmentBytes;                  /*!< Size of every segment. */
+    int flushIntervalMs;                  /*!< Time between background flushes. */
+    Segment current;                      /*!< Segment being written, owned by the writer. */
+    size_t writeOffset;                   /*!< Next free byte inside current. */
+    uint64_t frameCount;                  /*!< Frames written, not counting padding. */
+    uint64_t stallCount;                  /*!< Segment switches that had to wait for the background thread. */
+    std::atomic<size_t> committed;        /*!< File offset after the last complete frame. */
+
+    std::mutex segmentLock;                    /*!< Guards the fields below. */
+    std::condition_variable wake;         /*!< Wakes the background thread. */
+    std::condition_variable ready;        /*!< Signals that next has been mapped. */
+    Segment next;                         /*!< Segment mapped ahead for the writer. */
+    bool nextRequested;                   /*!< The writer took next and needs another one. */
+    bool mapFailed;                       /*!< The background thread could not map next. */
+    Segment flushTarget;                  /*!< Copy of current for periodic flushes. */
+    std::vector<Segment> retired;         /*!< Full segments waiting to be flushed and unmapped. */
+    bool stopping;                        /*!< Tells the background thread to exit. */
+    std::thread flusher;                  /*!< Background thread. */
+
+    //! mapSegment function
+    /*!
+    * Extends the file and maps the segment that starts at offset.
+    */
+    Segment mapSegment(size_t offset);
+
+    //! flushRange function
+    /*!
+    * Starts writing back bytes [from, to) of a segment.
+    */
+    void flushRange(const Segment& segment, size_t from, size_t to);
+
+    //! unmapSegment function
+    void unmapSegment(Segment& segment);
+
+    //! switchSegment function
+    /*!
+    * Pads the rest of the current segment and moves to the next one.
+    * @return false if the next segment could not be mapped.
+    */
+    bool switchSegment();
+
+    //! flushLoop function
+    /*!
+    * Body of the background thread.
+    */
+    void flushLoop();
+
+    Record(const Record&) = delete;
+    Record& operator=(const Record&) = delete;
+
+public:
+    //! Default constructor
+    Record();
+
+    //! Destructor
+    /*!
+    * Closes the file if it is open.
+    */
+    ~Record();
+
+    //! open function
+    /*!
+    * Creates or truncates a record file and starts the background thread.
+    * @param path File name.
+    * @param segmentBytes Mapping size, rounded up to whole MiB.
+    * @param flushIntervalMs Time between background flushes.
+    * @return true on success.
+    */
+    bool open(const std::string& path, size_t segmentBytes = DEFAULT_SEGMENT_BYTES, int flushIntervalMs = DEFAULT_FLUSH_INTERVAL_MS);
+
+    //! write function
+    /*!
+    * Appends a frame.
+    * @param timestampNs Time of the sample in nanoseconds.
+    * @param pose Robot pose.
+    * @param ir RecordFrame::IR_COUNT IR ranges.
+    * @param lidar Lidar ranges, may be nullptr if lidarCount is 0.
+    * @param lidarCount Number of lidar ranges.
+    * @return false if the file is not open or the frame cannot fit in a segment.
+    */
+    bool write(long long timestampNs, const Pose& pose, const double* ir, const float* lidar, int lidarCount);
+
+    //! write function
+    /*!
+    * Appends a sensor snapshot.
+    */
+    bool write(const SensorSnapshot& snapshot);
+
+    //! close function
+    /*!
+    * Stops the background thread, writes the header and trims the file to its data.
+    */
+    void close();
+
+    //! isOpen function
+    bool isOpen() const;
+
+    //! getFrameCount function
+    uint64_t getFrameCount() const;
+
+    //! getBytesWritten function
+    /*!
+    * @return the file size the log will have once closed.
+    */
+    uint64_t getBytesWritten() const;
+
+    //! getStallCount function
+    uint64_t getStallCount() const;
+};
+
+//! RecordReader class
+/*!
+ * @brief Maps a record file read-only and walks its frames in place.
+ *
+ * Frames are returned as pointers into the mapping, so reading does no parsing or
+ * copying. Files that were not closed are read up to the last complete frame.
+ */
+class RecordReader {
+private:
+    const char* base;        /*!< Start of the mapping. */
+    size_t mappedBytes;      /*!< Size of the mapping. */
+    size_t dataEnd;          /*!< Offset after the last frame. */
+    uint64_t frameCount;     /*!< Number of frames, excluding padding. */
+
+    //! skipPadding function
+    /*!
+    * @return the first non-padding frame at or after offset, or nullptr.
+    */
+    const RecordFrame* skipPadding(size_t offset) const;
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+public:
+    //! Default constructor
+    RecordReader();
+
+    //! Destructor
+    ~RecordReader();
+
+    //! open function
+    /*!
+    * Maps a record file.
+    * @return false if the file cannot be mapped or is not a record file.
+    */
+    bool open(const std::string& path);
+
+    //! close function
+    void close();
+
+    //! isOpen function
+    bool isOpen() const;
+
+    //! getFrameCount function
+    uint64_t getFrameCount() const;
+
+    //! first function
+    /*!
+    * @return the first frame, or nullptr if the log is empty.
+    */
+    const RecordFrame* first() const;
+
+    //! next function
+    /*!
+    * @return the frame after frame, or nullptr at the end of the log.
+    */
+    const RecordFrame* next(const RecordFrame* frame) const;
+};
@@ -0,0 +1,254 @@
+/**
+ * @file   ReplayRobot.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the ReplayRobot class.
+ */
+
+#include <iostream>
+#include "ReplayRobot.h"
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor.
+ * Maps the log and indexes its frames, so replaying does not walk the file.
+ * @param path Record file to replay.
+ * @param timeScale Replay speed relative to real time, 0 to step on every getXYTh().
+ */
+ReplayRobot::ReplayRobot(const string& path, double timeScale) {
+    this->cursor = 0;
+    this->started = false;
+    this->finished = false;
+    this->timeScale = timeScale > 0.0 ? timeScale : 0.0;
+    this->lidarNumber = 0;
+    this->connected = false;
+    this->moving = false;
+    this->lastDirection = FORWARD;
+    this->commandCount = 0;
+
+    if (!this->reader.open(path)) {
+        return;
+    }
+    this->frames.reserve(static_cast<size_t>(this->reader.getFrameCount()));
+    for (const RecordFrame* frame = this->reader.first(); frame != nullptr; frame = this->reader.next(frame)) {
+        this->frames.push_back(frame);
+        if (static_cast<int>(frame->lidarCount) > this->lidarNumber) {
+            this->lidarNumber = static_cast<int>(frame->lidarCount);
+        }
+    }
+    if (this->frames.empty()) {
+        cout << "Error: record file " << path << " has no frames." << endl;
+    }
+}
+
+/**
+ * @brief Returns the frame to serve.
+ * In timed mode the cursor moves forward to the last frame whose log time has been
+ * reached; it never moves back.
+ */
+const RecordFrame* ReplayRobot::current() {
+    if (this->frames.empty()) {
+        return nullptr;
+    }
+    if (!this->started) {
+        this->started = true;
+        this->startTime = chrono::steady_clock::now();
+    }
+    else if (this->timeScale > 0.0) {
+        double elapsedNs = chrono::duration<double, nano>(chrono::steady_clock::now() - this->startTime).count();
+        long long target = this->frames[0]->timestampNs + static_cast<long long>(elapsedNs * this->timeScale);
+        while (this->cursor + 1 < this->frames.size() && this->frames[this->cursor + 1]->timestampNs <= target) {
+            this->cursor++;
+        }
+        if (this->cursor + 1 == this->frames.size() && this->frames[this->cursor]->timestampNs < target) {
+            this->finished = true;
+        }
+    }
+    return this->frames[this->cursor];
+}
+
+/**
+ * @brief Returns true if the log holds at least one frame.
+ */
+bool ReplayRobot::isLoaded() const {
+    return !this->frames.empty();
+}
+
+/**
+ * @brief Changes the replay speed.
+ * The clock is restarted so that the frame being served stays the same.
+ */
+void ReplayRobot::setTimeScale(double timeScale) {
+    this->timeScale = timeScale > 0.0 ? timeScale : 0.0;
+    seek(this->cursor);
+}
+
+/**
+ * @brief Moves to the next frame.
+ * @return false if the replay is already at the last frame.
+ */
+bool ReplayRobot::advance() {
+    if (this->cursor + 1 >= this->frames.size()) {
+        this->finished = true;
+        return false;
+    }
+    this->cursor++;
+    return true;
+}
+
+/**
+ * @brief Moves to a frame and restarts the clock.
+ * In timed mode the log time of that frame is played at the next sensor read.
+ */
+void ReplayRobot::seek(size_t index) {
+    if (this->frames.empty()) {
+        return;
+    }
+    this->cursor = index < this->frames.size() ? index : this->frames.size() - 1;
+    this->started = false;
+    this->finished = false;
+    if (this->timeScale > 0.0 && this->cursor > 0) {
+        // Shift the clock so that the first read lands on the chosen frame.
+        this->started = true;
+        long long offsetNs = this->frames[this->cursor]->timestampNs - this->frames[0]->timestampNs;
+        this->startTime = chrono::steady_clock::now() -
+            chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double, nano>(offsetNs / this->timeScale));
+    }
+}
+
+/**
+ * @brief Returns the index of the frame being served.
+ */
+size_t ReplayRobot::getFrameIndex() const {
+    return this->cursor;
+}
+
+/**
+ * @brief Returns the number of frames in the log.
+ */
+size_t ReplayRobot::getFrameCount() const {
+    return this->frames.size();
+}
+
+/**
+ * @brief Returns the frame being served.
+ */
+const RecordFrame* ReplayRobot::getFrame() const {
+    return this->frames.empty() ? nullptr : this->frames[this->cursor];
+}
+
+/**
+ * @brief Returns true once the replay ran past the last frame.
+ */
+bool ReplayRobot::isFinished() const {
+    return this->finished;
+}
+
+/**
+ * @brief Returns true between connect() and disconnect().
+ */
+bool ReplayRobot::isConnected() const {
+    return this->connected;
+}
+
+/**
+ * @brief Returns true if the last motion command was a move or a rotation.
+ */
+bool ReplayRobot::isMoving() const {
+    return this->moving;
+}
+
+/**
+ * @brief Returns the direction of the last move or rotate command.
+ */
+DIRECTION ReplayRobot::getLastDirection() const {
+    return this->lastDirection;
+}
+
+/**
+ * @brief Returns the number of motion commands received.
+ */
+unsigned long long ReplayRobot::getCommandCount() const {
+    return this->commandCount;
+}
+
+void ReplayRobot::connect() {
+    this->connected = true;
+}
+
+void ReplayRobot::disconnect() {
+    this->connected = false;
+    this->moving = false;
+}
+
+void ReplayRobot::move(DIRECTION direction) {
+    this->moving = true;
+    this->lastDirection = direction;
+    this->commandCount++;
+}
+
+void ReplayRobot::rotate(DIRECTION direction) {
+    this->moving = true;
+    this->lastDirection = direction;
+    this->commandCount++;
+}
+
+void ReplayRobot::stop() {
+    this->moving = false;
+    this->commandCount++;
+}
+
+/**
+ * @brief Returns IR range i of the current frame.
+ */
+double ReplayRobot::getIRRange(int i) {
+    const RecordFrame* frame = current();
+    if (frame == nullptr || i < 0 || i >= RecordFrame::IR_COUNT) {
+        cout << "Error: IR sensor " << i << " is not available in the replay." << endl;
+        return 0.0;
+    }
+    return frame->ir[i];
+}
+
+/**
+ * @brief Returns the pose of the current frame.
+ * In stepped mode every call after the first one moves to the next frame first.
+ */
+void ReplayRobot::getXYTh(double& X, double& Y, double& TH) {
+    if (this->timeScale == 0.0 && this->started) {
+        advance();
+    }
+    const RecordFrame* frame = current();
+    if (frame == nullptr) {
+        X = 0.0;
+        Y = 0.0;
+        TH = 0.0;
+        return;
+    }
+    X = frame->x;
+    Y = frame->y;
+    TH = frame->th;
+}
+
+/**
+ * @brief Copies the lidar scan of the current frame.
+ * Frames with fewer ranges than getLidarRangeNumber() are padded with 0, which
+ * consumers treat as an invalid reading.
+ */
+void ReplayRobot::getLidarRange(float* ranges) {
+    const RecordFrame* frame = current();
+    int count = frame != nullptr ? static_cast<int>(frame->lidarCount) : 0;
+    const float* source = frame != nullptr ? frame->lidar() : nullptr;
+    for (int i = 0; i < count; i++) {
+        ranges[i] = source[i];
+    }
+    for (int i = count; i < this->lidarNumber; i++) {
+        ranges[i] = 0.0f;
+    }
+}
+
+/**
+ * @brief Returns the largest lidar scan in the log.
+ */
+int ReplayRobot::getLidarRangeNumber() {
+    return this->lidarNumber;
+}
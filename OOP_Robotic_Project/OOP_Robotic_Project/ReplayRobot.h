@@ -0,0 +1,131 @@
+#pragma once
+/**
+ * @file   ReplayRobot.h
+ * @date   October, 2026
+ * @brief  Header file for the ReplayRobot class.
+ *
+ * This file contains the definition of the ReplayRobot class, a RobotInterface backend
+ * that serves sensor readings from a Record log instead of a simulator.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "Record.h"
+#include "RobotInterface.h"
+
+//! ReplayRobot class
+/*!
+ * @brief Plays a Record log back through the RobotInterface surface.
+ *
+ * With a time scale of 0 the replay is stepped: every getXYTh() call after the first
+ * one moves to the next frame, so a control loop, a SensorPipeline or a test pulls
+ * frames as fast as it can and always sees the same sequence. With a time scale above
+ * 0 the frame follows the wall clock: the log timestamps are played back timeScale
+ * times faster than real time, starting at the first sensor read, and frames that
+ * the consumer is too slow for are skipped. advance() and seek() move the replay by
+ * hand in either mode.
+ *
+ * Motion commands do not change what is replayed; they are only counted so that tests
+ * can check what a controller sent. The class is not thread safe, except that
+ * isFinished() may be polled from another thread.
+ */
+class ReplayRobot : public RobotInterface {
+private:
+    RecordReader reader;                      /*!< Mapped log. */
+    std::vector<const RecordFrame*> frames;   /*!< Frames of the log in order. */
+    size_t cursor;                            /*!< Index of the frame being served. */
+    bool started;                             /*!< A sensor has been read since the last seek. */
+    std::atomic<bool> finished;               /*!< A frame past the last one was asked for. */
+    double timeScale;                         /*!< Replay speed relative to real time, 0 to step. */
+    std::chrono::steady_clock::time_point startTime; /*!< Wall time of the first sensor read. */
+    int lidarNumber;                          /*!< Largest lidar scan in the log. */
+    bool connected;                           /*!< Set by connect(), cleared by disconnect(). */
+    bool moving;                              /*!< A move or rotate command is active. */
+    DIRECTION lastDirection;                  /*!< Direction of the last move or rotate command. */
+    unsigned long long commandCount;          /*!< Number of move, rotate and stop commands. */
+
+    //! current function
+    /*!
+    * Starts the clock on the first read and, in timed mode, catches up with it.
+    * @return the frame to serve, or nullptr if the log is empty.
+    */
+    const RecordFrame* current();
+
+    ReplayRobot(const ReplayRobot&) = delete;
+    ReplayRobot& operator=(const ReplayRobot&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param path Record file to replay.
+    * @param timeScale Replay speed relative to real time, 0 to step on every getXYTh().
+    */
+    ReplayRobot(const std::string& path, double timeScale = 0.0);
+
+    //! isLoaded function
+    /*!
+    * @return true if the log was opened and holds at least one frame.
+    */
+    bool isLoaded() const;
+
+    //! setTimeScale function
+    /*!
+    * Changes the replay speed; the clock restarts at the next sensor read.
+    */
+    void setTimeScale(double timeScale);
+
+    //! advance function
+    /*!
+    * Moves to the next frame.
+    * @return false if the replay is already at the last frame.
+    */
+    bool advance();
+
+    //! seek function
+    /*!
+    * Moves to frame index and restarts the clock.
+    */
+    void seek(size_t index);
+
+    //! getFrameIndex function
+    size_t getFrameIndex() const;
+
+    //! getFrameCount function
+    size_t getFrameCount() const;
+
+    //! getFrame function
+    /*!
+    * @return the frame being served, or nullptr if the log is empty.
+    */
+    const RecordFrame* getFrame() const;
+
+    //! isFinished function
+    /*!
+    * @return true once the last frame has been served and another one was asked for.
+    */
+    bool isFinished() const;
+
+    //! isConnected function
+    bool isConnected() const;
+
+    //! isMoving function
+    bool isMoving() const;
+
+    //! getLastDirection function
+    DIRECTION getLastDirection() const;
+
+    //! getCommandCount function
+    unsigned long long getCommandCount() const;
+
+    void connect() override;
+    void disconnect() override;
+    void move(DIRECTION direction) override;
+    void rotate(DIRECTION direction) override;
+    void stop() override;
+    double getIRRange(int i) override;
+    void getXYTh(double& X, double& Y, double& TH) override;
+    void getLidarRange(float* ranges) override;
+    int getLidarRangeNumber() override;
+};
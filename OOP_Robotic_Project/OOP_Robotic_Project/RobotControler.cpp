@@ -8,12 +8,14 @@
  * methods for controlling the movement of a robot, and utility methods.
  */
 
+#include <cmath>
 #include <iostream>
 #include <string>
 using namespace std;
 #include "Pose.h"
-#include "../../oop_project/Project_Packet/FestoRobotAPI.h"
 #include "RobotControler.h"
+#include "Logger.h"
+#include "Metrics.h"
 
 /**
  * @brief Default Constructor.
@@ -21,11 +23,16 @@ using namespace std;
  */
 RobotControler::RobotControler() {
     this->robotAPI = nullptr;
-    this->position = new Pose();
+    this->adapter = nullptr;
+    this->position = Pose();
     this->connectionStatus = false;
-    cout << "RobotControler created using default constructor." << endl;
+    this->dispatcher = nullptr;
+    this->poseCache = nullptr;
+    resetVelocity();
+    LOG_INFO("RobotControler created using default constructor.");
 }
 
+#ifdef ROBOT_USE_FESTO_API
 /**
  * @brief Parameterized Constructor.
  * Initializes the RobotControler with provided API.
@@ -33,10 +40,14 @@ RobotControler::RobotControler() {
  */
 
 RobotControler::RobotControler(FestoRobotAPI* api) {
-    this->robotAPI = api;
+    this->adapter = api != nullptr ? new FestoRobotInterface(api) : nullptr;
+    this->robotAPI = this->adapter;
     this->connectionStatus = false;
-    this->position = new Pose();
-    cout << "RobotControler created using one parameterized constructor." << endl;
+    this->dispatcher = nullptr;
+    this->poseCache = nullptr;
+    resetVelocity();
+    this->position = Pose();
+    LOG_INFO("RobotControler created using one parameterized constructor.");
 }
 
 
@@ -47,131 +58,178 @@ RobotControler::RobotControler(FestoRobotAPI* api) {
  * @param initialPose Pointer to the initial Pose object.
  */
 RobotControler::RobotControler(FestoRobotAPI* api, const Pose& initialPose) {
+    this->adapter = api != nullptr ? new FestoRobotInterface(api) : nullptr;
+    this->robotAPI = this->adapter;
+    this->position = initialPose; // Gelen pozisyonu kopyalayarak olutur
+    this->connectionStatus = false;
+    this->dispatcher = nullptr;
+    this->poseCache = nullptr;
+    resetVelocity();
+
+    if (this->robotAPI != nullptr) {
+        this->connectionStatus = connectRobot();
+        LOG_INFO("RobotControler connected successfully using parameterized constructor.");
+    }
+    else {
+        LOG_ERROR("robotAPI is null in parameterized constructor.");
+    }
+}
+#endif
+
+/**
+ * @brief Parameterized Constructor.
+ * Initializes the RobotControler with any robot API backend.
+ * @param api Pointer to the RobotInterface object, not owned.
+ */
+RobotControler::RobotControler(RobotInterface* api) {
+    this->robotAPI = api;
+    this->adapter = nullptr;
+    this->connectionStatus = false;
+    this->dispatcher = nullptr;
+    this->poseCache = nullptr;
+    resetVelocity();
+    this->position = Pose();
+    LOG_INFO("RobotControler created using one parameterized constructor.");
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * Initializes the RobotControler with any robot API backend and initial pose.
+ * @param api Pointer to the RobotInterface object, not owned.
+ * @param initialPose Pointer to the initial Pose object.
+ */
+RobotControler::RobotControler(RobotInterface* api, const Pose& initialPose) {
     this->robotAPI = api;
-    this->position = new Pose(initialPose); // Gelen pozisyonu kopyalayarak olutur
+    this->adapter = nullptr;
+    this->position = initialPose;
     this->connectionStatus = false;
+    this->dispatcher = nullptr;
+    this->poseCache = nullptr;
+    resetVelocity();
 
     if (this->robotAPI != nullptr) {
         this->connectionStatus = connectRobot();
-        cout << "RobotControler connected successfully using parameterized constructor." << endl;
+        LOG_INFO("RobotControler connected successfully using parameterized constructor.");
     }
     else {
-        cout << "Error: robotAPI is null in parameterized constructor." << endl;
+        LOG_ERROR("robotAPI is null in parameterized constructor.");
     }
 }
 
 /**
  * @brief Destructor.
- * Cleans up dynamically allocated memory for the position object.
+ * Cleans up the adapter created for a FestoRobotAPI.
  */
 RobotControler::~RobotControler() {
-    delete this->position;
-    cout << "RobotControler destroyed and resources cleaned up." << endl;
+    delete this->poseCache;
+    delete this->dispatcher;
+    delete this->adapter;
+    LOG_INFO("RobotControler destroyed and resources cleaned up.");
 }
 
 /**
  * @brief This function turns the robot to the left if it is connected.
  */
 void RobotControler::turnLeft() {
-    if (this->connectionStatus) {
-        this->robotAPI->rotate(LEFT);
-        cout << "RobotControler turned left." << endl;
-    }
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
-
+    issue(COMMAND_TURN_LEFT);
 }
 
 /**
  * @brief This function turns the robot to the right if it is connected.
  */
 void RobotControler::turnRight() {
-    if (this->connectionStatus) {
-        this->robotAPI->rotate(RIGHT);
-        cout << "RobotControler turned right." << endl;
-    }
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
-
+    issue(COMMAND_TURN_RIGHT);
 }
 
 /**
  * @brief This function moves the robot forward if it is connected.
  */
 void RobotControler::moveForward() {
-    if (this->connectionStatus) {
-        this->robotAPI->move(FORWARD);
-        cout << "RobotControler moved forward." << endl;
-    }
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
+    issue(COMMAND_MOVE_FORWARD);
 }
 
 /**
  * @brief This function moves the robot backward if it is connected.
  */
 void RobotControler::moveBackward() {
-    if (this->connectionStatus) {
-        this->robotAPI->move(BACKWARD);
-        cout << "RobotControler moved backward." << endl;
-    }
-
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
+    issue(COMMAND_MOVE_BACKWARD);
 }
 
 /**
  * @brief This function moves the robot to the left if it is connected.
  */
 void RobotControler::moveLeft() {
-    if (this->connectionStatus) {
-        this->robotAPI->move(LEFT);
-        cout << "RobotControler moved left." << endl;
-    }
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
+    issue(COMMAND_MOVE_LEFT);
 }
 
 /**
  * @brief This function moves the robot to the right if it is connected.
  */
 void RobotControler::moveRight() {
-    if (this->connectionStatus) {
-        this->robotAPI->move(RIGHT);
-        cout << "RobotControler moved right." << endl;
-    }
-    else {
-        cout << "Error: RobotControler is not connected." << endl;
-    }
+    issue(COMMAND_MOVE_RIGHT);
 }
 
 /**
  * @brief This function stops the robot if it is connected.
  */
 void RobotControler::stop() {
-    if (this->connectionStatus) {
-        this->robotAPI->stop();
-        cout << "RobotControler stopped." << endl;
+    issue(COMMAND_STOP);
+}
+
+/**
+ * @brief Carries out a command if the robot is connected.
+ * The command is queued while the dispatcher runs; otherwise it is sent to the API
+ * through CommandDispatcher::issue(), the one place a command becomes an API call.
+ */
+void RobotControler::issue(RobotCommand command) {
+    static const char* const MESSAGE[] = {
+        "RobotControler moved forward.",
+        "RobotControler moved backward.",
+        "RobotControler moved left.",
+        "RobotControler moved right.",
+        "RobotControler turned left.",
+        "RobotControler turned right.",
+        "RobotControler stopped."
+    };
+    if (!this->connectionStatus) {
+        if (command != COMMAND_STOP) {
+            LOG_ERROR("RobotControler is not connected.");
+        }
+        return;
+    }
+    track(command);
+    if (sendAsync(command)) {
+        return;
     }
+    {
+        METRIC_SCOPE("robot_api_command");
+        CommandDispatcher::issue(this->robotAPI, command);
+    }
+    LOG_INFO(MESSAGE[command]);
 }
 
 /**
  * @brief This function returns the current position and orientation of the robot.
+ * While the pose cache runs, the pose comes from the cache and the stored position is
+ * left alone, since readers on several threads would race on it.
  * @return The current position of the robot as a Pose object.
  */
 Pose RobotControler::getPose() {
-    cout << "Getting the current position of the robot." << endl;
+    if (this->poseCache != nullptr && this->poseCache->isRunning()) {
+        double x, y, th;
+        this->poseCache->get(x, y, th);
+        return Pose(x, y, th);
+    }
+    LOG_DEBUG("Getting the current position of the robot.");
     double x, y, th;
-    this->robotAPI->getXYTh(x, y, th);
-    this->position->setX(x);
-    this->position->setY(y);
-    this->position->setTh(th);
-    return *this->position;
+    {
+        METRIC_SCOPE("robot_api_pose");
+        this->robotAPI->getXYTh(x, y, th);
+    }
+    this->position.setX(x);
+    this->position.setY(y);
+    this->position.setTh(th);
+    return this->position;
 }
 
 /**
@@ -181,9 +239,9 @@ void RobotControler::print() {
     cout << "----------------------------------------------------------------------" << endl;
     cout << "IsOpen: " << this->connectionStatus << endl;
     cout << "----------------------------------------------------------------------" << endl;
-    cout << "Robot Position: " << this->position->getX() << ", "
-        << this->position->getY() << ", "
-        << this->position->getTh() << endl;
+    cout << "Robot Position: " << this->position.getX() << ", "
+        << this->position.getY() << ", "
+        << this->position.getTh() << endl;
 }
 
 /**
@@ -194,7 +252,7 @@ bool RobotControler::connectRobot() {
     if (!this->connectionStatus && this->robotAPI != nullptr) {
         this->robotAPI->connect();
         this->connectionStatus = true;
-        cout << "RobotControler connected successfully." << endl;
+        LOG_INFO("RobotControler connected successfully.");
     }
 
 
@@ -207,9 +265,242 @@ bool RobotControler::connectRobot() {
  */
 bool RobotControler::disconnectRobot() {
     if (this->connectionStatus && this->robotAPI != nullptr) {
+        if (this->dispatcher != nullptr) {
+            this->dispatcher->flush();
+        }
         this->robotAPI->disconnect();
         this->connectionStatus = false;
-        cout << "RobotControler disconnected successfully." << endl;
+        LOG_INFO("RobotControler disconnected successfully.");
     }
     return this->connectionStatus;
 }
+
+/**
+ * @brief Queues a command if the dispatcher is running.
+ * If the queue is full the caller waits for it to drain, so no command is lost.
+ * @return true if the command was handed to the dispatcher.
+ */
+bool RobotControler::sendAsync(RobotCommand command) {
+    if (this->dispatcher == nullptr || !this->dispatcher->isRunning()) {
+        return false;
+    }
+    if (this->dispatcher->submit(command)) {
+        METRIC_COUNT("robot_commands_queued_total", 1);
+        return true;
+    }
+    LOG_ERROR("RobotControler command queue is full, waiting for the dispatcher.");
+    METRIC_COUNT("robot_command_queue_full_total", 1);
+    this->dispatcher->flush();
+    return this->dispatcher->submit(command);
+}
+
+/**
+ * @brief Starts the dispatcher thread for queued motion commands.
+ * @return true if the dispatcher is running.
+ */
+bool RobotControler::startAsync() {
+    if (this->robotAPI == nullptr) {
+        LOG_ERROR("RobotControler has no robot API.");
+        return false;
+    }
+    if (this->dispatcher == nullptr) {
+        this->dispatcher = new CommandDispatcher(this->robotAPI);
+    }
+    return this->dispatcher->start();
+}
+
+/**
+ * @brief Issues the queued commands and stops the dispatcher thread.
+ */
+void RobotControler::stopAsync() {
+    if (this->dispatcher != nullptr) {
+        this->dispatcher->stop();
+    }
+}
+
+/**
+ * @brief Returns true while motion commands are queued.
+ */
+bool RobotControler::isAsync() const {
+    return this->dispatcher != nullptr && this->dispatcher->isRunning();
+}
+
+/**
+ * @brief Returns the dispatcher, or nullptr if startAsync() was never called.
+ */
+CommandDispatcher* RobotControler::getDispatcher() {
+    return this->dispatcher;
+}
+
+/**
+ * @brief Starts the pose cache read by getPose().
+ * A cache left from an earlier call is kept with its counters and gets the new max age.
+ * @return true if the refresher is running.
+ */
+bool RobotControler::startPoseCache(int maxAgeMicroseconds, int refreshMicroseconds) {
+    if (this->robotAPI == nullptr) {
+        LOG_ERROR("RobotControler has no robot API.");
+        return false;
+    }
+    if (this->poseCache == nullptr) {
+        this->poseCache = new PoseCache(this->robotAPI, maxAgeMicroseconds, refreshMicroseconds);
+    }
+    this->poseCache->setMaxAge(maxAgeMicroseconds);
+    return this->poseCache->start();
+}
+
+/**
+ * @brief Stops the pose cache refresher thread.
+ */
+void RobotControler::stopPoseCache() {
+    if (this->poseCache != nullptr) {
+        this->poseCache->stop();
+    }
+}
+
+/**
+ * @brief Returns the pose cache, or nullptr if startPoseCache() was never called.
+ */
+PoseCache* RobotControler::getPoseCache() {
+    return this->poseCache;
+}
+
+/**
+ * @brief Sets the default speeds of SimulatedRobot and leaves velocity mode.
+ */
+void RobotControler::resetVelocity() {
+    this->linearSpeed = 0.2;
+    this->angularSpeed = 0.5;
+    this->sliceHysteresis = 0.05;
+    this->activeCommand = COMMAND_STOP;
+    clearVelocity();
+}
+
+/**
+ * @brief Records a primitive sent by a motion function.
+ * The slot is forgotten, so the next tick() sends its primitive again even if it equals
+ * this one; a stop() or move from outside the time slicing is then undone one tick later.
+ */
+void RobotControler::track(RobotCommand command) {
+    this->activeSlot = -1;
+    this->activeCommand = command;
+}
+
+/**
+ * @brief Leaves velocity mode and drops the shares and credits of every slot.
+ * The robot keeps running the primitive last sent.
+ */
+void RobotControler::clearVelocity() {
+    this->velocityMode = false;
+    this->activeSlot = -1;
+    for (int k = 0; k < 4; k++) {
+        this->duty[k] = 0.0;
+        this->credit[k] = 0.0;
+        this->slotCommand[k] = COMMAND_STOP;
+    }
+}
+
+/**
+ * @brief Sets the speeds of the robot's primitives.
+ */
+void RobotControler::setMotionSpeeds(double linearSpeed, double angularSpeed) {
+    if (linearSpeed <= 0.0 || angularSpeed <= 0.0) {
+        LOG_ERROR("RobotControler motion speeds must be positive.");
+        return;
+    }
+    this->linearSpeed = linearSpeed;
+    this->angularSpeed = angularSpeed;
+}
+
+/**
+ * @brief Sets how long a slot may run past its share of time.
+ */
+void RobotControler::setSliceHysteresis(double seconds) {
+    if (seconds < 0.0) {
+        LOG_ERROR("RobotControler slice hysteresis cannot be negative.");
+        return;
+    }
+    this->sliceHysteresis = seconds;
+}
+
+/**
+ * @brief Enters velocity mode with a body twist.
+ * The twist becomes the share of time of each primitive. A slot keeps its credit
+ * across calls, so the twist may be updated every control period. When its direction
+ * changes or its share drops to zero the time it was owed is dropped, but time it ran
+ * ahead is kept, otherwise a twist hovering around zero would keep the slot running.
+ */
+void RobotControler::setVelocity(double vx, double vy, double omega) {
+    if (!isfinite(vx) || !isfinite(vy) || !isfinite(omega)) {
+        LOG_ERROR("RobotControler velocity must be finite.");
+        return;
+    }
+    double share[3] = { fabs(vx) / this->linearSpeed, fabs(vy) / this->linearSpeed, fabs(omega) / this->angularSpeed };
+    RobotCommand commands[3] = {
+        vx >= 0.0 ? COMMAND_MOVE_FORWARD : COMMAND_MOVE_BACKWARD,
+        vy >= 0.0 ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT,
+        omega >= 0.0 ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT
+    };
+    double total = share[0] + share[1] + share[2];
+    double scale = total > 1.0 ? 1.0 / total : 1.0;
+
+    double busy = 0.0;
+    for (int k = 0; k < 3; k++) {
+        this->duty[k] = share[k] * scale;
+        busy += this->duty[k];
+        if ((commands[k] != this->slotCommand[k] || this->duty[k] <= 0.0) && this->credit[k] > 0.0) {
+            this->credit[k] = 0.0;
+        }
+        this->slotCommand[k] = commands[k];
+    }
+    this->duty[3] = busy < 1.0 ? 1.0 - busy : 0.0;
+    this->slotCommand[3] = COMMAND_STOP;
+    if (this->duty[3] <= 0.0 && this->credit[3] > 0.0) {
+        this->credit[3] = 0.0;
+    }
+    this->velocityMode = true;
+}
+
+/**
+ * @brief Advances the time slicing by one control period.
+ * Every slot is owed its share of the period. The running slot goes on while it is
+ * less than the hysteresis ahead of its share; otherwise the slot owed the most time
+ * takes over. The motion function is only called when the primitive changes.
+ */
+RobotCommand RobotControler::tick(double seconds) {
+    if (!this->velocityMode || !this->connectionStatus || seconds <= 0.0) {
+        return this->activeCommand;
+    }
+    for (int k = 0; k < 4; k++) {
+        this->credit[k] += this->duty[k] * seconds;
+    }
+
+    int slot = this->activeSlot;
+    if (slot < 0 || this->duty[slot] <= 0.0 || this->credit[slot] - seconds < -this->sliceHysteresis) {
+        slot = -1;
+        for (int k = 0; k < 4; k++) {
+            if (this->duty[k] > 0.0 && (slot < 0 || this->credit[k] > this->credit[slot])) {
+                slot = k;
+            }
+        }
+        if (slot < 0) {
+            return this->activeCommand;
+        }
+    }
+    this->credit[slot] -= seconds;
+
+    RobotCommand command = this->slotCommand[slot];
+    if (this->activeSlot < 0 || command != this->activeCommand) {
+        issue(command);
+    }
+    this->activeSlot = slot;
+    this->activeCommand = command;
+    return command;
+}
+
+/**
+ * @brief Returns true after setVelocity().
+ */
+bool RobotControler::isVelocityMode() const {
+    return this->velocityMode;
+}
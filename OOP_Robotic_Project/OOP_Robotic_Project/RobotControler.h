@@ -14,7 +14,10 @@
 #include <string>
 using namespace std;
 #include "Pose.h"
-#include "../../oop_project/Project_Packet/FestoRobotAPI.h"
+#include "RobotPlatform.h"
+#include "FestoRobotInterface.h"
+#include "CommandDispatcher.h"
+#include "PoseCache.h"
 
 //! RobotControler class
 /*!
@@ -22,13 +25,66 @@ using namespace std;
  *
  * The RobotControler class provides functionalities for controlling the movement of a robot
  * in a 2D space. It uses the FestoRobotAPI class to communicate with the robot and send commands
- * for moving the robot in different directions.
+ * for moving the robot in different directions. Any other RobotInterface backend, such as
+ * ReplayRobot or SimulatedRobot, can be used in its place; the FestoRobotAPI constructors
+ * only exist where the API is available (ROBOT_USE_FESTO_API).
+ *
+ * After startAsync(), motion commands are queued to a CommandDispatcher thread instead
+ * of being sent and logged on the calling thread. After startPoseCache(), getPose()
+ * returns the pose of a PoseCache, refreshed in the background, and may then be called
+ * from any thread.
+ *
+ * Status and error messages go through Logger, so logging a command copies a small
+ * record instead of flushing a console line; print() still writes to cout directly.
+ *
+ * In velocity mode (setVelocity() until clearVelocity()) the caller gives a body twist
+ * and calls tick() from its control loop. The robot only knows full-speed primitives,
+ * so tick() splits time between moving along x, moving along y, rotating and standing
+ * still in proportion to the twist, like a PWM signal. A slot keeps running until it is
+ * ahead of its share by the slice hysteresis, so the API is only called when the
+ * primitive changes: a twist along one axis is a single call, and a larger hysteresis
+ * trades tracking error for fewer calls. A motion function called in between is
+ * undone on the next tick(), which sends the slot's primitive again.
  */
 class RobotControler {
 private:
-    FestoRobotAPI* robotAPI; /*!< Pointer to the FestoRobotAPI object used to control the robot. */
-    Pose* position; /*!< Pointer to the Pose object representing the current position and orientation of the robot. */
+    RobotInterface* robotAPI; /*!< Pointer to the robot API used to control the robot. */
+    RobotInterface* adapter; /*!< Adapter owned by the controller when it is built from a FestoRobotAPI. */
+    Pose position; /*!< Current position and orientation of the robot. */
     bool connectionStatus; /*!< Flag indicating whether the robot is connected or not. */
+    CommandDispatcher* dispatcher; /*!< Dispatcher for queued commands, nullptr until startAsync(). */
+    PoseCache* poseCache; /*!< Cache read by getPose(), nullptr until startPoseCache(). */
+    double linearSpeed; /*!< Speed of the move primitives (meters per second). */
+    double angularSpeed; /*!< Speed of the rotate primitives (radians per second). */
+    double sliceHysteresis; /*!< Time a velocity slot may run past its share (seconds). */
+    bool velocityMode; /*!< True after setVelocity(); tick() drives the robot. */
+    double duty[4]; /*!< Share of time of the x, y, rotation and idle slots. */
+    double credit[4]; /*!< Time each slot is owed (seconds). */
+    RobotCommand slotCommand[4]; /*!< Primitive that carries out each slot. */
+    int activeSlot; /*!< Slot running, -1 when none has been sent. */
+    RobotCommand activeCommand; /*!< Primitive last sent, by tick() or a motion function. */
+
+    //! sendAsync function
+    /*!
+    * Queues a command if the dispatcher is running.
+    * @return true if the command was handed to the dispatcher.
+    */
+    bool sendAsync(RobotCommand command);
+
+    //! resetVelocity function
+    /*!
+    * Sets the default speeds and leaves velocity mode.
+    */
+    void resetVelocity();
+
+    //! track function
+    /*!
+    * Records a primitive sent by a motion function, so tick() sends its slot again.
+    */
+    void track(RobotCommand command);
+
+    RobotControler(const RobotControler&) = delete;
+    RobotControler& operator=(const RobotControler&) = delete;
 
 public:
     //! Default Constructor
@@ -37,6 +93,7 @@ public:
     */
     RobotControler();
 
+#ifdef ROBOT_USE_FESTO_API
     //! One Parametrized Constructor
     /*!
     * Initializes the RobotControler with provided FestoRobotAPI object.
@@ -50,6 +107,22 @@ public:
     * @param initialPose Pointer to the initial Pose object.
     */
     RobotControler(FestoRobotAPI* api, const Pose& initialPose);
+#endif
+
+    //! One Parametrized Constructor
+    /*!
+    * Initializes the RobotControler with any robot API backend.
+    * @param api Pointer to the RobotInterface object, not owned.
+    */
+    RobotControler(RobotInterface* api);
+
+    //! Parameterized Constructor
+    /*!
+    * Initializes the RobotControler with any robot API backend and connects it.
+    * @param api Pointer to the RobotInterface object, not owned.
+    * @param initialPose Pointer to the initial Pose object.
+    */
+    RobotControler(RobotInterface* api, const Pose& initialPose);
 
     //! Destructor
     /*!
@@ -97,9 +170,16 @@ public:
     * @param void
     */
     void stop();
+    //! issue function
+    /*!
+    * Carries out a command, as the motion function of that command does.
+    * @param command Command to send or queue.
+    */
+    void issue(RobotCommand command);
     //! getPose function
     /*!
     * This function returns the current position and orientation of the robot.
+    * While the pose cache runs the pose may be up to its max age old.
     * @param void
     * @return the current position of the robot as a Pose object.
     */
@@ -124,4 +204,86 @@ public:
     * @return true if the disconnection is successful, false otherwise.
     */
     bool disconnectRobot();
+    //! startAsync function
+    /*!
+    * Starts a dispatcher thread; from then on motion functions only queue their
+    * command and return without console output.
+    * @return true if the dispatcher is running.
+    */
+    bool startAsync();
+    //! stopAsync function
+    /*!
+    * Issues the queued commands and goes back to sending commands directly.
+    */
+    void stopAsync();
+    //! isAsync function
+    /*!
+    * @return true while motion commands are queued.
+    */
+    bool isAsync() const;
+    //! getDispatcher function
+    /*!
+    * @return the dispatcher with its counters and latency histogram, or nullptr.
+    */
+    CommandDispatcher* getDispatcher();
+    //! startPoseCache function
+    /*!
+    * Starts a pose cache; from then on getPose() returns a pose at most maxAgeMicroseconds
+    * old without calling the robot API, and may be called from any thread.
+    * @param maxAgeMicroseconds Oldest pose getPose() returns.
+    * @param refreshMicroseconds Time between two background reads, e.g. half the max age.
+    * @return true if the refresher is running.
+    */
+    bool startPoseCache(int maxAgeMicroseconds, int refreshMicroseconds);
+    //! stopPoseCache function
+    /*!
+    * Stops the refresher and goes back to reading the robot on every getPose().
+    */
+    void stopPoseCache();
+    //! getPoseCache function
+    /*!
+    * @return the pose cache with its hit and miss counters, or nullptr.
+    */
+    PoseCache* getPoseCache();
+    //! setMotionSpeeds function
+    /*!
+    * Sets the speeds of the robot's primitives, which a twist is divided by.
+    * @param linearSpeed Speed of the move primitives (meters per second), positive.
+    * @param angularSpeed Speed of the rotate primitives (radians per second), positive.
+    */
+    void setMotionSpeeds(double linearSpeed, double angularSpeed);
+    //! setSliceHysteresis function
+    /*!
+    * @param seconds Time a slot may run past its share before tick() switches, 0 or more.
+    */
+    void setSliceHysteresis(double seconds);
+    //! setVelocity function
+    /*!
+    * Enters velocity mode with a body twist. A twist the primitives cannot reach is
+    * scaled down, keeping its direction; (0, 0, 0) stops the robot on the next tick().
+    * A twist with a NaN or infinite component is rejected and the previous one kept.
+    * @param vx Forward velocity (meters per second).
+    * @param vy Leftward velocity (meters per second).
+    * @param omega Counter-clockwise rate (radians per second).
+    */
+    void setVelocity(double vx, double vy, double omega);
+    //! clearVelocity function
+    /*!
+    * Leaves velocity mode; tick() does nothing until the next setVelocity(). The robot
+    * keeps running the primitive last sent, so call stop() to halt it.
+    */
+    void clearVelocity();
+    //! tick function
+    /*!
+    * Advances the time slicing by one control period and sends the primitive of the
+    * next slot if it changed. Does nothing outside velocity mode.
+    * @param seconds Control period, positive.
+    * @return the primitive running for the coming period.
+    */
+    RobotCommand tick(double seconds);
+    //! isVelocityMode function
+    /*!
+    * @return true after setVelocity().
+    */
+    bool isVelocityMode() const;
 };
@@ -0,0 +1,53 @@
+#pragma once
+/**
+ * @file   RobotInterface.h
+ * @date   October, 2026
+ * @brief  Header file for the RobotInterface class.
+ *
+ * This file contains the definition of the RobotInterface class, an abstract view of the
+ * robot API surface so that sensor and controller classes can run against FestoRobotAPI
+ * or against a local stand-in backend such as SimulatedRobot.
+ */
+
+#include "RobotPlatform.h"
+
+//! RobotInterface class
+/*!
+ * @brief Abstract robot API with the same surface as FestoRobotAPI.
+ *
+ * FestoRobotAPI is delivered as a prebuilt library and has no virtual functions, so it
+ * cannot be replaced directly. Classes that talk to the robot use a RobotInterface pointer
+ * instead; FestoRobotInterface forwards every call to a real FestoRobotAPI object.
+ */
+class RobotInterface {
+public:
+    //! Virtual destructor
+    virtual ~RobotInterface() {}
+
+    //! Connect to the robot.
+    virtual void connect() = 0;
+
+    //! Disconnect from the robot.
+    virtual void disconnect() = 0;
+
+    //! Move the robot in the given direction {FORWARD, BACKWARD, LEFT, RIGHT}.
+    virtual void move(DIRECTION direction) = 0;
+
+    //! Rotate the robot to the given side {LEFT, RIGHT}.
+    virtual void rotate(DIRECTION direction) = 0;
+
+    //! Stop the robot.
+    virtual void stop() = 0;
+
+    //! Distance in meters measured by IR sensor i (there are 9 sensors).
+    virtual double getIRRange(int i) = 0;
+
+    //! Position (meters) and heading angle of the robot.
+    virtual void getXYTh(double& X, double& Y, double& TH) = 0;
+
+    //! Copy the current lidar scan into ranges (getLidarRangeNumber() values, in meters).
+    virtual void getLidarRange(float* ranges) = 0;
+
+    //! Number of values in a lidar scan.
+    virtual int getLidarRangeNumber() = 0;
+};
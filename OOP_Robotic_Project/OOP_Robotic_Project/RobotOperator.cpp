@@ -0,0 +1,402 @@
+/**
+ * @file   RobotOperator.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the RobotOperator class.
+ */
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "RobotControler.h"
+#include "RobotOperator.h"
+
+using namespace std;
+
+static const int ALL_SECTORS = 4;
+
+/**
+ * @brief Parses a whole token as a finite number.
+ */
+static bool parseNumber(const string& token, double& value) {
+    char* end = nullptr;
+    errno = 0;
+    value = strtod(token.c_str(), &end);
+    return !token.empty() && *end == '\0' && errno == 0 && value == value && value - value == 0.0;
+}
+
+/**
+ * @brief Parses a direction name.
+ */
+static bool parseDirection(const string& token, DIRECTION& direction) {
+    if (token == "forward") {
+        direction = FORWARD;
+    }
+    else if (token == "backward") {
+        direction = BACKWARD;
+    }
+    else if (token == "left") {
+        direction = LEFT;
+    }
+    else if (token == "right") {
+        direction = RIGHT;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Returns an instruction with every operand zero.
+ */
+static OperatorInstruction makeInstruction(OperatorOp op, int line) {
+    OperatorInstruction instruction;
+    instruction.op = op;
+    instruction.slot = 0;
+    instruction.line = static_cast<uint16_t>(line < 65535 ? line : 65535);
+    instruction.arg = 0;
+    instruction.target = 0;
+    instruction.a = 0.0f;
+    instruction.b = 0.0f;
+    instruction.c = 0.0f;
+    instruction.d = 0.0f;
+    return instruction;
+}
+
+/**
+ * @brief Parameterized Constructor. The clock sleeps until run() is given another one.
+ */
+RobotOperator::RobotOperator(RobotControler* controler, RobotInterface* sensors) : ir(sensors) {
+    this->controler = controler;
+    this->sensors = sensors;
+    this->clock = [](double seconds) { sleepMilliseconds(static_cast<int>(seconds * 1000.0 + 0.5)); };
+    this->pollPeriod = DEFAULT_POLL_PERIOD;
+    this->pending = false;
+    this->executed = 0;
+    this->commands = 0;
+    this->polls = 0;
+    this->elapsed = 0.0;
+}
+
+void RobotOperator::setClock(function<void(double)> clock) {
+    this->clock = move(clock);
+}
+
+void RobotOperator::setPollPeriod(double seconds) {
+    if (seconds > 0.0) {
+        this->pollPeriod = seconds;
+    }
+}
+
+/**
+ * @brief Compiles a script line by line.
+ *
+ * Each repeat pushes its instruction on a stack; the matching end emits an OP_LOOP
+ * back to the first instruction of the body and patches the repeat to jump past it
+ * when the count is zero. A loop's counter is its nesting depth, since loops at the
+ * same depth are never active together, so MAX_NESTING counters cover any script.
+ */
+bool RobotOperator::compile(const string& script) {
+    vector<OperatorInstruction> code;
+    vector<int> open;
+    istringstream lines(script);
+    string text;
+    int line = 0;
+    auto fail = [this, &line](const string& reason) {
+        this->error = "line " + to_string(line) + ": " + reason;
+        cout << "Error: RobotOperator script " << this->error << endl;
+        return false;
+    };
+
+    while (getline(lines, text)) {
+        line++;
+        size_t comment = text.find('#');
+        if (comment != string::npos) {
+            text.erase(comment);
+        }
+        istringstream words(text);
+        vector<string> tokens;
+        string token;
+        while (words >> token) {
+            tokens.push_back(token);
+        }
+        if (tokens.empty()) {
+            continue;
+        }
+        const string& name = tokens[0];
+        size_t count = tokens.size();
+        double values[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+        if (name == "move" || name == "rotate") {
+            DIRECTION direction = FORWARD;
+            if (count < 2 || count > 3 || !parseDirection(tokens[1], direction)) {
+                return fail("expected " + name + (name == "move" ? " forward|backward|left|right" : " left|right") + " [seconds]");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_COMMAND, line);
+            if (name == "move") {
+                instruction.arg = direction == FORWARD ? COMMAND_MOVE_FORWARD : direction == BACKWARD ? COMMAND_MOVE_BACKWARD
+                    : direction == LEFT ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT;
+            }
+            else if (direction == LEFT || direction == RIGHT) {
+                instruction.arg = direction == LEFT ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT;
+            }
+            else {
+                return fail("rotate takes left or right");
+            }
+            code.push_back(instruction);
+            if (count == 3) {
+                if (!parseNumber(tokens[2], values[0]) || values[0] < 0.0) {
+                    return fail("duration must be a number of seconds");
+                }
+                OperatorInstruction wait = makeInstruction(OP_WAIT, line);
+                wait.a = static_cast<float>(values[0]);
+                code.push_back(wait);
+            }
+        }
+        else if (name == "stop") {
+            if (count != 1) {
+                return fail("stop takes no arguments");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_COMMAND, line);
+            instruction.arg = COMMAND_STOP;
+            code.push_back(instruction);
+        }
+        else if (name == "wait") {
+            if (count != 2 || !parseNumber(tokens[1], values[0]) || values[0] < 0.0) {
+                return fail("expected wait seconds");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_WAIT, line);
+            instruction.a = static_cast<float>(values[0]);
+            code.push_back(instruction);
+        }
+        else if (name == "wait_pose") {
+            values[2] = 0.05;
+            values[3] = DEFAULT_TIMEOUT;
+            bool valid = count >= 3 && count <= 5;
+            for (size_t i = 1; i < count && valid; i++) {
+                valid = parseNumber(tokens[i], values[i - 1]);
+            }
+            if (!valid || values[2] <= 0.0 || values[3] < 0.0) {
+                return fail("expected wait_pose x y [tolerance [timeout]]");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_WAIT_POSE, line);
+            instruction.a = static_cast<float>(values[0]);
+            instruction.b = static_cast<float>(values[1]);
+            instruction.c = static_cast<float>(values[2]);
+            instruction.d = static_cast<float>(values[3]);
+            code.push_back(instruction);
+        }
+        else if (name == "wait_clear") {
+            DIRECTION direction = FORWARD;
+            size_t first = count >= 2 && parseDirection(tokens[1], direction) ? 2 : 1;
+            values[1] = DEFAULT_TIMEOUT;
+            bool valid = count > first && count <= first + 2;
+            for (size_t i = first; i < count && valid; i++) {
+                valid = parseNumber(tokens[i], values[i - first]);
+            }
+            if (!valid || values[0] < 0.0 || values[1] < 0.0) {
+                return fail("expected wait_clear [forward|backward|left|right] distance [timeout]");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_WAIT_CLEAR, line);
+            instruction.arg = first == 2 ? direction : ALL_SECTORS;
+            instruction.a = static_cast<float>(values[0]);
+            instruction.d = static_cast<float>(values[1]);
+            code.push_back(instruction);
+        }
+        else if (name == "repeat") {
+            char* end = nullptr;
+            errno = 0;
+            long repeats = count == 2 ? strtol(tokens[1].c_str(), &end, 10) : -1;
+            if (count != 2 || *end != '\0' || errno != 0 || repeats < 0 || repeats > INT32_MAX) {
+                return fail("expected repeat count");
+            }
+            if (static_cast<int>(open.size()) == MAX_NESTING) {
+                return fail("repeat nested more than " + to_string(MAX_NESTING) + " deep");
+            }
+            OperatorInstruction instruction = makeInstruction(OP_REPEAT, line);
+            instruction.slot = static_cast<uint8_t>(open.size());
+            instruction.arg = static_cast<int32_t>(repeats);
+            open.push_back(static_cast<int>(code.size()));
+            code.push_back(instruction);
+        }
+        else if (name == "end") {
+            if (count != 1 || open.empty()) {
+                return fail("end without repeat");
+            }
+            int start = open.back();
+            open.pop_back();
+            OperatorInstruction instruction = makeInstruction(OP_LOOP, line);
+            instruction.slot = code[start].slot;
+            instruction.target = start + 1;
+            code.push_back(instruction);
+            code[start].target = static_cast<int32_t>(code.size());
+        }
+        else {
+            return fail("unknown command '" + name + "'");
+        }
+    }
+    if (!open.empty()) {
+        line = code[open.back()].line;
+        return fail("repeat without end");
+    }
+    code.push_back(makeInstruction(OP_HALT, line));
+
+    this->program.swap(code);
+    this->counters.assign(MAX_NESTING, 0);
+    this->error.clear();
+    return true;
+}
+
+/**
+ * @brief Reads a script file and compiles it.
+ */
+bool RobotOperator::load(const string& path) {
+    ifstream file(path);
+    if (!file) {
+        this->error = "cannot open " + path;
+        cout << "Error: RobotOperator " << this->error << "." << endl;
+        return false;
+    }
+    stringstream text;
+    text << file.rdbuf();
+    return compile(text.str());
+}
+
+/**
+ * @brief Sends a command through RobotControler::issue().
+ */
+void RobotOperator::send(RobotCommand command) {
+    this->controler->issue(command);
+    this->commands++;
+    this->pending |= this->controler->isAsync();
+}
+
+/**
+ * @brief Waits until the commands queued since the last flush reached the robot.
+ */
+void RobotOperator::flush() {
+    if (this->pending) {
+        this->controler->getDispatcher()->flush();
+        this->pending = false;
+    }
+}
+
+/**
+ * @brief Makes sure queued commands reached the robot, then lets time pass.
+ */
+void RobotOperator::advance(double seconds) {
+    flush();
+    this->clock(seconds);
+    this->elapsed += seconds;
+}
+
+/**
+ * @brief Checks the condition of a wait, reading the pose or the IR bank only.
+ */
+bool RobotOperator::conditionMet(const OperatorInstruction& instruction) {
+    this->polls++;
+    if (instruction.op == OP_WAIT_POSE) {
+        double x;
+        double y;
+        double th;
+        this->sensors->getXYTh(x, y, th);
+        double dx = x - instruction.a;
+        double dy = y - instruction.b;
+        return dx * dx + dy * dy <= static_cast<double>(instruction.c) * instruction.c;
+    }
+    this->ir.refresh();
+    float clearance = instruction.arg == ALL_SECTORS ? this->ir.minRange() : this->ir.sectorMin(static_cast<DIRECTION>(instruction.arg));
+    return clearance > instruction.a;
+}
+
+/**
+ * @brief Executes the program from the start.
+ *
+ * A wait on a condition checks it first and only then lets a poll period pass, so a
+ * condition that already holds costs no time. When a wait times out the robot is
+ * stopped and the line is reported in getError().
+ */
+OperatorStatus RobotOperator::run() {
+    this->executed = 0;
+    this->commands = 0;
+    this->polls = 0;
+    this->elapsed = 0.0;
+    this->pending = false;
+    if (this->program.empty() || this->controler == nullptr || this->sensors == nullptr) {
+        this->error = "no program loaded";
+        cout << "Error: RobotOperator has " << this->error << "." << endl;
+        return OPERATOR_NOT_READY;
+    }
+    const OperatorInstruction* code = this->program.data();
+    int32_t* counter = this->counters.data();
+    int pc = 0;
+    while (true) {
+        const OperatorInstruction& instruction = code[pc];
+        this->executed++;
+        switch (instruction.op) {
+        case OP_COMMAND:
+            send(static_cast<RobotCommand>(instruction.arg));
+            pc++;
+            break;
+        case OP_WAIT:
+            advance(instruction.a);
+            pc++;
+            break;
+        case OP_WAIT_POSE:
+        case OP_WAIT_CLEAR: {
+            double waited = 0.0;
+            while (!conditionMet(instruction)) {
+                if (waited >= instruction.d) {
+                    send(COMMAND_STOP);
+                    flush();
+                    this->error = "line " + to_string(instruction.line) + ": wait timed out";
+                    cout << "Error: RobotOperator " << this->error << "." << endl;
+                    return OPERATOR_TIMEOUT;
+                }
+                advance(this->pollPeriod);
+                waited += this->pollPeriod;
+            }
+            pc++;
+            break;
+        }
+        case OP_REPEAT:
+            counter[instruction.slot] = instruction.arg;
+            pc = instruction.arg > 0 ? pc + 1 : instruction.target;
+            break;
+        case OP_LOOP:
+            pc = --counter[instruction.slot] > 0 ? instruction.target : pc + 1;
+            break;
+        default:
+            flush();
+            this->error.clear();
+            return OPERATOR_DONE;
+        }
+    }
+}
+
+const vector<OperatorInstruction>& RobotOperator::getProgram() const {
+    return this->program;
+}
+
+const string& RobotOperator::getError() const {
+    return this->error;
+}
+
+unsigned long long RobotOperator::getExecutedCount() const {
+    return this->executed;
+}
+
+unsigned long long RobotOperator::getCommandCount() const {
+    return this->commands;
+}
+
+unsigned long long RobotOperator::getPollCount() const {
+    return this->polls;
+}
+
+double RobotOperator::getElapsed() const {
+    return this->elapsed;
+}
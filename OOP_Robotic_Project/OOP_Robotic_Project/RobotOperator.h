@@ -1 +1,211 @@
 #pragma once
+/**
+ * @file   RobotOperator.h
+ * @date   October, 2026
+ * @brief  Header file for the RobotOperator class.
+ *
+ * This file contains the definition of the RobotOperator class, which compiles a
+ * mission script into a flat instruction array once and runs it against a
+ * RobotControler.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "CommandDispatcher.h"
+#include "IRSensor.h"
+#include "RobotInterface.h"
+
+class RobotControler;
+
+//! OperatorOp enum
+/*!
+ * @brief Instruction codes of a compiled script.
+ */
+enum OperatorOp : uint8_t {
+    OP_COMMAND = 0,  /*!< Send the RobotCommand in arg. */
+    OP_WAIT,         /*!< Let a seconds pass. */
+    OP_WAIT_POSE,    /*!< Wait until the robot is within c meters of (a, b), at most d seconds. */
+    OP_WAIT_CLEAR,   /*!< Wait until the IR sector arg (4 for all sensors) reads more than a meters, at most d seconds. */
+    OP_REPEAT,       /*!< Load arg into loop counter slot; with a zero count jump to target. */
+    OP_LOOP,         /*!< Decrement loop counter slot and jump to target while it is positive. */
+    OP_HALT          /*!< End of the program. */
+};
+
+//! OperatorInstruction struct
+/*!
+ * @brief One compiled instruction; every instruction has the same 28-byte layout.
+ */
+struct OperatorInstruction {
+    OperatorOp op;     /*!< Instruction code. */
+    uint8_t slot;      /*!< Loop counter of OP_REPEAT and OP_LOOP. */
+    uint16_t line;     /*!< Script line, for error messages. */
+    int32_t arg;       /*!< Command, sector or repeat count. */
+    int32_t target;    /*!< Jump target of OP_REPEAT and OP_LOOP. */
+    float a;           /*!< Seconds, x or distance. */
+    float b;           /*!< y. */
+    float c;           /*!< Tolerance. */
+    float d;           /*!< Timeout of a wait on a condition (seconds). */
+};
+
+//! OperatorStatus enum
+/*!
+ * @brief Outcome of RobotOperator::run().
+ */
+enum OperatorStatus {
+    OPERATOR_DONE = 0,   /*!< The program ran to its end. */
+    OPERATOR_TIMEOUT,    /*!< A wait ran out of time; the robot was stopped. */
+    OPERATOR_NOT_READY   /*!< No program is loaded. */
+};
+
+//! RobotOperator class
+/*!
+ * @brief Runs compiled mission scripts on a robot.
+ *
+ * A script has one command per line; '#' starts a comment:
+ * - move forward|backward|left|right [seconds]
+ * - rotate left|right [seconds]
+ * - stop
+ * - wait seconds
+ * - wait_pose x y [tolerance [timeout]]
+ * - wait_clear [forward|backward|left|right] distance [timeout]
+ * - repeat count ... end, which may be nested
+ *
+ * A motion with a duration is the motion followed by a wait. compile() parses the
+ * script once into an array of fixed-size instructions with resolved jumps, so run()
+ * does no parsing, string handling or allocation however long the mission is.
+ *
+ * Time passes only through the clock, which by default sleeps; a simulated backend
+ * passes a clock that advances the simulation, and missions of hours then run in
+ * moments. Waits on a condition poll the sensors every poll period and read only what
+ * the condition needs: the pose for wait_pose, the IR bank for wait_clear.
+ *
+ * When the controller runs a CommandDispatcher (startAsync()), motion commands are
+ * queued and the interpreter goes straight on to the next instruction, so a run of
+ * commands is handed over as a batch and the first sensor check of a wait overlaps
+ * with the dispatcher thread sending the command. The queue is flushed only before the
+ * clock advances, since that is when the command must have reached the robot.
+ */
+class RobotOperator {
+public:
+    static constexpr double DEFAULT_POLL_PERIOD = 0.01; /*!< Seconds between two checks of a wait condition. */
+    static constexpr double DEFAULT_TIMEOUT = 60.0;     /*!< Longest wait on a condition when the script gives none. */
+    static const int MAX_NESTING = 16;                  /*!< Deepest repeat nesting. */
+
+private:
+    RobotControler* controler;                 /*!< Controller the commands are sent to. */
+    RobotInterface* sensors;                   /*!< Robot API the pose and IR ranges are read from. */
+    IRSensor ir;                               /*!< IR bank read by wait_clear. */
+    std::function<void(double)> clock;         /*!< Lets a number of seconds pass. */
+    double pollPeriod;                         /*!< Seconds between two checks of a wait condition. */
+    std::vector<OperatorInstruction> program;  /*!< Compiled script, ending with OP_HALT. */
+    std::vector<int32_t> counters;             /*!< Loop counters, one per repeat. */
+    std::string error;                         /*!< Message of the last failed compile() or run(). */
+    bool pending;                              /*!< Commands were queued since the last flush. */
+    unsigned long long executed;               /*!< Instructions executed by the last run(). */
+    unsigned long long commands;               /*!< Motion commands sent by the last run(). */
+    unsigned long long polls;                  /*!< Sensor checks made by the last run(). */
+    double elapsed;                            /*!< Clock seconds spent by the last run(). */
+
+    //! send function
+    /*!
+    * Sends a command through RobotControler::issue().
+    */
+    void send(RobotCommand command);
+
+    //! flush function
+    /*!
+    * Waits until the queued commands reached the robot.
+    */
+    void flush();
+
+    //! advance function
+    /*!
+    * Flushes queued commands and lets time pass.
+    */
+    void advance(double seconds);
+
+    //! conditionMet function
+    /*!
+    * Reads the sensors a wait instruction needs and checks its condition.
+    */
+    bool conditionMet(const OperatorInstruction& instruction);
+
+    RobotOperator(const RobotOperator&) = delete;
+    RobotOperator& operator=(const RobotOperator&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param controler Controller the commands are sent to; it must be connected before run().
+    * @param sensors Robot API the pose and IR ranges are read from.
+    */
+    RobotOperator(RobotControler* controler, RobotInterface* sensors);
+
+    //! setClock function
+    /*!
+    * @param clock Function that lets a number of seconds pass, e.g. SimulatedRobot::run.
+    */
+    void setClock(std::function<void(double)> clock);
+
+    //! setPollPeriod function
+    /*!
+    * @param seconds Time between two checks of a wait condition, positive.
+    */
+    void setPollPeriod(double seconds);
+
+    //! compile function
+    /*!
+    * Translates a script into instructions, replacing the loaded program.
+    * @return false, with the line and reason in getError(), if the script is not valid.
+    */
+    bool compile(const std::string& script);
+
+    //! load function
+    /*!
+    * Reads a script file and compiles it.
+    * @return false if the file cannot be read or the script is not valid.
+    */
+    bool load(const std::string& path);
+
+    //! run function
+    /*!
+    * Executes the loaded program from the start.
+    * @return OPERATOR_DONE, or why it stopped early.
+    */
+    OperatorStatus run();
+
+    //! getProgram function
+    /*!
+    * @return the compiled instructions, ending with OP_HALT.
+    */
+    const std::vector<OperatorInstruction>& getProgram() const;
+
+    //! getError function
+    const std::string& getError() const;
+
+    //! getExecutedCount function
+    /*!
+    * @return the instructions executed by the last run().
+    */
+    unsigned long long getExecutedCount() const;
+
+    //! getCommandCount function
+    /*!
+    * @return the motion commands sent by the last run().
+    */
+    unsigned long long getCommandCount() const;
+
+    //! getPollCount function
+    /*!
+    * @return the sensor checks made by the last run().
+    */
+    unsigned long long getPollCount() const;
+
+    //! getElapsed function
+    /*!
+    * @return the clock seconds the last run() let pass.
+    */
+    double getElapsed() const;
+};
@@ -0,0 +1,43 @@
+#pragma once
+/**
+ * @file   RobotPlatform.h
+ * @date   October, 2026
+ * @brief  Platform layer between the project and the FestoRobotAPI package.
+ *
+ * FestoRobotAPI.h includes <windows.h> and <process.h> and its library is only built
+ * for Windows, so it is included here and nowhere else. On Windows the real API is
+ * available and ROBOT_USE_FESTO_API is defined; elsewhere, or when
+ * ROBOT_SIMULATION_ONLY is defined, this header declares the same DIRECTION values
+ * and the robot is reached through a simulated RobotInterface backend instead.
+ */
+
+#if defined(_WIN32) && !defined(ROBOT_SIMULATION_ONLY)
+#define ROBOT_USE_FESTO_API
+#endif
+
+#ifdef ROBOT_USE_FESTO_API
+#include "../../oop_project/Project_Packet/FestoRobotAPI.h"
+#else
+//! DIRECTION enum
+/*!
+ * @brief Motion directions, with the values FestoRobotAPI.h gives them.
+ */
+enum DIRECTION {
+    FORWARD = 0,
+    BACKWARD,
+    LEFT,
+    RIGHT
+};
+#endif
+
+#include <chrono>
+#include <thread>
+
+//! sleepMilliseconds function
+/*!
+* Portable replacement for the Windows Sleep() call.
+* @param milliseconds Time to sleep.
+*/
+inline void sleepMilliseconds(int milliseconds) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
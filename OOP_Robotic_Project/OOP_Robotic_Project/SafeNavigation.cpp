@@ -0,0 +1,259 @@
+/**
+ * @file   SafeNavigation.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the SafeNavigation class.
+ */
+
+#include <cmath>
+#include "SafeNavigation.h"
+#include "RobotControler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SAFENAVIGATION_SSE
+#include <emmintrin.h>
+#endif
+
+static const double PI = 3.14159265358979323846;
+
+/** Angle of each move direction from the heading, indexed by DIRECTION. */
+static const double DIRECTION_ANGLE[SafeNavigation::DIRECTION_COUNT] = { 0.0, PI, PI / 2.0, -PI / 2.0 };
+
+/** Move command of each direction, indexed by DIRECTION. */
+static const RobotCommand MOVE_COMMAND[SafeNavigation::DIRECTION_COUNT] = {
+    COMMAND_MOVE_FORWARD, COMMAND_MOVE_BACKWARD, COMMAND_MOVE_LEFT, COMMAND_MOVE_RIGHT
+};
+
+/** The two directions at right angles to each direction, indexed by DIRECTION. */
+static const DIRECTION SIDEWAYS[SafeNavigation::DIRECTION_COUNT][2] = {
+    { LEFT, RIGHT }, { LEFT, RIGHT }, { FORWARD, BACKWARD }, { FORWARD, BACKWARD }
+};
+
+/**
+ * @brief Wraps an angle to [-pi, pi).
+ */
+static double wrapAngle(double angle) {
+    angle = fmod(angle + PI, 2.0 * PI);
+    if (angle < 0) {
+        angle += 2.0 * PI;
+    }
+    return angle - PI;
+}
+
+/**
+ * @brief Returns true if any valid range of beams begin..end-1 is below its limit.
+ *
+ * Every beam of the run is compared, without an early exit, so the time only depends
+ * on the length of the run.
+ */
+static bool anyInside(const float* ranges, const float* limits, int begin, int end) {
+    int i = begin;
+    bool hit = false;
+#if defined(SAFENAVIGATION_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    __m128 hits = zero;
+    for (; i + 4 <= end; i += 4) {
+        __m128 r = _mm_loadu_ps(ranges + i);
+        hits = _mm_or_ps(hits, _mm_and_ps(_mm_cmpgt_ps(r, zero), _mm_cmplt_ps(r, _mm_loadu_ps(limits + i))));
+    }
+    hit = _mm_movemask_ps(hits) != 0;
+#endif
+    for (; i < end; i++) {
+        hit |= ranges[i] > 0.0f && ranges[i] < limits[i];
+    }
+    return hit;
+}
+
+/**
+ * @brief Parameterized Constructor.
+ * Starts without lidar geometry, so only the IR sensors are checked until
+ * setLidarGeometry() is called.
+ */
+SafeNavigation::SafeNavigation(RobotControler* controler, double robotRadius, double margin, double stopDistance)
+    : controler(controler), ir(nullptr), robotRadius(robotRadius > 0 ? robotRadius : 0.0), margin(margin > 0 ? margin : 0.0),
+      stopDistance(stopDistance > 0 ? stopDistance : 0.0), irThreshold(0.2f), substitution(false), beamCount(0),
+      lidarUsed(false), lastSent(COMMAND_STOP), sentAny(false), ticks(0), vetoed(0), substituted(0) {
+    this->irState = IREvaluation{ IRSensor::OUT_OF_RANGE, { IRSensor::OUT_OF_RANGE, IRSensor::OUT_OF_RANGE, IRSensor::OUT_OF_RANGE, IRSensor::OUT_OF_RANGE }, false };
+    for (int d = 0; d < DIRECTION_COUNT; d++) {
+        this->runCount[d] = 0;
+        this->blocked[d] = false;
+    }
+}
+
+/**
+ * @brief Precomputes the beam sets and thresholds of every direction.
+ */
+void SafeNavigation::setLidarGeometry(const LidarGeometry& geometry, int count) {
+    this->beamCount = count > 0 ? count : 0;
+    buildEnvelopes(geometry);
+}
+
+/**
+ * @brief Computes, for every direction, the range below which each beam ends inside the
+ * stopping corridor, and the runs of beams where that range is not 0.
+ *
+ * A beam at angle phi from the direction ends at (r cos phi, r sin phi) in corridor
+ * coordinates, which is inside while r cos phi < length and r |sin phi| < halfWidth.
+ * Beams at 90 degrees or more from the direction move away from the corridor and get
+ * no threshold. If a geometry sweeps more than a full turn and a direction gets more
+ * than MAX_RUNS runs, the last run is stretched over the gaps, whose thresholds are 0.
+ */
+void SafeNavigation::buildEnvelopes(const LidarGeometry& geometry) {
+    double length = this->robotRadius + this->stopDistance;
+    double halfWidth = this->robotRadius + this->margin;
+    for (int d = 0; d < DIRECTION_COUNT; d++) {
+        std::vector<float>& limit = this->thresholds[d];
+        limit.assign(this->beamCount, 0.0f);
+        this->runCount[d] = 0;
+        bool inRun = false;
+        for (int i = 0; i < this->beamCount; i++) {
+            double phi = wrapAngle(geometry.startAngle + i * geometry.angleIncrement - DIRECTION_ANGLE[d]);
+            double along = cos(phi);
+            bool ahead = along > 1e-9;
+            if (ahead) {
+                double across = fabs(sin(phi));
+                double reach = length / along;
+                if (across > 1e-9 && halfWidth / across < reach) {
+                    reach = halfWidth / across;
+                }
+                limit[i] = static_cast<float>(reach);
+                if (!inRun) {
+                    if (this->runCount[d] < MAX_RUNS) {
+                        this->runs[d][this->runCount[d]++].begin = i;
+                    }
+                    inRun = true;
+                }
+                this->runs[d][this->runCount[d] - 1].end = i + 1;
+            }
+            else {
+                inRun = false;
+            }
+        }
+    }
+}
+
+void SafeNavigation::setIRThreshold(float threshold) {
+    this->irThreshold = threshold > 0 ? threshold : 0.0f;
+}
+
+void SafeNavigation::setSubstitution(bool enabled) {
+    this->substitution = enabled;
+}
+
+/**
+ * @brief Loads new ranges and decides which directions are blocked.
+ *
+ * The IR bank gives all four sector minimums in one SIMD evaluation; each direction
+ * then adds the compares of its lidar runs.
+ */
+void SafeNavigation::update(const double* irRanges, const float* lidarRanges, int lidarCount) {
+    this->ir.load(irRanges);
+    this->ir.evaluate(this->irThreshold, this->irState);
+    this->lidarUsed = lidarRanges != nullptr && this->beamCount > 0 && lidarCount == this->beamCount;
+    for (int d = 0; d < DIRECTION_COUNT; d++) {
+        bool hit = this->irState.sectorMin[d] < this->irThreshold;
+        if (this->lidarUsed) {
+            const float* limit = this->thresholds[d].data();
+            for (int r = 0; r < this->runCount[d]; r++) {
+                hit |= anyInside(lidarRanges, limit, this->runs[d][r].begin, this->runs[d][r].end);
+            }
+        }
+        this->blocked[d] = hit;
+    }
+}
+
+/**
+ * @brief Loads the IR and lidar ranges of a sensor snapshot.
+ */
+void SafeNavigation::update(const SensorSnapshot& snapshot) {
+    update(snapshot.ir, snapshot.lidar, snapshot.lidarCount);
+}
+
+bool SafeNavigation::isBlocked(DIRECTION direction) const {
+    return this->blocked[direction];
+}
+
+/**
+ * @brief Returns the command that is safe to run instead of requested.
+ *
+ * With substitution on, a blocked move is replaced by the free perpendicular direction
+ * with the larger IR sector minimum; without a free one, or with substitution off, the
+ * robot stops.
+ */
+RobotCommand SafeNavigation::filter(RobotCommand requested) {
+    if (requested > COMMAND_MOVE_RIGHT) {
+        return requested;
+    }
+    DIRECTION direction = static_cast<DIRECTION>(requested - COMMAND_MOVE_FORWARD);
+    if (!this->blocked[direction]) {
+        return requested;
+    }
+    if (this->substitution) {
+        DIRECTION a = SIDEWAYS[direction][0];
+        DIRECTION b = SIDEWAYS[direction][1];
+        bool freeA = !this->blocked[a];
+        bool freeB = !this->blocked[b];
+        if (freeA || freeB) {
+            DIRECTION side = freeA && (!freeB || this->irState.sectorMin[a] >= this->irState.sectorMin[b]) ? a : b;
+            this->substituted++;
+            return MOVE_COMMAND[side];
+        }
+    }
+    this->vetoed++;
+    return COMMAND_STOP;
+}
+
+/**
+ * @brief Filters a command and sends the result if it differs from the last one sent.
+ * @return the command that is now running.
+ */
+RobotCommand SafeNavigation::tick(RobotCommand requested) {
+    this->ticks++;
+    RobotCommand command = filter(requested);
+    if (!this->sentAny || command != this->lastSent) {
+        send(command);
+        this->lastSent = command;
+        this->sentAny = true;
+    }
+    return command;
+}
+
+RobotCommand SafeNavigation::move(DIRECTION direction) {
+    return tick(MOVE_COMMAND[direction]);
+}
+
+/**
+ * @brief Sends a command through RobotControler::issue().
+ */
+void SafeNavigation::send(RobotCommand command) {
+    if (this->controler == nullptr) {
+        return;
+    }
+    this->controler->issue(command);
+}
+
+/**
+ * @brief Returns the beam runs of a direction.
+ */
+const SafeNavigation::BeamRun* SafeNavigation::getRuns(DIRECTION direction, int& count) const {
+    count = this->runCount[direction];
+    return this->runs[direction];
+}
+
+float SafeNavigation::getThreshold(DIRECTION direction, int beam) const {
+    if (beam < 0 || beam >= this->beamCount) {
+        return 0.0f;
+    }
+    return this->thresholds[direction][beam];
+}
+
+unsigned long long SafeNavigation::getTickCount() const {
+    return this->ticks;
+}
+
+unsigned long long SafeNavigation::getVetoCount() const {
+    return this->vetoed;
+}
+
+unsigned long long SafeNavigation::getSubstitutionCount() const {
+    return this->substituted;
+}
@@ -1 +1,186 @@
 #pragma once
+/**
+ * @file   SafeNavigation.h
+ * @date   October, 2026
+ * @brief  Header file for the SafeNavigation class.
+ *
+ * This file contains the definition of the SafeNavigation class, a reactive safety layer
+ * that checks every motion command against the IR and lidar ranges before it reaches
+ * the robot.
+ */
+
+#include <vector>
+#include "CommandDispatcher.h"
+#include "IRSensor.h"
+#include "LidarSensor.h"
+#include "SensorPipeline.h"
+
+class RobotControler;
+
+//! SafeNavigation class
+/*!
+ * @brief Vetoes or replaces moves that would drive the robot into an obstacle.
+ *
+ * Each move direction has a safety envelope: the corridor the robot sweeps while it
+ * stops, robotRadius + stopDistance long and robotRadius + margin to each side of the
+ * robot center. A lidar beam at angle phi from the move direction reaches into the
+ * corridor if its range is below min(length / cos phi, halfWidth / |sin phi|), so
+ * setLidarGeometry() stores that threshold for every beam and, per direction, the one
+ * or two runs of beams that point into the corridor. An IR sector of the direction
+ * below irThreshold also blocks it.
+ *
+ * update() loads a new set of ranges and decides for all four directions at once with
+ * a few vector compares per run, so the per-tick cost is fixed by the scan size and
+ * does not depend on the command or on what is seen. Readings that are zero, negative
+ * or NaN are ignored, and a scan whose size does not match the geometry is not used.
+ *
+ * tick() then filters the requested command. A blocked move becomes a stop or, with
+ * substitution on, a sideways move to whichever free perpendicular direction has the
+ * most IR clearance. Turns and stops always pass because the robot is round. The
+ * filtered command is sent to the RobotControler only when it differs from the last
+ * one sent, so a move that becomes blocked while the robot is driving is stopped on
+ * the next tick.
+ */
+class SafeNavigation {
+public:
+    static const int DIRECTION_COUNT = 4; /*!< Move directions, indexed by DIRECTION. */
+    static const int MAX_RUNS = 2;        /*!< Beam runs per direction; a half circle wraps at most once. */
+
+    //! BeamRun struct
+    /*!
+     * @brief Beams begin..end-1 of a scan.
+     */
+    struct BeamRun {
+        int begin; /*!< First beam. */
+        int end;   /*!< One past the last beam. */
+    };
+
+private:
+    RobotControler* controler;     /*!< Controller the filtered commands are sent to. */
+    IRSensor ir;                   /*!< IR bank loaded from the last update(). */
+    IREvaluation irState;          /*!< Sector minimums of the last update(). */
+    double robotRadius;            /*!< Radius of the robot (meters). */
+    double margin;                 /*!< Extra clearance beside the robot (meters). */
+    double stopDistance;           /*!< Distance needed to stop, ahead of the robot (meters). */
+    float irThreshold;             /*!< IR range below which a sector blocks its direction (meters). */
+    bool substitution;             /*!< Replace a blocked move by a free sideways move. */
+    int beamCount;                 /*!< Beams per scan of the configured geometry, 0 for none. */
+    std::vector<float> thresholds[DIRECTION_COUNT]; /*!< Per-beam limit of each direction, 0 outside its runs. */
+    BeamRun runs[DIRECTION_COUNT][MAX_RUNS]; /*!< Beams that point into each corridor. */
+    int runCount[DIRECTION_COUNT]; /*!< Used entries of runs. */
+    bool blocked[DIRECTION_COUNT]; /*!< Decision of the last update() per direction. */
+    bool lidarUsed;                /*!< The last update() checked a lidar scan. */
+    RobotCommand lastSent;         /*!< Last command sent to the controller. */
+    bool sentAny;                  /*!< A command has been sent. */
+    unsigned long long ticks;      /*!< Calls to tick(). */
+    unsigned long long vetoed;     /*!< Moves turned into a stop. */
+    unsigned long long substituted; /*!< Moves replaced by a sideways move. */
+
+    //! buildEnvelopes function
+    /*!
+    * Computes the beam thresholds and runs of every direction.
+    */
+    void buildEnvelopes(const LidarGeometry& geometry);
+
+    //! send function
+    /*!
+    * Sends a command through RobotControler::issue().
+    */
+    void send(RobotCommand command);
+
+    SafeNavigation(const SafeNavigation&) = delete;
+    SafeNavigation& operator=(const SafeNavigation&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param controler Controller the filtered commands are sent to, may be nullptr to only decide.
+    * @param robotRadius Radius of the robot (meters).
+    * @param margin Extra clearance beside the robot (meters).
+    * @param stopDistance Distance needed to stop (meters).
+    */
+    SafeNavigation(RobotControler* controler, double robotRadius = 0.25, double margin = 0.05, double stopDistance = 0.3);
+
+    //! setLidarGeometry function
+    /*!
+    * Precomputes the beam sets and thresholds of every direction.
+    * @param geometry Beam directions of the scans passed to update().
+    * @param count Beams per scan, 0 to use the IR sensors only.
+    */
+    void setLidarGeometry(const LidarGeometry& geometry, int count);
+
+    //! setIRThreshold function
+    /*!
+    * @param threshold IR range below which a sector blocks its direction (meters).
+    */
+    void setIRThreshold(float threshold);
+
+    //! setSubstitution function
+    /*!
+    * @param enabled Replace a blocked move by a free sideways move instead of stopping.
+    */
+    void setSubstitution(bool enabled);
+
+    //! update function
+    /*!
+    * Loads new ranges and decides which directions are blocked.
+    * @param irRanges IRSensor::SENSOR_COUNT IR ranges (meters).
+    * @param lidarRanges Lidar ranges (meters), may be nullptr.
+    * @param lidarCount Number of lidar ranges.
+    */
+    void update(const double* irRanges, const float* lidarRanges, int lidarCount);
+
+    //! update function
+    /*!
+    * Loads the IR and lidar ranges of a sensor snapshot.
+    */
+    void update(const SensorSnapshot& snapshot);
+
+    //! isBlocked function
+    /*!
+    * @return true if the last update() found an obstacle in the envelope of the direction.
+    */
+    bool isBlocked(DIRECTION direction) const;
+
+    //! filter function
+    /*!
+    * @return the command that is safe to run instead of requested, given the last update().
+    */
+    RobotCommand filter(RobotCommand requested);
+
+    //! tick function
+    /*!
+    * Filters a command and sends the result to the controller if it changed.
+    * @return the command that is now running.
+    */
+    RobotCommand tick(RobotCommand requested);
+
+    //! move function
+    /*!
+    * Same as tick() with the move command of a direction.
+    */
+    RobotCommand move(DIRECTION direction);
+
+    //! getRuns function
+    /*!
+    * @param direction Move direction.
+    * @param count Receives the number of runs.
+    * @return the beam runs that point into the envelope of the direction.
+    */
+    const BeamRun* getRuns(DIRECTION direction, int& count) const;
+
+    //! getThreshold function
+    /*!
+    * @return the range below which beam blocks direction, 0 if it never does.
+    */
+    float getThreshold(DIRECTION direction, int beam) const;
+
+    //! getTickCount function
+    unsigned long long getTickCount() const;
+
+    //! getVetoCount function
+    unsigned long long getVetoCount() const;
+
+    //! getSubstitutionCount function
+    unsigned long long getSubstitutionCount() const;
+};
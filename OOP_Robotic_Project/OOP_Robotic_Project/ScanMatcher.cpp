@@ -0,0 +1,457 @@
+/**
+ * @file   ScanMatcher.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the ScanMatcher class.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include "ScanMatcher.h"
+
+#if defined(__AVX__)
+#define SCANMATCHER_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCANMATCHER_SSE
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+static const int MAX_CELLS = 1 << 20;  // grid cells before the cell size is doubled
+static const int SUM_COUNT = 10;       // H00 H01 H02 H11 H12 H22 g0 g1 g2 r^2
+
+#if defined(SCANMATCHER_AVX)
+typedef __m256d Vec;
+static const int LANES = 4;
+static inline Vec vzero() { return _mm256_setzero_pd(); }
+static inline Vec vloadu(const double* p) { return _mm256_loadu_pd(p); }
+static inline Vec vadd(Vec a, Vec b) { return _mm256_add_pd(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm256_sub_pd(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm256_mul_pd(a, b); }
+static inline double vsum(Vec v) {
+    __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+#elif defined(SCANMATCHER_SSE)
+typedef __m128d Vec;
+static const int LANES = 2;
+static inline Vec vzero() { return _mm_setzero_pd(); }
+static inline Vec vloadu(const double* p) { return _mm_loadu_pd(p); }
+static inline Vec vadd(Vec a, Vec b) { return _mm_add_pd(a, b); }
+static inline Vec vsub(Vec a, Vec b) { return _mm_sub_pd(a, b); }
+static inline Vec vmul(Vec a, Vec b) { return _mm_mul_pd(a, b); }
+static inline double vsum(Vec v) {
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+}
+#else
+static const int LANES = 1;
+#endif
+
+/**
+ * @brief Sums the point-to-line normal equations over count packed pairs.
+ *
+ * For a pair with moved point p, reference point q and normal n, the residual is
+ * r = n . (p - q) and its gradient with respect to (x, y, th) is
+ * J = (nx, ny, nx * -py + ny * px). sums receives the upper triangle of J^T J, then
+ * J^T r, then the sum of r^2. count is a multiple of LANES; padding pairs have a zero
+ * normal and add nothing.
+ */
+static void accumulate(const vector<double>* pairs, int count, double sums[SUM_COUNT]) {
+    const double* px = pairs[0].data();
+    const double* py = pairs[1].data();
+    const double* qx = pairs[2].data();
+    const double* qy = pairs[3].data();
+    const double* nx = pairs[4].data();
+    const double* ny = pairs[5].data();
+#if defined(SCANMATCHER_AVX) || defined(SCANMATCHER_SSE)
+    Vec acc[SUM_COUNT];
+    for (int k = 0; k < SUM_COUNT; k++) {
+        acc[k] = vzero();
+    }
+    for (int i = 0; i < count; i += LANES) {
+        Vec vpx = vloadu(px + i);
+        Vec vpy = vloadu(py + i);
+        Vec vnx = vloadu(nx + i);
+        Vec vny = vloadu(ny + i);
+        Vec r = vadd(vmul(vnx, vsub(vpx, vloadu(qx + i))), vmul(vny, vsub(vpy, vloadu(qy + i))));
+        Vec j = vsub(vmul(vny, vpx), vmul(vnx, vpy));
+        acc[0] = vadd(acc[0], vmul(vnx, vnx));
+        acc[1] = vadd(acc[1], vmul(vnx, vny));
+        acc[2] = vadd(acc[2], vmul(vnx, j));
+        acc[3] = vadd(acc[3], vmul(vny, vny));
+        acc[4] = vadd(acc[4], vmul(vny, j));
+        acc[5] = vadd(acc[5], vmul(j, j));
+        acc[6] = vadd(acc[6], vmul(vnx, r));
+        acc[7] = vadd(acc[7], vmul(vny, r));
+        acc[8] = vadd(acc[8], vmul(j, r));
+        acc[9] = vadd(acc[9], vmul(r, r));
+    }
+    for (int k = 0; k < SUM_COUNT; k++) {
+        sums[k] = vsum(acc[k]);
+    }
+#else
+    for (int k = 0; k < SUM_COUNT; k++) {
+        sums[k] = 0.0;
+    }
+    for (int i = 0; i < count; i++) {
+        double r = nx[i] * (px[i] - qx[i]) + ny[i] * (py[i] - qy[i]);
+        double j = ny[i] * px[i] - nx[i] * py[i];
+        sums[0] += nx[i] * nx[i];
+        sums[1] += nx[i] * ny[i];
+        sums[2] += nx[i] * j;
+        sums[3] += ny[i] * ny[i];
+        sums[4] += ny[i] * j;
+        sums[5] += j * j;
+        sums[6] += nx[i] * r;
+        sums[7] += ny[i] * r;
+        sums[8] += j * r;
+        sums[9] += r * r;
+    }
+#endif
+}
+
+/**
+ * @brief Parameterized Constructor. The matcher has no geometry and no reference yet.
+ */
+ScanMatcher::ScanMatcher(double maxDistance, int maxIterations, int minMatches)
+    : maxDistance(maxDistance > 0 ? maxDistance : 0.3), maxIterations(max(maxIterations, 1)),
+      minMatches(max(minMatches, 3)), beamCount(0), maxRange(0.0), gridX(0.0), gridY(0.0),
+      cellSize(this->maxDistance), gridWidth(0), gridHeight(0), hasPose(false), hasReference(false), matchCount(0),
+      iterationCount(0), residual(0.0), failures(0) {
+}
+
+/**
+ * @brief Computes the cosine and sine of every beam angle.
+ */
+void ScanMatcher::setLidarGeometry(const LidarGeometry& geometry, int count) {
+    this->beamCount = max(count, 0);
+    this->maxRange = geometry.maxRange;
+    this->beamCos.resize(this->beamCount);
+    this->beamSin.resize(this->beamCount);
+    for (int i = 0; i < this->beamCount; i++) {
+        double angle = geometry.startAngle + i * geometry.angleIncrement;
+        this->beamCos[i] = cos(angle);
+        this->beamSin[i] = sin(angle);
+    }
+}
+
+/**
+ * @brief Converts the ranges that hit something to points; zero, negative, NaN and
+ * maximum-range readings are skipped.
+ */
+void ScanMatcher::toPoints(const float* ranges, PointCloud& cloud) const {
+    cloud.clear();
+    cloud.reserve(this->beamCount);
+    for (int i = 0; i < this->beamCount; i++) {
+        double range = ranges[i];
+        if (range > 0.0 && range < this->maxRange) {
+            cloud.append(range * this->beamCos[i], range * this->beamSin[i]);
+        }
+    }
+}
+
+void ScanMatcher::setReference(const PointCloud& cloud) {
+    this->reference.copyFrom(cloud);
+    buildReference();
+}
+
+/**
+ * @brief Computes the normals and the grid of the reference points.
+ *
+ * The normal of a point is perpendicular to the line through its neighbors in scan
+ * order, or through the point and its one neighbor; a neighbor counts if it is within
+ * maxDistance. Points without a neighbor, such as lone returns, get no normal and are
+ * never paired. The grid is a counting sort of the points by cell.
+ */
+void ScanMatcher::buildReference() {
+    int count = this->reference.size();
+    const double* xs = this->reference.getXs();
+    const double* ys = this->reference.getYs();
+    double span2 = this->maxDistance * this->maxDistance;
+    this->normalX.assign(count, 0.0);
+    this->normalY.assign(count, 0.0);
+    for (int i = 0; i < count; i++) {
+        bool hasPrevious = i > 0 && (xs[i] - xs[i - 1]) * (xs[i] - xs[i - 1]) + (ys[i] - ys[i - 1]) * (ys[i] - ys[i - 1]) < span2;
+        bool hasNext = i + 1 < count && (xs[i + 1] - xs[i]) * (xs[i + 1] - xs[i]) + (ys[i + 1] - ys[i]) * (ys[i + 1] - ys[i]) < span2;
+        if (!hasPrevious && !hasNext) {
+            continue;
+        }
+        int a = hasPrevious ? i - 1 : i;
+        int b = hasNext ? i + 1 : i;
+        double dx = xs[b] - xs[a];
+        double dy = ys[b] - ys[a];
+        double length = sqrt(dx * dx + dy * dy);
+        if (length > 0.0) {
+            this->normalX[i] = -dy / length;
+            this->normalY[i] = dx / length;
+        }
+    }
+
+    this->gridWidth = 0;
+    this->gridHeight = 0;
+    this->cellStart.assign(1, 0);
+    this->cellItems.clear();
+    if (count == 0) {
+        return;
+    }
+    double minX = *min_element(xs, xs + count);
+    double maxX = *max_element(xs, xs + count);
+    double minY = *min_element(ys, ys + count);
+    double maxY = *max_element(ys, ys + count);
+    this->cellSize = this->maxDistance;
+    while ((maxX - minX) / this->cellSize * ((maxY - minY) / this->cellSize) > MAX_CELLS) {
+        this->cellSize *= 2.0;
+    }
+    this->gridX = minX;
+    this->gridY = minY;
+    this->gridWidth = static_cast<int>((maxX - minX) / this->cellSize) + 1;
+    this->gridHeight = static_cast<int>((maxY - minY) / this->cellSize) + 1;
+
+    int cells = this->gridWidth * this->gridHeight;
+    vector<int> cellOf(count);
+    this->cellStart.assign(cells + 1, 0);
+    for (int i = 0; i < count; i++) {
+        int cx = min(static_cast<int>((xs[i] - this->gridX) / this->cellSize), this->gridWidth - 1);
+        int cy = min(static_cast<int>((ys[i] - this->gridY) / this->cellSize), this->gridHeight - 1);
+        cellOf[i] = cy * this->gridWidth + cx;
+        this->cellStart[cellOf[i] + 1]++;
+    }
+    for (int c = 0; c < cells; c++) {
+        this->cellStart[c + 1] += this->cellStart[c];
+    }
+    this->cellItems.resize(count);
+    vector<int> fill(this->cellStart.begin(), this->cellStart.end() - 1);
+    for (int i = 0; i < count; i++) {
+        this->cellItems[fill[cellOf[i]]++] = i;
+    }
+}
+
+/**
+ * @brief Returns the nearest reference point within maxDistance, or -1.
+ *
+ * Cells are at least maxDistance wide, so only the cell of (x, y) and its eight
+ * neighbors can hold such a point. The cell of (x, y) is searched first, and a
+ * neighbor is skipped when its nearest edge is farther than the best point so far,
+ * which in a dense scan leaves most neighbors out.
+ */
+int ScanMatcher::findNearest(double x, double y) const {
+    if (this->gridWidth == 0) {
+        return -1;
+    }
+    double fx = floor((x - this->gridX) / this->cellSize);
+    double fy = floor((y - this->gridY) / this->cellSize);
+    if (fx < -1.0 || fy < -1.0 || fx > this->gridWidth || fy > this->gridHeight) {
+        return -1;
+    }
+    static const int ORDER[9][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 }, { -1, -1 }, { 1, -1 }, { -1, 1 }, { 1, 1 } };
+    int cx = static_cast<int>(fx);
+    int cy = static_cast<int>(fy);
+    const double* xs = this->reference.getXs();
+    const double* ys = this->reference.getYs();
+    double best = this->maxDistance * this->maxDistance;
+    int nearest = -1;
+    for (int n = 0; n < 9; n++) {
+        int gx = cx + ORDER[n][0];
+        int gy = cy + ORDER[n][1];
+        if (gx < 0 || gy < 0 || gx >= this->gridWidth || gy >= this->gridHeight) {
+            continue;
+        }
+        double left = this->gridX + gx * this->cellSize;
+        double bottom = this->gridY + gy * this->cellSize;
+        double ex = max(max(left - x, x - left - this->cellSize), 0.0);
+        double ey = max(max(bottom - y, y - bottom - this->cellSize), 0.0);
+        if (ex * ex + ey * ey >= best) {
+            continue;
+        }
+        int cell = gy * this->gridWidth + gx;
+        for (int k = this->cellStart[cell]; k < this->cellStart[cell + 1]; k++) {
+            int i = this->cellItems[k];
+            double d = (xs[i] - x) * (xs[i] - x) + (ys[i] - y) * (ys[i] - y);
+            if (d < best) {
+                best = d;
+                nearest = i;
+            }
+        }
+    }
+    return nearest;
+}
+
+/**
+ * @brief Pairs every moved point with its nearest reference point, if that point has a
+ * normal, and pads the pairs with zeros to a multiple of LANES.
+ */
+int ScanMatcher::pairPoints() {
+    int count = this->moved.size();
+    int padded = (count + LANES - 1) / LANES * LANES;
+    for (int k = 0; k < 6; k++) {
+        if (static_cast<int>(this->pairs[k].size()) < padded + LANES) {
+            this->pairs[k].resize(padded + LANES);
+        }
+    }
+    const double* xs = this->moved.getXs();
+    const double* ys = this->moved.getYs();
+    const double* refX = this->reference.getXs();
+    const double* refY = this->reference.getYs();
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        int j = findNearest(xs[i], ys[i]);
+        if (j < 0 || (this->normalX[j] == 0.0 && this->normalY[j] == 0.0)) {
+            continue;
+        }
+        this->pairs[0][n] = xs[i];
+        this->pairs[1][n] = ys[i];
+        this->pairs[2][n] = refX[j];
+        this->pairs[3][n] = refY[j];
+        this->pairs[4][n] = this->normalX[j];
+        this->pairs[5][n] = this->normalY[j];
+        n++;
+    }
+    for (int i = n; i % LANES != 0; i++) {
+        for (int k = 0; k < 6; k++) {
+            this->pairs[k][i] = 0.0;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Aligns a scan with the reference scan by Gauss-Newton steps.
+ *
+ * A step (dx, dy, dth) turns the moved points by dth around the reference origin and
+ * shifts them by (dx, dy), so the estimate becomes (R(dth) t + d, th + dth). A small
+ * multiple of the identity is added to J^T J, which keeps the step finite along a
+ * direction the scans do not constrain, such as the axis of a corridor; the estimate
+ * then stays at the guess along that direction. On failure estimate is unchanged.
+ */
+bool ScanMatcher::match(const PointCloud& source, Pose& estimate) {
+    this->iterationCount = 0;
+    this->matchCount = 0;
+    this->residual = 0.0;
+    double x = estimate.getX();
+    double y = estimate.getY();
+    double th = estimate.getTh();
+    for (int iteration = 0; iteration < this->maxIterations; iteration++) {
+        source.transform(Pose(x, y, th), this->moved);
+        int n = pairPoints();
+        this->iterationCount = iteration + 1;
+        this->matchCount = n;
+        if (n < this->minMatches) {
+            return false;
+        }
+        double s[SUM_COUNT];
+        accumulate(this->pairs, (n + LANES - 1) / LANES * LANES, s);
+        this->residual = sqrt(s[9] / n);
+
+        double damping = 1e-6 * (s[0] + s[3] + s[5]) + 1e-12;
+        double a = s[0] + damping, b = s[1], c = s[2];
+        double d = s[3] + damping, e = s[4];
+        double f = s[5] + damping;
+        double det = a * (d * f - e * e) - b * (b * f - c * e) + c * (b * e - c * d);
+        if (!(fabs(det) > 0.0)) {
+            return false;
+        }
+        // Cramer's rule on the symmetric system H * step = -g.
+        double g0 = -s[6], g1 = -s[7], g2 = -s[8];
+        double dx = (g0 * (d * f - e * e) - b * (g1 * f - e * g2) + c * (g1 * e - d * g2)) / det;
+        double dy = (a * (g1 * f - e * g2) - g0 * (b * f - c * e) + c * (b * g2 - g1 * c)) / det;
+        double dth = (a * (d * g2 - g1 * e) - b * (b * g2 - g1 * c) + g0 * (b * e - c * d)) / det;
+
+        double cs = cos(dth);
+        double sn = sin(dth);
+        double nx = cs * x - sn * y + dx;
+        double ny = sn * x + cs * y + dy;
+        x = nx;
+        y = ny;
+        th = remainder(th + dth, 2.0 * PI);
+        if (fabs(dx) < 1e-4 && fabs(dy) < 1e-4 && fabs(dth) < 1e-3 * PI / 180.0) {
+            break;
+        }
+    }
+    estimate = Pose(x, y, th);
+    return true;
+}
+
+/**
+ * @brief Forgets the reference scan; the next update() starts the estimate at pose.
+ */
+void ScanMatcher::reset(const Pose& pose) {
+    this->pose = pose;
+    this->hasPose = true;
+    this->hasReference = false;
+    this->reference.clear();
+    buildReference();
+}
+
+/**
+ * @brief Refines the odometry change since the previous scan and moves the estimate.
+ *
+ * The first scan only becomes the reference; the estimate starts at its odometry
+ * unless reset() set one.
+ */
+Pose ScanMatcher::update(const float* ranges, const Pose& odometry) {
+    toPoints(ranges, this->scan);
+    if (!this->hasReference) {
+        if (!this->hasPose) {
+            this->pose = odometry;
+            this->hasPose = true;
+        }
+        this->hasReference = true;
+    }
+    else {
+        Pose guess = between(this->lastOdometry, odometry);
+        Pose estimate = guess;
+        if (!match(this->scan, estimate)) {
+            this->failures++;
+            estimate = guess;
+        }
+        this->pose = compose(this->pose, estimate);
+    }
+    this->lastOdometry = odometry;
+    this->reference.swap(this->scan);
+    buildReference();
+    return this->pose;
+}
+
+Pose ScanMatcher::getPose() const {
+    return this->pose;
+}
+
+int ScanMatcher::getMatchCount() const {
+    return this->matchCount;
+}
+
+int ScanMatcher::getIterationCount() const {
+    return this->iterationCount;
+}
+
+double ScanMatcher::getResidual() const {
+    return this->residual;
+}
+
+unsigned long long ScanMatcher::getFailureCount() const {
+    return this->failures;
+}
+
+/**
+ * @brief Returns b, given in the frame of a, in the frame a is given in.
+ */
+Pose ScanMatcher::compose(const Pose& a, const Pose& b) {
+    double c = cos(a.getTh());
+    double s = sin(a.getTh());
+    return Pose(a.getX() + c * b.getX() - s * b.getY(), a.getY() + s * b.getX() + c * b.getY(),
+        remainder(a.getTh() + b.getTh(), 2.0 * PI));
+}
+
+/**
+ * @brief Returns b in the frame of a.
+ */
+Pose ScanMatcher::between(const Pose& a, const Pose& b) {
+    double c = cos(a.getTh());
+    double s = sin(a.getTh());
+    double dx = b.getX() - a.getX();
+    double dy = b.getY() - a.getY();
+    return Pose(c * dx + s * dy, -s * dx + c * dy, remainder(b.getTh() - a.getTh(), 2.0 * PI));
+}
@@ -0,0 +1,181 @@
+#pragma once
+/**
+ * @file   ScanMatcher.h
+ * @date   October, 2026
+ * @brief  Header file for the ScanMatcher class.
+ *
+ * This file contains the definition of the ScanMatcher class, which estimates the
+ * robot pose from odometry refined by aligning consecutive lidar scans with
+ * point-to-line ICP.
+ */
+
+#include <vector>
+#include "LidarSensor.h"
+#include "Point.h"
+#include "Pose.h"
+
+//! ScanMatcher class
+/*!
+ * @brief Scan-matching localization with point-to-line ICP.
+ *
+ * toPoints() converts the valid ranges of a scan into a PointCloud in the robot frame,
+ * with the beam cosines and sines computed once by setLidarGeometry(). The reference
+ * scan gets a normal per point, from its neighbors in scan order, and a uniform grid
+ * whose cells are maxDistance wide, so the nearest reference point of any position is
+ * in the 3x3 cells around it.
+ *
+ * match() looks for the pose of a source scan in the reference frame. Each iteration
+ * moves the source points by the current estimate, pairs every point with its nearest
+ * reference point within maxDistance, and takes one Gauss-Newton step on the sum of
+ * squared point-to-line distances n . (p - q). The pairs are packed into separate
+ * arrays and the 3x3 normal equations are summed over them with SSE2 or AVX, several
+ * pairs per instruction. Iterations stop when the step is below a tenth of a
+ * millimeter and a thousandth of a degree, or after maxIterations.
+ *
+ * update() keeps a pose estimate: the odometry change since the previous scan is the
+ * first guess, the match against the previous scan refines it, and the current scan
+ * becomes the next reference. When too few points pair up the odometry change is used
+ * as it is.
+ */
+class ScanMatcher {
+private:
+    double maxDistance;            /*!< Largest distance between paired points (meters), also the grid cell size. */
+    int maxIterations;             /*!< Gauss-Newton steps per match. */
+    int minMatches;                /*!< Pairs needed to accept a step. */
+    int beamCount;                 /*!< Beams per scan of the configured geometry. */
+    double maxRange;               /*!< Largest valid range (meters). */
+    std::vector<double> beamCos;   /*!< Cosine of each beam angle. */
+    std::vector<double> beamSin;   /*!< Sine of each beam angle. */
+
+    PointCloud reference;          /*!< Points of the reference scan. */
+    std::vector<double> normalX;   /*!< Normal of each reference point, 0 if it has none. */
+    std::vector<double> normalY;   /*!< Normal of each reference point, 0 if it has none. */
+    double gridX;                  /*!< x of the lower grid corner (meters). */
+    double gridY;                  /*!< y of the lower grid corner (meters). */
+    double cellSize;               /*!< Side of a grid cell (meters). */
+    int gridWidth;                 /*!< Cells along x. */
+    int gridHeight;                /*!< Cells along y. */
+    std::vector<int> cellStart;    /*!< First entry of each cell in cellItems, plus one end entry. */
+    std::vector<int> cellItems;    /*!< Reference points sorted by cell. */
+
+    PointCloud moved;              /*!< Source points moved by the current estimate. */
+    PointCloud scan;               /*!< Points of the scan passed to update(). */
+    std::vector<double> pairs[6];  /*!< Packed pairs: moved x, y, reference x, y, normal x, y. */
+
+    Pose pose;                     /*!< Pose estimate of update(). */
+    Pose lastOdometry;             /*!< Odometry of the previous update(). */
+    bool hasPose;                  /*!< pose was set by reset() or by the first update(). */
+    bool hasReference;             /*!< update() has seen a scan since the last reset(). */
+    int matchCount;                /*!< Pairs of the last iteration of the last match. */
+    int iterationCount;            /*!< Iterations of the last match. */
+    double residual;               /*!< RMS point-to-line distance of the last match (meters). */
+    unsigned long long failures;   /*!< update() calls that fell back on odometry. */
+
+    //! buildReference function
+    /*!
+    * Computes the normals and the grid of the reference points.
+    */
+    void buildReference();
+
+    //! pairPoints function
+    /*!
+    * Pairs the moved points with reference points that have a normal.
+    * @return the number of pairs.
+    */
+    int pairPoints();
+
+    ScanMatcher(const ScanMatcher&) = delete;
+    ScanMatcher& operator=(const ScanMatcher&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param maxDistance Largest distance between paired points (meters).
+    * @param maxIterations Gauss-Newton steps per match.
+    * @param minMatches Pairs needed to accept a match.
+    */
+    ScanMatcher(double maxDistance = 0.3, int maxIterations = 30, int minMatches = 20);
+
+    //! setLidarGeometry function
+    /*!
+    * Precomputes the beam directions used by toPoints().
+    * @param geometry Beam directions of the scans.
+    * @param count Beams per scan.
+    */
+    void setLidarGeometry(const LidarGeometry& geometry, int count);
+
+    //! toPoints function
+    /*!
+    * Converts the ranges that hit something (positive and below the maximum range) to
+    * points in the robot frame, in beam order.
+    * @param ranges Ranges of one scan (meters).
+    * @param cloud Receives the points.
+    */
+    void toPoints(const float* ranges, PointCloud& cloud) const;
+
+    //! setReference function
+    /*!
+    * Makes a copy of cloud the scan that match() aligns to.
+    */
+    void setReference(const PointCloud& cloud);
+
+    //! findNearest function
+    /*!
+    * @return the reference point nearest to (x, y) within maxDistance, or -1.
+    */
+    int findNearest(double x, double y) const;
+
+    //! match function
+    /*!
+    * Aligns a scan with the reference scan.
+    * @param source Points of the scan, in its own frame.
+    * @param estimate First guess of the source frame in the reference frame; receives the result.
+    * @return true if enough points paired up in every iteration.
+    */
+    bool match(const PointCloud& source, Pose& estimate);
+
+    //! reset function
+    /*!
+    * Forgets the reference scan and restarts the estimate of update() at pose.
+    */
+    void reset(const Pose& pose);
+
+    //! update function
+    /*!
+    * Refines the odometry change since the previous scan by matching the scans.
+    * @param ranges Ranges of the new scan (meters).
+    * @param odometry Pose reported by the robot with the scan.
+    * @return the new pose estimate.
+    */
+    Pose update(const float* ranges, const Pose& odometry);
+
+    //! getPose function
+    Pose getPose() const;
+
+    //! getMatchCount function
+    int getMatchCount() const;
+
+    //! getIterationCount function
+    int getIterationCount() const;
+
+    //! getResidual function
+    /*!
+    * @return the RMS point-to-line distance of the last match (meters).
+    */
+    double getResidual() const;
+
+    //! getFailureCount function
+    unsigned long long getFailureCount() const;
+
+    //! compose function
+    /*!
+    * @return the pose b, given in the frame of a, in the frame a is given in.
+    */
+    static Pose compose(const Pose& a, const Pose& b);
+
+    //! between function
+    /*!
+    * @return the pose b in the frame of a, so that compose(a, between(a, b)) is b.
+    */
+    static Pose between(const Pose& a, const Pose& b);
+};
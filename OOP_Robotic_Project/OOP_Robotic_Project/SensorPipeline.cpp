@@ -0,0 +1,143 @@
+/**
+ * @file   SensorPipeline.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the SensorPipeline class.
+ */
+
+#include <chrono>
+#include <iostream>
+#include "ControlLoop.h"
+#include "Metrics.h"
+#include "SensorPipeline.h"
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor.
+ * @param api Robot API the sensors are read from.
+ * @param periodMicroseconds Time between two acquisitions, 0 to poll as fast as possible.
+ */
+SensorPipeline::SensorPipeline(RobotInterface* api, int periodMicroseconds)
+    : robotAPI(api), ring(new SpscRing<SensorSnapshot, RING_SIZE>()), running(false),
+      periodNs(periodMicroseconds > 0 ? periodMicroseconds * 1000LL : 0), published(0), dropped(0) {
+}
+
+/**
+ * @brief Destructor. Stops the acquisition thread.
+ */
+SensorPipeline::~SensorPipeline() {
+    stop();
+    delete this->ring;
+}
+
+/**
+ * @brief Starts the acquisition thread.
+ * @return true if the thread is running.
+ */
+bool SensorPipeline::start() {
+    if (this->running.load()) {
+        return true;
+    }
+    if (this->robotAPI == nullptr) {
+        cout << "Error: SensorPipeline has no robot API." << endl;
+        return false;
+    }
+    this->running.store(true);
+    this->worker = thread(&SensorPipeline::acquisitionLoop, this);
+    return true;
+}
+
+/**
+ * @brief Stops the acquisition thread and waits for it to finish.
+ */
+void SensorPipeline::stop() {
+    this->running.store(false);
+    if (this->worker.joinable()) {
+        this->worker.join();
+    }
+}
+
+bool SensorPipeline::isRunning() const {
+    return this->running.load();
+}
+
+/**
+ * @brief Body of the acquisition thread.
+ *
+ * Each cycle reads the sensors directly into the next free ring slot and publishes it.
+ * With a period set, cycles are started on absolute deadlines so timing does not drift.
+ */
+void SensorPipeline::acquisitionLoop() {
+    unsigned long long sequence = 0;
+    int lidarCount = this->robotAPI->getLidarRangeNumber();
+    if (lidarCount > SensorSnapshot::MAX_LIDAR_RANGES) {
+        cout << "Error: lidar scan larger than SensorSnapshot::MAX_LIDAR_RANGES, lidar disabled." << endl;
+        lidarCount = 0;
+    }
+    long long deadline = ControlLoop::nowNs();
+
+    while (this->running.load(memory_order_relaxed)) {
+        SensorSnapshot* snapshot = this->ring->beginWrite();
+        if (snapshot == nullptr) {
+            this->dropped.fetch_add(1, memory_order_relaxed);
+        }
+        else {
+            METRIC_SCOPE("sensor_pipeline_read");
+            this->robotAPI->getXYTh(snapshot->x, snapshot->y, snapshot->th);
+            for (int i = 0; i < SensorSnapshot::IR_COUNT; i++) {
+                snapshot->ir[i] = this->robotAPI->getIRRange(i);
+            }
+            if (lidarCount > 0) {
+                this->robotAPI->getLidarRange(snapshot->lidar);
+            }
+            snapshot->lidarCount = lidarCount;
+            snapshot->sequence = sequence++;
+            snapshot->timestampNs = nowNs();
+            this->ring->commitWrite();
+            this->published.fetch_add(1, memory_order_relaxed);
+        }
+
+        if (this->periodNs > 0) {
+            deadline += this->periodNs;
+            ControlLoop::sleepUntil(deadline);
+        }
+        else if (snapshot == nullptr) {
+            this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Skips to the newest snapshot, discarding older unread ones.
+ */
+const SensorSnapshot* SensorPipeline::latest() {
+    return this->ring->latest();
+}
+
+/**
+ * @brief Returns the oldest unread snapshot.
+ */
+const SensorSnapshot* SensorPipeline::next() {
+    return this->ring->front();
+}
+
+/**
+ * @brief Hands the current snapshot back to the acquisition thread.
+ */
+void SensorPipeline::release() {
+    this->ring->pop();
+}
+
+unsigned long long SensorPipeline::getPublishedCount() const {
+    return this->published.load(memory_order_relaxed);
+}
+
+unsigned long long SensorPipeline::getDroppedCount() const {
+    return this->dropped.load(memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the steady clock time in nanoseconds.
+ */
+long long SensorPipeline::nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
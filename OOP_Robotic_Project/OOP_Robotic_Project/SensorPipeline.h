@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file   SensorPipeline.h
+ * @date   October, 2026
+ * @brief  Header file for the SensorPipeline class.
+ *
+ * This file contains the definition of the SensorPipeline class, which polls the robot
+ * sensors on a dedicated thread and publishes snapshots to the control loop.
+ */
+
+#include <atomic>
+#include <thread>
+#include "RobotInterface.h"
+#include "SpscRing.h"
+
+//! SensorSnapshot struct
+/*!
+ * @brief Pose, IR ranges and lidar scan read in one acquisition cycle.
+ */
+struct SensorSnapshot {
+    static const int IR_COUNT = 9;            /*!< Number of IR sensors on the robot. */
+    static const int MAX_LIDAR_RANGES = 2048; /*!< Largest lidar scan a snapshot can hold. */
+
+    long long timestampNs;          /*!< Steady clock time the snapshot was published, in nanoseconds. */
+    unsigned long long sequence;    /*!< Increasing snapshot number. */
+    double x;                       /*!< X position from getXYTh (meters). */
+    double y;                       /*!< Y position from getXYTh (meters). */
+    double th;                      /*!< Heading from getXYTh. */
+    double ir[IR_COUNT];            /*!< IR ranges in meters. */
+    int lidarCount;                 /*!< Number of valid values in lidar. */
+    alignas(64) float lidar[MAX_LIDAR_RANGES]; /*!< Lidar ranges in meters. */
+};
+
+//! SensorPipeline class
+/*!
+ * @brief Acquisition thread that feeds sensor snapshots through a lock-free SPSC ring.
+ *
+ * While running, the pipeline owns all sensor calls to the robot API (getXYTh,
+ * getIRRange and getLidarRange); motion commands may still be sent from the control
+ * thread. Snapshots are written in place into the ring, so acquisition does not copy
+ * or allocate. The control loop is the single consumer: it reads with latest() or
+ * next() and hands the snapshot back with release(); none of these calls block.
+ * If the consumer falls behind and the ring is full, the new snapshot is dropped
+ * and counted.
+ */
+class SensorPipeline {
+public:
+    static const int RING_SIZE = 8; /*!< Number of snapshots the ring can hold. */
+
+private:
+    RobotInterface* robotAPI;                       /*!< Robot API the sensors are read from. */
+    SpscRing<SensorSnapshot, RING_SIZE>* ring;      /*!< Snapshot ring, heap allocated once because it is large. */
+    std::thread worker;                             /*!< Acquisition thread. */
+    std::atomic<bool> running;                      /*!< Cleared to stop the acquisition thread. */
+    long long periodNs;                             /*!< Time between acquisitions, 0 to poll continuously. */
+    std::atomic<unsigned long long> published;      /*!< Number of snapshots published. */
+    std::atomic<unsigned long long> dropped;        /*!< Number of snapshots dropped because the ring was full. */
+
+    //! acquisitionLoop function
+    /*!
+    * Body of the acquisition thread.
+    */
+    void acquisitionLoop();
+
+    SensorPipeline(const SensorPipeline&) = delete;
+    SensorPipeline& operator=(const SensorPipeline&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param api Robot API the sensors are read from.
+    * @param periodMicroseconds Time between two acquisitions, 0 to poll as fast as possible.
+    */
+    SensorPipeline(RobotInterface* api, int periodMicroseconds = 0);
+
+    //! Destructor
+    /*!
+    * Stops the acquisition thread.
+    */
+    ~SensorPipeline();
+
+    //! start function
+    /*!
+    * Starts the acquisition thread.
+    * @return true if the thread is running.
+    */
+    bool start();
+
+    //! stop function
+    /*!
+    * Stops the acquisition thread and waits for it to finish.
+    */
+    void stop();
+
+    //! isRunning function
+    bool isRunning() const;
+
+    //! latest function (consumer)
+    /*!
+    * Skips to the newest snapshot, discarding older unread ones.
+    * @return the newest snapshot, or nullptr if nothing new was published. Call release() when done.
+    */
+    const SensorSnapshot* latest();
+
+    //! next function (consumer)
+    /*!
+    * @return the oldest unread snapshot, or nullptr if nothing new was published. Call release() when done.
+    */
+    const SensorSnapshot* next();
+
+    //! release function (consumer)
+    /*!
+    * Hands the snapshot returned by latest() or next() back to the acquisition thread.
+    */
+    void release();
+
+    //! getPublishedCount function
+    unsigned long long getPublishedCount() const;
+
+    //! getDroppedCount function
+    unsigned long long getDroppedCount() const;
+
+    //! nowNs function
+    /*!
+    * @return the steady clock time in nanoseconds, on the same base as SensorSnapshot::timestampNs.
+    */
+    static long long nowNs();
+};
@@ -0,0 +1,187 @@
+/**
+ * @file   SimulatedRobot.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the SimulatedRobot class.
+ */
+
+#include <cmath>
+#include "SimulatedRobot.h"
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Parameterized Constructor. The robot starts disconnected at the center of a
+ * square room, facing +x.
+ */
+SimulatedRobot::SimulatedRobot(double roomSize, int lidarCount, double linearSpeed, double angularSpeed)
+    : room(1.0), world(&room), radius(0.2), linearSpeed(linearSpeed), angularSpeed(angularSpeed),
+      lidarCount(lidarCount > 0 ? lidarCount : 0), lidarMaxRange(10.0), timeStep(DEFAULT_TIME_STEP), x(0.0), y(0.0),
+      th(0.0), vx(0.0), vy(0.0), omega(0.0), connected(false), time(0.0), collisions(0) {
+    double half = roomSize > 0 ? roomSize / 2.0 : 2.0;
+    this->room.addBox(-half, -half, half, half);
+    this->room.prepare();
+}
+
+/**
+ * @brief Parameterized Constructor. The robot starts disconnected at the origin of the
+ * world, facing +x.
+ */
+SimulatedRobot::SimulatedRobot(const SimulationWorld* world, int lidarCount, double linearSpeed, double angularSpeed)
+    : room(1.0), world(world != nullptr ? world : &room), radius(0.2), linearSpeed(linearSpeed), angularSpeed(angularSpeed),
+      lidarCount(lidarCount > 0 ? lidarCount : 0), lidarMaxRange(10.0), timeStep(DEFAULT_TIME_STEP), x(0.0), y(0.0),
+      th(0.0), vx(0.0), vy(0.0), omega(0.0), connected(false), time(0.0), collisions(0) {
+}
+
+/**
+ * @brief Takes one step at the current velocity.
+ *
+ * The velocity is either a translation or a rotation, so the heading is constant
+ * while the robot translates and the step is exact.
+ */
+void SimulatedRobot::advance() {
+    this->time += this->timeStep;
+    if (!this->connected) {
+        return;
+    }
+    if (this->omega != 0.0) {
+        this->th = remainder(this->th + this->omega * this->timeStep, 2.0 * PI);
+    }
+    if (this->vx != 0.0 || this->vy != 0.0) {
+        double c = cos(this->th);
+        double s = sin(this->th);
+        double nx = this->x + (this->vx * c - this->vy * s) * this->timeStep;
+        double ny = this->y + (this->vx * s + this->vy * c) * this->timeStep;
+        if (this->world->collides(nx, ny, this->radius)) {
+            this->collisions++;
+        }
+        else {
+            this->x = nx;
+            this->y = ny;
+        }
+    }
+}
+
+void SimulatedRobot::setPose(double x, double y, double th) {
+    lock_guard<mutex> guard(this->lock);
+    this->x = x;
+    this->y = y;
+    this->th = remainder(th, 2.0 * PI);
+}
+
+void SimulatedRobot::setTimeStep(double seconds) {
+    lock_guard<mutex> guard(this->lock);
+    if (seconds > 0.0) {
+        this->timeStep = seconds;
+    }
+}
+
+void SimulatedRobot::step() {
+    lock_guard<mutex> guard(this->lock);
+    advance();
+}
+
+/**
+ * @brief Advances the simulation by a duration, rounded to whole steps.
+ *
+ * The lock is taken per step, so sensors can be read from another thread meanwhile.
+ */
+void SimulatedRobot::run(double seconds) {
+    long long count;
+    {
+        lock_guard<mutex> guard(this->lock);
+        count = llround(seconds / this->timeStep);
+    }
+    for (long long i = 0; i < count; i++) {
+        lock_guard<mutex> guard(this->lock);
+        advance();
+    }
+}
+
+double SimulatedRobot::getTime() const {
+    lock_guard<mutex> guard(this->lock);
+    return this->time;
+}
+
+unsigned long long SimulatedRobot::getCollisionCount() const {
+    lock_guard<mutex> guard(this->lock);
+    return this->collisions;
+}
+
+bool SimulatedRobot::isConnected() const {
+    lock_guard<mutex> guard(this->lock);
+    return this->connected;
+}
+
+void SimulatedRobot::connect() {
+    lock_guard<mutex> guard(this->lock);
+    this->connected = true;
+}
+
+/**
+ * @brief Disconnects; the robot stops where it is.
+ */
+void SimulatedRobot::disconnect() {
+    lock_guard<mutex> guard(this->lock);
+    this->connected = false;
+    this->vx = 0.0;
+    this->vy = 0.0;
+    this->omega = 0.0;
+}
+
+void SimulatedRobot::move(DIRECTION direction) {
+    lock_guard<mutex> guard(this->lock);
+    this->vx = direction == FORWARD ? this->linearSpeed : (direction == BACKWARD ? -this->linearSpeed : 0.0);
+    this->vy = direction == LEFT ? this->linearSpeed : (direction == RIGHT ? -this->linearSpeed : 0.0);
+    this->omega = 0.0;
+}
+
+/**
+ * @brief Rotates in place; directions other than LEFT and RIGHT stop the robot.
+ */
+void SimulatedRobot::rotate(DIRECTION direction) {
+    lock_guard<mutex> guard(this->lock);
+    this->vx = 0.0;
+    this->vy = 0.0;
+    this->omega = direction == LEFT ? this->angularSpeed : (direction == RIGHT ? -this->angularSpeed : 0.0);
+}
+
+void SimulatedRobot::stop() {
+    lock_guard<mutex> guard(this->lock);
+    this->vx = 0.0;
+    this->vy = 0.0;
+    this->omega = 0.0;
+}
+
+/**
+ * @brief Returns the range of IR sensor i, or IR_MAX_RANGE for an invalid index.
+ */
+double SimulatedRobot::getIRRange(int i) {
+    if (i < 0 || i >= IR_COUNT) {
+        return IR_MAX_RANGE;
+    }
+    lock_guard<mutex> guard(this->lock);
+    return this->world->castRay(this->x, this->y, this->th + i * (2.0 * PI / IR_COUNT), IR_MAX_RANGE);
+}
+
+void SimulatedRobot::getXYTh(double& X, double& Y, double& TH) {
+    lock_guard<mutex> guard(this->lock);
+    X = this->x;
+    Y = this->y;
+    TH = this->th;
+}
+
+/**
+ * @brief Fills ranges with getLidarRangeNumber() beams, beam 0 pointing backwards.
+ */
+void SimulatedRobot::getLidarRange(float* ranges) {
+    lock_guard<mutex> guard(this->lock);
+    double increment = this->lidarCount > 0 ? 2.0 * PI / this->lidarCount : 0.0;
+    for (int i = 0; i < this->lidarCount; i++) {
+        ranges[i] = static_cast<float>(this->world->castRay(this->x, this->y, this->th - PI + i * increment, this->lidarMaxRange));
+    }
+}
+
+int SimulatedRobot::getLidarRangeNumber() {
+    return this->lidarCount;
+}
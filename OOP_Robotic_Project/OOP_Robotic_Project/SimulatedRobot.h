@@ -0,0 +1,141 @@
+#pragma once
+/**
+ * @file   SimulatedRobot.h
+ * @date   October, 2026
+ * @brief  Header file for the SimulatedRobot class.
+ *
+ * This file contains the definition of the SimulatedRobot class, an in-process
+ * kinematic simulator that implements the robot API where Webots and FestoRobotAPI are
+ * not available.
+ */
+
+#include <mutex>
+#include "RobotInterface.h"
+#include "SimulationWorld.h"
+
+//! SimulatedRobot class
+/*!
+ * @brief Omnidirectional robot moving among the walls of a SimulationWorld.
+ *
+ * Time is simulated: nothing moves until run() or step() is called, and each step
+ * advances the robot by a fixed timeStep at the velocity of its last command. A test
+ * therefore replaces Sleep(3000) with run(3.0) and thousands of simulated seconds take
+ * a fraction of a wall second. Within one step the robot either translates or rotates
+ * in place, never both, so a step is exact for a constant command. A step that would
+ * bring the robot's disc into a wall is not taken and counted as a collision; the
+ * robot then stays in contact until it gets another command.
+ *
+ * IR sensors sit 40 degrees apart, counterclockwise from sensor 0 at the front, and
+ * lidar beams cover a full turn starting behind the robot, as LidarGeometry::fullCircle
+ * describes. Both are rays from the robot center against the world, limited to their
+ * maximum range. The default constructor builds a square room; the other one uses a
+ * world owned by the caller, which must not change while the robot uses it. All
+ * functions may be called from several threads.
+ */
+class SimulatedRobot : public RobotInterface {
+public:
+    static const int IR_COUNT = 9;              /*!< IR sensors, as on the Festo robot. */
+    static constexpr double IR_MAX_RANGE = 0.8; /*!< Largest IR range (meters). */
+    static constexpr double DEFAULT_TIME_STEP = 0.01; /*!< Simulated seconds per step. */
+
+private:
+    mutable std::mutex lock;   /*!< Guards every member below. */
+    SimulationWorld room;      /*!< World built by the room constructor. */
+    const SimulationWorld* world; /*!< Walls the robot moves among. */
+    double radius;             /*!< Robot radius (meters). */
+    double linearSpeed;        /*!< Speed of move commands (meters per second). */
+    double angularSpeed;       /*!< Speed of rotate commands (radians per second). */
+    int lidarCount;            /*!< Beams per lidar scan. */
+    double lidarMaxRange;      /*!< Largest lidar range (meters). */
+    double timeStep;           /*!< Simulated seconds per step. */
+    double x;                  /*!< Position (meters). */
+    double y;                  /*!< Position (meters). */
+    double th;                 /*!< Heading (radians). */
+    double vx;                 /*!< Velocity along the heading (meters per second). */
+    double vy;                 /*!< Velocity to the left of the heading (meters per second). */
+    double omega;              /*!< Angular velocity (radians per second). */
+    bool connected;            /*!< connect() was called and disconnect() was not. */
+    double time;               /*!< Simulated seconds since construction. */
+    unsigned long long collisions; /*!< Steps refused because the robot would hit a wall. */
+
+    //! advance function
+    /*!
+    * Takes one step. Called with lock held.
+    */
+    void advance();
+
+    SimulatedRobot(const SimulatedRobot&) = delete;
+    SimulatedRobot& operator=(const SimulatedRobot&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * Places the robot at the center of an empty square room.
+    * @param roomSize Side of the square room (meters).
+    * @param lidarCount Beams per lidar scan.
+    * @param linearSpeed Speed of move commands (meters per second).
+    * @param angularSpeed Speed of rotate commands (radians per second).
+    */
+    SimulatedRobot(double roomSize = 4.0, int lidarCount = 360, double linearSpeed = 0.2, double angularSpeed = 0.5);
+
+    //! Parameterized Constructor
+    /*!
+    * Places the robot at the origin of a world owned by the caller.
+    * @param world Walls the robot moves among; it must outlive the robot. Call its
+    * prepare() first if several robots share it.
+    * @param lidarCount Beams per lidar scan.
+    * @param linearSpeed Speed of move commands (meters per second).
+    * @param angularSpeed Speed of rotate commands (radians per second).
+    */
+    SimulatedRobot(const SimulationWorld* world, int lidarCount = 360, double linearSpeed = 0.2, double angularSpeed = 0.5);
+
+    //! setPose function
+    /*!
+    * Places the robot, whether or not it fits there, and leaves its command unchanged.
+    */
+    void setPose(double x, double y, double th);
+
+    //! setTimeStep function
+    /*!
+    * @param seconds Simulated seconds per step, positive.
+    */
+    void setTimeStep(double seconds);
+
+    //! step function
+    /*!
+    * Advances the simulation by one time step.
+    */
+    void step();
+
+    //! run function
+    /*!
+    * Advances the simulation by a duration, rounded to whole steps.
+    * @param seconds Simulated time to run.
+    */
+    void run(double seconds);
+
+    //! getTime function
+    /*!
+    * @return the simulated time since construction (seconds).
+    */
+    double getTime() const;
+
+    //! getCollisionCount function
+    /*!
+    * @return the steps that were refused because the robot would have hit a wall.
+    */
+    unsigned long long getCollisionCount() const;
+
+    //! isConnected function
+    bool isConnected() const;
+
+    void connect() override;
+    void disconnect() override;
+    void move(DIRECTION direction) override;
+    void rotate(DIRECTION direction) override;
+    void stop() override;
+    double getIRRange(int i) override;
+    void getXYTh(double& X, double& Y, double& TH) override;
+    void getLidarRange(float* ranges) override;
+    int getLidarRangeNumber() override;
+};
@@ -0,0 +1,327 @@
+/**
+ * @file   SimulationWorld.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the SimulationWorld class.
+ */
+
+#include <cmath>
+#include <limits>
+#include "SimulationWorld.h"
+using namespace std;
+
+/**
+ * @brief Distance along a ray to a segment.
+ * @return the ray parameter of the crossing, or -1 if the ray misses the segment.
+ */
+static double raySegment(double x, double y, double dx, double dy, const WallSegment& s) {
+    double ex = s.x1 - s.x0;
+    double ey = s.y1 - s.y0;
+    double denominator = dx * ey - dy * ex;
+    if (fabs(denominator) < 1e-15) {
+        return -1.0;
+    }
+    double wx = s.x0 - x;
+    double wy = s.y0 - y;
+    double t = (wx * ey - wy * ex) / denominator;
+    double u = (wx * dy - wy * dx) / denominator;
+    return t >= 0.0 && u >= 0.0 && u <= 1.0 ? t : -1.0;
+}
+
+/**
+ * @brief Squared distance from a point to a segment.
+ */
+static double pointSegmentSquared(double x, double y, const WallSegment& s) {
+    double ex = s.x1 - s.x0;
+    double ey = s.y1 - s.y0;
+    double length = ex * ex + ey * ey;
+    double u = length > 0.0 ? ((x - s.x0) * ex + (y - s.y0) * ey) / length : 0.0;
+    u = u < 0.0 ? 0.0 : (u > 1.0 ? 1.0 : u);
+    double px = s.x0 + u * ex - x;
+    double py = s.y0 + u * ey - y;
+    return px * px + py * py;
+}
+
+/**
+ * @brief Returns true if the line of a segment passes through a box.
+ *
+ * Only called for boxes inside the segment's bounding box, so the segment crosses the
+ * box when its line does: when the box corners are not all on one side of it.
+ */
+static bool lineCrossesBox(const WallSegment& s, double x0, double y0, double x1, double y1) {
+    double ex = s.x1 - s.x0;
+    double ey = s.y1 - s.y0;
+    double c0 = ex * (y0 - s.y0) - ey * (x0 - s.x0);
+    double c1 = ex * (y0 - s.y0) - ey * (x1 - s.x0);
+    double c2 = ex * (y1 - s.y0) - ey * (x0 - s.x0);
+    double c3 = ex * (y1 - s.y0) - ey * (x1 - s.x0);
+    return !((c0 > 0 && c1 > 0 && c2 > 0 && c3 > 0) || (c0 < 0 && c1 < 0 && c2 < 0 && c3 < 0));
+}
+
+/**
+ * @brief Parameterized Constructor. The world starts empty.
+ */
+SimulationWorld::SimulationWorld(double cellSize)
+    : cellSize(cellSize > 0 ? cellSize : 0.5), gridCell(0.0), minX(0.0), minY(0.0), columns(0), rows(0), dirty(true) {
+}
+
+void SimulationWorld::clear() {
+    this->segments.clear();
+    this->dirty = true;
+}
+
+void SimulationWorld::addSegment(double x0, double y0, double x1, double y1) {
+    this->segments.push_back(WallSegment{ x0, y0, x1, y1 });
+    this->dirty = true;
+}
+
+/**
+ * @brief Adds the edges of a polygon.
+ */
+void SimulationWorld::addPolygon(const double* xy, int count, bool closed) {
+    for (int i = 0; i + 1 < count; i++) {
+        addSegment(xy[2 * i], xy[2 * i + 1], xy[2 * i + 2], xy[2 * i + 3]);
+    }
+    if (closed && count > 2) {
+        addSegment(xy[2 * count - 2], xy[2 * count - 1], xy[0], xy[1]);
+    }
+}
+
+void SimulationWorld::addBox(double x0, double y0, double x1, double y1) {
+    const double corners[8] = { x0, y0, x1, y0, x1, y1, x0, y1 };
+    addPolygon(corners, 4, true);
+}
+
+void SimulationWorld::prepare() {
+    ensureBuilt();
+}
+
+/**
+ * @brief Builds the grid if the segments changed.
+ */
+void SimulationWorld::ensureBuilt() const {
+    if (this->dirty) {
+        const_cast<SimulationWorld*>(this)->build();
+    }
+}
+
+/**
+ * @brief Sizes the grid to the segments and lists the segments of every cell.
+ *
+ * The grid covers the bounding box of the segments with one spare cell on each side.
+ * The cell side starts at cellSize and doubles until the grid fits in MAX_CELLS.
+ * Segments are counted per cell first, so the lists are packed into one array.
+ */
+void SimulationWorld::build() {
+    this->dirty = false;
+    this->cellItems.clear();
+    if (this->segments.empty()) {
+        this->columns = 0;
+        this->rows = 0;
+        this->cellStart.assign(1, 0);
+        return;
+    }
+    double maxX = -numeric_limits<double>::infinity();
+    double maxY = -numeric_limits<double>::infinity();
+    this->minX = numeric_limits<double>::infinity();
+    this->minY = numeric_limits<double>::infinity();
+    for (const WallSegment& s : this->segments) {
+        this->minX = fmin(this->minX, fmin(s.x0, s.x1));
+        this->minY = fmin(this->minY, fmin(s.y0, s.y1));
+        maxX = fmax(maxX, fmax(s.x0, s.x1));
+        maxY = fmax(maxY, fmax(s.y0, s.y1));
+    }
+    this->gridCell = this->cellSize;
+    long long cells = 0;
+    do {
+        this->columns = static_cast<int>(ceil((maxX - this->minX) / this->gridCell)) + 2;
+        this->rows = static_cast<int>(ceil((maxY - this->minY) / this->gridCell)) + 2;
+        cells = static_cast<long long>(this->columns) * this->rows;
+        if (cells > MAX_CELLS) {
+            this->gridCell *= 2.0;
+        }
+    } while (cells > MAX_CELLS);
+    this->minX -= this->gridCell;
+    this->minY -= this->gridCell;
+
+    this->cellStart.assign(static_cast<size_t>(cells) + 1, 0);
+    // Pass 0 counts the segments of every cell, pass 1 stores them.
+    vector<int> fill;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < this->segments.size(); i++) {
+            const WallSegment& s = this->segments[i];
+            int cx0 = static_cast<int>(floor((fmin(s.x0, s.x1) - this->minX) / this->gridCell));
+            int cx1 = static_cast<int>(floor((fmax(s.x0, s.x1) - this->minX) / this->gridCell));
+            int cy0 = static_cast<int>(floor((fmin(s.y0, s.y1) - this->minY) / this->gridCell));
+            int cy1 = static_cast<int>(floor((fmax(s.y0, s.y1) - this->minY) / this->gridCell));
+            double margin = this->gridCell * 1e-9;
+            for (int cy = cy0; cy <= cy1; cy++) {
+                for (int cx = cx0; cx <= cx1; cx++) {
+                    double bx = this->minX + cx * this->gridCell;
+                    double by = this->minY + cy * this->gridCell;
+                    if (!lineCrossesBox(s, bx - margin, by - margin, bx + this->gridCell + margin, by + this->gridCell + margin)) {
+                        continue;
+                    }
+                    int cell = cy * this->columns + cx;
+                    if (pass == 0) {
+                        this->cellStart[cell + 1]++;
+                    }
+                    else {
+                        this->cellItems[fill[cell]++] = static_cast<int>(i);
+                    }
+                }
+            }
+        }
+        if (pass == 0) {
+            for (long long c = 0; c < cells; c++) {
+                this->cellStart[c + 1] += this->cellStart[c];
+            }
+            this->cellItems.resize(this->cellStart[cells]);
+            fill.assign(this->cellStart.begin(), this->cellStart.end() - 1);
+        }
+    }
+}
+
+/**
+ * @brief Returns the distance to the first wall along a ray.
+ *
+ * The ray is clipped to the grid, then walks it cell by cell. tMaxX and tMaxY are the
+ * ray parameters where it crosses the next column and row boundary; the smaller one is
+ * where the current cell ends. A hit in the current cell's list may lie beyond that
+ * point, in a later cell the segment also crosses, so the walk only stops once the
+ * nearest hit is no farther than the end of the current cell.
+ */
+double SimulationWorld::castRay(double x, double y, double angle, double maxRange) const {
+    ensureBuilt();
+    if (this->columns == 0) {
+        return maxRange;
+    }
+    const double infinity = numeric_limits<double>::infinity();
+    double dx = cos(angle);
+    double dy = sin(angle);
+    double maxX = this->minX + this->columns * this->gridCell;
+    double maxY = this->minY + this->rows * this->gridCell;
+
+    double tEnter = 0.0;
+    double tExit = maxRange;
+    if (fabs(dx) < 1e-12) {
+        if (x < this->minX || x > maxX) {
+            return maxRange;
+        }
+    }
+    else {
+        double t0 = (this->minX - x) / dx;
+        double t1 = (maxX - x) / dx;
+        tEnter = fmax(tEnter, fmin(t0, t1));
+        tExit = fmin(tExit, fmax(t0, t1));
+    }
+    if (fabs(dy) < 1e-12) {
+        if (y < this->minY || y > maxY) {
+            return maxRange;
+        }
+    }
+    else {
+        double t0 = (this->minY - y) / dy;
+        double t1 = (maxY - y) / dy;
+        tEnter = fmax(tEnter, fmin(t0, t1));
+        tExit = fmin(tExit, fmax(t0, t1));
+    }
+    if (tEnter > tExit) {
+        return maxRange;
+    }
+
+    int cx = static_cast<int>(floor((x + dx * tEnter - this->minX) / this->gridCell));
+    int cy = static_cast<int>(floor((y + dy * tEnter - this->minY) / this->gridCell));
+    cx = cx < 0 ? 0 : (cx >= this->columns ? this->columns - 1 : cx);
+    cy = cy < 0 ? 0 : (cy >= this->rows ? this->rows - 1 : cy);
+    int stepX = dx > 0 ? 1 : -1;
+    int stepY = dy > 0 ? 1 : -1;
+    double tMaxX = fabs(dx) < 1e-12 ? infinity : (this->minX + (cx + (dx > 0 ? 1 : 0)) * this->gridCell - x) / dx;
+    double tMaxY = fabs(dy) < 1e-12 ? infinity : (this->minY + (cy + (dy > 0 ? 1 : 0)) * this->gridCell - y) / dy;
+    double tDeltaX = fabs(dx) < 1e-12 ? infinity : this->gridCell / fabs(dx);
+    double tDeltaY = fabs(dy) < 1e-12 ? infinity : this->gridCell / fabs(dy);
+
+    double best = maxRange;
+    while (true) {
+        int cell = cy * this->columns + cx;
+        for (int k = this->cellStart[cell]; k < this->cellStart[cell + 1]; k++) {
+            double t = raySegment(x, y, dx, dy, this->segments[this->cellItems[k]]);
+            if (t >= 0.0 && t < best) {
+                best = t;
+            }
+        }
+        double tNext = tMaxX < tMaxY ? tMaxX : tMaxY;
+        if (best <= tNext || tNext >= tExit) {
+            break;
+        }
+        if (tMaxX < tMaxY) {
+            cx += stepX;
+            tMaxX += tDeltaX;
+            if (cx < 0 || cx >= this->columns) {
+                break;
+            }
+        }
+        else {
+            cy += stepY;
+            tMaxY += tDeltaY;
+            if (cy < 0 || cy >= this->rows) {
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Same as castRay() but tests every segment.
+ */
+double SimulationWorld::castRayBruteForce(double x, double y, double angle, double maxRange) const {
+    double dx = cos(angle);
+    double dy = sin(angle);
+    double best = maxRange;
+    for (const WallSegment& s : this->segments) {
+        double t = raySegment(x, y, dx, dy, s);
+        if (t >= 0.0 && t < best) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Returns true if a disc at (x, y) touches a wall, checking the cells it overlaps.
+ */
+bool SimulationWorld::collides(double x, double y, double radius) const {
+    ensureBuilt();
+    if (this->columns == 0) {
+        return false;
+    }
+    int cx0 = static_cast<int>(floor((x - radius - this->minX) / this->gridCell));
+    int cx1 = static_cast<int>(floor((x + radius - this->minX) / this->gridCell));
+    int cy0 = static_cast<int>(floor((y - radius - this->minY) / this->gridCell));
+    int cy1 = static_cast<int>(floor((y + radius - this->minY) / this->gridCell));
+    cx0 = cx0 < 0 ? 0 : cx0;
+    cy0 = cy0 < 0 ? 0 : cy0;
+    cx1 = cx1 >= this->columns ? this->columns - 1 : cx1;
+    cy1 = cy1 >= this->rows ? this->rows - 1 : cy1;
+    double limit = radius * radius;
+    for (int cy = cy0; cy <= cy1; cy++) {
+        for (int cx = cx0; cx <= cx1; cx++) {
+            int cell = cy * this->columns + cx;
+            for (int k = this->cellStart[cell]; k < this->cellStart[cell + 1]; k++) {
+                if (pointSegmentSquared(x, y, this->segments[this->cellItems[k]]) < limit) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+const vector<WallSegment>& SimulationWorld::getSegments() const {
+    return this->segments;
+}
+
+double SimulationWorld::getCellSize() const {
+    ensureBuilt();
+    return this->gridCell;
+}
@@ -0,0 +1,136 @@
+#pragma once
+/**
+ * @file   SimulationWorld.h
+ * @date   October, 2026
+ * @brief  Header file for the SimulationWorld class.
+ *
+ * This file contains the definition of the SimulationWorld class, the polygonal
+ * obstacles a SimulatedRobot moves among, with a uniform grid for ray and collision
+ * queries.
+ */
+
+#include <vector>
+
+//! WallSegment struct
+/*!
+ * @brief One straight wall from (x0, y0) to (x1, y1), in meters.
+ */
+struct WallSegment {
+    double x0; /*!< Start x. */
+    double y0; /*!< Start y. */
+    double x1; /*!< End x. */
+    double y1; /*!< End y. */
+};
+
+//! SimulationWorld class
+/*!
+ * @brief Wall segments with a uniform grid index.
+ *
+ * Obstacles are polygons stored as their edges. The grid lists, for every square cell,
+ * the segments that cross it; a segment is listed in each cell its line passes through,
+ * found with an exact segment-box test over its bounding box of cells. A ray walks the
+ * cells it crosses in order (Amanatides and Woo, 1987) and only tests the segments
+ * listed there; it stops at the first cell that ends beyond the nearest hit found so
+ * far, so a lidar beam costs a few cells and segments however large the world is.
+ *
+ * The grid is rebuilt by the first query after the segments change, or by prepare().
+ * Once it is built, queries do not modify the world and may run on several threads at
+ * once.
+ */
+class SimulationWorld {
+public:
+    static const int MAX_CELLS = 1 << 22; /*!< Cell budget; the cell size grows to stay under it. */
+
+private:
+    std::vector<WallSegment> segments; /*!< Every wall. */
+    double cellSize;                   /*!< Requested cell side (meters). */
+    double gridCell;                   /*!< Cell side of the built grid (meters). */
+    double minX;                       /*!< Left edge of the grid (meters). */
+    double minY;                       /*!< Bottom edge of the grid (meters). */
+    int columns;                       /*!< Grid width in cells, 0 before build(). */
+    int rows;                          /*!< Grid height in cells. */
+    std::vector<int> cellStart;        /*!< Start of each cell's list in cellItems, rows * columns + 1 entries. */
+    std::vector<int> cellItems;        /*!< Segment indices, grouped by cell. */
+    bool dirty;                        /*!< Segments changed since the grid was built. */
+
+    //! build function
+    /*!
+    * Sizes the grid to the segments and lists the segments of every cell.
+    */
+    void build();
+
+    //! ensureBuilt function
+    /*!
+    * Builds the grid if the segments changed. Not thread safe; called by the queries.
+    */
+    void ensureBuilt() const;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * @param cellSize Side of a grid cell (meters); about the spacing of the obstacles works best.
+    */
+    explicit SimulationWorld(double cellSize = 0.5);
+
+    //! clear function
+    void clear();
+
+    //! addSegment function
+    /*!
+    * Adds one wall from (x0, y0) to (x1, y1).
+    */
+    void addSegment(double x0, double y0, double x1, double y1);
+
+    //! addPolygon function
+    /*!
+    * Adds the edges of a polygon.
+    * @param xy Vertices as x0, y0, x1, y1, ...
+    * @param count Number of vertices.
+    * @param closed Also add the edge from the last vertex back to the first.
+    */
+    void addPolygon(const double* xy, int count, bool closed = true);
+
+    //! addBox function
+    /*!
+    * Adds an axis-aligned rectangle with corners (x0, y0) and (x1, y1).
+    */
+    void addBox(double x0, double y0, double x1, double y1);
+
+    //! prepare function
+    /*!
+    * Builds the grid now, so the first query after a change does not, and several
+    * threads can query at once.
+    */
+    void prepare();
+
+    //! castRay function
+    /*!
+    * @param x Ray origin (meters).
+    * @param y Ray origin (meters).
+    * @param angle Ray direction (radians).
+    * @param maxRange Longest range returned (meters).
+    * @return the distance to the first wall along the ray, or maxRange if there is none closer.
+    */
+    double castRay(double x, double y, double angle, double maxRange) const;
+
+    //! castRayBruteForce function
+    /*!
+    * Same as castRay() but tests every segment; the reference for tests and benchmarks.
+    */
+    double castRayBruteForce(double x, double y, double angle, double maxRange) const;
+
+    //! collides function
+    /*!
+    * @return true if a disc of the given radius at (x, y) touches a wall.
+    */
+    bool collides(double x, double y, double radius) const;
+
+    //! getSegments function
+    const std::vector<WallSegment>& getSegments() const;
+
+    //! getCellSize function
+    /*!
+    * @return the cell side of the built grid (meters).
+    */
+    double getCellSize() const;
+};
@@ -0,0 +1,154 @@
+#pragma once
+/**
+ * @file   SpscRing.h
+ * @date   October, 2026
+ * @brief  Header file for the SpscRing class template.
+ *
+ * This file contains the definition of SpscRing, a bounded lock-free ring buffer for
+ * exactly one producer thread and one consumer thread.
+ */
+
+#include <atomic>
+#include <cstddef>
+
+//! SpscRing class template
+/*!
+ * @brief Bounded lock-free single-producer/single-consumer queue.
+ *
+ * Slots are preallocated inside the object. The producer fills a slot in place with
+ * beginWrite()/commitWrite() (or copies one in with tryPush()), and the consumer reads
+ * it in place with front()/pop() (or copies it out with tryPop()). No call ever blocks
+ * or allocates. The head and tail indices live on separate cache lines, and each side
+ * keeps a cached copy of the other side's index so it only touches the shared line when
+ * the ring looks full or empty.
+ *
+ * @tparam T Element type, default constructible.
+ * @tparam Capacity Number of slots, a power of two.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    alignas(64) std::atomic<size_t> head; /*!< Next slot the producer writes, owned by the producer. */
+    size_t cachedTail;                    /*!< Producer's last view of tail. */
+    alignas(64) std::atomic<size_t> tail; /*!< Next slot the consumer reads, owned by the consumer. */
+    size_t cachedHead;                    /*!< Consumer's last view of head. */
+    alignas(64) T slots[Capacity];        /*!< Element storage. */
+
+public:
+    //! Default constructor
+    SpscRing() : head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    //! beginWrite function (producer)
+    /*!
+    * @return the next free slot to fill in place, or nullptr if the ring is full.
+    */
+    T* beginWrite() {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cachedTail == Capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail == Capacity) {
+                return nullptr;
+            }
+        }
+        return &slots[h & MASK];
+    }
+
+    //! commitWrite function (producer)
+    /*!
+    * Publishes the slot returned by the last beginWrite().
+    */
+    void commitWrite() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    //! tryPush function (producer)
+    /*!
+    * @param value Element copied into the ring.
+    * @return false if the ring is full.
+    */
+    bool tryPush(const T& value) {
+        T* slot = beginWrite();
+        if (slot == nullptr) {
+            return false;
+        }
+        *slot = value;
+        commitWrite();
+        return true;
+    }
+
+    //! front function (consumer)
+    /*!
+    * @return the oldest published element, or nullptr if the ring is empty.
+    */
+    T* front() {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == cachedHead) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t == cachedHead) {
+                return nullptr;
+            }
+        }
+        return &slots[t & MASK];
+    }
+
+    //! pop function (consumer)
+    /*!
+    * Releases the element returned by front() back to the producer.
+    */
+    void pop() {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    //! tryPop function (consumer)
+    /*!
+    * @param value Receives a copy of the oldest element.
+    * @return false if the ring is empty.
+    */
+    bool tryPop(T& value) {
+        T* slot = front();
+        if (slot == nullptr) {
+            return false;
+        }
+        value = *slot;
+        pop();
+        return true;
+    }
+
+    //! latest function (consumer)
+    /*!
+    * Drops every published element except the newest one.
+    * @return the newest element, or nullptr if the ring is empty. Release it with pop().
+    */
+    T* latest() {
+        size_t h = head.load(std::memory_order_acquire);
+        size_t t = tail.load(std::memory_order_relaxed);
+        cachedHead = h;
+        if (t == h) {
+            return nullptr;
+        }
+        if (h - t > 1) {
+            tail.store(h - 1, std::memory_order_release);
+        }
+        return &slots[(h - 1) & MASK];
+    }
+
+    //! size function
+    /*!
+    * @return the number of published elements; exact only when called from one of the two threads.
+    */
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    //! capacity function
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+};
@@ -0,0 +1,230 @@
+/**
+ * @file TestCommandDispatcher.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestCommandDispatcher class for testing the CommandDispatcher class.
+ */
+
+#include "TestCommandDispatcher.h"
+#include "RobotControler.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static const char* TEST_FILE = "TestCommandDispatcher.txt";
+
+/**
+ * @brief Stand-in robot API that logs motion commands and can be made slow or held.
+ */
+class CountingRobotAPI : public RobotInterface {
+private:
+    mutex lock;
+    condition_variable released;
+    vector<RobotCommand> commands;
+    int delayUs;
+    bool held;
+
+    void log(RobotCommand command) {
+        if (delayUs > 0) {
+            this_thread::sleep_for(chrono::microseconds(delayUs));
+        }
+        unique_lock<mutex> guard(lock);
+        released.wait(guard, [this] { return !held; });
+        commands.push_back(command);
+    }
+
+public:
+    CountingRobotAPI(int delayUs = 0) : delayUs(delayUs), held(false) {}
+
+    // While held, motion calls block before they are logged.
+    void hold() {
+        lock_guard<mutex> guard(lock);
+        held = true;
+    }
+
+    void release() {
+        {
+            lock_guard<mutex> guard(lock);
+            held = false;
+        }
+        released.notify_all();
+    }
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION direction) override {
+        log(direction == FORWARD ? COMMAND_MOVE_FORWARD : direction == BACKWARD ? COMMAND_MOVE_BACKWARD :
+            direction == LEFT ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT);
+    }
+    void rotate(DIRECTION direction) override { log(direction == LEFT ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT); }
+    void stop() override { log(COMMAND_STOP); }
+    double getIRRange(int) override { return 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 0; Y = 0; TH = 0; }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+
+    vector<RobotCommand> getCommands() {
+        lock_guard<mutex> guard(lock);
+        return commands;
+    }
+};
+
+/**
+ * @brief Default constructor for the TestCommandDispatcher class.
+ */
+TestCommandDispatcher::TestCommandDispatcher() {
+    cout << "[TestCommandDispatcher] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestCommandDispatcher class.
+ */
+TestCommandDispatcher::~TestCommandDispatcher() {
+    remove(TEST_FILE);
+    cout << "[TestCommandDispatcher] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the CommandDispatcher class.
+ */
+void TestCommandDispatcher::runAllTests() {
+    cout << "\n================ Starting CommandDispatcher Tests ================\n" << endl;
+
+    testOrderAndCoalescing();
+    testControllerAsync();
+    benchmarkSubmit();
+
+    cout << "\n================ Ending CommandDispatcher Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that commands are issued in order and repeats are coalesced.
+ */
+void TestCommandDispatcher::testOrderAndCoalescing() {
+    cout << "--- Test: Order and Coalescing ---" << endl;
+
+    CountingRobotAPI api;
+    CommandDispatcher dispatcher(&api);
+    cout << "Submit before start is refused: " << (!dispatcher.submit(COMMAND_STOP) ? "PASS" : "FAIL") << endl;
+
+    dispatcher.start();
+    RobotCommand sequence[] = { COMMAND_MOVE_FORWARD, COMMAND_MOVE_FORWARD, COMMAND_MOVE_FORWARD,
+        COMMAND_TURN_LEFT, COMMAND_TURN_LEFT, COMMAND_STOP, COMMAND_STOP };
+    bool accepted = true;
+    for (RobotCommand command : sequence) {
+        accepted = accepted && dispatcher.submit(command);
+    }
+    dispatcher.flush();
+
+    vector<RobotCommand> seen = api.getCommands();
+    bool ordered = seen.size() == 3 && seen[0] == COMMAND_MOVE_FORWARD && seen[1] == COMMAND_TURN_LEFT && seen[2] == COMMAND_STOP;
+    cout << "Commands are accepted: " << (accepted && dispatcher.getSubmittedCount() == 7 ? "PASS" : "FAIL") << endl;
+    cout << "Repeats are dropped, order is kept: " << (ordered ? "PASS" : "FAIL") << endl;
+    cout << "Counters add up: " << (dispatcher.getIssuedCount() == 3 && dispatcher.getCoalescedCount() == 4 ? "PASS" : "FAIL") << endl;
+    cout << "Latency recorded per issued command: " << (dispatcher.getLatency().getCount() == 3 ? "PASS" : "FAIL") << endl;
+
+    // A repeat submitted after the robot state changed must still be sent.
+    dispatcher.submit(COMMAND_MOVE_FORWARD);
+    dispatcher.submit(COMMAND_STOP);
+    dispatcher.submit(COMMAND_MOVE_FORWARD);
+    dispatcher.stop();
+    seen = api.getCommands();
+    cout << "stop() issues what is still queued: " << (seen.size() == 6 && seen[5] == COMMAND_MOVE_FORWARD ? "PASS" : "FAIL") << endl;
+    cout << "Dispatcher stops: " << (!dispatcher.isRunning() && !dispatcher.submit(COMMAND_STOP) ? "PASS" : "FAIL") << endl;
+
+    // After a restart the robot state is unknown, so even a repeat goes out.
+    dispatcher.start();
+    dispatcher.submit(COMMAND_MOVE_FORWARD);
+    dispatcher.stop();
+    cout << "Restart sends the first command: " << (api.getCommands().size() == 7 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests RobotControler with the dispatcher started.
+ * A held API shows that the motion functions return before the command is sent.
+ */
+void TestCommandDispatcher::testControllerAsync() {
+    cout << "\n--- Test: RobotControler Async Mode ---" << endl;
+
+    CountingRobotAPI api(2000);
+    RobotControler rc(&api);
+    rc.connectRobot();
+    cout << "Synchronous by default: " << (!rc.isAsync() && rc.getDispatcher() == nullptr ? "PASS" : "FAIL") << endl;
+
+    rc.startAsync();
+    api.hold();
+    auto start = chrono::steady_clock::now();
+    rc.moveForward();
+    rc.turnLeft();
+    rc.moveBackward();
+    rc.stop();
+    double callMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    bool nothingSent = api.getCommands().empty();
+    api.release();
+    rc.getDispatcher()->flush();
+    cout << "Motion calls return before the API is called: " << (rc.isAsync() && nothingSent ? "PASS" : "FAIL") << endl;
+    cout << "Flush sends the queued commands: " << (api.getCommands().size() == 4 ? "PASS" : "FAIL") << endl;
+    cout << "Four motion calls took " << callMs << " ms" << endl;
+
+    rc.disconnectRobot();
+    vector<RobotCommand> seen = api.getCommands();
+    bool ordered = seen.size() == 4 && seen[0] == COMMAND_MOVE_FORWARD && seen[1] == COMMAND_TURN_LEFT &&
+        seen[2] == COMMAND_MOVE_BACKWARD && seen[3] == COMMAND_STOP;
+    cout << "Disconnect waits for queued commands: " << (ordered ? "PASS" : "FAIL") << endl;
+
+    rc.connectRobot();
+    rc.stopAsync();
+    rc.moveRight();
+    seen = api.getCommands();
+    cout << "stopAsync returns to direct calls: " << (!rc.isAsync() && seen.size() == 5 && seen[4] == COMMAND_MOVE_RIGHT ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the caller-side cost of synchronous and queued commands.
+ *
+ * The synchronous path is what RobotControler did before: the API call plus a console
+ * line, here written to a file so the timing does not depend on the terminal. The
+ * latencies depend on the load of the machine and are only reported.
+ */
+void TestCommandDispatcher::benchmarkSubmit() {
+    cout << "\n--- Benchmark: Command Submit Latency ---" << endl;
+
+    const int rounds = 20000;
+    RobotCommand cycle[] = { COMMAND_MOVE_FORWARD, COMMAND_TURN_LEFT, COMMAND_MOVE_FORWARD, COMMAND_STOP };
+    CountingRobotAPI api;
+
+    LatencyHistogram direct;
+    ofstream sink(TEST_FILE);
+    streambuf* console = cout.rdbuf(sink.rdbuf());
+    for (int i = 0; i < rounds; i++) {
+        auto start = chrono::steady_clock::now();
+        CommandDispatcher::issue(&api, cycle[i % 4]);
+        cout << "RobotControler moved forward." << endl;
+        direct.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    }
+    cout.rdbuf(console);
+
+    LatencyHistogram queued;
+    CommandDispatcher dispatcher(&api);
+    dispatcher.start();
+    for (int i = 0; i < rounds; i++) {
+        auto start = chrono::steady_clock::now();
+        while (!dispatcher.submit(cycle[i % 4])) {
+            dispatcher.flush();
+        }
+        queued.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    }
+    dispatcher.stop();
+
+    direct.print("synchronous call (caller)");
+    queued.print("submit (caller)");
+    dispatcher.getLatency().print("submit-to-API (dispatcher)");
+    cout << "Every command handled: " << (dispatcher.getIssuedCount() + dispatcher.getCoalescedCount() == rounds ? "PASS" : "FAIL") << endl;
+    cout << "Submit against synchronous call at p50: " << queued.getPercentile(50) << " ns vs " << direct.getPercentile(50) << " ns" << endl;
+}
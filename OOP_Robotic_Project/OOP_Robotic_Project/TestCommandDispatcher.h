@@ -0,0 +1,52 @@
+#pragma once
+
+/**
+ * @file TestCommandDispatcher.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestCommandDispatcher class for testing the CommandDispatcher class.
+ *
+ * This file contains the class declaration for testing queued motion commands, both
+ * directly and through RobotControler, and for measuring the time a caller spends
+ * issuing a command.
+ */
+
+#include "CommandDispatcher.h"
+
+ /**
+  * @class TestCommandDispatcher
+  * @brief A class to test the functionality of the CommandDispatcher class.
+  */
+class TestCommandDispatcher {
+public:
+    /**
+     * @brief Default constructor for TestCommandDispatcher.
+     */
+    TestCommandDispatcher();
+
+    /**
+     * @brief Destructor for TestCommandDispatcher.
+     */
+    ~TestCommandDispatcher();
+
+    /**
+     * @brief Runs all test cases for the CommandDispatcher class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that commands are issued in order and repeats are coalesced.
+     */
+    void testOrderAndCoalescing();
+
+    /**
+     * @brief Tests RobotControler with the dispatcher started.
+     */
+    void testControllerAsync();
+
+    /**
+     * @brief Compares the caller-side cost of synchronous and queued commands.
+     */
+    void benchmarkSubmit();
+};
@@ -0,0 +1,241 @@
+/**
+ * @file TestControlLoop.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestControlLoop class for testing the ControlLoop class.
+ */
+
+#include "TestControlLoop.h"
+#include "RobotControler.h"
+#include "SafeNavigation.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Stand-in robot API that records motion commands and sees a wall coming closer
+ * ahead while it moves forward.
+ */
+class ApproachingRobotAPI : public RobotInterface {
+public:
+    vector<RobotCommand> commands;
+    double frontRange;
+    bool moving;
+
+    ApproachingRobotAPI() : frontRange(1.0), moving(false) {}
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION direction) override {
+        commands.push_back(direction == FORWARD ? COMMAND_MOVE_FORWARD : direction == BACKWARD ? COMMAND_MOVE_BACKWARD :
+            direction == LEFT ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT);
+        moving = direction == FORWARD;
+    }
+    void rotate(DIRECTION direction) override {
+        commands.push_back(direction == LEFT ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT);
+        moving = false;
+    }
+    void stop() override {
+        commands.push_back(COMMAND_STOP);
+        moving = false;
+    }
+    double getIRRange(int i) override { return i == 0 ? frontRange : 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 1.0 - frontRange; Y = 0; TH = 0; }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+};
+
+/**
+ * @brief Busy-waits for a duration, standing in for a task that takes too long.
+ */
+static void spin(long long durationNs) {
+    long long end = ControlLoop::nowNs() + durationNs;
+    while (ControlLoop::nowNs() < end) {
+    }
+}
+
+/**
+ * @brief Default constructor for the TestControlLoop class.
+ */
+TestControlLoop::TestControlLoop() {
+    cout << "[TestControlLoop] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestControlLoop class.
+ */
+TestControlLoop::~TestControlLoop() {
+    cout << "[TestControlLoop] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the ControlLoop class.
+ */
+void TestControlLoop::runAllTests() {
+    cout << "\n================ Starting ControlLoop Tests ================\n" << endl;
+
+    testRates();
+    testOverrun();
+    testRobotControler();
+    testThread();
+
+    cout << "\n================ Ending ControlLoop Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that tasks run at their rates and that releases do not drift.
+ *
+ * Every release in the run window is either run or skipped, so runs + skipped is the
+ * number of periods; the window starts a little before the first release, which may
+ * cost the last one. The lateness of the last run and the drift of the same number of
+ * relative sleeps depend on the load of the machine, so they are only reported.
+ */
+void TestControlLoop::testRates() {
+    cout << "--- Test: Task Rates ---" << endl;
+
+    const long long durationUs = 200000;
+    ControlLoop loop;
+    vector<long long> starts;
+    starts.reserve(256);
+    int fast = loop.addTask("fast", 1000, [&starts]() { starts.push_back(ControlLoop::nowNs()); });
+    int slow = loop.addTask("slow", 5000, []() {});
+    int invalid = loop.addTask("bad", 0, []() {});
+    cout << "Invalid period is refused: " << (invalid == -1 ? "PASS" : "FAIL") << endl;
+
+    loop.runFor(durationUs);
+    loop.printStats();
+    const ControlTaskStats& fastStats = loop.getStats(fast);
+    const ControlTaskStats& slowStats = loop.getStats(slow);
+    unsigned long long fastReleases = fastStats.runs + fastStats.skipped;
+    unsigned long long slowReleases = slowStats.runs + slowStats.skipped;
+    cout << "Every release of the 1 ms task is accounted for: " << (fastReleases >= 199 && fastReleases <= 200 ? "PASS" : "FAIL") << endl;
+    cout << "Every release of the 5 ms task is accounted for: " << (slowReleases >= 39 && slowReleases <= 40 ? "PASS" : "FAIL") << endl;
+
+    // Start of run k minus release k; a relative sleep would let this grow with k.
+    long long origin = starts.empty() ? 0 : starts[0];
+    long long lastLateness = 0;
+    bool onGrid = fastStats.skipped == 0 && starts.size() == fastStats.runs;
+    for (size_t k = 0; onGrid && k < starts.size(); k++) {
+        lastLateness = starts[k] - origin - static_cast<long long>(k) * 1000000;
+    }
+    long long relativeStart = ControlLoop::nowNs();
+    for (size_t k = 1; k < starts.size(); k++) {
+        this_thread::sleep_for(chrono::microseconds(1000));
+    }
+    long long relativeDrift = ControlLoop::nowNs() - relativeStart - static_cast<long long>(starts.size() - 1) * 1000000;
+    cout << "Lateness of the last run: " << lastLateness << " ns, drift of " << starts.size() - 1 << " relative sleeps: " << relativeDrift << " ns" << endl;
+}
+
+/**
+ * @brief Tests that an overrun is counted and skips the missed releases.
+ *
+ * The 2 ms task spins for 7 ms on its sixth run, released at 10 ms: it ends at about
+ * 17 ms, so the releases at 12, 14 and 16 ms are skipped and it runs again at 18 ms.
+ * The 1 ms task below it cannot run meanwhile and misses its releases too. A run that
+ * ends after the run window only skips the releases inside the window.
+ */
+void TestControlLoop::testOverrun() {
+    cout << "\n--- Test: Overrun Detection ---" << endl;
+
+    ControlLoop loop;
+    int runs = 0;
+    int heavy = loop.addTask("heavy", 2000, [&runs]() {
+        if (runs++ == 5) {
+            spin(7000000);
+        }
+    });
+    int light = loop.addTask("light", 1000, []() {});
+    loop.runFor(40000);
+    loop.printStats();
+
+    const ControlTaskStats& heavyStats = loop.getStats(heavy);
+    const ControlTaskStats& lightStats = loop.getStats(light);
+    cout << "Overrun is counted once: " << (heavyStats.overruns >= 1 && heavyStats.duration.getMax() >= 7000000 ? "PASS" : "FAIL") << endl;
+    unsigned long long heavyReleases = heavyStats.runs + heavyStats.skipped;
+    unsigned long long lightReleases = lightStats.runs + lightStats.skipped;
+    cout << "Missed releases are skipped, not run late: " << (heavyStats.skipped >= 3 && heavyReleases >= 19 && heavyReleases <= 20 ? "PASS" : "FAIL") << endl;
+    cout << "Lower priority task records the delay: " << (lightStats.jitter.getMax() >= 5000000 && lightReleases >= 39 && lightReleases <= 40 ? "PASS" : "FAIL") << endl;
+
+    ControlLoop late;
+    int last = late.addTask("last", 1000, []() { spin(30000000); });
+    late.runFor(10000);
+    const ControlTaskStats& lastStats = late.getStats(last);
+    unsigned long long lastReleases = lastStats.runs + lastStats.skipped;
+    cout << "Releases after the window are not counted: " << (lastStats.runs == 1 && lastReleases >= 9 && lastReleases <= 10 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests driving a RobotControler through SafeNavigation from fixed-rate tasks.
+ *
+ * A 2 ms task reads the IR ranges and a 4 ms task checks them and asks to move
+ * forward. Each sensor read while moving brings the wall 5 mm closer, so the safety
+ * check stops the robot once the front range falls below 0.2 m, without any Sleep().
+ */
+void TestControlLoop::testRobotControler() {
+    cout << "\n--- Test: Driving RobotControler ---" << endl;
+
+    ApproachingRobotAPI api;
+    RobotControler rc(&api);
+    rc.connectRobot();
+    SafeNavigation navigation(&rc);
+    double ir[IRSensor::SENSOR_COUNT];
+    for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+        ir[i] = 1.0;
+    }
+    RobotCommand running = COMMAND_STOP;
+    int logged = 0;
+
+    ControlLoop loop;
+    loop.addTask("sensors", 2000, [&]() {
+        if (api.moving) {
+            api.frontRange -= 0.005;
+        }
+        for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+            ir[i] = api.getIRRange(i);
+        }
+    });
+    loop.addTask("safety", 4000, [&]() {
+        navigation.update(ir, nullptr, 0);
+        running = navigation.move(FORWARD);
+    });
+    loop.addTask("log", 50000, [&]() { logged++; });
+    loop.runFor(500000);
+    loop.printStats();
+    rc.disconnectRobot();
+
+    cout << "Front range when stopped: " << api.frontRange << " m" << endl;
+    cout << "Robot moved, then was stopped by the safety task: " << (api.commands.size() == 2 && api.commands[0] == COMMAND_MOVE_FORWARD
+        && api.commands[1] == COMMAND_STOP && running == COMMAND_STOP ? "PASS" : "FAIL") << endl;
+    cout << "Robot stopped within one safety period: " << (api.frontRange < 0.2 && api.frontRange > 0.2 - 3 * 0.005 ? "PASS" : "FAIL") << endl;
+    unsigned long long logReleases = logged + loop.getStats(2).skipped;
+    cout << "Logging task ran at its rate: " << (logReleases >= 9 && logReleases <= 10 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Runs the loop on its own thread with CPU pinning and SCHED_FIFO requested.
+ *
+ * Both requests may be refused without privileges; the loop must run either way.
+ */
+void TestControlLoop::testThread() {
+    cout << "\n--- Test: Loop Thread ---" << endl;
+
+    ControlLoop loop;
+    atomic<int> runs(0);
+    int task = loop.addTask("tick", 1000, [&runs]() { runs.fetch_add(1, memory_order_relaxed); });
+    loop.setCpu(0);
+    loop.setRealtimePriority(10);
+    bool started = loop.start();
+    int late = loop.addTask("late", 1000, []() {});
+    cout << "Task refused while running: " << (late == -1 ? "PASS" : "FAIL") << endl;
+    ControlLoop::sleepUntil(ControlLoop::nowNs() + 50000000);
+    loop.stop();
+    loop.printStats();
+
+    cout << "Pinned to CPU 0: " << (loop.isPinned() ? "yes" : "no") << ", SCHED_FIFO: " << (loop.isRealtime() ? "yes" : "no") << endl;
+    cout << "Loop thread ran " << runs.load() << " times in 50 ms" << endl;
+    cout << "Loop thread runs and stops: " << (started && !loop.isRunning() && runs.load() >= 1 && runs.load() <= 60
+        && static_cast<int>(loop.getStats(task).runs) == runs.load() ? "PASS" : "FAIL") << endl;
+}
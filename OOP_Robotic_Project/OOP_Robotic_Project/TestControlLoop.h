@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file TestControlLoop.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestControlLoop class for testing the ControlLoop class.
+ *
+ * This file contains the class declaration for testing task rates, drift, overrun
+ * handling and driving a RobotControler from fixed-rate tasks.
+ */
+
+#include "ControlLoop.h"
+
+ /**
+  * @class TestControlLoop
+  * @brief A class to test the functionality of the ControlLoop class.
+  */
+class TestControlLoop {
+public:
+    /**
+     * @brief Default constructor for TestControlLoop.
+     */
+    TestControlLoop();
+
+    /**
+     * @brief Destructor for TestControlLoop.
+     */
+    ~TestControlLoop();
+
+    /**
+     * @brief Runs all test cases for the ControlLoop class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that tasks run at their rates and that releases do not drift.
+     */
+    void testRates();
+
+    /**
+     * @brief Tests that an overrun is counted and skips the missed releases.
+     */
+    void testOverrun();
+
+    /**
+     * @brief Tests driving a RobotControler through SafeNavigation from fixed-rate tasks.
+     */
+    void testRobotControler();
+
+    /**
+     * @brief Runs the loop on its own thread with CPU pinning and SCHED_FIFO requested.
+     */
+    void testThread();
+};
@@ -0,0 +1,381 @@
+/**
+ * @file TestEncryption.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestEncryption class for testing the Encryption, EncryptedWriter and EncryptedReader classes.
+ */
+
+#include "TestEncryption.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const char* TEST_FILE = "TestEncryption.bin";
+
+static const char SUNSCREEN[] = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+    "sunscreen would be it.";
+
+/**
+ * @brief Converts a hexadecimal string to bytes.
+ */
+static vector<uint8_t> fromHex(const string& hex) {
+    vector<uint8_t> bytes;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        bytes.push_back(static_cast<uint8_t>(stoi(hex.substr(i, 2), nullptr, 16)));
+    }
+    return bytes;
+}
+
+/**
+ * @brief Returns the bytes of a file.
+ */
+static vector<uint8_t> readFile(const char* path) {
+    ifstream file(path, ios::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+/**
+ * @brief Replaces the contents of a file.
+ */
+static void writeFile(const char* path, const vector<uint8_t>& bytes, size_t size) {
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<streamsize>(size));
+}
+
+/**
+ * @brief Returns the test key 0, 1, ..., 31 plus offset.
+ */
+static vector<uint8_t> testKey(int offset) {
+    vector<uint8_t> key(Encryption::KEY_SIZE);
+    for (int i = 0; i < Encryption::KEY_SIZE; i++) {
+        key[i] = static_cast<uint8_t>(i + offset);
+    }
+    return key;
+}
+
+/**
+ * @brief Default constructor for the TestEncryption class.
+ */
+TestEncryption::TestEncryption() {
+    cout << "[TestEncryption] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestEncryption class.
+ */
+TestEncryption::~TestEncryption() {
+    remove(TEST_FILE);
+    cout << "[TestEncryption] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the Encryption classes.
+ */
+void TestEncryption::runAllTests() {
+    cout << "\n================ Starting Encryption Tests ================\n" << endl;
+
+    testChaCha20();
+    testPoly1305();
+    testAead();
+    testStream();
+    benchmarkThroughput();
+
+    cout << "\n================ Ending Encryption Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests the ChaCha20 key stream against RFC 8439 and the vector path against single blocks.
+ *
+ * The RFC vector (section 2.4.2) is two blocks, which the scalar code handles. A long
+ * message goes through the 4- or 8-block path and must match encrypting it one block
+ * at a time with the counter advanced by hand.
+ */
+void TestEncryption::testChaCha20() {
+    cout << "--- Test: ChaCha20 ---" << endl;
+
+    vector<uint8_t> key = testKey(0);
+    vector<uint8_t> nonce = fromHex("000000000000004a00000000");
+    vector<uint8_t> expected = fromHex("6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0bf91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d807ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab77937365af90bbf74a35be6b40b8eedf2785e42874d");
+    size_t size = sizeof(SUNSCREEN) - 1;
+    vector<uint8_t> out(size);
+    Encryption::chacha20(key.data(), nonce.data(), 1, reinterpret_cast<const uint8_t*>(SUNSCREEN), out.data(), size);
+    cout << "Key stream matches RFC 8439 section 2.4.2: " << (out == expected ? "PASS" : "FAIL") << endl;
+
+    const size_t length = 64 * 37 + 11;
+    vector<uint8_t> message(length);
+    for (size_t i = 0; i < length; i++) {
+        message[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+    vector<uint8_t> wide(length);
+    vector<uint8_t> single(length);
+    Encryption::chacha20(key.data(), nonce.data(), 7, message.data(), wide.data(), length);
+    for (size_t offset = 0; offset < length; offset += 64) {
+        size_t n = length - offset < 64 ? length - offset : 64;
+        Encryption::chacha20(key.data(), nonce.data(), static_cast<uint32_t>(7 + offset / 64), message.data() + offset, single.data() + offset, n);
+    }
+    cout << "Vector path matches block-by-block encryption: " << (wide == single ? "PASS" : "FAIL") << endl;
+
+    Encryption::chacha20(key.data(), nonce.data(), 7, wide.data(), wide.data(), length);
+    cout << "Encrypting twice in place restores the message: " << (wide == message ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests Poly1305 against RFC 8439.
+ *
+ * Section 2.5.2 covers a partial last block. A key with r = 0 gives tag s for any
+ * message, and an all-ones block with r = 2 and s = 0 (appendix A.3, vector 5) checks
+ * the final reduction mod 2^130 - 5.
+ */
+void TestEncryption::testPoly1305() {
+    cout << "\n--- Test: Poly1305 ---" << endl;
+
+    vector<uint8_t> key = fromHex("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b");
+    const char message[] = "Cryptographic Forum Research Group";
+    uint8_t tag[Encryption::TAG_SIZE];
+    Encryption::poly1305(key.data(), reinterpret_cast<const uint8_t*>(message), sizeof(message) - 1, tag);
+    vector<uint8_t> expected = fromHex("a8061dc1305136c6c22b8baf0c0127a9");
+    cout << "Tag matches RFC 8439 section 2.5.2: " << (memcmp(tag, expected.data(), sizeof(tag)) == 0 ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> zeroR(32, 0);
+    for (int i = 16; i < 32; i++) {
+        zeroR[i] = static_cast<uint8_t>(i);
+    }
+    Encryption::poly1305(zeroR.data(), reinterpret_cast<const uint8_t*>(message), sizeof(message) - 1, tag);
+    cout << "With r = 0 the tag is s: " << (memcmp(tag, zeroR.data() + 16, sizeof(tag)) == 0 ? "PASS" : "FAIL") << endl;
+
+    // h ends at 2^130 - 5 + 3, which only the final reduction brings down to 3
+    vector<uint8_t> one(32, 0);
+    one[0] = 2;
+    vector<uint8_t> ones(16, 0xff);
+    Encryption::poly1305(one.data(), ones.data(), ones.size(), tag);
+    vector<uint8_t> reduced = fromHex("03000000000000000000000000000000");
+    cout << "Final reduction mod 2^130 - 5: " << (memcmp(tag, reduced.data(), sizeof(tag)) == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests seal() and open() against RFC 8439 and that changed messages are rejected.
+ *
+ * The long message (4099 bytes, 13 bytes of associated data) exercises the vector
+ * path and both padding cases; its tag was computed with an independent implementation.
+ */
+void TestEncryption::testAead() {
+    cout << "\n--- Test: AEAD ---" << endl;
+
+    vector<uint8_t> key = testKey(0x80);
+    vector<uint8_t> nonce = fromHex("070000004041424344454647");
+    vector<uint8_t> aad = fromHex("50515253c0c1c2c3c4c5c6c7");
+    vector<uint8_t> expected = fromHex("d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d63dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b3692ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc3ff4def08e4b7a9de576d26586cec64b6116"
+        "1ae10b594f09e26a7e902ecbd0600691");
+    size_t size = sizeof(SUNSCREEN) - 1;
+    Encryption cipher(key.data());
+    vector<uint8_t> sealed(size + Encryption::TAG_SIZE);
+    cipher.seal(nonce.data(), aad.data(), aad.size(), reinterpret_cast<const uint8_t*>(SUNSCREEN), size, sealed.data());
+    cout << "Ciphertext and tag match RFC 8439 section 2.8.2: " << (sealed == expected ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> opened(size);
+    bool ok = cipher.open(nonce.data(), aad.data(), aad.size(), sealed.data(), sealed.size(), opened.data());
+    cout << "open() restores the message: " << (ok && memcmp(opened.data(), SUNSCREEN, size) == 0 ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> untouched(size, 0x5a);
+    vector<uint8_t> changed = sealed;
+    changed[40] ^= 0x01;
+    bool ciphertextRejected = !cipher.open(nonce.data(), aad.data(), aad.size(), changed.data(), changed.size(), untouched.data());
+    changed = sealed;
+    changed[size + 3] ^= 0x80;
+    bool tagRejected = !cipher.open(nonce.data(), aad.data(), aad.size(), changed.data(), changed.size(), untouched.data());
+    vector<uint8_t> otherAad = aad;
+    otherAad[0] ^= 0x01;
+    bool aadRejected = !cipher.open(nonce.data(), otherAad.data(), otherAad.size(), sealed.data(), sealed.size(), untouched.data());
+    bool shortRejected = !cipher.open(nonce.data(), aad.data(), aad.size(), sealed.data(), Encryption::TAG_SIZE - 1, untouched.data());
+    bool outputKept = untouched == vector<uint8_t>(size, 0x5a);
+    cout << "Changed ciphertext, tag or associated data is rejected: "
+        << (ciphertextRejected && tagRejected && aadRejected && shortRejected && outputKept ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> longKey(Encryption::KEY_SIZE);
+    for (int i = 0; i < Encryption::KEY_SIZE; i++) {
+        longKey[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    uint8_t longNonce[Encryption::NONCE_SIZE];
+    Encryption::makeNonce(0x01020304, 5, longNonce);
+    vector<uint8_t> longAad(13);
+    for (size_t i = 0; i < longAad.size(); i++) {
+        longAad[i] = static_cast<uint8_t>(i * 5 + 1);
+    }
+    const size_t length = 4099;
+    vector<uint8_t> message(length + Encryption::TAG_SIZE);
+    for (size_t i = 0; i < length; i++) {
+        message[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+    vector<uint8_t> original(message.begin(), message.begin() + length);
+    Encryption longCipher(longKey.data());
+    longCipher.seal(longNonce, longAad.data(), longAad.size(), message.data(), length, message.data());
+    vector<uint8_t> longTag = fromHex("53db455eeb0ba26dd5c5542e078b8c8f");
+    bool tagMatches = memcmp(message.data() + length, longTag.data(), Encryption::TAG_SIZE) == 0;
+    bool reopened = longCipher.open(longNonce, longAad.data(), longAad.size(), message.data(), message.size(), message.data());
+    cout << "Long message sealed and opened in place: "
+        << (tagMatches && reopened && equal(original.begin(), original.end(), message.begin()) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests writing and reading an encrypted file, and detection of changed, cut and misread files.
+ *
+ * Frames of random length are written through small chunks so the background thread
+ * is kept busy, then read back at random offsets. Copies of the file with one byte
+ * flipped, two chunks swapped or the final chunk removed must fail exactly where
+ * they were changed, and the wrong key must read nothing.
+ */
+void TestEncryption::testStream() {
+    cout << "\n--- Test: Encrypted File ---" << endl;
+
+    vector<uint8_t> key = testKey(0x40);
+    const uint32_t chunkSize = 4096;
+    srand(21);
+    vector<uint8_t> data;
+    EncryptedWriter writer;
+    bool written = writer.open(TEST_FILE, key.data(), chunkSize);
+    for (int frame = 0; frame < 2000; frame++) {
+        vector<uint8_t> bytes(37 + rand() % 300);
+        for (uint8_t& b : bytes) {
+            b = static_cast<uint8_t>(rand());
+        }
+        written &= writer.write(bytes.data(), bytes.size());
+        data.insert(data.end(), bytes.begin(), bytes.end());
+    }
+    written &= writer.getBytesWritten() == data.size();
+    written &= writer.close();
+    cout << "Writer seals " << data.size() << " bytes in " << (data.size() + chunkSize - 1) / chunkSize << " chunks, "
+        << writer.getStallCount() << " stalls: " << (written ? "PASS" : "FAIL") << endl;
+
+    EncryptedReader reader;
+    bool readable = reader.open(TEST_FILE, key.data()) && reader.getSize() == data.size();
+    vector<uint8_t> all(data.size());
+    readable &= reader.read(0, all.data(), all.size()) == data.size() && all == data;
+    for (int i = 0; i < 200 && readable; i++) {
+        uint64_t offset = static_cast<uint64_t>(rand()) % data.size();
+        size_t count = static_cast<size_t>(rand() % 10000);
+        vector<uint8_t> part(count);
+        size_t expected = static_cast<size_t>(min<uint64_t>(count, data.size() - offset));
+        readable &= reader.read(offset, part.data(), count) == expected
+            && equal(part.begin(), part.begin() + expected, data.begin() + static_cast<ptrdiff_t>(offset));
+    }
+    readable &= reader.read(data.size(), all.data(), 10) == 0 && reader.getFailureCount() == 0;
+    reader.close();
+    cout << "Whole file and random ranges read back: " << (readable ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> file = readFile(TEST_FILE);
+    const size_t header = sizeof(EncryptedFileHeader);
+    const size_t sealedChunk = chunkSize + Encryption::TAG_SIZE;
+    vector<uint8_t> buffer(chunkSize);
+
+    vector<uint8_t> flipped = file;
+    flipped[header + 3 * sealedChunk + 100] ^= 0x04;
+    writeFile(TEST_FILE, flipped, flipped.size());
+    reader.open(TEST_FILE, key.data());
+    bool flipDetected = reader.read(3 * chunkSize, buffer.data(), chunkSize) == 0
+        && reader.read(2 * chunkSize, buffer.data(), chunkSize) == chunkSize
+        && reader.read(4 * chunkSize, buffer.data(), chunkSize) == chunkSize && reader.getFailureCount() == 1;
+    cout << "A flipped byte fails its chunk only: " << (flipDetected ? "PASS" : "FAIL") << endl;
+
+    vector<uint8_t> swapped = file;
+    swap_ranges(swapped.begin() + header + sealedChunk, swapped.begin() + header + 2 * sealedChunk, swapped.begin() + header + 2 * sealedChunk);
+    writeFile(TEST_FILE, swapped, swapped.size());
+    reader.open(TEST_FILE, key.data());
+    bool swapDetected = reader.read(chunkSize, buffer.data(), chunkSize) == 0 && reader.read(2 * chunkSize, buffer.data(), chunkSize) == 0;
+    cout << "Swapped chunks are rejected: " << (swapDetected ? "PASS" : "FAIL") << endl;
+
+    size_t fullChunks = data.size() / chunkSize;
+    writeFile(TEST_FILE, file, header + fullChunks * sealedChunk);
+    bool opened = reader.open(TEST_FILE, key.data());
+    bool cutDetected = opened && reader.read(0, all.data(), all.size()) == (fullChunks - 1) * chunkSize && reader.getFailureCount() == 1;
+    cout << "A file cut at a chunk boundary is detected: " << (cutDetected ? "PASS" : "FAIL") << endl;
+
+    writeFile(TEST_FILE, file, file.size());
+    vector<uint8_t> wrongKey = testKey(0x41);
+    reader.open(TEST_FILE, wrongKey.data());
+    cout << "The wrong key reads nothing: " << (reader.read(0, all.data(), all.size()) == 0 ? "PASS" : "FAIL") << endl;
+    reader.close();
+
+    writer.open(TEST_FILE, key.data(), chunkSize);
+    bool empty = writer.close() && reader.open(TEST_FILE, key.data()) && reader.getSize() == 0 && reader.read(0, buffer.data(), 1) == 0;
+    reader.close();
+    writer.open(TEST_FILE, key.data(), chunkSize);
+    writer.write(data.data(), 2 * chunkSize);
+    bool exact = writer.close() && reader.open(TEST_FILE, key.data()) && reader.getSize() == 2 * chunkSize
+        && reader.read(0, all.data(), all.size()) == 2 * chunkSize && equal(data.begin(), data.begin() + 2 * chunkSize, all.begin());
+    reader.close();
+    cout << "Empty files and files of whole chunks round-trip: " << (empty && exact ? "PASS" : "FAIL") << endl;
+
+    const char text[] = "this is not an encrypted file, only some text that is long enough for a header and a tag";
+    writeFile(TEST_FILE, vector<uint8_t>(text, text + sizeof(text)), sizeof(text));
+    bool rejected = !reader.open(TEST_FILE, key.data());
+    cout << "Reader rejects a file that is not encrypted: " << (rejected ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures the throughput of ChaCha20, Poly1305, seal(), open() and EncryptedWriter.
+ *
+ * Each primitive runs over a 16 MB buffer. The writer test writes 64 MB in 4 KB
+ * frames, the size of a lidar record, and includes close(). The rates are compared
+ * with the 100 MB/s a recorded run could produce, but only reported, since they depend
+ * on the load of the machine; the known-answer, tamper and seek tests cover correctness.
+ */
+void TestEncryption::benchmarkThroughput() {
+    cout << "\n--- Benchmark: Encryption Throughput ---" << endl;
+
+    const size_t size = 16 << 20;
+    vector<uint8_t> key = testKey(0x10);
+    uint8_t nonce[Encryption::NONCE_SIZE];
+    Encryption::makeNonce(1, 2, nonce);
+    vector<uint8_t> buffer(size + Encryption::TAG_SIZE);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = static_cast<uint8_t>(i);
+    }
+    Encryption cipher(key.data());
+    uint8_t tag[Encryption::TAG_SIZE];
+
+    double slowest = 1e30;
+    auto measure = [&](const char* name, size_t bytes, int repeats, auto body) {
+        body();
+        auto start = chrono::steady_clock::now();
+        for (int r = 0; r < repeats; r++) {
+            body();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double rate = static_cast<double>(bytes) * repeats / seconds / 1e9;
+        slowest = rate < slowest ? rate : slowest;
+        cout << name << ": " << rate << " GB/s" << endl;
+    };
+    measure("ChaCha20", size, 8, [&] { Encryption::chacha20(key.data(), nonce, 1, buffer.data(), buffer.data(), size); });
+    measure("Poly1305", size, 8, [&] { Encryption::poly1305(key.data(), buffer.data(), size, tag); });
+    measure("seal()", size, 8, [&] { cipher.seal(nonce, nullptr, 0, buffer.data(), size, buffer.data()); });
+    cipher.seal(nonce, nullptr, 0, buffer.data(), size, buffer.data());
+    bool opened = true;
+    measure("open() and seal()", size, 4, [&] {
+        opened &= cipher.open(nonce, nullptr, 0, buffer.data(), size + Encryption::TAG_SIZE, buffer.data());
+        cipher.seal(nonce, nullptr, 0, buffer.data(), size, buffer.data());
+    });
+
+    const size_t frame = 4096;
+    const size_t total = 64 << 20;
+    uint64_t stalls = 0;
+    measure("EncryptedWriter", total, 1, [&] {
+        EncryptedWriter writer;
+        writer.open(TEST_FILE, key.data());
+        for (size_t written = 0; written < total; written += frame) {
+            writer.write(buffer.data() + written % size, frame);
+        }
+        writer.close();
+        stalls = writer.getStallCount();
+    });
+    cout << "Writer stalls for " << total / frame << " frames: " << stalls << endl;
+    cout << "Slowest path: " << slowest * 1000.0 << " MB/s (a recorded run needs 100 MB/s)" << endl;
+    cout << "Every sealed buffer opens: " << (opened ? "PASS" : "FAIL") << endl;
+}
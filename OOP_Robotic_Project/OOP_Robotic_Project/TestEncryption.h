@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @file TestEncryption.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestEncryption class for testing the Encryption, EncryptedWriter and EncryptedReader classes.
+ *
+ * This file contains the class declaration for testing ChaCha20, Poly1305 and the
+ * AEAD construction against the RFC 8439 vectors, the encrypted file format and its
+ * tamper detection, and for measuring encryption throughput.
+ */
+
+#include "Encryption.h"
+
+ /**
+  * @class TestEncryption
+  * @brief A class to test the functionality of the Encryption, EncryptedWriter and EncryptedReader classes.
+  */
+class TestEncryption {
+public:
+    /**
+     * @brief Default constructor for TestEncryption.
+     */
+    TestEncryption();
+
+    /**
+     * @brief Destructor for TestEncryption.
+     */
+    ~TestEncryption();
+
+    /**
+     * @brief Runs all test cases for the Encryption classes.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests the ChaCha20 key stream against RFC 8439 and the vector path against single blocks.
+     */
+    void testChaCha20();
+
+    /**
+     * @brief Tests Poly1305 against RFC 8439.
+     */
+    void testPoly1305();
+
+    /**
+     * @brief Tests seal() and open() against RFC 8439 and that changed messages are rejected.
+     */
+    void testAead();
+
+    /**
+     * @brief Tests writing and reading an encrypted file, and detection of changed, cut and misread files.
+     */
+    void testStream();
+
+    /**
+     * @brief Measures the throughput of ChaCha20, Poly1305, seal(), open() and EncryptedWriter.
+     */
+    void benchmarkThroughput();
+};
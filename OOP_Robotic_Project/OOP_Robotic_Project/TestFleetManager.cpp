@@ -0,0 +1,282 @@
+/**
+ * @file TestFleetManager.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestFleetManager class for testing the FleetManager and
+ * WorkStealingPool classes.
+ */
+
+#include "TestFleetManager.h"
+#include "Logger.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Returns a random value in [low, high).
+ */
+static double uniform(double low, double high) {
+    return low + (high - low) * (rand() / (RAND_MAX + 1.0));
+}
+
+/**
+ * @brief Fills a world with a square room of the given side and count boxes inside.
+ */
+static void buildWorld(SimulationWorld& world, double size, int count, unsigned int seed) {
+    srand(seed);
+    double half = size / 2.0;
+    world.addBox(-half, -half, half, half);
+    for (int i = 0; i < count; i++) {
+        double cx = uniform(-half + 1.0, half - 1.0);
+        double cy = uniform(-half + 1.0, half - 1.0);
+        double r = uniform(0.1, 0.5);
+        world.addBox(cx - r, cy - r, cx + r, cy + r);
+    }
+    world.prepare();
+}
+
+/**
+ * @brief Adds count robots at random free poses of the world.
+ */
+static void addRobots(FleetManager& fleet, const SimulationWorld& world, double size, int count, unsigned int seed) {
+    srand(seed);
+    double half = size / 2.0 - 0.5;
+    while (fleet.getRobotCount() < count) {
+        double x = uniform(-half, half);
+        double y = uniform(-half, half);
+        if (!world.collides(x, y, 0.3)) {
+            fleet.addRobot(x, y, uniform(-PI, PI));
+        }
+    }
+}
+
+/**
+ * @brief Returns the pose, collision count and blocked count of every robot.
+ */
+static vector<double> fleetState(const FleetManager& fleet) {
+    vector<double> state;
+    for (int i = 0; i < fleet.getRobotCount(); i++) {
+        const FleetRobot& slot = fleet.getRobot(i);
+        double x = 0.0;
+        double y = 0.0;
+        double th = 0.0;
+        slot.robot->getXYTh(x, y, th);
+        state.push_back(x);
+        state.push_back(y);
+        state.push_back(th);
+        state.push_back(static_cast<double>(slot.robot->getCollisionCount()));
+        state.push_back(static_cast<double>(slot.blocked));
+    }
+    return state;
+}
+
+/**
+ * @brief Default constructor for the TestFleetManager class.
+ */
+TestFleetManager::TestFleetManager() {
+    cout << "[TestFleetManager] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestFleetManager class.
+ */
+TestFleetManager::~TestFleetManager() {
+    cout << "[TestFleetManager] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the FleetManager class.
+ *
+ * Hundreds of controllers log every command change, so their log output is discarded
+ * while the tests run.
+ */
+void TestFleetManager::runAllTests() {
+    cout << "\n================ Starting FleetManager Tests ================\n" << endl;
+
+    ostream discard(nullptr);
+    Logger::setOutput(&discard);
+
+    testPool();
+    testStealing();
+    testDeterminism();
+    benchmarkScaling();
+
+    Logger::setOutput(nullptr);
+
+    cout << "\n================ Ending FleetManager Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that parallelFor() runs every index once on any number of threads.
+ *
+ * Loops of several sizes and grains run on pools of 1, 2 and 4 threads, and every
+ * index counts its calls.
+ */
+void TestFleetManager::testPool() {
+    cout << "--- Test: Parallel Loops ---" << endl;
+
+    const int count = 10007;
+    bool once = true;
+    bool chunked = true;
+    for (int threads = 1; threads <= 4; threads *= 2) {
+        WorkStealingPool pool(threads);
+        unique_ptr<atomic<int>[]> calls(new atomic<int>[count]);
+        for (int grain = 1; grain <= 1000; grain *= 10) {
+            for (int i = 0; i < count; i++) {
+                calls[i].store(0);
+            }
+            atomic<int> chunks(0);
+            atomic<int> oversized(0);
+            pool.parallelFor(count, grain, [&calls, &chunks, &oversized, grain](int begin, int end) {
+                oversized.fetch_add(end - begin < 1 || end - begin > grain);
+                chunks.fetch_add(1);
+                for (int i = begin; i < end; i++) {
+                    calls[i].fetch_add(1);
+                }
+            });
+            for (int i = 0; i < count; i++) {
+                once &= calls[i].load() == 1;
+            }
+            chunked &= oversized.load() == 0 && chunks.load() == (count - 1) / grain + 1;
+        }
+        unsigned long long executed = 0;
+        for (int w = 0; w < pool.getThreadCount(); w++) {
+            executed += pool.getExecutedCount(w);
+        }
+        chunked &= executed == 10007ULL + 1001 + 101 + 11;
+    }
+    cout << "Every index runs exactly once: " << (once ? "PASS" : "FAIL") << endl;
+    cout << "Chunks respect the grain and are all counted: " << (chunked ? "PASS" : "FAIL") << endl;
+
+    WorkStealingPool pool(2);
+    bool called = false;
+    pool.parallelFor(0, 8, [&called](int, int) { called = true; });
+    cout << "An empty loop calls nothing: " << (!called ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that idle workers steal chunks from a busy one.
+ *
+ * The chunks in the block of worker 0 sleep, the others return at once, so the other
+ * workers run out of work first and take chunks from worker 0's queue.
+ */
+void TestFleetManager::testStealing() {
+    cout << "\n--- Test: Work Stealing ---" << endl;
+
+    WorkStealingPool pool(4);
+    const int count = 64;
+    atomic<int> done(0);
+    auto start = chrono::steady_clock::now();
+    pool.parallelFor(count, 1, [&done, count](int begin, int) {
+        if (begin < count / 4) {
+            this_thread::sleep_for(chrono::milliseconds(2));
+        }
+        done.fetch_add(1);
+    });
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "Chunks stolen: " << pool.getStealCount() << ", run by worker 0: " << pool.getExecutedCount(0)
+        << " of " << count << ", " << ms << " ms" << endl;
+    cout << "Idle workers steal from the busy one: " << (done.load() == count && pool.getStealCount() > 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that a fleet ends in the same state on one and on several threads.
+ *
+ * 64 robots wander for 500 steps (5 simulated seconds) in a cluttered room; the poses,
+ * collision counts and blocked counts must be equal bit for bit.
+ */
+void TestFleetManager::testDeterminism() {
+    cout << "\n--- Test: Fleet State Independent of Threads ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 20.0, 150, 5);
+
+    FleetManager single(&world, 1);
+    addRobots(single, world, 20.0, 64, 9);
+    single.run(500);
+
+    FleetManager parallel(&world, 4);
+    parallel.setGrain(3);
+    addRobots(parallel, world, 20.0, 64, 9);
+    parallel.run(500);
+
+    vector<double> a = fleetState(single);
+    vector<double> b = fleetState(parallel);
+    unsigned long long blocked = 0;
+    for (int i = 0; i < single.getRobotCount(); i++) {
+        blocked += single.getRobot(i).blocked;
+    }
+    vector<double> initial;
+    {
+        FleetManager fresh(&world, 1);
+        addRobots(fresh, world, 20.0, 64, 9);
+        initial = fleetState(fresh);
+    }
+    double moved = 0.0;
+    for (int i = 0; i < single.getRobotCount(); i++) {
+        moved += hypot(a[5 * i] - initial[5 * i], a[5 * i + 1] - initial[5 * i + 1]);
+    }
+
+    cout << "Robot steps: " << parallel.getRobotStepCount() << ", blocked forward moves: " << blocked
+        << ", mean distance from the start: " << moved / single.getRobotCount() << " m" << endl;
+    cout << "Robots move and get blocked: " << (moved > 0.0 && blocked > 0 ? "PASS" : "FAIL") << endl;
+    cout << "One and four threads reach the same state: " << (a == b && single.getRobotStepCount() == 64ULL * 500 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures robot steps per second against the number of threads.
+ *
+ * 256 robots with 90-beam lidars scanned every tenth step wander through a 30 m room
+ * with 400 boxes. Each thread count from 1 up to the hardware threads (at least 2)
+ * runs a fresh fleet for 200 steps after 20 warm-up steps; all runs must end in the
+ * same state. The speedup is relative to one thread and only means something up to
+ * the number of cores.
+ */
+void TestFleetManager::benchmarkScaling() {
+    cout << "\n--- Benchmark: Fleet Scaling ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 30.0, 400, 21);
+    const int robotCount = 256;
+    const int steps = 200;
+    int hardware = static_cast<int>(thread::hardware_concurrency());
+    vector<int> threadCounts;
+    for (int threads = 1; threads < (hardware > 2 ? hardware : 2); threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware > 2 ? hardware : 2);
+
+    vector<double> reference;
+    bool same = true;
+    double baseRate = 0.0;
+    cout << "Hardware threads: " << hardware << ", robots: " << robotCount << endl;
+    for (int threads : threadCounts) {
+        FleetManager fleet(&world, threads);
+        addRobots(fleet, world, 30.0, robotCount, 17);
+        fleet.run(20);
+        auto start = chrono::steady_clock::now();
+        fleet.run(steps);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double rate = robotCount * static_cast<double>(steps) / seconds;
+        if (threads == 1) {
+            baseRate = rate;
+            reference = fleetState(fleet);
+        }
+        else {
+            same &= fleetState(fleet) == reference;
+        }
+        cout << "Threads: " << threads << ", robot steps per second: " << rate << ", speedup: " << rate / baseRate
+            << "x, chunks stolen: " << fleet.getPool().getStealCount() << endl;
+    }
+    cout << "Every thread count reaches the same fleet state: " << (same ? "PASS" : "FAIL") << endl;
+}
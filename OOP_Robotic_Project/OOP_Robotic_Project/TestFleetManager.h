@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file TestFleetManager.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestFleetManager class for testing the FleetManager and
+ * WorkStealingPool classes.
+ *
+ * This file contains the class declaration for testing parallel loops and work
+ * stealing, checking that a fleet reaches the same state on any number of threads, and
+ * measuring robot steps per second against the number of threads.
+ */
+
+#include "FleetManager.h"
+
+ /**
+  * @class TestFleetManager
+  * @brief A class to test the functionality of the FleetManager class.
+  */
+class TestFleetManager {
+public:
+    /**
+     * @brief Default constructor for TestFleetManager.
+     */
+    TestFleetManager();
+
+    /**
+     * @brief Destructor for TestFleetManager.
+     */
+    ~TestFleetManager();
+
+    /**
+     * @brief Runs all test cases for the FleetManager class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that parallelFor() runs every index once on any number of threads.
+     */
+    void testPool();
+
+    /**
+     * @brief Tests that idle workers steal chunks from a busy one.
+     */
+    void testStealing();
+
+    /**
+     * @brief Tests that a fleet ends in the same state on one and on several threads.
+     */
+    void testDeterminism();
+
+    /**
+     * @brief Measures robot steps per second against the number of threads.
+     */
+    void benchmarkScaling();
+};
@@ -0,0 +1,183 @@
+/**
+ * @file TestIRSensor.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestIRSensor class for testing the IRSensor class.
+ */
+
+#include "TestIRSensor.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+
+/**
+ * @brief Stand-in robot API that returns a fixed range per IR sensor.
+ */
+class StandInIRAPI : public RobotInterface {
+public:
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION) override {}
+    void rotate(DIRECTION) override {}
+    void stop() override {}
+    double getIRRange(int i) override { return 0.25 * (i + 1); }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 0; Y = 0; TH = 0; }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+};
+
+/**
+ * @brief Scalar reference: the per-index loop the control code used before IRSensor.
+ */
+static void scalarEvaluate(const double* ir, double threshold, IREvaluation& result) {
+    double minimum = 1.0e30;
+    double sector[4] = { 1.0e30, 1.0e30, 1.0e30, 1.0e30 };
+    bool below = false;
+    for (int i = 0; i < 9; i++) {
+        double range = ir[i];
+        if (range < minimum) minimum = range;
+        if (range < threshold) below = true;
+        int s;
+        if (i == 0 || i == 1 || i == 8) s = FORWARD;
+        else if (i == 2 || i == 3) s = LEFT;
+        else if (i == 4 || i == 5) s = BACKWARD;
+        else s = RIGHT;
+        if (range < sector[s]) sector[s] = range;
+    }
+    result.minRange = static_cast<float>(minimum);
+    for (int d = 0; d < 4; d++) {
+        result.sectorMin[d] = static_cast<float>(sector[d]);
+    }
+    result.anyBelow = below;
+}
+
+/**
+ * @brief Default constructor for the TestIRSensor class.
+ */
+TestIRSensor::TestIRSensor() {
+    cout << "[TestIRSensor] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestIRSensor class.
+ */
+TestIRSensor::~TestIRSensor() {
+    cout << "[TestIRSensor] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the IRSensor class.
+ */
+void TestIRSensor::runAllTests() {
+    cout << "\n================ Starting IRSensor Tests ================\n" << endl;
+
+    testRefresh();
+    testKernels();
+    benchmarkEvaluation();
+
+    cout << "\n================ Ending IRSensor Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that refresh() reads every sensor from the robot API.
+ */
+void TestIRSensor::testRefresh() {
+    cout << "--- Test: Refresh ---" << endl;
+
+    StandInIRAPI api;
+    IRSensor ir(&api);
+    ir.refresh();
+
+    bool values = true;
+    for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+        values = values && ir.getRange(i) == static_cast<float>(0.25 * (i + 1));
+    }
+    cout << "All 9 ranges read: " << (values ? "PASS" : "FAIL") << endl;
+    cout << "Minimum is sensor 0: " << (ir.minRange() == 0.25f ? "PASS" : "FAIL") << endl;
+    cout << "Right sector minimum is sensor 6: " << (ir.sectorMin(RIGHT) == 1.75f ? "PASS" : "FAIL") << endl;
+    cout << "Forward sector minimum is sensor 0: " << (ir.sectorMin(FORWARD) == 0.25f ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares every kernel with a scalar per-index loop on random banks.
+ */
+void TestIRSensor::testKernels() {
+    cout << "\n--- Test: Kernels Against Scalar Reference ---" << endl;
+
+    srand(42);
+    IRSensor ir;
+    int mismatches = 0;
+    for (int n = 0; n < 10000; n++) {
+        double values[9];
+        for (int i = 0; i < 9; i++) {
+            values[i] = static_cast<float>(rand() % 4000) / 1000.0f;
+        }
+        float threshold = static_cast<float>(rand() % 1000) / 1000.0f;
+        ir.load(values);
+
+        IREvaluation expected;
+        IREvaluation actual;
+        scalarEvaluate(values, threshold, expected);
+        ir.evaluate(threshold, actual);
+
+        bool same = actual.minRange == expected.minRange && actual.anyBelow == expected.anyBelow
+            && ir.minRange() == expected.minRange && ir.anyBelow(threshold) == expected.anyBelow;
+        for (int d = 0; d < 4; d++) {
+            same = same && actual.sectorMin[d] == expected.sectorMin[d]
+                && ir.sectorMin(static_cast<DIRECTION>(d)) == expected.sectorMin[d]
+                && ir.anyBelow(static_cast<DIRECTION>(d), threshold) == (expected.sectorMin[d] < threshold);
+        }
+        if (!same) {
+            mismatches++;
+        }
+    }
+    cout << "10000 random banks match the scalar loop: " << (mismatches == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures ns per full-bank evaluation against the scalar per-index loop.
+ */
+void TestIRSensor::benchmarkEvaluation() {
+    cout << "\n--- Benchmark: Full-Bank Evaluation ---" << endl;
+
+    const int banks = 1024;
+    const int iterations = 2000000;
+    static double values[banks][9];
+    for (int n = 0; n < banks; n++) {
+        for (int i = 0; i < 9; i++) {
+            values[n][i] = (rand() % 4000) / 1000.0;
+        }
+    }
+    IREvaluation result;
+    int hits = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        scalarEvaluate(values[n & (banks - 1)], 0.3, result);
+        hits += result.anyBelow;
+    }
+    auto middle = chrono::steady_clock::now();
+
+    IRSensor ir;
+    for (int n = 0; n < iterations; n++) {
+        ir.load(values[n & (banks - 1)]);
+        ir.evaluate(0.3f, result);
+        hits += result.anyBelow;
+    }
+    auto end = chrono::steady_clock::now();
+
+    double scalar = chrono::duration<double, nano>(middle - start).count() / iterations;
+    double vector = chrono::duration<double, nano>(end - middle).count() / iterations;
+#if defined(__AVX__)
+    const char* path = "AVX";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    const char* path = "SSE2";
+#else
+    const char* path = "scalar";
+#endif
+    cout << "Scalar per-index loop        : " << scalar << " ns per bank" << endl;
+    cout << "IRSensor load + evaluate (" << path << "): " << vector << " ns per bank" << endl;
+    cout << "(hits " << hits << ")" << endl;
+}
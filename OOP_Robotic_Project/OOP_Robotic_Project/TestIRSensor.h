@@ -0,0 +1,51 @@
+#pragma once
+
+/**
+ * @file TestIRSensor.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestIRSensor class for testing the IRSensor class.
+ *
+ * This file contains the class declaration for checking the vectorized IR bank kernels
+ * against a scalar reference and for benchmarking them.
+ */
+
+#include "IRSensor.h"
+
+ /**
+  * @class TestIRSensor
+  * @brief A class to test the functionality of the IRSensor class.
+  */
+class TestIRSensor {
+public:
+    /**
+     * @brief Default constructor for TestIRSensor.
+     */
+    TestIRSensor();
+
+    /**
+     * @brief Destructor for TestIRSensor.
+     */
+    ~TestIRSensor();
+
+    /**
+     * @brief Runs all test cases for the IRSensor class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that refresh() reads every sensor from the robot API.
+     */
+    void testRefresh();
+
+    /**
+     * @brief Compares every kernel with a scalar per-index loop on random banks.
+     */
+    void testKernels();
+
+    /**
+     * @brief Measures ns per full-bank evaluation against the scalar per-index loop.
+     */
+    void benchmarkEvaluation();
+};
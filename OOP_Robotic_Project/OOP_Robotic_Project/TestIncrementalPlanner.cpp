@@ -0,0 +1,368 @@
+/**
+ * @file TestIncrementalPlanner.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestIncrementalPlanner class for testing the IncrementalPlanner class.
+ */
+
+#include "TestIncrementalPlanner.h"
+#include "MAP.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Fills a grid with random rectangular obstacles covering about density of it.
+ */
+static void randomObstacles(vector<unsigned char>& grid, int width, int height, double density) {
+    grid.assign(static_cast<size_t>(width) * height, 0);
+    int target = static_cast<int>(density * width * height);
+    int filled = 0;
+    while (filled < target) {
+        int w = 1 + rand() % 8;
+        int h = 1 + rand() % 8;
+        int x0 = rand() % (width - w);
+        int y0 = rand() % (height - h);
+        for (int y = y0; y < y0 + h; y++) {
+            for (int x = x0; x < x0 + w; x++) {
+                unsigned char& cell = grid[static_cast<size_t>(y) * width + x];
+                filled += cell == 0;
+                cell = 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets a square of obstacle flags in the grid and in the planner.
+ */
+static void placeBlock(vector<unsigned char>& grid, PathPlanner& planner, int cx, int cy, int half, bool obstacle) {
+    int width = planner.getWidth();
+    for (int y = cy - half; y <= cy + half; y++) {
+        for (int x = cx - half; x <= cx + half; x++) {
+            if (x >= 0 && y >= 0 && x < width && y < planner.getHeight()) {
+                grid[static_cast<size_t>(y) * width + x] = obstacle;
+                planner.setObstacle(GridCell{ x, y }, obstacle);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Returns the cost of a cell path, or a negative value if a step is not allowed.
+ */
+static double pathCost(const PathPlanner& planner, const vector<GridCell>& path) {
+    double total = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        const GridCell& a = path[i - 1];
+        const GridCell& b = path[i];
+        int dx = abs(b.x - a.x);
+        int dy = abs(b.y - a.y);
+        float cost = planner.getCost(b.x, b.y);
+        if (dx > 1 || dy > 1 || dx + dy == 0 || cost == PathPlanner::BLOCKED) {
+            return -1.0;
+        }
+        if (dx + dy == 2) {
+            if (planner.getCost(a.x, b.y) == PathPlanner::BLOCKED || planner.getCost(b.x, a.y) == PathPlanner::BLOCKED) {
+                return -1.0;
+            }
+            total += cost * 1.41421356;
+        }
+        else {
+            total += cost;
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Returns true if two plan results agree: both unreachable, or equal costs up to rounding.
+ */
+static bool sameCost(double a, double b) {
+    if (a < 0 || b < 0) {
+        return a < 0 && b < 0;
+    }
+    return fabs(a - b) <= 1e-4 * (a > 1.0 ? a : 1.0);
+}
+
+/**
+ * @brief Default constructor for the TestIncrementalPlanner class.
+ */
+TestIncrementalPlanner::TestIncrementalPlanner() {
+    cout << "[TestIncrementalPlanner] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestIncrementalPlanner class.
+ */
+TestIncrementalPlanner::~TestIncrementalPlanner() {
+    cout << "[TestIncrementalPlanner] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the IncrementalPlanner class.
+ */
+void TestIncrementalPlanner::runAllTests() {
+    cout << "\n================ Starting IncrementalPlanner Tests ================\n" << endl;
+
+    testRegionalUpdate();
+    testMatchesAStar();
+    testMapUpdates();
+    benchmarkReplan();
+
+    cout << "\n================ Ending IncrementalPlanner Tests ================\n" << endl;
+}
+
+/**
+ * @brief Compares locally repaired distances and costs with a full recomputation.
+ */
+void TestIncrementalPlanner::testRegionalUpdate() {
+    cout << "--- Test: Regional Update ---" << endl;
+
+    const int width = 150;
+    const int height = 110;
+    vector<unsigned char> grid;
+    srand(12);
+    randomObstacles(grid, width, height, 0.05);
+
+    DistanceField field;
+    field.setLimit(0.35);
+    field.compute(width, height, grid.data(), 0.05);
+    for (int i = 0; i < 30; i++) {
+        grid[rand() % (width * height)] ^= 1;
+    }
+    field.update(grid.data(), 0, 0, width, height / 2);
+    field.update(grid.data(), 0, height / 2, width, height);
+    DistanceField full;
+    full.setLimit(0.35);
+    full.compute(width, height, grid.data(), 0.05);
+    double worst = 0.0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            double error = fabs(field.getDistance(x, y) - full.getDistance(x, y));
+            worst = error > worst ? error : worst;
+        }
+    }
+    cout << "Repaired field equals a full transform: " << (worst < 1e-5 ? "PASS" : "FAIL") << endl;
+
+    PathPlanner planner;
+    planner.setRobotRadius(0.1, 0.3, 3.0);
+    planner.setGrid(width, height, grid.data(), 0.05, 0.0, 0.0);
+    vector<float> before(planner.getCosts(), planner.getCosts() + width * height);
+    placeBlock(grid, planner, 40, 50, 2, true);
+    placeBlock(grid, planner, 120, 20, 0, true);
+    placeBlock(grid, planner, 75, 90, 3, false);
+    size_t changed = planner.applyChanges();
+
+    PathPlanner reference;
+    reference.setRobotRadius(0.1, 0.3, 3.0);
+    reference.setGrid(width, height, grid.data(), 0.05, 0.0, 0.0);
+    int mismatches = 0;
+    int differing = 0;
+    for (int i = 0; i < width * height; i++) {
+        mismatches += planner.getCosts()[i] != reference.getCosts()[i];
+        differing += before[i] != reference.getCosts()[i];
+    }
+    cout << "Repaired costs equal those of a new grid: " << (mismatches == 0 ? "PASS" : "FAIL") << endl;
+    cout << "Every changed cost is listed once: " << (changed > 0 && static_cast<int>(changed) == differing ? "PASS" : "FAIL") << endl;
+    cout << "Nothing left to apply: " << (planner.applyChanges() == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares repaired plans with A* while the robot moves and obstacles change.
+ *
+ * Each round the robot advances along its path, then a block appears on the path
+ * ahead of it and another one somewhere else disappears.
+ */
+void TestIncrementalPlanner::testMatchesAStar() {
+    cout << "\n--- Test: D* Lite Matches A* ---" << endl;
+
+    const int size = 200;
+    vector<unsigned char> grid;
+    srand(31);
+    randomObstacles(grid, size, size, 0.08);
+    PathPlanner planner;
+    planner.setRobotRadius(0.05, 0.2, 3.0);
+    planner.setGrid(size, size, grid.data(), 0.05, 0.0, 0.0);
+
+    GridCell start = { 5, 5 };
+    GridCell goal = { 190, 185 };
+    placeBlock(grid, planner, start.x, start.y, 4, false);
+    placeBlock(grid, planner, goal.x, goal.y, 4, false);
+    planner.applyChanges();
+
+    IncrementalPlanner incremental(planner);
+    bool goalSet = incremental.setGoal(goal);
+    vector<GridCell> path;
+    vector<GridCell> reference;
+    double cost = incremental.replan(start, path);
+    double expected = planner.plan(start, goal, reference);
+    cout << "First plan equals A*: " << (goalSet && cost > 0 && sameCost(cost, expected) ? "PASS" : "FAIL") << endl;
+
+    bool agree = true;
+    bool valid = true;
+    int rounds = 0;
+    int unreachable = 0;
+    while (rounds < 40 && path.size() > 30) {
+        start = path[8];
+        const GridCell& ahead = path[20];
+        placeBlock(grid, planner, ahead.x, ahead.y, 1 + rand() % 2, true);
+        placeBlock(grid, planner, rand() % size, rand() % size, 3, false);
+        planner.applyChanges();
+        incremental.costsChanged(planner.getCostChanges());
+
+        cost = incremental.replan(start, path);
+        expected = planner.plan(start, goal, reference);
+        agree = agree && sameCost(cost, expected);
+        valid = valid && (cost < 0 || (path.front().x == start.x && path.front().y == start.y
+            && path.back().x == goal.x && path.back().y == goal.y && sameCost(pathCost(planner, path), cost)));
+        unreachable += cost < 0;
+        rounds++;
+        if (cost < 0) {
+            break;
+        }
+    }
+    cout << "Replanned " << rounds << " times, " << unreachable << " unreachable" << endl;
+    cout << "Every repaired cost equals A*: " << (rounds > 10 && agree ? "PASS" : "FAIL") << endl;
+    cout << "Repaired paths are connected and cost what is reported: " << (valid ? "PASS" : "FAIL") << endl;
+
+    placeBlock(grid, planner, goal.x, goal.y, 1, true);
+    planner.applyChanges();
+    incremental.costsChanged(planner.getCostChanges());
+    cout << "A blocked goal is unreachable: " << (incremental.replan(start, path) < 0 && path.empty() ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Replans from the cells a MAP reports as changed.
+ *
+ * A wall with a gap is written into the map, then the gap is closed and reopened
+ * further along; each time only the changed cells are passed on.
+ */
+void TestIncrementalPlanner::testMapUpdates() {
+    cout << "\n--- Test: Map Updates ---" << endl;
+
+    MAP map(6.4, 6.4, 0.05);
+    map.setChangeTracking(true);
+    PathPlanner planner;
+    planner.setMap(map);
+
+    GridCell start;
+    GridCell goal;
+    planner.worldToCell(-2.5, 0.0, start);
+    planner.worldToCell(2.5, 0.0, goal);
+    IncrementalPlanner incremental(planner);
+    incremental.setGoal(goal);
+    vector<GridCell> path;
+    vector<GridCell> reference;
+    double straight = incremental.replan(start, path);
+
+    int wallX = map.getWidth() / 2;
+    for (int y = 0; y < map.getHeight(); y++) {
+        if (y < 90 || y > 100) {
+            map.updateCell(wallX, y, 5.0f);
+        }
+    }
+    vector<GridCell> changed;
+    map.takeChangedCells(changed);
+    size_t costs = incremental.updateMap(map, changed);
+    double around = incremental.replan(start, path);
+    double expected = planner.plan(start, goal, reference);
+    cout << "Wall cells are reported and change costs: " << (changed.size() == static_cast<size_t>(map.getHeight() - 11) && costs > changed.size() ? "PASS" : "FAIL") << endl;
+    cout << "Path detours through the gap as A* does: " << (around > straight && sameCost(around, expected) ? "PASS" : "FAIL") << endl;
+
+    for (int y = 90; y <= 100; y++) {
+        map.updateCell(wallX, y, 5.0f);
+    }
+    for (int y = 20; y <= 30; y++) {
+        map.updateCell(wallX, y, -10.0f);
+    }
+    map.takeChangedCells(changed);
+    incremental.updateMap(map, changed);
+    double moved = incremental.replan(start, path);
+    expected = planner.plan(start, goal, reference);
+    bool throughNewGap = false;
+    for (size_t i = 0; i < path.size(); i++) {
+        throughNewGap = throughNewGap || (path[i].x == wallX && path[i].y >= 20 && path[i].y <= 30);
+    }
+    cout << "Path follows the gap when it moves: " << (throughNewGap && sameCost(moved, expected) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures replan latency after small changes against full A* on 1000 x 1000.
+ *
+ * The robot advances 10 cells along its path, then a small block appears 30 cells
+ * ahead of it. Both planners see the same repaired costs; the time to repair the
+ * costs is reported on its own since both need it.
+ */
+void TestIncrementalPlanner::benchmarkReplan() {
+    cout << "\n--- Benchmark: Replan Latency on 1000 x 1000 ---" << endl;
+
+    const int size = 1000;
+    vector<unsigned char> grid;
+    srand(2026);
+    randomObstacles(grid, size, size, 0.15);
+    PathPlanner planner;
+    planner.setRobotRadius(0.05, 0.2, 3.0);
+    planner.setGrid(size, size, grid.data(), 0.05, 0.0, 0.0);
+
+    GridCell start = { 20, 20 };
+    GridCell goal = { 970, 960 };
+    placeBlock(grid, planner, start.x, start.y, 5, false);
+    placeBlock(grid, planner, goal.x, goal.y, 5, false);
+    planner.applyChanges();
+
+    IncrementalPlanner incremental(planner);
+    incremental.setGoal(goal);
+    vector<GridCell> path;
+    vector<GridCell> reference;
+    auto begin = chrono::steady_clock::now();
+    double cost = incremental.replan(start, path);
+    double firstMs = chrono::duration<double, milli>(chrono::steady_clock::now() - begin).count();
+    cout << "First D* Lite plan: " << firstMs << " ms, " << incremental.getExpandedCount() << " cells expanded" << endl;
+
+    double repairMs = 0.0;
+    double incrementalMs = 0.0;
+    double fullMs = 0.0;
+    long long incrementalExpanded = 0;
+    long long fullExpanded = 0;
+    int rounds = 0;
+    bool agree = cost > 0;
+    while (rounds < 20 && path.size() > 50) {
+        start = path[10];
+        const GridCell& ahead = path[40];
+        placeBlock(grid, planner, ahead.x, ahead.y, 1, true);
+
+        begin = chrono::steady_clock::now();
+        planner.applyChanges();
+        auto repaired = chrono::steady_clock::now();
+        incremental.costsChanged(planner.getCostChanges());
+        cost = incremental.replan(start, path);
+        auto replanned = chrono::steady_clock::now();
+        double expected = planner.plan(start, goal, reference);
+        auto planned = chrono::steady_clock::now();
+
+        repairMs += chrono::duration<double, milli>(repaired - begin).count();
+        incrementalMs += chrono::duration<double, milli>(replanned - repaired).count();
+        fullMs += chrono::duration<double, milli>(planned - replanned).count();
+        incrementalExpanded += incremental.getExpandedCount();
+        fullExpanded += planner.getExpandedCount();
+        agree = agree && sameCost(cost, expected);
+        rounds++;
+        if (cost < 0) {
+            break;
+        }
+    }
+    if (rounds == 0) {
+        cout << "Replans match A*: FAIL" << endl;
+        return;
+    }
+    cout << "Rounds: " << rounds << ", cost repair: " << repairMs / rounds << " ms per change" << endl;
+    cout << "D* Lite replan: " << incrementalMs / rounds << " ms, " << incrementalExpanded / rounds << " cells expanded" << endl;
+    cout << "Full A* plan:   " << fullMs / rounds << " ms, " << fullExpanded / rounds << " cells expanded" << endl;
+    cout << "Speedup: " << fullMs / (incrementalMs > 0 ? incrementalMs : 1e-9) << "x" << endl;
+    cout << "Replans match A*: " << (agree ? "PASS" : "FAIL") << endl;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file TestIncrementalPlanner.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestIncrementalPlanner class for testing the IncrementalPlanner class.
+ *
+ * This file contains the class declaration for testing local repairs of the distance
+ * field and costs, D* Lite replanning against full A* plans, and for measuring replan
+ * latency after small map changes.
+ */
+
+#include "IncrementalPlanner.h"
+
+ /**
+  * @class TestIncrementalPlanner
+  * @brief A class to test the functionality of the IncrementalPlanner class.
+  */
+class TestIncrementalPlanner {
+public:
+    /**
+     * @brief Default constructor for TestIncrementalPlanner.
+     */
+    TestIncrementalPlanner();
+
+    /**
+     * @brief Destructor for TestIncrementalPlanner.
+     */
+    ~TestIncrementalPlanner();
+
+    /**
+     * @brief Runs all test cases for the IncrementalPlanner class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Compares locally repaired distances and costs with a full recomputation.
+     */
+    void testRegionalUpdate();
+
+    /**
+     * @brief Compares repaired plans with A* while the robot moves and obstacles change.
+     */
+    void testMatchesAStar();
+
+    /**
+     * @brief Replans from the cells a MAP reports as changed.
+     */
+    void testMapUpdates();
+
+    /**
+     * @brief Measures replan latency after small changes against full A* on 1000 x 1000.
+     */
+    void benchmarkReplan();
+};
@@ -0,0 +1,393 @@
+/**
+ * @file TestLidarSensor.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestLidarSensor class for testing the LidarSensor class.
+ */
+
+#include "TestLidarSensor.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Stand-in robot API that produces a synthetic lidar scan.
+ */
+class StandInLidarAPI : public RobotInterface {
+private:
+    int rangeNumber;
+    float offset;
+
+public:
+    StandInLidarAPI(int number) : rangeNumber(number), offset(0.0f) {}
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION) override {}
+    void rotate(DIRECTION) override {}
+    void stop() override {}
+    double getIRRange(int) override { return 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 0; Y = 0; TH = 0; }
+    void getLidarRange(float* ranges) override {
+        for (int i = 0; i < rangeNumber; i++) {
+            ranges[i] = offset + 0.01f * i;
+        }
+        offset += 1.0f;
+    }
+    int getLidarRangeNumber() override { return rangeNumber; }
+};
+
+/**
+ * @brief Fills a scan of a room with a few objects: flat stretches joined by range
+ * jumps, 1 cm of noise, and every 37th reading a spike, a dropout or a NaN.
+ */
+static void syntheticScan(float* ranges, int count, unsigned int seed) {
+    srand(seed);
+    float level = 3.0f;
+    for (int i = 0; i < count; i++) {
+        if (i % 60 == 0) {
+            level = 0.5f + 9.0f * (rand() / (RAND_MAX + 1.0f));
+        }
+        ranges[i] = level + 0.02f * (rand() / (RAND_MAX + 1.0f) - 0.5f);
+        if (i % 37 == 5) {
+            int kind = (i / 37) % 4;
+            ranges[i] = kind == 0 ? 0.0f : kind == 1 ? numeric_limits<float>::infinity()
+                : kind == 2 ? numeric_limits<float>::quiet_NaN() : ranges[i] * 0.3f;
+        }
+    }
+}
+
+/**
+ * @brief Default constructor for the TestLidarSensor class.
+ */
+TestLidarSensor::TestLidarSensor() {
+    cout << "[TestLidarSensor] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestLidarSensor class.
+ */
+TestLidarSensor::~TestLidarSensor() {
+    cout << "[TestLidarSensor] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the LidarSensor class.
+ */
+void TestLidarSensor::runAllTests() {
+    cout << "\n================ Starting LidarSensor Tests ================\n" << endl;
+
+    testAcquireScan();
+    testPoolRecycling();
+    testRangeClamp();
+    testMedianFilter();
+    testDownsampling();
+    testSegmentation();
+    testPipeline();
+    benchmarkAcquisition();
+    benchmarkStages();
+
+    cout << "\n================ Ending LidarSensor Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that scans are read into aligned buffers with the right values.
+ */
+void TestLidarSensor::testAcquireScan() {
+    cout << "--- Test: Acquire Scan ---" << endl;
+
+    StandInLidarAPI api(360);
+    LidarSensor lidar(&api);
+
+    LidarScan* scan = lidar.acquireScan();
+    bool valid = scan != nullptr && scan->count == 360 && lidar.getRangeNumber() == 360;
+    cout << "Scan has 360 values: " << (valid ? "PASS" : "FAIL") << endl;
+    if (!valid) {
+        return;
+    }
+
+    bool aligned = reinterpret_cast<uintptr_t>(scan->ranges) % LidarSensor::CACHE_LINE_SIZE == 0;
+    cout << "Scan buffer is cache aligned: " << (aligned ? "PASS" : "FAIL") << endl;
+
+    bool values = scan->ranges[0] == 0.0f && scan->ranges[100] == 0.01f * 100;
+    cout << "Scan values copied from API: " << (values ? "PASS" : "FAIL") << endl;
+
+    LidarScan* next = lidar.acquireScan();
+    bool ordered = next != nullptr && next->sequence == scan->sequence + 1 && next->ranges[0] == 1.0f;
+    cout << "Second scan has next sequence number: " << (ordered ? "PASS" : "FAIL") << endl;
+
+    lidar.releaseScan(scan);
+    lidar.releaseScan(next);
+}
+
+/**
+ * @brief Tests that an exhausted pool returns nullptr and released buffers are reused.
+ */
+void TestLidarSensor::testPoolRecycling() {
+    cout << "\n--- Test: Pool Recycling ---" << endl;
+
+    StandInLidarAPI api(100);
+    LidarSensor lidar(&api, 3);
+
+    LidarScan* held[3];
+    int read = lidar.acquireScans(held, 3);
+    cout << "Batch read fills the pool: " << (read == 3 && lidar.getFreeCount() == 0 ? "PASS" : "FAIL") << endl;
+    cout << "Exhausted pool returns nullptr: " << (lidar.acquireScan() == nullptr ? "PASS" : "FAIL") << endl;
+
+    float* buffer = held[1]->ranges;
+    lidar.releaseScan(held[1]);
+    LidarScan* reused = lidar.acquireScan();
+    cout << "Released buffer is reused: " << (reused != nullptr && reused->ranges == buffer ? "PASS" : "FAIL") << endl;
+
+    lidar.releaseScan(held[0]);
+    lidar.releaseScan(reused);
+    lidar.releaseScan(held[2]);
+    cout << "All buffers returned: " << (lidar.getFreeCount() == 3 ? "PASS" : "FAIL") << endl;
+
+    LidarScan* first = lidar.acquireScan();
+    LidarScan* second = lidar.acquireScan();
+    lidar.releaseScan(first);
+    lidar.releaseScan(first);
+    bool once = lidar.getFreeCount() == 2;
+    LidarScan* third = lidar.acquireScan();
+    LidarScan* fourth = lidar.acquireScan();
+    cout << "Double release is rejected: " << (once && third != fourth && third != second && fourth != second ? "PASS" : "FAIL") << endl;
+    lidar.releaseScan(second);
+    lidar.releaseScan(third);
+    lidar.releaseScan(fourth);
+}
+
+/**
+ * @brief Compares per-scan time of the pool against new/delete for every scan.
+ *
+ * Both paths read the same stand-in scan and sum it, so the only difference is
+ * where the buffer comes from.
+ */
+void TestLidarSensor::benchmarkAcquisition() {
+    cout << "\n--- Benchmark: Scan Acquisition ---" << endl;
+
+    const int iterations = 200000;
+    const int number = 1081;
+    StandInLidarAPI api(number);
+    double checksum = 0;
+
+    auto start = chrono::steady_clock::now();
+    for (int n = 0; n < iterations; n++) {
+        int count = api.getLidarRangeNumber();
+        float* ranges = new float[count];
+        api.getLidarRange(ranges);
+        checksum += ranges[n % count];
+        delete[] ranges;
+    }
+    auto middle = chrono::steady_clock::now();
+
+    LidarSensor lidar(&api);
+    for (int n = 0; n < iterations; n++) {
+        LidarScan* scan = lidar.acquireScan();
+        checksum += scan->ranges[n % scan->count];
+        lidar.releaseScan(scan);
+    }
+    auto end = chrono::steady_clock::now();
+
+    double newDelete = chrono::duration<double, nano>(middle - start).count() / iterations;
+    double pool = chrono::duration<double, nano>(end - middle).count() / iterations;
+    cout << "new/delete per scan : " << newDelete << " ns" << endl;
+    cout << "buffer pool per scan: " << pool << " ns" << endl;
+    cout << "(checksum " << checksum << ")" << endl;
+}
+
+/**
+ * @brief Tests that invalid readings are replaced with the maximum range.
+ *
+ * The scan length is not a multiple of the vector width, so the scalar tail runs too.
+ */
+void TestLidarSensor::testRangeClamp() {
+    cout << "\n--- Test: Range Clamping ---" << endl;
+
+    const float nan = numeric_limits<float>::quiet_NaN();
+    const float inf = numeric_limits<float>::infinity();
+    float ranges[] = { 1.0f, nan, inf, -inf, 0.0f, -2.0f, 0.05f, 9.99f, 10.0f, 12.0f, 3.5f, nan, 0.2f };
+    float expected[] = { 1.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 9.99f, 10.0f, 10.0f, 3.5f, 10.0f, 0.2f };
+    RangeClamp clamp(0.1f, 10.0f);
+    int count = clamp.process(ranges, 13);
+    bool same = count == 13;
+    for (int i = 0; i < 13; i++) {
+        same &= ranges[i] == expected[i];
+    }
+    cout << "NaN, infinite, short and far readings become the maximum range: " << (same ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the vectorized median filter with sorting every window.
+ *
+ * Windows of 3 and 5 over scans of every length from 1 to 40, so that both ends and
+ * every tail length are covered.
+ */
+void TestLidarSensor::testMedianFilter() {
+    cout << "\n--- Test: Median Filter ---" << endl;
+
+    bool same = true;
+    vector<float> scan(40);
+    vector<float> out(40);
+    for (int radius = 1; radius <= 2; radius++) {
+        for (int count = 1; count <= 40; count++) {
+            syntheticScan(scan.data(), count, count);
+            RangeClamp().process(scan.data(), count);
+            medianFilter(scan.data(), out.data(), count, radius);
+            for (int i = 0; i < count; i++) {
+                vector<float> window;
+                for (int k = -radius; k <= radius; k++) {
+                    window.push_back(scan[min(max(i + k, 0), count - 1)]);
+                }
+                sort(window.begin(), window.end());
+                same &= out[i] == window[radius];
+            }
+        }
+    }
+    cout << "Vectorized median matches sorted windows: " << (same ? "PASS" : "FAIL") << endl;
+
+    float spikes[] = { 2.0f, 2.0f, 0.3f, 2.0f, 2.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 9.0f, 5.0f };
+    MedianFilter<1> filter;
+    filter.process(spikes, 13);
+    cout << "Spikes are removed and the step is kept: " << (spikes[2] == 2.0f && spikes[11] == 5.0f
+        && spikes[4] == 2.0f && spikes[5] == 5.0f ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests angular downsampling and its geometry.
+ */
+void TestLidarSensor::testDownsampling() {
+    cout << "\n--- Test: Angular Downsampling ---" << endl;
+
+    float ranges[] = { 4.0f, 3.0f, 5.0f, 1.0f, 2.0f, 6.0f, 7.0f };
+    AngleDownsampler<3> downsampler;
+    int count = downsampler.process(ranges, 7);
+    cout << "Each group keeps its shortest reading: " << (count == 3 && ranges[0] == 3.0f && ranges[1] == 1.0f
+        && ranges[2] == 7.0f ? "PASS" : "FAIL") << endl;
+
+    LidarGeometry geometry = downsampler.geometry(LidarGeometry::fullCircle(360));
+    LidarGeometry full = LidarGeometry::fullCircle(360);
+    cout << "Downsampled beams point at the middle of their groups: " << (fabs(geometry.startAngle - (full.startAngle + full.angleIncrement)) < 1e-12
+        && fabs(geometry.angleIncrement - 3.0 * full.angleIncrement) < 1e-12 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the vectorized segmenter with checking every pair of beams.
+ */
+void TestLidarSensor::testSegmentation() {
+    cout << "\n--- Test: Range-Jump Segmentation ---" << endl;
+
+    const int count = 1081;
+    vector<float> scan(count);
+    syntheticScan(scan.data(), count, 3);
+    RangeClamp().process(scan.data(), count);
+    MedianFilter<2>().process(scan.data(), count);
+    RangeJumpSegmenter segmenter(0.1f, 0.1f);
+    segmenter.process(scan.data(), count);
+
+    vector<int> expected(1, 0);
+    for (int i = 1; i < count; i++) {
+        float jump = fabs(scan[i] - scan[i - 1]);
+        if (jump > 0.1f + 0.1f * min(scan[i], scan[i - 1])) {
+            expected.push_back(i);
+        }
+    }
+    bool same = segmenter.getSegmentCount() == static_cast<int>(expected.size());
+    for (int k = 0; same && k < segmenter.getSegmentCount(); k++) {
+        same &= segmenter.getSegmentStarts()[k] == expected[k];
+    }
+    cout << "Segments: " << segmenter.getSegmentCount() << endl;
+    cout << "Vectorized segments match checking every pair: " << (same && expected.size() > 10 ? "PASS" : "FAIL") << endl;
+
+    float flat[] = { 2.0f, 2.01f, 2.02f, 2.03f, 2.04f, 2.05f, 2.06f, 2.07f, 2.08f, 4.0f, 4.0f };
+    segmenter.process(flat, 11);
+    cout << "A surface is one segment until the jump: " << (segmenter.getSegmentCount() == 2
+        && segmenter.getSegmentStarts()[1] == 9 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests a full pipeline on pooled scans.
+ *
+ * Clamping, a 3-reading median, downsampling by 2 and segmentation run on scans from a
+ * LidarSensor; the scan count and the geometry follow the downsampling, and the
+ * segment buffer is not reallocated after the first scan.
+ */
+void TestLidarSensor::testPipeline() {
+    cout << "\n--- Test: Preprocessing Pipeline ---" << endl;
+
+    StandInLidarAPI api(1081);
+    LidarSensor lidar(&api);
+    LidarPipeline<RangeClamp, MedianFilter<1>, AngleDownsampler<2>, RangeJumpSegmenter> pipeline(
+        RangeClamp(0.1f, 10.0f), MedianFilter<1>(), AngleDownsampler<2>(), RangeJumpSegmenter(0.1f, 0.1f));
+
+    LidarScan* scan = lidar.acquireScan();
+    pipeline.process(*scan);
+    bool shaped = scan->count == 541 && scan->ranges[0] == 10.0f && fabs(scan->ranges[300] - 6.0f) < 1e-4f && scan->ranges[540] == 10.0f;
+    lidar.releaseScan(scan);
+    const int* starts = pipeline.stage<3>().getSegmentStarts();
+    for (int n = 0; n < 10; n++) {
+        scan = lidar.acquireScan();
+        pipeline.process(*scan);
+        shaped &= scan->count == 541;
+        lidar.releaseScan(scan);
+    }
+    cout << "Scans are downsampled in their pool buffers: " << (shaped ? "PASS" : "FAIL") << endl;
+    cout << "Stages keep their buffers between scans: " << (pipeline.stage<3>().getSegmentStarts() == starts ? "PASS" : "FAIL") << endl;
+
+    LidarGeometry geometry = pipeline.geometry(LidarGeometry::fullCircle(1081, 30.0));
+    cout << "Pipeline geometry follows the stages: " << (geometry.maxRange == 10.0
+        && fabs(geometry.angleIncrement - 2.0 * LidarGeometry::fullCircle(1081).angleIncrement) < 1e-12 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures the throughput of each preprocessing stage and of a full pipeline.
+ *
+ * Every run copies a 1081-beam synthetic scan into a work buffer and processes it; the
+ * copy alone is timed first and reported as the baseline. The times depend on the
+ * load of the machine and are only reported.
+ */
+void TestLidarSensor::benchmarkStages() {
+    cout << "\n--- Benchmark: Preprocessing Stages ---" << endl;
+
+    const int count = 1081;
+    const int iterations = 20000;
+    vector<float> source(count);
+    vector<float> work(count);
+    syntheticScan(source.data(), count, 7);
+    double checksum = 0.0;
+
+    auto run = [&](const char* name, auto&& stage) {
+        auto start = chrono::steady_clock::now();
+        for (int n = 0; n < iterations; n++) {
+            memcpy(work.data(), source.data(), sizeof(float) * count);
+            int left = stage.process(work.data(), count);
+            checksum += work[n % left] < 100.0f ? work[n % left] : 0.0f;
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << name << ": " << seconds / iterations * 1e9 << " ns per scan, "
+            << static_cast<double>(count) * iterations / seconds / 1e6 << " million beams per second" << endl;
+        return seconds / iterations;
+    };
+
+    struct CopyOnly {
+        int process(float*, int count) { return count; }
+    };
+    run("Copy only         ", CopyOnly());
+    run("Range clamp       ", RangeClamp());
+    run("Median of 3       ", MedianFilter<1>());
+    run("Median of 5       ", MedianFilter<2>());
+    run("Downsample by 4   ", AngleDownsampler<4>());
+    run("Jump segmentation ", RangeJumpSegmenter());
+    LidarPipeline<RangeClamp, MedianFilter<1>, AngleDownsampler<2>, RangeJumpSegmenter> pipeline{
+        RangeClamp(), MedianFilter<1>(), AngleDownsampler<2>(), RangeJumpSegmenter() };
+    double perScan = run("Full pipeline     ", pipeline);
+    cout << "(checksum " << checksum << ")" << endl;
+    cout << "Full pipeline: " << perScan * 40.0 * 100.0 << " % of a 40 Hz scan period (target under 1 %)" << endl;
+}
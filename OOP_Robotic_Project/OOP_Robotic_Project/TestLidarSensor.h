@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file TestLidarSensor.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestLidarSensor class for testing the LidarSensor class.
+ *
+ * This file contains the class declaration for testing the LidarSensor buffer pool
+ * and the scan preprocessing stages, and for benchmarking them.
+ */
+
+#include "LidarFilter.h"
+#include "LidarSensor.h"
+
+ /**
+  * @class TestLidarSensor
+  * @brief A class to test the functionality of the LidarSensor class.
+  *
+  * The tests run against a local stand-in robot API, so no simulator is needed.
+  */
+class TestLidarSensor {
+public:
+    /**
+     * @brief Default constructor for TestLidarSensor.
+     */
+    TestLidarSensor();
+
+    /**
+     * @brief Destructor for TestLidarSensor.
+     */
+    ~TestLidarSensor();
+
+    /**
+     * @brief Runs all test cases for the LidarSensor class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that scans are read into aligned buffers with the right values.
+     */
+    void testAcquireScan();
+
+    /**
+     * @brief Tests that an exhausted pool returns nullptr and released buffers are reused.
+     */
+    void testPoolRecycling();
+
+    /**
+     * @brief Tests that invalid readings are replaced with the maximum range.
+     */
+    void testRangeClamp();
+
+    /**
+     * @brief Compares the vectorized median filter with sorting every window.
+     */
+    void testMedianFilter();
+
+    /**
+     * @brief Tests angular downsampling and its geometry.
+     */
+    void testDownsampling();
+
+    /**
+     * @brief Compares the vectorized segmenter with checking every pair of beams.
+     */
+    void testSegmentation();
+
+    /**
+     * @brief Tests a full pipeline on pooled scans.
+     */
+    void testPipeline();
+
+    /**
+     * @brief Compares per-scan time of the pool against new/delete for every scan.
+     */
+    void benchmarkAcquisition();
+
+    /**
+     * @brief Measures the throughput of each preprocessing stage and of a full pipeline.
+     */
+    void benchmarkStages();
+};
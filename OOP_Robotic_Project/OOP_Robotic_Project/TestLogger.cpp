@@ -0,0 +1,278 @@
+/**
+ * @file TestLogger.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestLogger class for testing the Logger class.
+ */
+
+// The tests check INFO-level behaviour whatever level the project is built with.
+#undef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+
+#include "TestLogger.h"
+#include "LatencyHistogram.h"
+#include "RobotControler.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static const char* TEST_FILE = "TestLogger.txt";
+
+/**
+ * @brief Robot API that accepts every command and does nothing.
+ */
+class SilentRobotAPI : public RobotInterface {
+public:
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION) override {}
+    void rotate(DIRECTION) override {}
+    void stop() override {}
+    double getIRRange(int) override { return 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 0; Y = 0; TH = 0; }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+};
+
+/**
+ * @brief Counts the lines of text that contain pattern.
+ */
+static int countLines(const string& text, const string& pattern) {
+    istringstream lines(text);
+    string line;
+    int count = 0;
+    while (getline(lines, line)) {
+        if (line.find(pattern) != string::npos) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Default constructor for the TestLogger class.
+ */
+TestLogger::TestLogger() {
+    cout << "[TestLogger] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestLogger class.
+ */
+TestLogger::~TestLogger() {
+    Logger::setOutput(nullptr);
+    remove(TEST_FILE);
+    cout << "[TestLogger] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the Logger class.
+ */
+void TestLogger::runAllTests() {
+    cout << "\n================ Starting Logger Tests ================\n" << endl;
+
+    testFormatting();
+    testLevelFilter();
+    testThreads();
+    testDrops();
+    benchmarkLogCall();
+
+    cout << "\n================ Ending Logger Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests argument substitution and line layout.
+ */
+void TestLogger::testFormatting() {
+    cout << "--- Test: Formatting ---" << endl;
+
+    ostringstream out;
+    Logger::setOutput(&out);
+    unsigned long long before = Logger::getWrittenCount();
+    LOG_INFO("a {} b {} c {} d {} e {}", -42, 3u, 2.5, "text", true);
+    LOG_WARNING("char {} size {}", 'x', sizeof(int));
+    LOG_ERROR("missing {} {}", 1);
+    LOG_INFO("no arguments {}");
+    Logger::setOutput(nullptr);
+    string text = out.str();
+
+    cout << "Every record is written: " << (Logger::getWrittenCount() - before == 4 ? "PASS" : "FAIL") << endl;
+    cout << "Arguments replace {} in order: " << (countLines(text, "INFO    a -42 b 3 c 2.5 d text e true") == 1 ? "PASS" : "FAIL") << endl;
+    cout << "Level names are printed: " << (countLines(text, "WARNING char x size 4") == 1 ? "PASS" : "FAIL") << endl;
+    cout << "Unmatched {} is kept: " << (countLines(text, "ERROR   missing 1 {}") == 1 &&
+        countLines(text, "INFO    no arguments {}") == 1 ? "PASS" : "FAIL") << endl;
+    cout << "Lines start with a timestamp: " << (text.size() > 0 && text[0] == '[' ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that calls below LOG_MIN_LEVEL are compiled out.
+ * A filtered call must not evaluate its arguments or queue a record.
+ */
+void TestLogger::testLevelFilter() {
+    cout << "\n--- Test: Compile-Time Level Filter ---" << endl;
+
+    ostringstream out;
+    Logger::setOutput(&out);
+    unsigned long long before = Logger::getWrittenCount();
+    int evaluated = 0;
+    LOG_DEBUG("debug {}", ++evaluated);
+    LOG_ERROR("error {}", ++evaluated);
+    Logger::setOutput(nullptr);
+    unsigned long long count = Logger::getWrittenCount() - before;
+
+    cout << "Debug call is compiled out: " << (evaluated == 1 && count == 1 && countLines(out.str(), "debug") == 0 ? "PASS" : "FAIL") << endl;
+    cout << "Error call is kept: " << (countLines(out.str(), "ERROR   error") == 1 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests logging from several threads at once.
+ * Each thread's records must be written in the order the thread logged them, or
+ * counted as dropped; how many drop depends on the machine and is only reported.
+ */
+void TestLogger::testThreads() {
+    cout << "\n--- Test: Logging From Several Threads ---" << endl;
+
+    const int threadCount = 4;
+    const int records = 500;
+    ostringstream out;
+    Logger::setOutput(&out);
+    unsigned long long before = Logger::getWrittenCount();
+    unsigned long long droppedBefore = Logger::getDroppedCount();
+
+    vector<thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.push_back(thread([t, records] {
+            for (int i = 0; i < records; i++) {
+                LOG_INFO("thread {} record {}", t, i);
+                if (i % 64 == 63) {
+                    this_thread::sleep_for(chrono::microseconds(200));
+                }
+            }
+        }));
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    Logger::setOutput(nullptr);
+
+    istringstream lines(out.str());
+    string line;
+    vector<int> last(threadCount, -1);
+    bool ordered = true;
+    int parsed = 0;
+    while (getline(lines, line)) {
+        int t;
+        int i;
+        size_t at = line.find("thread ");
+        if (at != string::npos && sscanf(line.c_str() + at, "thread %d record %d", &t, &i) == 2 && t >= 0 && t < threadCount) {
+            ordered = ordered && i > last[t];
+            last[t] = i;
+            parsed++;
+        }
+    }
+    unsigned long long dropped = Logger::getDroppedCount() - droppedBefore;
+    cout << "Every record is written or counted as dropped: " <<
+        (parsed + dropped == threadCount * records && Logger::getWrittenCount() - before == static_cast<unsigned long long>(parsed) ? "PASS" : "FAIL") << endl;
+    cout << "Records of each thread keep their order: " << (ordered ? "PASS" : "FAIL") << endl;
+    cout << "Dropped " << dropped << " of " << threadCount * records << " records at this rate" << endl;
+}
+
+/**
+ * @brief Tests that a full ring drops and counts records instead of blocking.
+ */
+void TestLogger::testDrops() {
+    cout << "\n--- Test: Full Ring Drops Records ---" << endl;
+
+    const int records = 50000;
+    ostringstream out;
+    Logger::setOutput(&out);
+    unsigned long long before = Logger::getWrittenCount();
+    unsigned long long droppedBefore = Logger::getDroppedCount();
+    for (int i = 0; i < records; i++) {
+        LOG_INFO("burst {}", i);
+    }
+    Logger::setOutput(nullptr);
+    unsigned long long written = Logger::getWrittenCount() - before;
+    unsigned long long dropped = Logger::getDroppedCount() - droppedBefore;
+
+    cout << "Written " << written << ", dropped " << dropped << endl;
+    cout << "Written and dropped add up: " << (written + dropped == records ? "PASS" : "FAIL") << endl;
+    cout << "Drops are reported in the log: " << (dropped == 0 || countLines(out.str(), "log records dropped") > 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares a log call with a flushed console line.
+ *
+ * Calls are timed in bursts smaller than the ring, with a flush between bursts, so the
+ * numbers show the cost on the calling thread rather than the writer's speed. The
+ * console line and the logger output both go to a file.
+ */
+void TestLogger::benchmarkLogCall() {
+    cout << "\n--- Benchmark: Log Call Overhead ---" << endl;
+
+    const int bursts = 200;
+    const int burst = Logger::RING_SIZE / 2;
+    ofstream file(TEST_FILE);
+    Logger::setOutput(&file);
+
+    LatencyHistogram console;
+    streambuf* saved = cout.rdbuf(file.rdbuf());
+    for (int b = 0; b < bursts; b++) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < burst; i++) {
+            cout << "RobotControler moved forward." << endl;
+        }
+        console.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / burst);
+    }
+    cout.rdbuf(saved);
+
+    LatencyHistogram plain;
+    LatencyHistogram arguments;
+    for (int b = 0; b < bursts; b++) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < burst; i++) {
+            LOG_INFO("RobotControler moved forward.");
+        }
+        plain.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / burst);
+        Logger::flush();
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < burst; i++) {
+            LOG_INFO("pose {} {} {} step {}", 1.5, -2.0, 0.25, i);
+        }
+        arguments.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / burst);
+        Logger::flush();
+    }
+
+    // Full controller command: API call plus its status message.
+    SilentRobotAPI api;
+    RobotControler rc(&api);
+    rc.connectRobot();
+    LatencyHistogram command;
+    for (int b = 0; b < bursts; b++) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < burst; i++) {
+            rc.moveForward();
+        }
+        command.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count() / burst);
+        Logger::flush();
+    }
+    rc.disconnectRobot();
+    Logger::setOutput(nullptr);
+
+    console.print("cout << ... << endl (per line)");
+    plain.print("LOG_INFO, no arguments (per call)");
+    arguments.print("LOG_INFO, 4 arguments (per call)");
+    command.print("RobotControler::moveForward (per call)");
+    // Timings depend on the build and the load of the machine, so they are reported rather than checked.
+    cout << "Enabled log call p50: " << plain.getPercentile(50) << " ns without arguments, " <<
+        arguments.getPercentile(50) << " ns with 4 (target under 100 ns)" << endl;
+    cout << "Log call against a console line at p50: " << plain.getPercentile(50) << " ns vs " << console.getPercentile(50) << " ns" << endl;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file TestLogger.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestLogger class for testing the Logger class.
+ *
+ * This file contains the class declaration for testing message formatting, level
+ * filtering and logging from several threads, and for measuring the cost of a log call.
+ */
+
+#include "Logger.h"
+
+ /**
+  * @class TestLogger
+  * @brief A class to test the functionality of the Logger class.
+  */
+class TestLogger {
+public:
+    /**
+     * @brief Default constructor for TestLogger.
+     */
+    TestLogger();
+
+    /**
+     * @brief Destructor for TestLogger.
+     */
+    ~TestLogger();
+
+    /**
+     * @brief Runs all test cases for the Logger class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests argument substitution and line layout.
+     */
+    void testFormatting();
+
+    /**
+     * @brief Tests that calls below LOG_MIN_LEVEL are compiled out.
+     */
+    void testLevelFilter();
+
+    /**
+     * @brief Tests logging from several threads at once.
+     */
+    void testThreads();
+
+    /**
+     * @brief Tests that a full ring drops and counts records instead of blocking.
+     */
+    void testDrops();
+
+    /**
+     * @brief Compares a log call with a flushed console line.
+     */
+    void benchmarkLogCall();
+};
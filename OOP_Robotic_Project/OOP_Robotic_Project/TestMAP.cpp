@@ -0,0 +1,225 @@
+/**
+ * @file TestMAP.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestMAP class for testing the MAP class.
+ */
+
+#include "TestMAP.h"
+#include "RayCaster.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Default constructor for the TestMAP class.
+ */
+TestMAP::TestMAP() {
+    cout << "[TestMAP] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestMAP class.
+ */
+TestMAP::~TestMAP() {
+    cout << "[TestMAP] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the MAP class.
+ */
+void TestMAP::runAllTests() {
+    cout << "\n================ Starting MAP Tests ================\n" << endl;
+
+    testCoordinates();
+    testIntegrateScan();
+    testChangedCells();
+    benchmarkIntegration();
+
+    cout << "\n================ Ending MAP Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests conversion between world coordinates and cells.
+ */
+void TestMAP::testCoordinates() {
+    cout << "--- Test: Coordinates ---" << endl;
+
+    MAP map(10.0, 10.0, 0.1);
+    int cx = 0;
+    int cy = 0;
+    bool inside = map.worldToCell(0.05, -0.05, cx, cy);
+    cout << "Map is rounded up to whole tiles: " << (map.getWidth() == 128 && map.getHeight() == 128 ? "PASS" : "FAIL") << endl;
+    cout << "World origin maps to the middle of the requested area: " << (inside && cx == 50 && cy == 49 ? "PASS" : "FAIL") << endl;
+
+    double x = 0;
+    double y = 0;
+    map.cellToWorld(cx, cy, x, y);
+    cout << "Cell center converts back: " << (fabs(x - 0.05) < 1e-9 && fabs(y + 0.05) < 1e-9 ? "PASS" : "FAIL") << endl;
+    cout << "Far point is outside: " << (!map.worldToCell(50.0, 0.0, cx, cy) ? "PASS" : "FAIL") << endl;
+    cout << "No tiles before any update: " << (map.getTileCount() == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that a scan clears the beam path, marks the hit and allocates tiles lazily.
+ */
+void TestMAP::testIntegrateScan() {
+    cout << "\n--- Test: Integrate Scan ---" << endl;
+
+    MAP map(20.0, 20.0, 0.1);
+    LidarGeometry geometry;
+    geometry.startAngle = 0.0;
+    geometry.angleIncrement = 3.14159265358979323846 / 2.0;
+    geometry.maxRange = 5.0;
+    // Beam 0 along +x hits at 2 m, beam 1 along +y reaches the maximum range.
+    float ranges[2] = { 2.0f, 5.0f };
+    map.integrateScan(Pose(0.0, 0.0, 0.0), ranges, 2, geometry);
+
+    int cx = 0;
+    int cy = 0;
+    map.worldToCell(1.0, 0.0, cx, cy);
+    cout << "Cell on the beam is free: " << (map.isFree(cx, cy) ? "PASS" : "FAIL") << endl;
+    map.worldToCell(2.05, 0.05, cx, cy);
+    cout << "Cell at the hit is occupied: " << (map.isOccupied(cx, cy) ? "PASS" : "FAIL") << endl;
+    map.worldToCell(0.0, 4.5, cx, cy);
+    cout << "Max-range beam clears its path: " << (map.isFree(cx, cy) ? "PASS" : "FAIL") << endl;
+    map.worldToCell(0.05, 5.05, cx, cy);
+    cout << "Max-range beam marks no hit: " << (!map.isOccupied(cx, cy) ? "PASS" : "FAIL") << endl;
+    map.worldToCell(-3.0, -3.0, cx, cy);
+    cout << "Unseen cell is unknown: " << (map.getProbability(cx, cy) == 0.5 ? "PASS" : "FAIL") << endl;
+    cout << "Only touched tiles are allocated: " << (map.getTileCount() > 0 && map.getTileCount() <= 4 ? "PASS" : "FAIL") << endl;
+
+    for (int n = 0; n < 100; n++) {
+        map.integrateScan(Pose(0.0, 0.0, 0.0), ranges, 2, geometry);
+    }
+    map.worldToCell(1.0, 0.0, cx, cy);
+    cout << "Repeated misses stay clamped: " << (map.getLogOdds(cx, cy) == -5.0f ? "PASS" : "FAIL") << endl;
+
+    // 40000 cells wide: cells past 32767 would overflow the ray caster's positions.
+    MAP wide(2000.0, 20.0, 0.05);
+    wide.integrateScan(Pose(900.0, 0.0, 0.0), ranges, 2, geometry);
+    wide.worldToCell(901.0, 0.0, cx, cy);
+    bool ok = cx > RayCaster::MAX_CELLS && wide.isFree(cx, cy);
+    wide.worldToCell(902.025, 0.025, cx, cy);
+    ok = ok && wide.isOccupied(cx, cy);
+    wide.worldToCell(900.025, 4.5, cx, cy);
+    ok = ok && wide.isFree(cx, cy);
+    wide.worldToCell(900.025, 5.025, cx, cy);
+    ok = ok && !wide.isOccupied(cx, cy);
+    cout << "Map wider than the ray caster traces beam by beam: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that change tracking reports every cell whose classification changed.
+ *
+ * The classification of every cell is compared before and after a few scans; each
+ * cell that changed must be in the reported set.
+ */
+void TestMAP::testChangedCells() {
+    cout << "\n--- Test: Changed Cells ---" << endl;
+
+    MAP map(6.4, 6.4, 0.05);
+    LidarGeometry geometry = LidarGeometry::fullCircle(180, 4.0);
+    vector<float> ranges(180);
+    srand(17);
+    for (size_t i = 0; i < ranges.size(); i++) {
+        ranges[i] = 0.5f + static_cast<float>(rand() % 2500) / 1000.0f;
+    }
+    map.integrateScan(Pose(0.0, 0.0, 0.0), ranges.data(), 180, geometry);
+    cout << "Nothing is recorded while tracking is off: " << (map.getChangedCount() == 0 ? "PASS" : "FAIL") << endl;
+
+    const int width = map.getWidth();
+    const int height = map.getHeight();
+    vector<int> before(width * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            before[y * width + x] = map.isOccupied(x, y) ? 1 : (map.isFree(x, y) ? -1 : 0);
+        }
+    }
+    map.setChangeTracking(true);
+    for (int s = 0; s < 3; s++) {
+        for (size_t i = 0; i < ranges.size(); i++) {
+            ranges[i] = 0.5f + static_cast<float>(rand() % 2500) / 1000.0f;
+        }
+        map.integrateScan(Pose(0.3 * s, -0.2 * s, 0.1 * s), ranges.data(), 180, geometry);
+    }
+    map.traceRay(10, 10, 40, 20, true);
+    for (int i = 0; i < 3; i++) {
+        map.updateCell(100, 100, 1.0f);
+    }
+
+    vector<GridCell> changed;
+    size_t count = map.takeChangedCells(changed);
+    vector<unsigned char> reported(width * height, 0);
+    bool ordered = true;
+    for (size_t i = 0; i < changed.size(); i++) {
+        reported[changed[i].y * width + changed[i].x] = 1;
+        if (i > 0) {
+            const GridCell& a = changed[i - 1];
+            const GridCell& b = changed[i];
+            ordered = ordered && (a.y < b.y || (a.y == b.y && a.x < b.x));
+        }
+    }
+    int missed = 0;
+    int actual = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int now = map.isOccupied(x, y) ? 1 : (map.isFree(x, y) ? -1 : 0);
+            if (now != before[y * width + x]) {
+                actual++;
+                missed += reported[y * width + x] == 0;
+            }
+        }
+    }
+    cout << "Changed cells: " << actual << ", reported: " << count << endl;
+    cout << "Every changed cell is reported: " << (actual > 0 && missed == 0 && count == changed.size() ? "PASS" : "FAIL") << endl;
+    cout << "Cells are reported row by row, each once: " << (ordered ? "PASS" : "FAIL") << endl;
+    cout << "Direct updates are tracked: " << (reported[100 * width + 100] == 1 ? "PASS" : "FAIL") << endl;
+    cout << "Taking the set starts a new one: " << (map.getChangedCount() == 0 && map.takeChangedCells(changed) == 0 ? "PASS" : "FAIL") << endl;
+
+    map.updateCell(100, 100, 1.0f);
+    cout << "A cell that stays occupied is not reported: " << (map.getChangedCount() == 0 ? "PASS" : "FAIL") << endl;
+    map.updateCell(100, 100, -10.0f);
+    map.setChangeTracking(false);
+    cout << "Stopping tracking discards the set: " << (map.getChangedCount() == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures scans per second on a 200 m x 200 m map at 5 cm.
+ *
+ * A robot drives a 60 m loop and takes 720-beam scans with ranges up to 8 m.
+ */
+void TestMAP::benchmarkIntegration() {
+    cout << "\n--- Benchmark: Scan Integration ---" << endl;
+
+    const int beams = 720;
+    const int scans = 2000;
+    MAP map(200.0, 200.0, 0.05);
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 8.0);
+
+    static float ranges[64][beams];
+    srand(7);
+    for (int s = 0; s < 64; s++) {
+        for (int i = 0; i < beams; i++) {
+            ranges[s][i] = 0.5f + static_cast<float>(rand() % 8000) / 1000.0f;
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        double t = 2.0 * 3.14159265358979323846 * s / scans;
+        Pose pose(30.0 * cos(t), 30.0 * sin(t), t);
+        map.integrateScan(pose, ranges[s & 63], beams, geometry);
+    }
+    auto end = chrono::steady_clock::now();
+
+    double seconds = chrono::duration<double>(end - start).count();
+    cout << "Map: " << map.getWidth() << " x " << map.getHeight() << " cells, "
+        << map.getTileCount() << " tiles allocated ("
+        << map.getMemoryUsage() / (1024.0 * 1024.0) << " MB)" << endl;
+    cout << "Scans per second: " << scans / seconds << " (" << beams * scans / seconds << " beams/s)" << endl;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file TestMAP.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestMAP class for testing the MAP class.
+ *
+ * This file contains the class declaration for testing the occupancy grid and for
+ * measuring scan integration throughput on a large map.
+ */
+
+#include "MAP.h"
+
+ /**
+  * @class TestMAP
+  * @brief A class to test the functionality of the MAP class.
+  */
+class TestMAP {
+public:
+    /**
+     * @brief Default constructor for TestMAP.
+     */
+    TestMAP();
+
+    /**
+     * @brief Destructor for TestMAP.
+     */
+    ~TestMAP();
+
+    /**
+     * @brief Runs all test cases for the MAP class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests conversion between world coordinates and cells.
+     */
+    void testCoordinates();
+
+    /**
+     * @brief Tests that a scan clears the beam path, marks the hit and allocates tiles lazily.
+     */
+    void testIntegrateScan();
+
+    /**
+     * @brief Tests that change tracking reports every cell whose classification changed.
+     */
+    void testChangedCells();
+
+    /**
+     * @brief Measures scans per second on a 200 m x 200 m map at 5 cm.
+     */
+    void benchmarkIntegration();
+};
@@ -0,0 +1,359 @@
+/**
+ * @file TestMetrics.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestMetrics class for testing the Metrics class.
+ */
+
+#include "TestMetrics.h"
+#include "IRSensor.h"
+#include "Logger.h"
+#include "PathPlanner.h"
+#include "RobotControler.h"
+#include "SimulatedRobot.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+static const char* TRACE_FILE = "TestMetrics.json";
+static const char* PROMETHEUS_FILE = "TestMetrics.prom";
+
+/**
+ * @brief Returns the contents of a file, empty if it cannot be read.
+ */
+static string readFile(const char* path) {
+    ifstream file(path, ios::binary);
+    ostringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+/**
+ * @brief Counts the occurrences of a pattern in a text.
+ */
+static size_t countOf(const string& text, const string& pattern) {
+    size_t count = 0;
+    for (size_t at = text.find(pattern); at != string::npos; at = text.find(pattern, at + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Default constructor for the TestMetrics class.
+ */
+TestMetrics::TestMetrics() {
+    cout << "[TestMetrics] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestMetrics class.
+ */
+TestMetrics::~TestMetrics() {
+    remove(TRACE_FILE);
+    remove(PROMETHEUS_FILE);
+    cout << "[TestMetrics] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the Metrics class.
+ *
+ * Metrics are process-wide, so every test starts from reset() and recording is
+ * turned off again at the end. The controller logs every command it sends, so its log
+ * output is discarded while the tests run.
+ */
+void TestMetrics::runAllTests() {
+    cout << "\n================ Starting Metrics Tests ================\n" << endl;
+
+    ostream discard(nullptr);
+    Logger::setOutput(&discard);
+
+    testDisabled();
+    testCounters();
+    testHistograms();
+    testInstrumentation();
+    testExport();
+    benchmarkOverhead();
+
+    Metrics::setTracing(false);
+    Metrics::setEnabled(false);
+    Metrics::reset();
+    Logger::flush();
+    Logger::setOutput(nullptr);
+
+    cout << "\n================ Ending Metrics Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests that nothing is recorded while recording is off.
+ */
+void TestMetrics::testDisabled() {
+    cout << "--- Test: Recording Off ---" << endl;
+
+    Metrics::setEnabled(false);
+    Metrics::reset();
+    for (int i = 0; i < 1000; i++) {
+        METRIC_COUNT("test_disabled_total", 1);
+        METRIC_SCOPE("test_disabled");
+    }
+    bool ok = !Metrics::isEnabled() && Metrics::getCounter("test_disabled_total") == 0
+        && Metrics::getHistogram("test_disabled").count == 0;
+    cout << "Macros record nothing and register nothing: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests counters updated from several threads.
+ *
+ * Each thread writes its own shard, so no update may be lost, and the counts of
+ * threads that exited stay in the total.
+ */
+void TestMetrics::testCounters() {
+    cout << "\n--- Test: Counters ---" << endl;
+
+    Metrics::reset();
+    Metrics::setEnabled(true);
+    const int threads = 4;
+    const int perThread = 100000;
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([]() {
+            for (int i = 0; i < perThread; i++) {
+                METRIC_COUNT("test_events_total", 1);
+            }
+            METRIC_COUNT("test_bytes_total", 1000);
+        });
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    unsigned long long events = Metrics::getCounter("test_events_total");
+    unsigned long long bytes = Metrics::getCounter("test_bytes_total");
+    bool ok = events == static_cast<unsigned long long>(threads) * perThread && bytes == threads * 1000ULL;
+    cout << threads << " threads counted " << events << " events and " << bytes << " bytes: " << (ok ? "PASS" : "FAIL") << endl;
+
+    int first = Metrics::counter("test_events_total");
+    ok = first >= 0 && Metrics::counter("test_events_total") == first && Metrics::getCounter("test_unknown_total") == 0;
+    cout << "Names register once: " << (ok ? "PASS" : "FAIL") << endl;
+
+    Metrics::reset();
+    ok = Metrics::getCounter("test_events_total") == 0 && Metrics::counter("test_events_total") == first;
+    cout << "Reset zeroes counters and keeps names: " << (ok ? "PASS" : "FAIL") << endl;
+    Metrics::setEnabled(false);
+}
+
+/**
+ * @brief Tests histogram buckets, percentiles and scoped timers.
+ */
+void TestMetrics::testHistograms() {
+    cout << "\n--- Test: Histograms ---" << endl;
+
+    bool ok = true;
+    for (long long value = 0; value < (1LL << 22) && ok; value += 1 + value / 64) {
+        int bucket = Metrics::bucketOf(value);
+        ok = Metrics::bucketUpper(bucket) >= value && (bucket == 0 || Metrics::bucketUpper(bucket - 1) < value)
+            && Metrics::bucketUpper(bucket) - value <= value / 16;
+    }
+    ok = ok && Metrics::bucketOf(1LL << 50) == Metrics::BUCKET_COUNT - 1;
+    cout << "Buckets are contiguous with 1/16 resolution: " << (ok ? "PASS" : "FAIL") << endl;
+
+    Metrics::reset();
+    int histogram = Metrics::histogram("test_values");
+    for (long long value = 1; value <= 100000; value++) {
+        Metrics::record(histogram, value);
+    }
+    HistogramSnapshot snapshot = Metrics::getHistogram("test_values");
+    long long p50 = snapshot.getPercentile(50.0);
+    long long p99 = snapshot.getPercentile(99.0);
+    ok = snapshot.count == 100000 && snapshot.minimum == 1 && snapshot.maximum == 100000
+        && fabs(snapshot.getMean() - 50000.5) < 1e-6 && p50 >= 50000 && p50 <= 50000 + 50000 / 16
+        && p99 >= 99000 && p99 <= 99000 + 99000 / 16 && snapshot.getPercentile(100.0) == 100000;
+    cout << "1..100000: p50 " << p50 << ", p99 " << p99 << ", mean " << snapshot.getMean() << ": " << (ok ? "PASS" : "FAIL") << endl;
+
+    Metrics::setEnabled(true);
+    for (int i = 0; i < 3; i++) {
+        METRIC_SCOPE("test_sleep");
+        this_thread::sleep_for(chrono::milliseconds(2));
+    }
+    Metrics::setEnabled(false);
+    snapshot = Metrics::getHistogram("test_sleep");
+    ok = snapshot.count == 3 && snapshot.minimum >= 2000000 && snapshot.maximum < 1000000000;
+    cout << "Scoped timer of a 2 ms sleep: " << snapshot.count << " samples, min " << snapshot.minimum / 1e6
+        << " ms: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests the metrics recorded by RobotControler, the sensors and the planner.
+ */
+void TestMetrics::testInstrumentation() {
+    cout << "\n--- Test: Instrumented Control Stack ---" << endl;
+
+    Metrics::reset();
+    Metrics::setEnabled(true);
+
+    SimulatedRobot robot;
+    RobotControler rc(&robot);
+    rc.connectRobot();
+    rc.moveForward();
+    rc.turnLeft();
+    rc.stop();
+    rc.getPose();
+    rc.getPose();
+    IRSensor ir(&robot);
+    ir.refresh();
+
+    const int size = 64;
+    vector<unsigned char> grid(size * size, 0);
+    for (int y = 8; y < size; y++) {
+        grid[y * size + size / 2] = 1;
+    }
+    PathPlanner planner;
+    planner.setGrid(size, size, grid.data(), 0.1, 0.0, 0.0);
+    vector<GridCell> path;
+    double cost = planner.plan(GridCell{ 2, 60 }, GridCell{ 60, 60 }, path);
+    Metrics::setEnabled(false);
+
+    bool ok = Metrics::getHistogram("robot_api_command").count == 3 && Metrics::getHistogram("robot_api_pose").count == 2;
+    cout << "RobotControler API calls: " << (ok ? "PASS" : "FAIL") << endl;
+
+    ok = Metrics::getHistogram("sensor_ir_read").count == 1;
+    cout << "IR sensor read: " << (ok ? "PASS" : "FAIL") << endl;
+
+    unsigned long long expanded = Metrics::getCounter("planner_expanded_total");
+    ok = cost > 0.0 && Metrics::getHistogram("planner_plan").count == 1
+        && expanded == static_cast<unsigned long long>(planner.getExpandedCount()) && expanded > 0;
+    cout << "Planner search of " << expanded << " cells: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests the Chrome trace and Prometheus files.
+ *
+ * A thread records more scopes than its ring holds without collecting, so the rest
+ * must be counted as dropped.
+ */
+void TestMetrics::testExport() {
+    cout << "\n--- Test: Export ---" << endl;
+
+    Metrics::reset();
+    Metrics::setEnabled(true);
+    Metrics::setTracing(true);
+    for (int i = 0; i < 100; i++) {
+        METRIC_SCOPE("test_step");
+        METRIC_COUNT("test_steps_total", 1);
+    }
+    thread worker([]() {
+        for (int i = 0; i < Metrics::TRACE_RING_SIZE + 50; i++) {
+            METRIC_SCOPE("test_worker_step");
+        }
+    });
+    worker.join();
+    Metrics::setTracing(false);
+    Metrics::setEnabled(false);
+
+    size_t events = Metrics::getTraceEventCount();
+    unsigned long long dropped = Metrics::getTraceDroppedCount();
+    bool ok = events == 100 + static_cast<size_t>(Metrics::TRACE_RING_SIZE) && dropped == 50;
+    cout << events << " trace events, " << dropped << " dropped: " << (ok ? "PASS" : "FAIL") << endl;
+
+    ok = Metrics::writeChromeTrace(TRACE_FILE);
+    string trace = readFile(TRACE_FILE);
+    const string header = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    ok = ok && trace.compare(0, header.size(), header) == 0 && trace.find("\n]}") != string::npos
+        && countOf(trace, "\"ph\":\"X\"") == events && countOf(trace, "\"name\":\"test_step\"") == 100
+        && countOf(trace, "\"ts\":-") == 0 && Metrics::getTraceEventCount() == 0;
+    cout << "Chrome trace holds every event: " << (ok ? "PASS" : "FAIL") << endl;
+
+    ok = Metrics::writePrometheus(PROMETHEUS_FILE);
+    string text = readFile(PROMETHEUS_FILE);
+    ok = ok && text == Metrics::prometheusText() && text.find("# TYPE test_steps_total counter\ntest_steps_total 100\n") != string::npos
+        && text.find("# TYPE test_step_seconds histogram\n") != string::npos
+        && text.find("test_step_seconds_bucket{le=\"+Inf\"} 100\n") != string::npos
+        && text.find("test_step_seconds_count 100\n") != string::npos
+        && text.find("metrics_trace_dropped_total 50\n") != string::npos;
+
+    unsigned long long previous = 0;
+    istringstream lines(text);
+    string line;
+    while (getline(lines, line)) {
+        if (line.compare(0, 24, "test_step_seconds_bucket") == 0) {
+            unsigned long long value = stoull(line.substr(line.rfind(' ') + 1));
+            ok = ok && value >= previous;
+            previous = value;
+        }
+    }
+    cout << "Prometheus snapshot with cumulative buckets: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures the cost of METRIC_COUNT and METRIC_SCOPE.
+ *
+ * Each loop runs the macro around an addition to a volatile variable; the cost is the
+ * time per iteration minus that of the bare loop. With tracing, events are collected
+ * every 1024 iterations, outside the timed part. The times depend on the machine and
+ * its load, so they are only reported; what is checked is that the loops record
+ * nothing while recording is off and every call while it is on.
+ */
+void TestMetrics::benchmarkOverhead() {
+    cout << "\n--- Benchmark: Instrumentation Overhead ---" << endl;
+
+    const int iterations = 2000000;
+    volatile long long sink = 0;
+    Metrics::reset();
+
+    auto time = [&](int mode) {
+        auto start = chrono::steady_clock::now();
+        double excluded = 0.0;
+        for (int i = 0; i < iterations; i++) {
+            if (mode == 0) {
+                sink = sink + i;
+            }
+            else if (mode == 1) {
+                METRIC_COUNT("bench_total", 1);
+                sink = sink + i;
+            }
+            else {
+                METRIC_SCOPE("bench_scope");
+                sink = sink + i;
+            }
+            if (mode == 2 && Metrics::isTracing() && (i & 1023) == 1023) {
+                auto pause = chrono::steady_clock::now();
+                Metrics::collectTrace();
+                Metrics::reset();
+                excluded += chrono::duration<double>(chrono::steady_clock::now() - pause).count();
+            }
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count() - excluded;
+        return seconds * 1e9 / iterations;
+    };
+
+    double bare = time(0);
+    Metrics::setEnabled(false);
+    double countOff = time(1) - bare;
+    double scopeOff = time(2) - bare;
+    bool nothing = Metrics::getCounter("bench_total") == 0 && Metrics::getHistogram("bench_scope").count == 0;
+    Metrics::setEnabled(true);
+    double countOn = time(1) - bare;
+    double scopeOn = time(2) - bare;
+    bool every = Metrics::getCounter("bench_total") == static_cast<unsigned long long>(iterations)
+        && Metrics::getHistogram("bench_scope").count == static_cast<unsigned long long>(iterations);
+    Metrics::setTracing(true);
+    double scopeTraced = time(2) - bare;
+    Metrics::setTracing(false);
+    Metrics::setEnabled(false);
+    Metrics::reset();
+
+    cout << "Bare loop: " << bare << " ns/iteration" << endl;
+    cout << "Recording off: METRIC_COUNT " << countOff << " ns, METRIC_SCOPE " << scopeOff << " ns" << endl;
+    cout << "Recording on: METRIC_COUNT " << countOn << " ns, METRIC_SCOPE " << scopeOn << " ns, with tracing "
+        << scopeTraced << " ns" << endl;
+
+    bool ok = nothing && every;
+    cout << "Loops record nothing while off and every call while on: " << (ok ? "PASS" : "FAIL") << endl;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file TestMetrics.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestMetrics class for testing the Metrics class.
+ *
+ * This file contains the class declaration for testing counters, histograms, scoped
+ * timers, the instrumented control stack and the trace and Prometheus exports, and
+ * for measuring the cost of the METRIC_* macros when recording is off and on.
+ */
+
+#include "Metrics.h"
+
+ /**
+  * @class TestMetrics
+  * @brief A class to test the functionality of the Metrics class.
+  */
+class TestMetrics {
+public:
+    /**
+     * @brief Default constructor for TestMetrics.
+     */
+    TestMetrics();
+
+    /**
+     * @brief Destructor for TestMetrics.
+     */
+    ~TestMetrics();
+
+    /**
+     * @brief Runs all test cases for the Metrics class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests that nothing is recorded while recording is off.
+     */
+    void testDisabled();
+
+    /**
+     * @brief Tests counters updated from several threads.
+     */
+    void testCounters();
+
+    /**
+     * @brief Tests histogram buckets, percentiles and scoped timers.
+     */
+    void testHistograms();
+
+    /**
+     * @brief Tests the metrics recorded by RobotControler, the sensors and the planner.
+     */
+    void testInstrumentation();
+
+    /**
+     * @brief Tests the Chrome trace and Prometheus files.
+     */
+    void testExport();
+
+    /**
+     * @brief Measures the cost of METRIC_COUNT and METRIC_SCOPE.
+     */
+    void benchmarkOverhead();
+};
@@ -0,0 +1,462 @@
+/**
+ * @file TestParticleFilter.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestParticleFilter class for testing the ParticleFilter class.
+ */
+
+#include "TestParticleFilter.h"
+#include "MAP.h"
+#include "ScanMatcher.h"
+#include "SimulatedRobot.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+static const double WORLD_SIZE = 20.0;
+static const double RESOLUTION = 0.05;
+
+/**
+ * @brief Returns a random value in [low, high).
+ */
+static double uniform(double low, double high) {
+    return low + (high - low) * (rand() / (RAND_MAX + 1.0));
+}
+
+/**
+ * @brief Fills a world with a square room of the given side and count boxes inside.
+ */
+static void buildWorld(SimulationWorld& world, double size, int count, unsigned int seed) {
+    srand(seed);
+    double half = size / 2.0;
+    world.addBox(-half, -half, half, half);
+    for (int i = 0; i < count; i++) {
+        double cx = uniform(-half + 1.0, half - 1.0);
+        double cy = uniform(-half + 1.0, half - 1.0);
+        double r = uniform(0.2, 0.6);
+        world.addBox(cx - r, cy - r * 0.5, cx + r, cy + r * 0.5);
+    }
+    world.prepare();
+}
+
+/**
+ * @brief Rasterizes the walls of a world into a map: a cell is occupied when a wall
+ * passes within half a cell diagonal of its center, free otherwise.
+ */
+static void buildMap(const SimulationWorld& world, MAP& map) {
+    for (int cy = 0; cy < map.getHeight(); cy++) {
+        for (int cx = 0; cx < map.getWidth(); cx++) {
+            double x;
+            double y;
+            map.cellToWorld(cx, cy, x, y);
+            map.updateCell(cx, cy, world.collides(x, y, 0.75 * map.getResolution()) ? 5.0f : -5.0f);
+        }
+    }
+}
+
+/**
+ * @brief Casts a full-circle scan from a pose, with uniform range noise of +-noise.
+ */
+static void castScan(const SimulationWorld& world, const Pose& pose, int count, double noise, float* ranges) {
+    for (int i = 0; i < count; i++) {
+        double range = world.castRay(pose.getX(), pose.getY(), pose.getTh() - PI + i * (2.0 * PI / count), 10.0);
+        if (range < 10.0) {
+            range += uniform(-noise, noise);
+        }
+        ranges[i] = static_cast<float>(range);
+    }
+}
+
+/**
+ * @brief Returns a random pose of the world at least 0.5 m from every wall.
+ */
+static Pose freePose(const SimulationWorld& world, double half) {
+    while (true) {
+        Pose pose(uniform(-half, half), uniform(-half, half), uniform(-PI, PI));
+        if (!world.collides(pose.getX(), pose.getY(), 0.5)) {
+            return pose;
+        }
+    }
+}
+
+/**
+ * @brief Returns the coordinates of every particle, x, y and th of each in turn.
+ */
+static vector<double> particleState(const ParticleFilter& filter) {
+    const PoseArray& particles = filter.getParticles();
+    vector<double> state;
+    for (int i = 0; i < particles.size(); i++) {
+        state.push_back(particles.getXs()[i]);
+        state.push_back(particles.getYs()[i]);
+        state.push_back(particles.getThs()[i]);
+    }
+    return state;
+}
+
+/**
+ * @brief Default constructor for the TestParticleFilter class.
+ */
+TestParticleFilter::TestParticleFilter() {
+    cout << "[TestParticleFilter] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestParticleFilter class.
+ */
+TestParticleFilter::~TestParticleFilter() {
+    cout << "[TestParticleFilter] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the ParticleFilter class.
+ */
+void TestParticleFilter::runAllTests() {
+    cout << "\n================ Starting ParticleFilter Tests ================\n" << endl;
+
+    testLikelihood();
+    testScoring();
+    testResampling();
+    testDeterminism();
+    testTracking();
+    benchmarkUpdate();
+
+    cout << "\n================ Ending ParticleFilter Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests the likelihood field and that the true pose scores best.
+ *
+ * Wall cells must hold the largest value and cells far from walls and outside the map
+ * the smallest. Scans from 100 random poses must score higher at their own pose than
+ * 20 cm away or 5 degrees off.
+ */
+void TestParticleFilter::testLikelihood() {
+    cout << "--- Test: Likelihood Field ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 5);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    ParticleFilter filter(map, 100, 1, 0.2, 0.05);
+    float wall = filter.getFieldValue(-WORLD_SIZE / 2.0, 0.0);
+    float near = filter.getFieldValue(-WORLD_SIZE / 2.0 + 0.2, 0.0);
+    float outside = filter.getFieldValue(100.0, 0.0);
+    cout << "Field at a wall: " << wall << ", 20 cm away: " << near << ", outside: " << outside << endl;
+    cout << "Field peaks at walls and falls off with distance: " << (fabs(wall - log(1.05)) < 1e-3
+        && near < wall && near > outside && fabs(outside - log(0.05)) < 1e-6 ? "PASS" : "FAIL") << endl;
+
+    filter.setLidarGeometry(LidarGeometry::fullCircle(360), 360);
+    vector<float> ranges(360);
+    int best = 0;
+    const int trials = 100;
+    for (int t = 0; t < trials; t++) {
+        Pose pose = freePose(world, 9.0);
+        castScan(world, pose, 360, 0.02, ranges.data());
+        filter.update(ranges.data());
+        double truth = filter.logLikelihood(pose);
+        bool wins = true;
+        for (int k = 0; k < 4; k++) {
+            double angle = k * PI / 2.0;
+            wins &= truth > filter.logLikelihood(Pose(pose.getX() + 0.2 * cos(angle), pose.getY() + 0.2 * sin(angle), pose.getTh()));
+        }
+        wins &= truth > filter.logLikelihood(Pose(pose.getX(), pose.getY(), pose.getTh() + 5.0 * PI / 180.0));
+        wins &= truth > filter.logLikelihood(Pose(pose.getX(), pose.getY(), pose.getTh() - 5.0 * PI / 180.0));
+        best += wins;
+    }
+    cout << "The scan pose beats its neighbors in " << best << " of " << trials << " scans: " << (best >= trials * 95 / 100 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the weights of update() with scoring every particle one beam at a time.
+ *
+ * 1001 particles, not a multiple of the chunk size, spread over the whole room, so
+ * many end points fall outside the map. Every fifth beam is cut to the maximum range
+ * and every other beam skipped, so the scored beams are not a multiple of the vector
+ * width either. Resampling is off so the weights stay those of the scan.
+ */
+void TestParticleFilter::testScoring() {
+    cout << "\n--- Test: Vectorized Scoring ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 5);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    ParticleFilter filter(map, 1001, 2);
+    filter.setLidarGeometry(LidarGeometry::fullCircle(362), 362, 2);
+    filter.setResampleThreshold(0.0);
+    filter.initialize(Pose(0.0, 0.0, 0.0), 6.0, PI);
+
+    vector<float> ranges(362);
+    castScan(world, Pose(1.0, -2.0, 0.3), 362, 0.02, ranges.data());
+    for (int i = 0; i < 362; i += 5) {
+        ranges[i] = 10.0f;
+    }
+    filter.update(ranges.data());
+    int valid = 0;
+    for (int i = 0; i < 362; i += 2) {
+        valid += ranges[i] < 10.0f;
+    }
+
+    const PoseArray& particles = filter.getParticles();
+    const double* weights = filter.getWeights();
+    vector<double> expected(particles.size());
+    double largest = -1e300;
+    int heaviest = 0;
+    for (int i = 0; i < particles.size(); i++) {
+        expected[i] = filter.logLikelihood(particles.get(i));
+        if (expected[i] > largest) {
+            largest = expected[i];
+            heaviest = i;
+        }
+    }
+    double worst = 0.0;
+    for (int i = 0; i < particles.size(); i++) {
+        if (weights[i] > 0.0) {
+            double difference = fabs(log(weights[i] / weights[heaviest]) - (expected[i] - largest));
+            worst = difference > worst ? difference : worst;
+        }
+        else {
+            worst = expected[i] - largest > -700.0 ? 1e300 : worst;
+        }
+    }
+    cout << "Scored beams: " << filter.getScoredBeamCount() << ", largest log-weight difference: " << worst << endl;
+    cout << "Vectorized weights match beam-by-beam scoring: " << (filter.getScoredBeamCount() == valid && valid % 8 != 0 && worst < 1e-3 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests low-variance resampling and that it reuses the particle arrays.
+ *
+ * After a scan weights a spread of particles, every particle must get floor(w n) or
+ * ceil(w n) copies. Two resamplings must switch to the second array and back without
+ * allocating a third.
+ */
+void TestParticleFilter::testResampling() {
+    cout << "\n--- Test: Low-Variance Resampling ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 5);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    ParticleFilter filter(map, 2000, 1, 0.5);
+    filter.setLidarGeometry(LidarGeometry::fullCircle(90), 90);
+    filter.setResampleThreshold(0.0);
+    filter.initialize(Pose(1.0, -2.0, 0.3), 0.3, 0.1);
+    vector<float> ranges(90);
+    castScan(world, Pose(1.0, -2.0, 0.3), 90, 0.02, ranges.data());
+    filter.update(ranges.data());
+
+    const PoseArray& before = filter.getParticles();
+    int n = before.size();
+    std::map<tuple<double, double, double>, int> index;
+    vector<double> weights(filter.getWeights(), filter.getWeights() + n);
+    for (int i = 0; i < n; i++) {
+        index[make_tuple(before.getXs()[i], before.getYs()[i], before.getThs()[i])] = i;
+    }
+    const double* first = before.getXs();
+    cout << "Effective particles before resampling: " << filter.getEffectiveSampleSize() << " of " << n << endl;
+
+    filter.resample();
+    const PoseArray& after = filter.getParticles();
+    vector<int> copies(n, 0);
+    bool known = after.size() == n;
+    for (int i = 0; i < after.size(); i++) {
+        auto found = index.find(make_tuple(after.getXs()[i], after.getYs()[i], after.getThs()[i]));
+        known &= found != index.end();
+        if (found != index.end()) {
+            copies[found->second]++;
+        }
+    }
+    bool proportional = known;
+    int survivors = 0;
+    for (int i = 0; i < n; i++) {
+        double share = weights[i] * n;
+        proportional &= copies[i] >= floor(share) - 1e-9 && copies[i] <= ceil(share) + 1e-9;
+        survivors += copies[i] > 0;
+    }
+    cout << "Particles with copies: " << survivors << ", effective particles after: " << filter.getEffectiveSampleSize() << endl;
+    cout << "Each particle gets floor or ceil of w n copies: " << (proportional ? "PASS" : "FAIL") << endl;
+
+    const double* second = filter.getParticles().getXs();
+    filter.resample();
+    const double* third = filter.getParticles().getXs();
+    cout << "Resampling alternates between two arrays: " << (second != first && third == first && filter.getResampleCount() == 2 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that the filter gives the same particles on 1 and 4 threads.
+ *
+ * Twenty predict() and update() steps along a straight path, with resampling on.
+ */
+void TestParticleFilter::testDeterminism() {
+    cout << "\n--- Test: Determinism Across Threads ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 5);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    srand(9);
+    Pose start = freePose(world, 8.0);
+    vector<float> ranges(180);
+    vector<double> reference;
+    bool same = true;
+    for (int threads = 1; threads <= 4; threads += 3) {
+        ParticleFilter filter(map, 3000, threads, 0.2, 0.05, 77);
+        filter.setLidarGeometry(LidarGeometry::fullCircle(180), 180);
+        filter.initialize(start, 0.3, 0.2);
+        for (int step = 0; step <= 20; step++) {
+            Pose pose = ScanMatcher::compose(start, Pose(0.02 * step, 0.0, 0.01 * step));
+            castScan(world, pose, 180, 0.0, ranges.data());
+            filter.predict(pose);
+            filter.update(ranges.data());
+        }
+        if (threads == 1) {
+            reference = particleState(filter);
+        }
+        else {
+            same &= particleState(filter) == reference;
+        }
+    }
+    cout << "1 and 4 threads give the same particles: " << (same ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that the filter tracks a simulated robot with drifting odometry.
+ *
+ * A SimulatedRobot wanders for 60 simulated seconds with a 360-beam lidar read every
+ * 0.1 s, turning when its front IR sees a wall or when it bumps into one. The odometry
+ * overestimates distances and turns by 5 %. The filter starts 30 cm and 8 degrees off,
+ * with particles spread 0.5 m and 10 degrees, and scores every other beam. After the
+ * first 5 seconds its mean error must stay below 10 cm and 3 degrees.
+ */
+void TestParticleFilter::testTracking() {
+    cout << "\n--- Test: Tracking a Robot ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 12);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    SimulatedRobot robot(&world, 360);
+    srand(4);
+    Pose start = freePose(world, 8.0);
+    robot.setPose(start.getX(), start.getY(), start.getTh());
+    robot.connect();
+    robot.move(FORWARD);
+
+    ParticleFilter filter(map, 2000, 0, 0.15, 0.05, 5);
+    filter.setLidarGeometry(LidarGeometry::fullCircle(360), 360, 2);
+    filter.setMotionNoise(0.1, 0.1, 0.05);
+    filter.initialize(Pose(start.getX() + 0.3, start.getY() - 0.3, start.getTh() + 8.0 * PI / 180.0), 0.5, 10.0 * PI / 180.0);
+    vector<float> ranges(360);
+    Pose truth = start;
+    Pose odometry = start;
+    double odometryError = 0.0;
+    double filterError = 0.0;
+    double headingError = 0.0;
+    double worst = 0.0;
+    int scans = 0;
+    int turnSteps = 0;
+    unsigned long long collisions = 0;
+    for (int step = 0; step < 6000; step++) {
+        if (step % 10 == 0) {
+            double x;
+            double y;
+            double th;
+            robot.getXYTh(x, y, th);
+            Pose now(x, y, th);
+            Pose delta = ScanMatcher::between(truth, now);
+            odometry = ScanMatcher::compose(odometry, Pose(delta.getX() * 1.05, delta.getY() * 1.05, delta.getTh() * 1.05));
+            truth = now;
+            robot.getLidarRange(ranges.data());
+            for (int i = 0; i < 360; i++) {
+                ranges[i] += ranges[i] < 10.0f ? static_cast<float>(uniform(-0.02, 0.02)) : 0.0f;
+            }
+            filter.predict(odometry);
+            filter.update(ranges.data());
+            if (step >= 500) {
+                Pose estimate = filter.getEstimate();
+                double error = estimate.findDistanceTo(truth);
+                odometryError += odometry.findDistanceTo(truth);
+                filterError += error;
+                headingError += fabs(remainder(estimate.getTh() - truth.getTh(), 2.0 * PI));
+                worst = error > worst ? error : worst;
+                scans++;
+            }
+        }
+        if (turnSteps > 0 && --turnSteps == 0) {
+            robot.move(FORWARD);
+        }
+        else if (turnSteps == 0 && (robot.getIRRange(0) < 0.5 || robot.getCollisionCount() != collisions)) {
+            robot.rotate(step % 3 == 0 ? LEFT : RIGHT);
+            turnSteps = 40 + step % 80;
+        }
+        collisions = robot.getCollisionCount();
+        robot.step();
+    }
+    odometryError /= scans;
+    filterError /= scans;
+    headingError = headingError / scans * 180.0 / PI;
+    cout << "Mean position error: odometry " << odometryError << " m, particle filter " << filterError << " m (worst "
+        << worst << " m), mean heading error " << headingError << " deg, resamplings: " << filter.getResampleCount() << endl;
+    cout << "The particle filter tracks the robot: " << (filterError < 0.1 && headingError < 3.0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures particle-beam evaluations per second on 1 to all hardware threads.
+ *
+ * One update() of 10000 particles against a 360-beam scan, repeated, with resampling
+ * off so every run scores the same particles. A single thread should score them at
+ * 10 Hz; the time depends on the load of the machine and is only reported.
+ */
+void TestParticleFilter::benchmarkUpdate() {
+    cout << "\n--- Benchmark: Particle-Beam Evaluations per Second ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, WORLD_SIZE, 60, 5);
+    MAP map(WORLD_SIZE + 1.0, WORLD_SIZE + 1.0, RESOLUTION, -(WORLD_SIZE + 1.0) / 2.0, -(WORLD_SIZE + 1.0) / 2.0);
+    buildMap(world, map);
+    srand(13);
+    Pose pose = freePose(world, 8.0);
+    vector<float> ranges(360);
+    castScan(world, pose, 360, 0.02, ranges.data());
+
+    int hardware = static_cast<int>(thread::hardware_concurrency());
+    vector<int> threadCounts;
+    for (int threads = 1; threads < (hardware > 2 ? hardware : 2); threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware > 2 ? hardware : 2);
+
+    const int particleCount = 10000;
+    const int updates = 20;
+    double baseRate = 0.0;
+    double baseUpdate = 0.0;
+    cout << "Hardware threads: " << hardware << ", particles: " << particleCount << ", beams: 360" << endl;
+    for (int threads : threadCounts) {
+        ParticleFilter filter(map, particleCount, threads);
+        filter.setLidarGeometry(LidarGeometry::fullCircle(360), 360);
+        filter.setResampleThreshold(0.0);
+        filter.initialize(pose, 0.5, 0.2);
+        filter.update(ranges.data());
+        auto start = chrono::steady_clock::now();
+        for (int u = 0; u < updates; u++) {
+            filter.update(ranges.data());
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double rate = static_cast<double>(particleCount) * filter.getScoredBeamCount() * updates / seconds;
+        if (threads == 1) {
+            baseRate = rate;
+            baseUpdate = seconds / updates;
+        }
+        cout << "Threads: " << threads << ", particle-beam evaluations per second: " << rate << ", speedup: " << rate / baseRate
+            << "x, " << seconds / updates * 1000.0 << " ms per update" << endl;
+    }
+    cout << "One thread updates " << particleCount << " particles in " << baseUpdate * 1000.0 << " ms (10 Hz needs under 100 ms)" << endl;
+}
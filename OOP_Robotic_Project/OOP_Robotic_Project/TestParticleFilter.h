@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file TestParticleFilter.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestParticleFilter class for testing the ParticleFilter class.
+ *
+ * This file contains the class declaration for testing the likelihood field, the
+ * vectorized scoring, resampling, determinism across threads and tracking a simulated
+ * robot, and for measuring particle-beam evaluations per second.
+ */
+
+#include "ParticleFilter.h"
+
+ /**
+  * @class TestParticleFilter
+  * @brief A class to test the functionality of the ParticleFilter class.
+  */
+class TestParticleFilter {
+public:
+    /**
+     * @brief Default constructor for TestParticleFilter.
+     */
+    TestParticleFilter();
+
+    /**
+     * @brief Destructor for TestParticleFilter.
+     */
+    ~TestParticleFilter();
+
+    /**
+     * @brief Runs all test cases for the ParticleFilter class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests the likelihood field and that the true pose scores best.
+     */
+    void testLikelihood();
+
+    /**
+     * @brief Compares the weights of update() with scoring every particle one beam at a time.
+     */
+    void testScoring();
+
+    /**
+     * @brief Tests low-variance resampling and that it reuses the particle arrays.
+     */
+    void testResampling();
+
+    /**
+     * @brief Tests that the filter gives the same particles on 1 and 4 threads.
+     */
+    void testDeterminism();
+
+    /**
+     * @brief Tests that the filter tracks a simulated robot with drifting odometry.
+     */
+    void testTracking();
+
+    /**
+     * @brief Measures particle-beam evaluations per second on 1 to all hardware threads.
+     */
+    void benchmarkUpdate();
+};
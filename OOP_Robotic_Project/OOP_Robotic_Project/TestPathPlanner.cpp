@@ -0,0 +1,388 @@
+/**
+ * @file TestPathPlanner.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestPathPlanner class for testing the PathPlanner class.
+ */
+
+#include "TestPathPlanner.h"
+#include "MAP.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Fills a grid with random rectangular obstacles covering about density of it.
+ */
+static void randomObstacles(vector<unsigned char>& grid, int width, int height, double density) {
+    grid.assign(static_cast<size_t>(width) * height, 0);
+    int target = static_cast<int>(density * width * height);
+    int filled = 0;
+    while (filled < target) {
+        int w = 1 + rand() % 8;
+        int h = 1 + rand() % 8;
+        int x0 = rand() % (width - w);
+        int y0 = rand() % (height - h);
+        for (int y = y0; y < y0 + h; y++) {
+            for (int x = x0; x < x0 + w; x++) {
+                unsigned char& cell = grid[static_cast<size_t>(y) * width + x];
+                filled += cell == 0;
+                cell = 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Applies motion steps to a pose: turns change the heading, moves go forward,
+ * left, backward or right of it.
+ */
+static Pose runSteps(Pose pose, const vector<MotionStep>& steps) {
+    for (const MotionStep& step : steps) {
+        double th = pose.getTh();
+        double direction = th;
+        switch (step.command) {
+        case COMMAND_TURN_LEFT:
+            pose.setTh(th + step.amount);
+            continue;
+        case COMMAND_TURN_RIGHT:
+            pose.setTh(th - step.amount);
+            continue;
+        case COMMAND_MOVE_LEFT:
+            direction = th + PI / 2.0;
+            break;
+        case COMMAND_MOVE_BACKWARD:
+            direction = th + PI;
+            break;
+        case COMMAND_MOVE_RIGHT:
+            direction = th - PI / 2.0;
+            break;
+        default:
+            break;
+        }
+        pose.setX(pose.getX() + step.amount * cos(direction));
+        pose.setY(pose.getY() + step.amount * sin(direction));
+    }
+    return pose;
+}
+
+/**
+ * @brief Default constructor for the TestPathPlanner class.
+ */
+TestPathPlanner::TestPathPlanner() {
+    cout << "[TestPathPlanner] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestPathPlanner class.
+ */
+TestPathPlanner::~TestPathPlanner() {
+    cout << "[TestPathPlanner] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the PathPlanner class.
+ */
+void TestPathPlanner::runAllTests() {
+    cout << "\n================ Starting PathPlanner Tests ================\n" << endl;
+
+    testIndexedHeap();
+    testDistanceField();
+    testPlanOnMap();
+    testCommands();
+    testArenaReuse();
+    benchmarkPlans();
+
+    cout << "\n================ Ending PathPlanner Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests ordering and key updates of IndexedHeap.
+ */
+void TestPathPlanner::testIndexedHeap() {
+    cout << "--- Test: Indexed Heap ---" << endl;
+
+    const int n = 1000;
+    IndexedHeap<int> heap;
+    heap.resize(n);
+    vector<int> keys(n);
+    srand(11);
+    for (int id = 0; id < n; id++) {
+        keys[id] = rand() % 10000;
+        heap.push(id, keys[id]);
+    }
+    // Lower some keys, raise others and remove a few: the heap must follow without duplicates.
+    for (int id = 0; id < n; id += 3) {
+        keys[id] = id % 2 == 0 ? keys[id] - 5000 : keys[id] + 5000;
+        heap.push(id, keys[id]);
+    }
+    for (int id = 1; id < n; id += 10) {
+        heap.remove(id);
+        keys[id] = -1;
+    }
+    cout << "Updating a queued id does not add an entry: " << (heap.size() == n - 100 && heap.keyOf(3) == keys[3] ? "PASS" : "FAIL") << endl;
+
+    bool sorted = true;
+    bool exact = true;
+    int last = -100000;
+    int popped = 0;
+    while (!heap.empty()) {
+        int key = heap.topKey();
+        int id = heap.pop();
+        sorted = sorted && key >= last;
+        exact = exact && key == keys[id] && !heap.contains(id);
+        last = key;
+        popped++;
+    }
+    cout << "Ids come out in key order: " << (sorted && popped == n - 100 ? "PASS" : "FAIL") << endl;
+    cout << "Each id comes out once, with its latest key: " << (exact ? "PASS" : "FAIL") << endl;
+
+    heap.push(5, 1);
+    heap.push(7, 2);
+    heap.clear();
+    cout << "clear() forgets the queued ids: " << (heap.empty() && !heap.contains(5) && !heap.contains(7) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares DistanceField with a brute force search.
+ */
+void TestPathPlanner::testDistanceField() {
+    cout << "\n--- Test: Distance Transform ---" << endl;
+
+    const int width = 53;
+    const int height = 37;
+    vector<unsigned char> grid(width * height, 0);
+    srand(5);
+    for (int i = 0; i < 40; i++) {
+        grid[rand() % (width * height)] = 1;
+    }
+    DistanceField field;
+    field.compute(width, height, grid.data(), 0.1);
+
+    double worst = 0.0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            double best = 1e30;
+            for (int oy = 0; oy < height; oy++) {
+                for (int ox = 0; ox < width; ox++) {
+                    if (grid[oy * width + ox] != 0) {
+                        double d = sqrt(static_cast<double>((x - ox) * (x - ox) + (y - oy) * (y - oy))) * 0.1;
+                        best = d < best ? d : best;
+                    }
+                }
+            }
+            double error = fabs(field.getDistance(x, y) - best);
+            worst = error > worst ? error : worst;
+        }
+    }
+    cout << "Matches brute force on a random grid: " << (worst < 1e-5 ? "PASS" : "FAIL") << endl;
+
+    vector<unsigned char> empty(width * height, 0);
+    field.compute(width, height, empty.data(), 0.1);
+    cout << "Grid without obstacles is far from everything: " << (field.getDistance(10, 10) > 1e6 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Plans around a wall on a MAP with A* and Dijkstra.
+ *
+ * The wall runs along x = 0 from y = -5 m to y = 3 m, so the only way from the left
+ * half to the right half is through the gap above it.
+ */
+void TestPathPlanner::testPlanOnMap() {
+    cout << "\n--- Test: Plan Around a Wall ---" << endl;
+
+    MAP map(12.0, 12.0, 0.05);
+    int cx;
+    int cy;
+    for (double y = -6.0; y <= 3.0; y += 0.025) {
+        map.worldToCell(0.0, y, cx, cy);
+        map.updateCell(cx, cy, 10.0f);
+    }
+    PathPlanner planner;
+    planner.setRobotRadius(0.2, 0.5, 4.0);
+    planner.setMap(map);
+
+    GridCell start;
+    GridCell goal;
+    planner.worldToCell(-2.0, 0.0, start);
+    planner.worldToCell(2.0, 0.0, goal);
+    vector<GridCell> path;
+    double cost = planner.plan(start, goal, path);
+    int aStarExpanded = planner.getExpandedCount();
+
+    bool clear = !path.empty();
+    double highest = -1e9;
+    for (const GridCell& cell : path) {
+        double x;
+        double y;
+        planner.cellToWorld(cell, x, y);
+        highest = y > highest ? y : highest;
+        clear = clear && planner.getDistanceField().getDistance(cell.x, cell.y) >= 0.2;
+    }
+    bool connected = true;
+    for (size_t i = 1; i < path.size(); i++) {
+        connected = connected && abs(path[i].x - path[i - 1].x) <= 1 && abs(path[i].y - path[i - 1].y) <= 1;
+    }
+    cout << "Path is found: " << (cost > 0 && path.front().x == start.x && path.back().x == goal.x ? "PASS" : "FAIL") << endl;
+    cout << "Path is 8-connected: " << (connected ? "PASS" : "FAIL") << endl;
+    cout << "Path goes through the gap: " << (highest > 3.2 ? "PASS" : "FAIL") << endl;
+    cout << "Path keeps the robot radius from the wall: " << (clear ? "PASS" : "FAIL") << endl;
+
+    planner.setHeuristicWeight(0.0);
+    vector<GridCell> dijkstraPath;
+    double dijkstraCost = planner.plan(start, goal, dijkstraPath);
+    cout << "A* cost equals Dijkstra cost: " << (fabs(cost - dijkstraCost) < 1e-3 * cost ? "PASS" : "FAIL") << endl;
+    cout << "A* expands fewer cells (" << aStarExpanded << " vs " << planner.getExpandedCount() << "): " <<
+        (aStarExpanded < planner.getExpandedCount() ? "PASS" : "FAIL") << endl;
+    planner.setHeuristicWeight(1.0);
+
+    // Close the gap: the right half becomes unreachable.
+    for (double y = 3.0; y <= 7.0; y += 0.025) {
+        map.worldToCell(0.0, y, cx, cy);
+        map.updateCell(cx, cy, 10.0f);
+    }
+    planner.setMap(map);
+    cout << "Unreachable goal is reported: " << (planner.plan(start, goal, path) < 0 && path.empty() ? "PASS" : "FAIL") << endl;
+    planner.worldToCell(0.0, 0.0, goal);
+    cout << "Goal inside an obstacle is rejected: " << (planner.plan(start, goal, path) < 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests the conversion of waypoints to motion steps.
+ */
+void TestPathPlanner::testCommands() {
+    cout << "\n--- Test: Motion Commands ---" << endl;
+
+    MAP map(6.0, 6.0, 0.05);
+    PathPlanner planner;
+    planner.setMap(map);
+    vector<MotionStep> steps;
+
+    bool planned = planner.planCommands(Pose(0.0, 0.0, 0.0), Pose(2.0, 0.0, 0.0), steps);
+    cout << "Straight ahead is one forward move: " << (planned && steps.size() == 1 && steps[0].command == COMMAND_MOVE_FORWARD &&
+        fabs(steps[0].amount - 2.0) < 1e-9 ? "PASS" : "FAIL") << endl;
+
+    planner.planCommands(Pose(0.0, 0.0, PI / 2.0), Pose(2.0, 0.0, PI / 2.0), steps);
+    cout << "Omnidirectional robot strafes instead of turning: " << (steps.size() == 1 && steps[0].command == COMMAND_MOVE_RIGHT ? "PASS" : "FAIL") << endl;
+
+    planner.planCommands(Pose(0.0, 0.0, 0.0), Pose(-1.5, 0.0, PI), steps);
+    cout << "Goal heading is reached with a final turn: " << (steps.size() == 2 && steps[0].command == COMMAND_MOVE_BACKWARD &&
+        (steps[1].command == COMMAND_TURN_LEFT || steps[1].command == COMMAND_TURN_RIGHT) && fabs(steps[1].amount - PI) < 1e-9 ? "PASS" : "FAIL") << endl;
+
+    double xs[] = { 0.0, 1.0, 1.0 };
+    double ys[] = { 0.0, 1.0, 2.0 };
+    steps.clear();
+    double heading = PathPlanner::toCommands(0.0, xs, ys, 3, steps);
+    Pose end = runSteps(Pose(0.0, 0.0, 0.0), steps);
+    bool smallTurns = true;
+    for (const MotionStep& step : steps) {
+        bool turn = step.command == COMMAND_TURN_LEFT || step.command == COMMAND_TURN_RIGHT;
+        smallTurns = smallTurns && (!turn || step.amount <= PI / 4.0 + 1e-9);
+    }
+    cout << "Diagonal segments turn by at most 45 degrees: " << (smallTurns && steps.size() == 4 ? "PASS" : "FAIL") << endl;
+    cout << "Steps drive through the waypoints: " << (fabs(end.getX() - 1.0) < 1e-9 && fabs(end.getY() - 2.0) < 1e-9 &&
+        fabs(end.getTh() - heading) < 1e-9 ? "PASS" : "FAIL") << endl;
+
+    cout << "Pose outside the map is rejected: " << (!planner.planCommands(Pose(0.0, 0.0, 0.0), Pose(50.0, 0.0, 0.0), steps) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that repeated plans reuse the search arenas.
+ */
+void TestPathPlanner::testArenaReuse() {
+    cout << "\n--- Test: Arena Reuse ---" << endl;
+
+    const int size = 200;
+    vector<unsigned char> grid;
+    srand(3);
+    randomObstacles(grid, size, size, 0.1);
+    PathPlanner planner;
+    planner.setRobotRadius(0.0, 0.15, 2.0);
+    planner.setGrid(size, size, grid.data(), 0.05, 0.0, 0.0);
+    size_t bytes = planner.getArenaBytes();
+
+    vector<GridCell> path;
+    path.reserve(4 * size);
+    const GridCell* storage = path.data();
+    int found = 0;
+    bool consistent = true;
+    for (int i = 0; i < 200; i++) {
+        GridCell start = { rand() % size, rand() % size };
+        GridCell goal = { rand() % size, rand() % size };
+        double cost = planner.plan(start, goal, path);
+        if (cost >= 0) {
+            found++;
+            consistent = consistent && path.front().x == start.x && path.front().y == start.y &&
+                path.back().x == goal.x && path.back().y == goal.y;
+        }
+    }
+    cout << "Plans found: " << found << " of 200" << endl;
+    cout << "Every path runs from start to goal: " << (found > 0 && consistent ? "PASS" : "FAIL") << endl;
+    cout << "Repeated plans allocate no arena or path memory: " << (planner.getArenaBytes() == bytes && path.data() == storage ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures plans per second on 1000 x 1000 grids with random obstacles.
+ *
+ * Obstacles are random rectangles covering 15 percent of the grid. Start and goal
+ * pairs are drawn among enterable cells; pairs with no path still count, as they cost
+ * a full search. The rates are only reported; the check compares the cells A* and
+ * Dijkstra expand on the same pairs, which does not depend on the machine.
+ */
+void TestPathPlanner::benchmarkPlans() {
+    cout << "\n--- Benchmark: Plans per Second on 1000 x 1000 ---" << endl;
+
+    const int size = 1000;
+    vector<unsigned char> grid;
+    srand(2026);
+    randomObstacles(grid, size, size, 0.15);
+
+    PathPlanner planner;
+    planner.setRobotRadius(0.05, 0.2, 3.0);
+    auto start = chrono::steady_clock::now();
+    planner.setGrid(size, size, grid.data(), 0.05, 0.0, 0.0);
+    double setupMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    vector<GridCell> starts;
+    vector<GridCell> goals;
+    while (starts.size() < 100) {
+        GridCell a = { rand() % size, rand() % size };
+        GridCell b = { rand() % size, rand() % size };
+        if (planner.getCost(a.x, a.y) != PathPlanner::BLOCKED && planner.getCost(b.x, b.y) != PathPlanner::BLOCKED) {
+            starts.push_back(a);
+            goals.push_back(b);
+        }
+    }
+
+    vector<GridCell> path;
+    double rates[2];
+    long long expanded[2] = { 0, 0 };
+    long long sameExpanded[2] = { 0, 0 };
+    int found = 0;
+    for (int mode = 0; mode < 2; mode++) {
+        int plans = mode == 0 ? 100 : 10;
+        planner.setHeuristicWeight(mode == 0 ? 1.0 : 0.0);
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < plans; i++) {
+            double cost = planner.plan(starts[i], goals[i], path);
+            expanded[mode] += planner.getExpandedCount();
+            sameExpanded[mode] += i < 10 ? planner.getExpandedCount() : 0;
+            found += mode == 0 && cost >= 0;
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        rates[mode] = plans / seconds;
+        expanded[mode] /= plans;
+    }
+
+    cout << "Distance transform and costs: " << setupMs << " ms" << endl;
+    cout << "A*: " << rates[0] << " plans/s, " << expanded[0] << " cells expanded per plan, " << found << " of 100 reachable" << endl;
+    cout << "Dijkstra: " << rates[1] << " plans/s, " << expanded[1] << " cells expanded per plan" << endl;
+    cout << "Search arenas: " << planner.getArenaBytes() / (1024 * 1024) << " MiB" << endl;
+    cout << "A* expands fewer cells than Dijkstra on the same pairs: " << (sameExpanded[0] < sameExpanded[1] ? "PASS" : "FAIL") << endl;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file TestPathPlanner.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestPathPlanner class for testing the PathPlanner class.
+ *
+ * This file contains the class declaration for testing the indexed heap, the distance
+ * transform, grid planning and the conversion of paths to motion commands, and for
+ * measuring planning speed on large grids.
+ */
+
+#include "PathPlanner.h"
+
+ /**
+  * @class TestPathPlanner
+  * @brief A class to test the functionality of the PathPlanner class.
+  */
+class TestPathPlanner {
+public:
+    /**
+     * @brief Default constructor for TestPathPlanner.
+     */
+    TestPathPlanner();
+
+    /**
+     * @brief Destructor for TestPathPlanner.
+     */
+    ~TestPathPlanner();
+
+    /**
+     * @brief Runs all test cases for the PathPlanner class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests ordering and key updates of IndexedHeap.
+     */
+    void testIndexedHeap();
+
+    /**
+     * @brief Compares DistanceField with a brute force search.
+     */
+    void testDistanceField();
+
+    /**
+     * @brief Plans around a wall on a MAP with A* and Dijkstra.
+     */
+    void testPlanOnMap();
+
+    /**
+     * @brief Tests the conversion of waypoints to motion steps.
+     */
+    void testCommands();
+
+    /**
+     * @brief Tests that repeated plans reuse the search arenas.
+     */
+    void testArenaReuse();
+
+    /**
+     * @brief Measures plans per second on 1000 x 1000 grids with random obstacles.
+     */
+    void benchmarkPlans();
+};
@@ -9,6 +9,10 @@
 #include "TestPose.h"
 #include <iostream>
 #include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
 
 using namespace std;
 
@@ -36,6 +40,9 @@ void TestPose::runAllTests() {
     testGettersAndSetters();
     testOperators();
     testUtilityFunctions();
+    testValueType();
+    testPoseArray();
+    benchmarkDistances();
 
     cout << "\n================ Ending Pose Tests ================\n" << endl;
 }
@@ -118,4 +125,151 @@ void TestPose::testUtilityFunctions() {
     cout << "Angle from Pose(0, 0, 0) to Pose(3, 4, 0): " << angle << " radians" << endl;
 }
 
+/**
+ * @brief Tests that Pose is a constexpr, trivially copyable value type.
+ */
+void TestPose::testValueType() {
+    cout << "\n--- Test: Value Type ---" << endl;
+
+    constexpr Pose a(1.0, 2.0, 0.5);
+    constexpr Pose b(4.0, 6.0, 0.25);
+    static_assert((a + b).getX() == 5.0, "constexpr addition");
+    static_assert(a.findSquaredDistanceTo(b) == 25.0, "constexpr squared distance");
+    static_assert(a < b && !(b < a), "constexpr comparison");
+
+    cout << "Trivially copyable: " << (is_trivially_copyable<Pose>::value ? "PASS" : "FAIL") << endl;
+    cout << "Size of three doubles: " << (sizeof(Pose) == 3 * sizeof(double) ? "PASS" : "FAIL") << endl;
+    const Pose c = a;
+    cout << "Const getters and operators: " << (c == a && c.findDistanceTo(b) == 5.0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests the PoseArray batch operations against the Pose member functions.
+ * Sizes that are not a multiple of the vector width exercise the scalar tails.
+ */
+void TestPose::testPoseArray() {
+    cout << "\n--- Test: PoseArray Batch Operations ---" << endl;
+
+    srand(7);
+    const int count = 1003;
+    PoseArray poses;
+    vector<Pose> reference;
+    for (int i = 0; i < count; i++) {
+        Pose pose((rand() % 20001 - 10000) / 100.0, (rand() % 20001 - 10000) / 100.0, (rand() % 6283) / 1000.0);
+        if (i % 100 == 0) {
+            pose.setPose(0.0, 0.0, 0.0); // angle to a pose on top of the target
+        }
+        if (i % 100 == 1) {
+            pose.setPose(-5.0, 0.0, 0.0); // target straight ahead along +x
+        }
+        poses.append(pose);
+        reference.push_back(pose);
+    }
+    Pose target(0.0, 0.0, 0.0);
+    Pose other(3.25, -1.5, 0.0);
+
+    vector<double> out(count);
+    double distanceError = 0.0;
+    double angleError = 0.0;
+    poses.distancesTo(other, out.data());
+    for (int i = 0; i < count; i++) {
+        distanceError = fmax(distanceError, fabs(out[i] - reference[i].findDistanceTo(other)));
+    }
+    poses.anglesTo(target, out.data());
+    for (int i = 0; i < count; i++) {
+        angleError = fmax(angleError, fabs(out[i] - reference[i].findAngleTo(target)));
+    }
+    poses.anglesTo(other, out.data());
+    for (int i = 0; i < count; i++) {
+        angleError = fmax(angleError, fabs(out[i] - reference[i].findAngleTo(other)));
+    }
+    cout << "Batch distances match findDistanceTo: " << (distanceError < 1e-12 ? "PASS" : "FAIL") << endl;
+    cout << "Batch angles match findAngleTo (max error " << angleError << "): " << (angleError < 1e-14 ? "PASS" : "FAIL") << endl;
+
+    double length = 0.0;
+    for (int i = 1; i < count; i++) {
+        length += reference[i - 1].findDistanceTo(reference[i]);
+    }
+    cout << "Path length: " << (fabs(poses.pathLength() - length) < 1e-9 * length ? "PASS" : "FAIL") << endl;
+
+    Pose frame(2.0, -3.0, 0.75);
+    poses.transform(frame);
+    double transformError = 0.0;
+    for (int i = 0; i < count; i++) {
+        double x = reference[i].getX();
+        double y = reference[i].getY();
+        Pose expected(2.0 + cos(0.75) * x - sin(0.75) * y, -3.0 + sin(0.75) * x + cos(0.75) * y, reference[i].getTh() + 0.75);
+        Pose moved = poses.get(i);
+        transformError = fmax(transformError, fabs(moved.getX() - expected.getX()) + fabs(moved.getY() - expected.getY()) +
+            fabs(moved.getTh() - expected.getTh()));
+    }
+    cout << "Transform into the parent frame: " << (transformError < 1e-12 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Pose as it was before it became a header-only value type: getters and
+ * findDistanceTo were out-of-line calls and the distance used pow.
+ */
+struct LegacyPose {
+    double x;
+    double y;
+    double th;
+};
 
+static double legacyDistance(const LegacyPose& from, const LegacyPose& to) {
+    double dx = to.x - from.x;
+    double dy = to.y - from.y;
+    return sqrt(pow(dx, 2) + pow(dy, 2));
+}
+
+/**
+ * @brief Measures distance computations over 1M poses, one by one and in batch.
+ */
+void TestPose::benchmarkDistances() {
+    cout << "\n--- Benchmark: 1M Pose Distances ---" << endl;
+
+    const int count = 1000000;
+    const int rounds = 10;
+    vector<LegacyPose> legacy(count);
+    vector<Pose> poses(count);
+    PoseArray batch(count);
+    for (int i = 0; i < count; i++) {
+        double x = (i % 1000) * 0.01;
+        double y = (i / 1000) * 0.01;
+        legacy[i] = { x, y, 0.0 };
+        poses[i] = Pose(x, y, 0.0);
+        batch.append(poses[i]);
+    }
+    vector<double> out(count);
+    Pose target(3.0, 4.0, 0.0);
+    LegacyPose legacyTarget = { 3.0, 4.0, 0.0 };
+
+    // Calling through a volatile pointer keeps the call out of line, as it was.
+    double (*volatile outOfLine)(const LegacyPose&, const LegacyPose&) = legacyDistance;
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < count; i++) {
+            out[i] = outOfLine(legacy[i], legacyTarget);
+        }
+    }
+    auto legacyEnd = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < count; i++) {
+            out[i] = poses[i].findDistanceTo(target);
+        }
+    }
+    auto inlineEnd = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        batch.distancesTo(target, out.data());
+    }
+    auto batchEnd = chrono::steady_clock::now();
+
+    double total = static_cast<double>(count) * rounds;
+    double legacyNs = chrono::duration<double, nano>(legacyEnd - start).count() / total;
+    double inlineNs = chrono::duration<double, nano>(inlineEnd - legacyEnd).count() / total;
+    double batchNs = chrono::duration<double, nano>(batchEnd - inlineEnd).count() / total;
+    cout << "Out-of-line Pose with pow : " << legacyNs << " ns per distance" << endl;
+    cout << "Inline Pose::findDistanceTo: " << inlineNs << " ns per distance" << endl;
+    cout << "PoseArray::distancesTo     : " << batchNs << " ns per distance (" << legacyNs / batchNs << "x)" << endl;
+    cout << "(checksum " << out[count / 2] << ")" << endl;
+}
@@ -13,6 +13,7 @@
  */
 
 #include "Pose.h"
+#include "PoseArray.h"
 
  /**
   * @class TestPose
@@ -58,4 +59,19 @@ private:
      * @brief Tests the utility methods (distance and angle calculations).
      */
     void testUtilityFunctions();
+
+    /**
+     * @brief Tests that Pose is a constexpr, trivially copyable value type.
+     */
+    void testValueType();
+
+    /**
+     * @brief Tests the PoseArray batch operations against the Pose member functions.
+     */
+    void testPoseArray();
+
+    /**
+     * @brief Measures distance computations over 1M poses, one by one and in batch.
+     */
+    void benchmarkDistances();
 };
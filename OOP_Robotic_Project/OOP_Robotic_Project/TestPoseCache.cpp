@@ -0,0 +1,324 @@
+/**
+ * @file TestPoseCache.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestPoseCache class for testing the PoseCache class.
+ */
+
+#include "TestPoseCache.h"
+#include "Logger.h"
+#include "RobotControler.h"
+#include "SimulatedRobot.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Stand-in robot API whose n-th pose read returns (n, 2n, 3n), so a pose mixed
+ * from two reads is detected.
+ */
+class SequencePoseAPI : public RobotInterface {
+public:
+    atomic<unsigned long long> reads;
+
+    SequencePoseAPI() : reads(0) {}
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION) override {}
+    void rotate(DIRECTION) override {}
+    void stop() override {}
+    double getIRRange(int) override { return 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override {
+        double n = static_cast<double>(reads.fetch_add(1) + 1);
+        X = n;
+        Y = 2.0 * n;
+        TH = 3.0 * n;
+    }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+};
+
+/**
+ * @brief SimulatedRobot behind a link: a pose read holds the link for a round trip,
+ * as a call to the simulator or the robot does.
+ */
+class LinkedRobotAPI : public RobotInterface {
+public:
+    SimulatedRobot* robot;
+    long long roundTripNs;
+    mutex link;
+
+    LinkedRobotAPI(SimulatedRobot* robot, int roundTripMicroseconds) : robot(robot), roundTripNs(roundTripMicroseconds * 1000LL) {}
+    void connect() override { robot->connect(); }
+    void disconnect() override { robot->disconnect(); }
+    void move(DIRECTION direction) override { robot->move(direction); }
+    void rotate(DIRECTION direction) override { robot->rotate(direction); }
+    void stop() override { robot->stop(); }
+    double getIRRange(int i) override { return robot->getIRRange(i); }
+    void getXYTh(double& X, double& Y, double& TH) override {
+        lock_guard<mutex> guard(link);
+        long long end = PoseCache::nowNs() + roundTripNs;
+        while (PoseCache::nowNs() < end) {
+        }
+        robot->getXYTh(X, Y, TH);
+    }
+    void getLidarRange(float* ranges) override { robot->getLidarRange(ranges); }
+    int getLidarRangeNumber() override { return robot->getLidarRangeNumber(); }
+};
+
+/**
+ * @brief Calls a function from several threads for a duration.
+ * @return the total number of calls.
+ */
+template <typename Read>
+static unsigned long long runReaders(int threads, int milliseconds, Read read) {
+    atomic<bool> go(false);
+    atomic<bool> done(false);
+    vector<unsigned long long> counts(threads, 0);
+    vector<thread> readers;
+    for (int t = 0; t < threads; t++) {
+        readers.emplace_back([&, t]() {
+            while (!go.load()) {
+                this_thread::yield();
+            }
+            unsigned long long count = 0;
+            while (!done.load(memory_order_relaxed)) {
+                for (int i = 0; i < 64; i++) {
+                    read();
+                }
+                count += 64;
+            }
+            counts[t] = count;
+        });
+    }
+    go.store(true);
+    this_thread::sleep_for(chrono::milliseconds(milliseconds));
+    done.store(true);
+    unsigned long long total = 0;
+    for (int t = 0; t < threads; t++) {
+        readers[t].join();
+        total += counts[t];
+    }
+    return total;
+}
+
+/**
+ * @brief Default constructor for the TestPoseCache class.
+ */
+TestPoseCache::TestPoseCache() {
+    cout << "[TestPoseCache] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestPoseCache class.
+ */
+TestPoseCache::~TestPoseCache() {
+    cout << "[TestPoseCache] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the PoseCache class.
+ */
+void TestPoseCache::runAllTests() {
+    cout << "\n================ Starting PoseCache Tests ================\n" << endl;
+
+    ostream discard(nullptr);
+    Logger::setOutput(&discard);
+
+    testStaleness();
+    testRefresher();
+    testConsistency();
+    testRobotControler();
+    benchmarkReaders();
+
+    Logger::flush();
+    Logger::setOutput(nullptr);
+
+    cout << "\n================ Ending PoseCache Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests hits within the max age and misses once the pose is older.
+ *
+ * The refresher is not started, so only get() reads the robot.
+ */
+void TestPoseCache::testStaleness() {
+    cout << "--- Test: Staleness Budget ---" << endl;
+
+    SimulatedRobot robot;
+    robot.setPose(1.0, 2.0, 0.5);
+    PoseCache cache(&robot, 20000, 0);
+
+    double x, y, th;
+    cache.get(x, y, th);
+    bool ok = x == 1.0 && y == 2.0 && th == 0.5 && cache.getMissCount() == 1 && cache.getHitCount() == 0;
+    cout << "First read goes to the robot: " << (ok ? "PASS" : "FAIL") << endl;
+
+    robot.setPose(3.0, 4.0, -0.5);
+    cache.get(x, y, th);
+    ok = x == 1.0 && y == 2.0 && cache.getMissCount() == 1 && cache.getHitCount() == 1;
+    cout << "Read within the max age returns the cached pose: " << (ok ? "PASS" : "FAIL") << endl;
+
+    this_thread::sleep_for(chrono::milliseconds(30));
+    cache.get(x, y, th);
+    ok = x == 3.0 && y == 4.0 && th == -0.5 && cache.getMissCount() == 2;
+    cout << "Read after the max age returns the new pose: " << (ok ? "PASS" : "FAIL") << endl;
+
+    cache.setMaxAge(0);
+    robot.setPose(5.0, 6.0, 0.0);
+    cache.get(x, y, th);
+    ok = x == 5.0 && cache.getMissCount() == 3 && cache.getMaxAge() == 0 && cache.getRefreshCount() == 0;
+    cout << "Max age 0 reads the robot every time: " << (ok ? "PASS" : "FAIL") << endl;
+
+    cache.resetCounters();
+    ok = cache.getHitCount() == 0 && cache.getMissCount() == 0;
+    cout << "Counters reset: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that the refresher keeps the pose fresh without misses.
+ *
+ * The max age is far above the refresh period, so every read should be a hit even
+ * on a loaded machine. The test waits on the refresh count rather than on sleeps,
+ * since a loaded machine may not run the refresher for a while.
+ */
+void TestPoseCache::testRefresher() {
+    cout << "\n--- Test: Refresher ---" << endl;
+
+    SimulatedRobot robot;
+    PoseCache cache(&robot, 200000, 1000);
+    bool started = cache.start();
+
+    robot.setPose(-1.0, 0.5, 1.0);
+    // A refresh in progress may have read the old pose, so wait for two more.
+    unsigned long long target = cache.getRefreshCount() + 2;
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(2);
+    while (cache.getRefreshCount() < target && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    double x, y, th;
+    cache.get(x, y, th);
+    bool ok = started && x == -1.0 && y == 0.5 && th == 1.0 && cache.getHitCount() == 1 && cache.getMissCount() == 0;
+    cout << "Pose set on the robot reaches readers: " << (ok ? "PASS" : "FAIL") << endl;
+
+    cache.stop();
+    unsigned long long refreshes = cache.getRefreshCount();
+    this_thread::sleep_for(chrono::milliseconds(5));
+    ok = !cache.isRunning() && cache.getRefreshCount() == refreshes;
+    cout << "Refresher ran " << refreshes << " times and stopped: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that readers never see a pose mixed from two refreshes.
+ *
+ * The refresher publishes as fast as it can while readers copy the pose; each read
+ * must satisfy y = 2x and th = 3x. A max age of 0 adds readers that miss and publish.
+ */
+void TestPoseCache::testConsistency() {
+    cout << "\n--- Test: Consistent Reads ---" << endl;
+
+    for (int maxAge : { 1000000, 0 }) {
+        SequencePoseAPI api;
+        PoseCache cache(&api, maxAge, 0);
+        cache.start();
+        atomic<unsigned long long> torn(0);
+        unsigned long long reads = runReaders(4, 100, [&]() {
+            double x, y, th;
+            cache.get(x, y, th);
+            if (y != 2.0 * x || th != 3.0 * x) {
+                torn.fetch_add(1);
+            }
+        });
+        cache.stop();
+        bool ok = torn.load() == 0 && reads > 0 && api.reads.load() > 1;
+        cout << "Max age " << maxAge << " us: " << reads << " reads during " << api.reads.load()
+            << " robot reads, " << torn.load() << " torn: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+}
+
+/**
+ * @brief Tests getPose() with the cache started and stopped.
+ */
+void TestPoseCache::testRobotControler() {
+    cout << "\n--- Test: RobotControler getPose ---" << endl;
+
+    SimulatedRobot robot;
+    robot.setPose(0.25, -0.5, 0.125);
+    RobotControler rc(&robot);
+    bool started = rc.startPoseCache(200000, 1000);
+    Pose pose = rc.getPose();
+    PoseCache* cache = rc.getPoseCache();
+    bool ok = started && cache != nullptr && pose.getX() == 0.25 && pose.getY() == -0.5 && pose.getTh() == 0.125
+        && cache->getHitCount() + cache->getMissCount() == 1;
+    cout << "getPose() reads the cache: " << (ok ? "PASS" : "FAIL") << endl;
+
+    rc.stopPoseCache();
+    robot.setPose(1.0, 1.0, 0.0);
+    pose = rc.getPose();
+    ok = pose.getX() == 1.0 && cache->getHitCount() + cache->getMissCount() == 1;
+    cout << "getPose() reads the robot after stopPoseCache(): " << (ok ? "PASS" : "FAIL") << endl;
+
+    ok = rc.startPoseCache(100000, 1000) && rc.getPoseCache() == cache && cache->getMaxAge() == 100000;
+    cout << "Restart keeps the cache with the new max age: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures getPose() calls per second with several reader threads.
+ *
+ * Without the cache every call goes over a link with a 10 us round trip, which one
+ * caller uses at a time; the in-process simulated robot, with no link at all, is shown
+ * for reference. With the cache (max age 2 ms, refreshed every 1 ms) a call copies the
+ * pose under the seqlock. Each configuration runs for 200 ms. Rates and hit rates
+ * depend on the scheduler and are only reported; every call must be counted as a hit
+ * or a miss.
+ */
+void TestPoseCache::benchmarkReaders() {
+    cout << "\n--- Benchmark: getPose Throughput ---" << endl;
+
+    int hardware = static_cast<int>(thread::hardware_concurrency());
+    int maxThreads = hardware >= 8 ? 8 : (hardware >= 2 ? hardware : 2);
+    const int milliseconds = 200;
+
+    double directRate = 0.0;
+    double cachedRate = 0.0;
+    double hitRate = 0.0;
+    bool counted = true;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        SimulatedRobot robot;
+        LinkedRobotAPI api(&robot, 10);
+        unsigned long long local = runReaders(threads, milliseconds, [&]() {
+            double x, y, th;
+            robot.getXYTh(x, y, th);
+        });
+        unsigned long long direct = runReaders(threads, milliseconds, [&]() {
+            double x, y, th;
+            api.getXYTh(x, y, th);
+        });
+
+        RobotControler rc(&api);
+        rc.startPoseCache(2000, 1000);
+        unsigned long long cached = runReaders(threads, milliseconds, [&]() {
+            Pose pose = rc.getPose();
+            (void)pose;
+        });
+        PoseCache* cache = rc.getPoseCache();
+        unsigned long long reads = cache->getHitCount() + cache->getMissCount();
+        hitRate = reads > 0 ? static_cast<double>(cache->getHitCount()) / reads : 0.0;
+        counted = counted && reads == cached;
+        rc.stopPoseCache();
+
+        directRate = direct / (milliseconds / 1000.0);
+        cachedRate = cached / (milliseconds / 1000.0);
+        cout << threads << " reader(s): in-process " << local / (milliseconds / 1000.0) / 1e6 << " M/s, over the link "
+            << directRate / 1e6 << " M/s, cached " << cachedRate / 1e6 << " M/s, hit rate " << hitRate * 100.0 << " %" << endl;
+    }
+
+    cout << maxThreads << " readers: " << cachedRate / directRate << "x the throughput over the link" << endl;
+    cout << "Every cached call is a hit or a miss: " << (counted ? "PASS" : "FAIL") << endl;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @file TestPoseCache.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestPoseCache class for testing the PoseCache class.
+ *
+ * This file contains the class declaration for testing the staleness budget, the
+ * refresher thread, consistency of concurrent reads and the cache behind
+ * RobotControler::getPose(), and for measuring getPose() throughput with several readers.
+ */
+
+#include "PoseCache.h"
+
+ /**
+  * @class TestPoseCache
+  * @brief A class to test the functionality of the PoseCache class.
+  */
+class TestPoseCache {
+public:
+    /**
+     * @brief Default constructor for TestPoseCache.
+     */
+    TestPoseCache();
+
+    /**
+     * @brief Destructor for TestPoseCache.
+     */
+    ~TestPoseCache();
+
+    /**
+     * @brief Runs all test cases for the PoseCache class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests hits within the max age and misses once the pose is older.
+     */
+    void testStaleness();
+
+    /**
+     * @brief Tests that the refresher keeps the pose fresh without misses.
+     */
+    void testRefresher();
+
+    /**
+     * @brief Tests that readers never see a pose mixed from two refreshes.
+     */
+    void testConsistency();
+
+    /**
+     * @brief Tests getPose() with the cache started and stopped.
+     */
+    void testRobotControler();
+
+    /**
+     * @brief Measures getPose() calls per second with several reader threads.
+     */
+    void benchmarkReaders();
+};
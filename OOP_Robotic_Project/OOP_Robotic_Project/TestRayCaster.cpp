@@ -0,0 +1,273 @@
+/**
+ * @file TestRayCaster.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestRayCaster class for testing the RayCaster class.
+ */
+
+#include "TestRayCaster.h"
+#include "MAP.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <map>
+
+using namespace std;
+
+/**
+ * @brief Visitor that counts misses and hits per cell.
+ */
+struct CellCounter {
+    map<long long, pair<int, int> > cells;
+
+    bool operator()(int, int cx, int cy, bool hit) {
+        pair<int, int>& entry = cells[static_cast<long long>(cx) * 100000 + cy];
+        if (hit) {
+            entry.second++;
+        }
+        else {
+            entry.first++;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Fills a scan with random ranges, including invalid and max-range values.
+ */
+static void randomScan(float* ranges, int count, float maxRange) {
+    for (int i = 0; i < count; i++) {
+        int kind = rand() % 20;
+        if (kind == 0) {
+            ranges[i] = numeric_limits<float>::quiet_NaN();
+        }
+        else if (kind == 1) {
+            ranges[i] = 0.0f;
+        }
+        else if (kind == 2) {
+            ranges[i] = numeric_limits<float>::infinity();
+        }
+        else {
+            ranges[i] = 0.05f + static_cast<float>(rand() % 10000) / 10000.0f * maxRange;
+        }
+    }
+}
+
+/**
+ * @brief Default constructor for the TestRayCaster class.
+ */
+TestRayCaster::TestRayCaster() {
+    cout << "[TestRayCaster] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestRayCaster class.
+ */
+TestRayCaster::~TestRayCaster() {
+    cout << "[TestRayCaster] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the RayCaster class.
+ */
+void TestRayCaster::runAllTests() {
+    cout << "\n================ Starting RayCaster Tests ================\n" << endl;
+
+    testEndpoints();
+    testTraversal();
+    testStoppedBeam();
+    benchmarkBeams();
+
+    cout << "\n================ Ending RayCaster Tests ================\n" << endl;
+}
+
+/**
+ * @brief Compares SIMD end points with the scalar reference.
+ *
+ * The two paths may round the last bit differently, so end points are compared with
+ * a small tolerance in grid units; step counts and hit flags must agree exactly
+ * unless the end point is that close to a cell border.
+ */
+void TestRayCaster::testEndpoints() {
+    cout << "--- Test: End Points Against Scalar Reference ---" << endl;
+
+    const int beams = 723;
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 6.0);
+    RayCaster simd(geometry, beams);
+    RayCaster scalar(geometry, beams);
+    float ranges[beams];
+    srand(11);
+
+    int mismatches = 0;
+    for (int n = 0; n < 200; n++) {
+        randomScan(ranges, beams, 7.0f);
+        float startX = 100.0f + static_cast<float>(rand() % 1000) / 7.0f;
+        float startY = 100.0f + static_cast<float>(rand() % 1000) / 7.0f;
+        double heading = (rand() % 6283) / 1000.0 - 3.1415;
+        simd.computeEndpoints(startX, startY, heading, 20.0f, ranges);
+        scalar.computeEndpointsScalar(startX, startY, heading, 20.0f, ranges);
+
+        for (int i = 0; i < beams; i++) {
+            if (simd.getSteps(i) < 0 || scalar.getSteps(i) < 0) {
+                mismatches += simd.getSteps(i) != scalar.getSteps(i);
+                continue;
+            }
+            float ex = scalar.getEndGridX(i);
+            float ey = scalar.getEndGridY(i);
+            bool close = fabs(simd.getEndGridX(i) - ex) < 1e-3f && fabs(simd.getEndGridY(i) - ey) < 1e-3f;
+            bool onBorder = fabs(ex - floor(ex + 0.5f)) < 1e-3f || fabs(ey - floor(ey + 0.5f)) < 1e-3f;
+            bool same = simd.getSteps(i) == scalar.getSteps(i) && simd.getEndX(i) == scalar.getEndX(i)
+                && simd.getEndY(i) == scalar.getEndY(i);
+            if (!close || simd.isHit(i) != scalar.isHit(i) || (!same && !onBorder)) {
+                mismatches++;
+            }
+        }
+    }
+    cout << "200 random scans match the scalar end points: " << (mismatches == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the lockstep traversal with the scalar reference, cell by cell.
+ */
+void TestRayCaster::testTraversal() {
+    cout << "\n--- Test: Traversal Against Scalar Reference ---" << endl;
+
+    const int beams = 361;
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 4.0);
+    RayCaster caster(geometry, beams);
+    float ranges[beams];
+    srand(5);
+
+    bool same = true;
+    bool connected = true;
+    for (int n = 0; n < 50 && same; n++) {
+        randomScan(ranges, beams, 5.0f);
+        float startX = 500.0f + static_cast<float>(rand() % 100) / 9.0f;
+        float startY = 500.0f + static_cast<float>(rand() % 100) / 9.0f;
+        caster.computeEndpoints(startX, startY, n * 0.37, 20.0f, ranges);
+
+        CellCounter lockstep;
+        CellCounter reference;
+        caster.trace(lockstep);
+        caster.traceScalar(reference);
+        same = lockstep.cells == reference.cells;
+
+        // Every beam must reach a cell next to its end cell.
+        for (int i = 0; i < beams; i++) {
+            int steps = caster.getSteps(i);
+            if (steps <= 0) {
+                continue;
+            }
+            float lastX = startX + (caster.getEndGridX(i) - startX) * (steps - 1) / steps;
+            float lastY = startY + (caster.getEndGridY(i) - startY) * (steps - 1) / steps;
+            if (fabs(floor(lastX) - caster.getEndX(i)) > 1.0f || fabs(floor(lastY) - caster.getEndY(i)) > 1.0f) {
+                connected = false;
+            }
+        }
+    }
+    cout << "Lockstep trace visits the same cells as the scalar trace: " << (same ? "PASS" : "FAIL") << endl;
+    cout << "Beams reach their end cells: " << (connected ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that a beam stopped by the visitor does not mark its end cell.
+ */
+void TestRayCaster::testStoppedBeam() {
+    cout << "\n--- Test: Stopped Beam ---" << endl;
+
+    LidarGeometry geometry;
+    geometry.startAngle = 0.0;
+    geometry.angleIncrement = 0.0;
+    geometry.maxRange = 10.0;
+    RayCaster caster(geometry, 1);
+    float range = 2.0f;
+    caster.computeEndpoints(10.5f, 10.5f, 0.0, 10.0f, &range);
+
+    int visited = 0;
+    bool endVisited = false;
+    auto visit = [&](int, int cx, int, bool hit) -> bool {
+        if (hit) {
+            endVisited = true;
+        }
+        visited++;
+        return cx < 20;
+    };
+    caster.trace(visit);
+    cout << "Beam of 20 cells with a hit: " << (caster.getSteps(0) == 20 && caster.isHit(0) ? "PASS" : "FAIL") << endl;
+    cout << "Beam stops where the visitor refuses: " << (visited == 11 && !endVisited ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures beams per second of the kernel and of MAP integration.
+ *
+ * The per-beam path is the straightforward one: cos and sin of every beam angle and a
+ * Bresenham trace into the map.
+ */
+void TestRayCaster::benchmarkBeams() {
+    cout << "\n--- Benchmark: Beams per Second ---" << endl;
+
+    const int beams = 1080;
+    const int scans = 1000;
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 8.0);
+    static float ranges[16][beams];
+    srand(3);
+    for (int s = 0; s < 16; s++) {
+        for (int i = 0; i < beams; i++) {
+            ranges[s][i] = 0.5f + static_cast<float>(rand() % 7500) / 1000.0f;
+        }
+    }
+
+    RayCaster caster(geometry, beams);
+    long long checksum = 0;
+    auto count = [&](int, int cx, int cy, bool) -> bool {
+        checksum += cx ^ cy;
+        return true;
+    };
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        caster.computeEndpointsScalar(2000.0f, 2000.0f, 0.01 * s, 20.0f, ranges[s & 15]);
+        caster.traceScalar(count);
+    }
+    auto middle = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        caster.computeEndpoints(2000.0f, 2000.0f, 0.01 * s, 20.0f, ranges[s & 15]);
+        caster.trace(count);
+    }
+    auto end = chrono::steady_clock::now();
+    double scalarKernel = beams * scans / chrono::duration<double>(middle - start).count();
+    double batchedKernel = beams * scans / chrono::duration<double>(end - middle).count();
+
+    MAP perBeamMap(200.0, 200.0, 0.05);
+    MAP batchedMap(200.0, 200.0, 0.05);
+    start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        double x = 0.002 * s;
+        double th = 0.01 * s;
+        int robotX;
+        int robotY;
+        perBeamMap.worldToCell(x, 0.0, robotX, robotY);
+        const float* scan = ranges[s & 15];
+        for (int i = 0; i < beams; i++) {
+            double angle = th + geometry.startAngle + i * geometry.angleIncrement;
+            int endX;
+            int endY;
+            perBeamMap.worldToCell(x + scan[i] * cos(angle), scan[i] * sin(angle), endX, endY);
+            perBeamMap.traceRay(robotX, robotY, endX, endY, true);
+        }
+    }
+    middle = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        batchedMap.integrateScan(Pose(0.002 * s, 0.0, 0.01 * s), ranges[s & 15], beams, geometry);
+    }
+    end = chrono::steady_clock::now();
+    double perBeamMapRate = beams * scans / chrono::duration<double>(middle - start).count();
+    double batchedMapRate = beams * scans / chrono::duration<double>(end - middle).count();
+
+    cout << "Kernel, scalar reference        : " << scalarKernel << " beams/s" << endl;
+    cout << "Kernel, " << RayCaster::TRACE_LANES << " beams in lockstep     : " << batchedKernel << " beams/s" << endl;
+    cout << "MAP, per-beam trig + Bresenham  : " << perBeamMapRate << " beams/s" << endl;
+    cout << "MAP::integrateScan (RayCaster)  : " << batchedMapRate << " beams/s" << endl;
+    cout << "(checksum " << checksum << ")" << endl;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file TestRayCaster.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestRayCaster class for testing the RayCaster class.
+ *
+ * This file contains the class declaration for checking the batched ray casting kernel
+ * against its scalar reference and for measuring beams per second.
+ */
+
+#include "RayCaster.h"
+
+ /**
+  * @class TestRayCaster
+  * @brief A class to test the functionality of the RayCaster class.
+  */
+class TestRayCaster {
+public:
+    /**
+     * @brief Default constructor for TestRayCaster.
+     */
+    TestRayCaster();
+
+    /**
+     * @brief Destructor for TestRayCaster.
+     */
+    ~TestRayCaster();
+
+    /**
+     * @brief Runs all test cases for the RayCaster class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Compares SIMD end points with the scalar reference.
+     */
+    void testEndpoints();
+
+    /**
+     * @brief Compares the lockstep traversal with the scalar reference, cell by cell.
+     */
+    void testTraversal();
+
+    /**
+     * @brief Tests that a beam stopped by the visitor does not mark its end cell.
+     */
+    void testStoppedBeam();
+
+    /**
+     * @brief Measures beams per second of the kernel and of MAP integration.
+     */
+    void benchmarkBeams();
+};
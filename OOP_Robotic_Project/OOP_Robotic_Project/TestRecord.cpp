@@ -0,0 +1,231 @@
+/**
+ * @file TestRecord.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestRecord class for testing the Record class.
+ */
+
+#include "TestRecord.h"
+#include "LatencyHistogram.h"
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+static const char* TEST_FILE = "TestRecord.bin";
+
+/**
+ * @brief Value of lidar range j in frame i, so every frame can be checked on read.
+ */
+static float lidarValue(int i, int j) {
+    return static_cast<float>(i) + static_cast<float>(j) * 0.001f;
+}
+
+/**
+ * @brief Number of lidar ranges in frame i.
+ */
+static int lidarCountOf(int i) {
+    return 500 + (i * 37) % 1549;
+}
+
+/**
+ * @brief Writes frame i of the test pattern.
+ */
+static bool writePattern(Record& record, int i, vector<float>& lidar) {
+    double ir[RecordFrame::IR_COUNT];
+    for (int k = 0; k < RecordFrame::IR_COUNT; k++) {
+        ir[k] = i + k * 0.1;
+    }
+    int count = lidarCountOf(i);
+    for (int j = 0; j < count; j++) {
+        lidar[j] = lidarValue(i, j);
+    }
+    return record.write(1000LL * i, Pose(i * 0.5, -i * 0.25, i * 0.01), ir, lidar.data(), count);
+}
+
+/**
+ * @brief Checks frame i of the test pattern.
+ */
+static bool checkPattern(const RecordFrame* frame, int i) {
+    if (frame == nullptr || frame->sequence != static_cast<uint64_t>(i) || frame->timestampNs != 1000LL * i ||
+        frame->x != i * 0.5 || frame->y != -i * 0.25 || frame->th != i * 0.01 ||
+        frame->lidarCount != static_cast<uint32_t>(lidarCountOf(i))) {
+        return false;
+    }
+    for (int k = 0; k < RecordFrame::IR_COUNT; k++) {
+        if (frame->ir[k] != i + k * 0.1) {
+            return false;
+        }
+    }
+    const float* lidar = frame->lidar();
+    for (uint32_t j = 0; j < frame->lidarCount; j++) {
+        if (lidar[j] != lidarValue(i, j)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Default constructor for the TestRecord class.
+ */
+TestRecord::TestRecord() {
+    cout << "[TestRecord] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestRecord class.
+ */
+TestRecord::~TestRecord() {
+    remove(TEST_FILE);
+    cout << "[TestRecord] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the Record class.
+ */
+void TestRecord::runAllTests() {
+    cout << "\n================ Starting Record Tests ================\n" << endl;
+
+    testRoundTrip();
+    testUnclosedFile();
+    testInvalidInput();
+    benchmarkWrite();
+
+    cout << "\n================ Ending Record Tests ================\n" << endl;
+}
+
+/**
+ * @brief Writes frames over several segments and reads them back.
+ */
+void TestRecord::testRoundTrip() {
+    cout << "--- Test: Round Trip ---" << endl;
+
+    const int frames = 1000;
+    vector<float> lidar(2048);
+    Record record;
+    bool written = record.open(TEST_FILE, 1 << 20, 10);
+    for (int i = 0; i < frames && written; i++) {
+        written = writePattern(record, i, lidar);
+    }
+    uint64_t bytes = record.getBytesWritten();
+    record.close();
+    cout << "Frames written across " << (bytes >> 20) + 1 << " segments: " << (written ? "PASS" : "FAIL") << endl;
+
+    RecordReader reader;
+    bool opened = reader.open(TEST_FILE);
+    cout << "Reader opens the file: " << (opened ? "PASS" : "FAIL") << endl;
+    cout << "Frame count: " << (reader.getFrameCount() == frames ? "PASS" : "FAIL") << endl;
+
+    int matching = 0;
+    for (const RecordFrame* frame = reader.first(); frame != nullptr; frame = reader.next(frame)) {
+        matching += checkPattern(frame, matching) ? 1 : 0;
+    }
+    cout << "Every frame reads back unchanged: " << (matching == frames ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Reads a file while it is still being written.
+ * The header has no frame count yet, so the reader walks frames up to the first one
+ * without a size.
+ */
+void TestRecord::testUnclosedFile() {
+    cout << "\n--- Test: Unclosed File ---" << endl;
+
+    vector<float> lidar(2048);
+    Record record;
+    bool written = record.open(TEST_FILE, 1 << 20, 10);
+    for (int i = 0; i < 300 && written; i++) {
+        written = writePattern(record, i, lidar);
+    }
+
+    RecordReader reader;
+    reader.open(TEST_FILE);
+    int matching = 0;
+    for (const RecordFrame* frame = reader.first(); frame != nullptr; frame = reader.next(frame)) {
+        matching += checkPattern(frame, matching) ? 1 : 0;
+    }
+    cout << "Frames of an open record can be read: " << (written && matching == 300 && reader.getFrameCount() == 300 ? "PASS" : "FAIL") << endl;
+    reader.close();
+    record.close();
+}
+
+/**
+ * @brief Tests that invalid frames and files are rejected.
+ */
+void TestRecord::testInvalidInput() {
+    cout << "\n--- Test: Invalid Input ---" << endl;
+
+    Record record;
+    double ir[RecordFrame::IR_COUNT] = {};
+    cout << "Write before open fails: " << (!record.write(0, Pose(), ir, nullptr, 0) ? "PASS" : "FAIL") << endl;
+
+    record.open(TEST_FILE, 1 << 20, 10);
+    vector<float> huge(1 << 19);
+    cout << "Frame larger than a segment fails: " << (!record.write(0, Pose(), ir, huge.data(), static_cast<int>(huge.size())) ? "PASS" : "FAIL") << endl;
+    cout << "Frame without lidar succeeds: " << (record.write(0, Pose(), ir, nullptr, 0) ? "PASS" : "FAIL") << endl;
+    record.close();
+
+    FILE* file = fopen(TEST_FILE, "wb");
+    if (file != nullptr) {
+        const char text[] = "this is not a record file, only some text that is long enough for a header";
+        fwrite(text, 1, sizeof(text), file);
+        fclose(file);
+    }
+    RecordReader reader;
+    cout << "Reader rejects a foreign file: " << (!reader.open(TEST_FILE) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures write() latency against formatting the same data as text.
+ * The text path is what print() does today: doubles formatted on the control thread.
+ */
+void TestRecord::benchmarkWrite() {
+    cout << "\n--- Benchmark: Frame Logging Cost ---" << endl;
+
+    const int frames = 20000;
+    const int lidarCount = 1080;
+    vector<float> lidar(lidarCount);
+    double ir[RecordFrame::IR_COUNT];
+    for (int k = 0; k < RecordFrame::IR_COUNT; k++) {
+        ir[k] = 0.5 + k;
+    }
+    for (int j = 0; j < lidarCount; j++) {
+        lidar[j] = 1.0f + j * 0.003f;
+    }
+
+    LatencyHistogram binary;
+    Record record;
+    record.open(TEST_FILE);
+    for (int i = 0; i < frames; i++) {
+        auto start = chrono::steady_clock::now();
+        record.write(i, Pose(i * 0.001, 0.5, 0.1), ir, lidar.data(), lidarCount);
+        binary.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    }
+    uint64_t bytes = record.getBytesWritten();
+    uint64_t stalls = record.getStallCount();
+    record.close();
+
+    LatencyHistogram text;
+    ostringstream out;
+    for (int i = 0; i < frames / 10; i++) {
+        auto start = chrono::steady_clock::now();
+        out.str("");
+        out << i << " " << i * 0.001 << " " << 0.5 << " " << 0.1;
+        for (int k = 0; k < RecordFrame::IR_COUNT; k++) {
+            out << " " << ir[k];
+        }
+        for (int j = 0; j < lidarCount; j++) {
+            out << " " << lidar[j];
+        }
+        out << "\n";
+        text.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+    }
+
+    binary.print("Record::write, 1080 ranges");
+    text.print("Text formatting, 1080 ranges");
+    cout << "Bytes written: " << bytes << ", segment stalls: " << stalls << endl;
+}
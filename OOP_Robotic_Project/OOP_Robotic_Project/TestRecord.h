@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file TestRecord.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestRecord class for testing the Record class.
+ *
+ * This file contains the class declaration for round-tripping frames through a record
+ * file and for measuring the cost of write() on the control thread.
+ */
+
+#include "Record.h"
+
+ /**
+  * @class TestRecord
+  * @brief A class to test the functionality of the Record and RecordReader classes.
+  */
+class TestRecord {
+public:
+    /**
+     * @brief Default constructor for TestRecord.
+     */
+    TestRecord();
+
+    /**
+     * @brief Destructor for TestRecord.
+     */
+    ~TestRecord();
+
+    /**
+     * @brief Runs all test cases for the Record class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Writes frames over several segments and reads them back.
+     */
+    void testRoundTrip();
+
+    /**
+     * @brief Reads a file while it is still being written.
+     */
+    void testUnclosedFile();
+
+    /**
+     * @brief Tests that invalid frames and files are rejected.
+     */
+    void testInvalidInput();
+
+    /**
+     * @brief Measures write() latency against formatting the same data as text.
+     */
+    void benchmarkWrite();
+};
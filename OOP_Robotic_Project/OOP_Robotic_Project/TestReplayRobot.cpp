@@ -0,0 +1,234 @@
+/**
+ * @file TestReplayRobot.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestReplayRobot class for testing the ReplayRobot class.
+ */
+
+#include "TestReplayRobot.h"
+#include "LidarSensor.h"
+#include "MAP.h"
+#include "RobotControler.h"
+#include "SensorPipeline.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static const char* TEST_FILE = "TestReplayRobot.bin";
+static const long long FRAME_PERIOD_NS = 20000000; /*!< 50 Hz. */
+
+/**
+ * @brief Writes a log of a robot driving a circle in a 10 m x 10 m room.
+ * Frame i has x = i * 0.001 + 1, so tests can tell which frame a value came from.
+ */
+static bool writeRoomLog(int frames, int lidarCount) {
+    LidarGeometry geometry = LidarGeometry::fullCircle(lidarCount, 10.0);
+    vector<float> lidar(lidarCount);
+    double ir[RecordFrame::IR_COUNT];
+    Record record;
+    if (!record.open(TEST_FILE)) {
+        return false;
+    }
+    for (int i = 0; i < frames; i++) {
+        double x = i * 0.001 + 1.0;
+        double y = 2.0 * sin(i * 0.01);
+        double th = i * 0.01;
+        for (int b = 0; b < lidarCount; b++) {
+            double angle = th + geometry.startAngle + b * geometry.angleIncrement;
+            double c = cos(angle);
+            double s = sin(angle);
+            double tx = c > 1e-9 ? (5.0 - x) / c : (c < -1e-9 ? (-5.0 - x) / c : 1e9);
+            double ty = s > 1e-9 ? (5.0 - y) / s : (s < -1e-9 ? (-5.0 - y) / s : 1e9);
+            lidar[b] = static_cast<float>(tx < ty ? tx : ty);
+        }
+        for (int k = 0; k < RecordFrame::IR_COUNT; k++) {
+            ir[k] = x + k;
+        }
+        if (!record.write(i * FRAME_PERIOD_NS, Pose(x, y, th), ir, lidar.data(), lidarCount)) {
+            return false;
+        }
+    }
+    record.close();
+    return true;
+}
+
+/**
+ * @brief Default constructor for the TestReplayRobot class.
+ */
+TestReplayRobot::TestReplayRobot() {
+    cout << "[TestReplayRobot] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestReplayRobot class.
+ */
+TestReplayRobot::~TestReplayRobot() {
+    remove(TEST_FILE);
+    cout << "[TestReplayRobot] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the ReplayRobot class.
+ */
+void TestReplayRobot::runAllTests() {
+    cout << "\n================ Starting ReplayRobot Tests ================\n" << endl;
+
+    testSteppedReplay();
+    testPipelineReplay();
+    testTimedReplay();
+    benchmarkOfflineMapping();
+
+    cout << "\n================ Ending ReplayRobot Tests ================\n" << endl;
+}
+
+/**
+ * @brief Replays a log step by step through RobotControler.
+ */
+void TestReplayRobot::testSteppedReplay() {
+    cout << "--- Test: Stepped Replay ---" << endl;
+
+    writeRoomLog(200, 360);
+    ReplayRobot replay(TEST_FILE);
+    cout << "Log loaded: " << (replay.isLoaded() && replay.getFrameCount() == 200 ? "PASS" : "FAIL") << endl;
+    cout << "Lidar size from the log: " << (replay.getLidarRangeNumber() == 360 ? "PASS" : "FAIL") << endl;
+
+    RobotControler rc(&replay);
+    rc.connectRobot();
+    rc.moveForward();
+    rc.turnLeft();
+    bool poses = true;
+    for (int i = 0; i < 3; i++) {
+        Pose pose = rc.getPose();
+        poses = poses && pose.getX() == i * 0.001 + 1.0 && pose.getTh() == i * 0.01;
+    }
+    rc.stop();
+    rc.disconnectRobot();
+    cout << "RobotControler reads one frame per getPose: " << (poses ? "PASS" : "FAIL") << endl;
+    cout << "Commands reach the replay: " << (replay.getCommandCount() == 3 && !replay.isMoving() &&
+        replay.getLastDirection() == LEFT && !replay.isConnected() ? "PASS" : "FAIL") << endl;
+
+    double x;
+    double y;
+    double th;
+    bool ordered = true;
+    for (int i = 3; i < 200; i++) {
+        replay.getXYTh(x, y, th);
+        ordered = ordered && x == i * 0.001 + 1.0 && replay.getIRRange(4) == x + 4;
+    }
+    cout << "Every frame is served once, in order: " << (ordered && !replay.isFinished() ? "PASS" : "FAIL") << endl;
+    replay.getXYTh(x, y, th);
+    cout << "Replay holds the last frame when finished: " << (replay.isFinished() && x == 199 * 0.001 + 1.0 ? "PASS" : "FAIL") << endl;
+
+    replay.seek(50);
+    replay.getXYTh(x, y, th);
+    cout << "Seek restarts at the chosen frame: " << (x == 50 * 0.001 + 1.0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Replays a log through the SensorPipeline acquisition thread.
+ * Each snapshot must hold the pose, IR and lidar values of a single frame.
+ */
+void TestReplayRobot::testPipelineReplay() {
+    cout << "\n--- Test: Replay Through SensorPipeline ---" << endl;
+
+    writeRoomLog(500, 720);
+    ReplayRobot replay(TEST_FILE);
+    SensorPipeline pipeline(&replay);
+    pipeline.start();
+
+    int received = 0;
+    bool consistent = true;
+    double lastX = 0.0;
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(5);
+    while (!replay.isFinished() && chrono::steady_clock::now() < deadline) {
+        const SensorSnapshot* snapshot = pipeline.next();
+        if (snapshot == nullptr) {
+            continue;
+        }
+        int frame = static_cast<int>(lround((snapshot->x - 1.0) / 0.001));
+        consistent = consistent && snapshot->x > lastX && snapshot->ir[3] == snapshot->x + 3 &&
+            snapshot->lidarCount == 720 && frame >= 0 && frame < 500;
+        lastX = snapshot->x;
+        received++;
+        pipeline.release();
+    }
+    pipeline.stop();
+    cout << "Snapshots carry one frame each, in order: " << (received > 0 && consistent ? "PASS" : "FAIL") << endl;
+    cout << "Pipeline runs to the end of the log: " << (replay.isFinished() ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Replays a log against the wall clock at a higher speed.
+ * A 2 second log played 50 times faster must take at least 40 ms; how much longer
+ * it takes depends on the load of the machine and is only reported.
+ */
+void TestReplayRobot::testTimedReplay() {
+    cout << "\n--- Test: Timed Replay ---" << endl;
+
+    writeRoomLog(101, 16);
+    ReplayRobot replay(TEST_FILE, 50.0);
+    double x;
+    double y;
+    double th;
+    bool monotonic = true;
+    double lastX = 0.0;
+    auto start = chrono::steady_clock::now();
+    while (!replay.isFinished()) {
+        replay.getXYTh(x, y, th);
+        monotonic = monotonic && x >= lastX;
+        lastX = x;
+        this_thread::sleep_for(chrono::microseconds(200));
+    }
+    double elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "Replay took " << elapsedMs << " ms for a 2000 ms log at 50x" << endl;
+    cout << "Frames never go back: " << (monotonic ? "PASS" : "FAIL") << endl;
+    cout << "Replay is not faster than the scaled clock: " << (elapsedMs >= 39.0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures how much faster than real time a log can be mapped offline.
+ * Every frame goes through LidarSensor and MAP::integrateScan as it would online.
+ */
+void TestReplayRobot::benchmarkOfflineMapping() {
+    cout << "\n--- Benchmark: Offline Mapping Replay ---" << endl;
+
+    const int frames = 3000;
+    const int lidarCount = 1080;
+    writeRoomLog(frames, lidarCount);
+    ReplayRobot replay(TEST_FILE);
+    LidarSensor lidar(&replay);
+    MAP map(12.0, 12.0, 0.05);
+    LidarGeometry geometry = LidarGeometry::fullCircle(lidarCount, 10.0);
+
+    auto start = chrono::steady_clock::now();
+    int mapped = 0;
+    while (true) {
+        double x;
+        double y;
+        double th;
+        replay.getXYTh(x, y, th);
+        if (replay.isFinished()) {
+            break;
+        }
+        LidarScan* scan = lidar.acquireScan();
+        if (scan != nullptr) {
+            map.integrateScan(Pose(x, y, th), scan->ranges, scan->count, geometry);
+            lidar.releaseScan(scan);
+            mapped++;
+        }
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double logSeconds = frames * FRAME_PERIOD_NS / 1e9;
+
+    // The wall at x = 5 m may fall on either side of a cell border.
+    int wallX;
+    int wallY;
+    map.worldToCell(5.0, 0.0, wallX, wallY);
+    cout << "Frames mapped: " << mapped << " in " << seconds * 1000.0 << " ms" << endl;
+    cout << "Replay speed: " << logSeconds / seconds << "x real time at 50 Hz" << endl;
+    cout << "Room wall is mapped as occupied: " << (map.isOccupied(wallX, wallY) || map.isOccupied(wallX - 1, wallY) ? "PASS" : "FAIL") << endl;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+/**
+ * @file TestReplayRobot.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestReplayRobot class for testing the ReplayRobot class.
+ *
+ * This file contains the class declaration for replaying recorded logs through the
+ * controller and sensor classes, and for measuring offline replay speed.
+ */
+
+#include "ReplayRobot.h"
+
+ /**
+  * @class TestReplayRobot
+  * @brief A class to test the functionality of the ReplayRobot class.
+  */
+class TestReplayRobot {
+public:
+    /**
+     * @brief Default constructor for TestReplayRobot.
+     */
+    TestReplayRobot();
+
+    /**
+     * @brief Destructor for TestReplayRobot.
+     */
+    ~TestReplayRobot();
+
+    /**
+     * @brief Runs all test cases for the ReplayRobot class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Replays a log step by step through RobotControler.
+     */
+    void testSteppedReplay();
+
+    /**
+     * @brief Replays a log through the SensorPipeline acquisition thread.
+     */
+    void testPipelineReplay();
+
+    /**
+     * @brief Replays a log against the wall clock at a higher speed.
+     */
+    void testTimedReplay();
+
+    /**
+     * @brief Measures how much faster than real time a log can be mapped offline.
+     */
+    void benchmarkOfflineMapping();
+};
@@ -7,11 +7,152 @@
  * the functionality of the RobotControler class under various conditions.
  */
 
+#include <cmath>
 #include <iostream>
 #include "TestRobotControler.h"
+#include "Logger.h"
 
 using namespace std;
 
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief SimulatedRobot wrapper that counts the motion calls it receives.
+ */
+class CountingSimulatedRobot : public RobotInterface {
+public:
+    SimulatedRobot* robot;
+    unsigned long long calls;
+
+    CountingSimulatedRobot(SimulatedRobot* robot) : robot(robot), calls(0) {}
+    void connect() override { robot->connect(); }
+    void disconnect() override { robot->disconnect(); }
+    void move(DIRECTION direction) override { calls++; robot->move(direction); }
+    void rotate(DIRECTION direction) override { calls++; robot->rotate(direction); }
+    void stop() override { calls++; robot->stop(); }
+    double getIRRange(int i) override { return robot->getIRRange(i); }
+    void getXYTh(double& X, double& Y, double& TH) override { robot->getXYTh(X, Y, TH); }
+    void getLidarRange(float* ranges) override { robot->getLidarRange(ranges); }
+    int getLidarRangeNumber() override { return robot->getLidarRangeNumber(); }
+};
+
+/**
+ * @brief Runs velocity mode for a duration, one tick per control period.
+ */
+static void driveVelocity(RobotControler& rc, SimulatedRobot& robot, double seconds, double period) {
+    long long count = llround(seconds / period);
+    for (long long i = 0; i < count; i++) {
+        rc.tick(period);
+        robot.run(period);
+    }
+}
+
+/**
+ * @brief Reference twist of the tracking benchmark at time t.
+ */
+static void referenceTwist(double t, double& vx, double& vy, double& omega) {
+    vx = 0.12;
+    vy = 0.04 * sin(0.3 * t);
+    omega = 0.15 * cos(0.2 * t);
+}
+
+//! TrackingResult struct
+/*!
+ * @brief Outcome of following the reference trajectory.
+ */
+struct TrackingResult {
+    unsigned long long calls; /*!< Motion calls that reached the robot. */
+    double length;            /*!< Length of the reference path (meters). */
+    double rmsError;          /*!< Root mean square position error (meters). */
+    double maxError;          /*!< Largest position error (meters). */
+};
+
+/**
+ * @brief Follows the reference trajectory for a duration and measures the tracking.
+ *
+ * Every control period the pose error is taken in the robot frame. With a hysteresis
+ * of 0 or more the controller is in velocity mode with the reference twist plus a
+ * proportional correction; a negative hysteresis selects discrete commands, where
+ * the primitive that reduces the largest error is sent whenever it changes.
+ */
+static TrackingResult trackReference(double hysteresis, double seconds, double period) {
+    SimulatedRobot robot(100.0, 0);
+    CountingSimulatedRobot api(&robot);
+    RobotControler rc(&api);
+    rc.connectRobot();
+    if (hysteresis >= 0.0) {
+        rc.setSliceHysteresis(hysteresis);
+    }
+
+    const double gain = 1.0;
+    const double headingTolerance = 0.03;
+    const double positionTolerance = 0.01;
+    double rx = 0.0, ry = 0.0, rth = 0.0;
+    double sum = 0.0;
+    TrackingResult result = { 0, 0.0, 0.0, 0.0 };
+    RobotCommand sent = COMMAND_STOP;
+    bool anySent = false;
+    long long count = llround(seconds / period);
+
+    for (long long i = 0; i < count; i++) {
+        double t = i * period;
+        double vx, vy, omega;
+        referenceTwist(t, vx, vy, omega);
+
+        double x, y, th;
+        robot.getXYTh(x, y, th);
+        double dx = rx - x;
+        double dy = ry - y;
+        double error = sqrt(dx * dx + dy * dy);
+        sum += error * error;
+        result.maxError = error > result.maxError ? error : result.maxError;
+        double ex = cos(th) * dx + sin(th) * dy;
+        double ey = -sin(th) * dx + cos(th) * dy;
+        double eth = remainder(rth - th, 2.0 * PI);
+
+        if (hysteresis >= 0.0) {
+            rc.setVelocity(vx + gain * ex, vy + gain * ey, omega + gain * eth);
+            rc.tick(period);
+        }
+        else {
+            RobotCommand command = COMMAND_STOP;
+            if (fabs(eth) > headingTolerance) {
+                command = eth > 0.0 ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT;
+            }
+            else if (fabs(ex) >= fabs(ey) && fabs(ex) > positionTolerance) {
+                command = ex > 0.0 ? COMMAND_MOVE_FORWARD : COMMAND_MOVE_BACKWARD;
+            }
+            else if (fabs(ey) > positionTolerance) {
+                command = ey > 0.0 ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT;
+            }
+            if (!anySent || command != sent) {
+                switch (command) {
+                case COMMAND_MOVE_FORWARD: rc.moveForward(); break;
+                case COMMAND_MOVE_BACKWARD: rc.moveBackward(); break;
+                case COMMAND_MOVE_LEFT: rc.moveLeft(); break;
+                case COMMAND_MOVE_RIGHT: rc.moveRight(); break;
+                case COMMAND_TURN_LEFT: rc.turnLeft(); break;
+                case COMMAND_TURN_RIGHT: rc.turnRight(); break;
+                default: rc.stop(); break;
+                }
+                sent = command;
+                anySent = true;
+            }
+        }
+        robot.run(period);
+
+        double c = cos(rth + 0.5 * omega * period);
+        double s = sin(rth + 0.5 * omega * period);
+        rx += (vx * c - vy * s) * period;
+        ry += (vx * s + vy * c) * period;
+        rth += omega * period;
+        result.length += sqrt(vx * vx + vy * vy) * period;
+    }
+    result.calls = api.calls;
+    result.rmsError = sqrt(sum / count);
+    return result;
+}
+
 /**
  * @brief Constructs a TestRobotControler object.
  */
@@ -25,12 +166,12 @@ TestRobotControler::~TestRobotControler() {
 }
 
 /**
- * @brief Creates a dummy FestoRobotAPI instance for testing.
+ * @brief Creates a simulated robot backend for testing.
  *
- * @return A pointer to a new FestoRobotAPI instance.
+ * @return A pointer to a new SimulatedRobot instance.
  */
-FestoRobotAPI* TestRobotControler::createDummyAPI() {
-    return new FestoRobotAPI();
+SimulatedRobot* TestRobotControler::createDummyAPI() {
+    return new SimulatedRobot();
 }
 
 /**
@@ -41,14 +182,14 @@ FestoRobotAPI* TestRobotControler::createDummyAPI() {
 void TestRobotControler::testDisconnectedMovement() {
     cout << "\n--- Test: Movements While Disconnected ---" << endl;
 
-    FestoRobotAPI* robotino = createDummyAPI();
+    SimulatedRobot* robotino = createDummyAPI();
     RobotControler rc(robotino);
 
     cout << "Attempting to move while disconnected:" << endl;
     rc.moveForward();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.turnLeft();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.stop();
 
     delete robotino;
@@ -62,7 +203,7 @@ void TestRobotControler::testDisconnectedMovement() {
 void TestRobotControler::testConnectedMovement() {
     cout << "\n--- Test: Movements While Connected ---" << endl;
 
-    FestoRobotAPI* robotino = createDummyAPI();
+    SimulatedRobot* robotino = createDummyAPI();
     RobotControler rc(robotino);
 
     cout << "Connecting the robot..." << endl;
@@ -70,9 +211,9 @@ void TestRobotControler::testConnectedMovement() {
 
     cout << "Attempting to move while connected:" << endl;
     rc.moveForward();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.turnLeft();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.stop();
 
     cout << "Disconnecting the robot..." << endl;
@@ -89,7 +230,7 @@ void TestRobotControler::testConnectedMovement() {
 void TestRobotControler::testMovementAfterDisconnection() {
     cout << "\n--- Test: Movements After Disconnection ---" << endl;
 
-    FestoRobotAPI* robotino = createDummyAPI();
+    SimulatedRobot* robotino = createDummyAPI();
     RobotControler rc(robotino);
 
     cout << "Connecting the robot..." << endl;
@@ -100,9 +241,9 @@ void TestRobotControler::testMovementAfterDisconnection() {
 
     cout << "Attempting to move after disconnecting:" << endl;
     rc.moveForward();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.turnRight();
-    Sleep(3000);
+    robotino->run(3.0);
     rc.stop();
 
     delete robotino;
@@ -117,7 +258,7 @@ void TestRobotControler::testMovementAfterDisconnection() {
 void TestRobotControler::testMultipleConnections() {
     cout << "\n--- Test: Multiple Connection Attempts ---" << endl;
 
-    FestoRobotAPI* robotino = createDummyAPI();
+    SimulatedRobot* robotino = createDummyAPI();
     RobotControler rc(robotino);
 
     cout << "First connection attempt:" << endl;
@@ -143,7 +284,7 @@ void TestRobotControler::testMultipleConnections() {
 void TestRobotControler::testStopWhileMoving() {
     cout << "\n--- Test: Stop Command While Moving ---" << endl;
 
-    FestoRobotAPI* robotino = createDummyAPI();
+    SimulatedRobot* robotino = createDummyAPI();
     RobotControler rc(robotino);
 
     cout << "Connecting the robot..." << endl;
@@ -151,14 +292,14 @@ void TestRobotControler::testStopWhileMoving() {
 
     cout << "Robot moving forward..." << endl;
     rc.moveForward();
-    Sleep(3000);
+    robotino->run(3.0);
 
     cout << "Robot issuing stop command while moving..." << endl;
     rc.stop();
 
     cout << "Robot turning left..." << endl;
     rc.turnLeft();
-    Sleep(3000);
+    robotino->run(3.0);
 
     cout << "Stopping the robot again..." << endl;
     rc.stop();
@@ -168,6 +309,156 @@ void TestRobotControler::testStopWhileMoving() {
     delete robotino;
 }
 
+/**
+ * @brief Tests velocity mode on a simulated robot.
+ *
+ * The controller ticks every 20 ms, twice the simulation step, and the robot's
+ * speeds are the defaults of both sides (0.2 m/s, 0.5 rad/s).
+ */
+void TestRobotControler::testVelocityMode() {
+    cout << "\n--- Test: Velocity Mode ---" << endl;
+    const double period = 0.02;
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        bool idle = rc.tick(period) == COMMAND_STOP && api.calls == 0 && !rc.isVelocityMode();
+        rc.setVelocity(0.2, 0.0, 0.0);
+        driveVelocity(rc, robot, 5.0, period);
+        double x, y, th;
+        robot.getXYTh(x, y, th);
+        bool ok = idle && api.calls == 1 && fabs(x - 1.0) < 1e-6 && fabs(y) < 1e-9;
+        cout << "Full-speed forward for 5 s: x " << x << " m after " << api.calls << " call(s): " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        rc.setVelocity(0.1, 0.0, 0.0);
+        driveVelocity(rc, robot, 10.0, period);
+        double x, y, th;
+        robot.getXYTh(x, y, th);
+        bool ok = fabs(x - 1.0) <= 0.2 * 0.05 + 1e-9 && api.calls > 1 && api.calls <= 102;
+        cout << "Half-speed forward for 10 s: x " << x << " m after " << api.calls << " calls: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        rc.setVelocity(-0.05, 0.0, -0.25);
+        driveVelocity(rc, robot, 4.0, period);
+        double x, y, th;
+        robot.getXYTh(x, y, th);
+        bool ok = fabs(th + 1.0) < 0.03 && fabs(hypot(x, y) - 0.2) < 0.02 && x < 0.0;
+        cout << "Backward and clockwise for 4 s: (" << x << ", " << y << ", " << th << "): " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        rc.setVelocity(0.4, 0.4, 0.0);
+        driveVelocity(rc, robot, 10.0, period);
+        double x, y, th;
+        robot.getXYTh(x, y, th);
+        bool ok = fabs(x - 1.0) < 0.02 && fabs(y - 1.0) < 0.02 && fabs(th) < 1e-9;
+        cout << "Saturated diagonal for 10 s scaled to (1, 1): (" << x << ", " << y << "): " << (ok ? "PASS" : "FAIL") << endl;
+
+        rc.setVelocity(0.0, 0.0, 0.0);
+        unsigned long long before = api.calls;
+        RobotCommand command = rc.tick(period);
+        driveVelocity(rc, robot, 2.0, period);
+        double x2, y2, th2;
+        robot.getXYTh(x2, y2, th2);
+        ok = command == COMMAND_STOP && api.calls == before + 1 && hypot(x2 - x, y2 - y) < 0.2 * period + 1e-9;
+        cout << "Zero twist stops with one call: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.setVelocity(0.2, 0.0, 0.0);
+        bool ok = rc.tick(period) == COMMAND_STOP && api.calls == 0;
+        cout << "Ticks while disconnected send nothing: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        rc.setVelocity(NAN, 0.0, 0.0);
+        rc.setVelocity(0.0, INFINITY, 0.0);
+        bool ok = !rc.isVelocityMode() && rc.tick(period) == COMMAND_STOP && api.calls == 0;
+        rc.setVelocity(0.2, 0.0, 0.0);
+        rc.setVelocity(0.0, 0.0, -INFINITY);
+        ok = ok && rc.tick(period) == COMMAND_MOVE_FORWARD && rc.tick(period) == COMMAND_MOVE_FORWARD && api.calls == 1;
+        cout << "Non-finite twists are rejected: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+
+    {
+        SimulatedRobot robot(20.0, 0);
+        CountingSimulatedRobot api(&robot);
+        RobotControler rc(&api);
+        rc.connectRobot();
+        rc.setVelocity(0.2, 0.0, 0.0);
+        rc.tick(period);
+        rc.stop();
+        bool ok = rc.tick(period) == COMMAND_MOVE_FORWARD && api.calls == 3;
+        rc.moveLeft();
+        ok = ok && rc.tick(period) == COMMAND_MOVE_FORWARD && api.calls == 5;
+        cout << "Ticks resend the slot after an outside stop or move: " << (ok ? "PASS" : "FAIL") << endl;
+
+        rc.clearVelocity();
+        rc.stop();
+        ok = !rc.isVelocityMode() && rc.tick(period) == COMMAND_STOP && api.calls == 6;
+        rc.moveRight();
+        ok = ok && rc.tick(period) == COMMAND_MOVE_RIGHT && api.calls == 7;
+        cout << "clearVelocity() returns to discrete commands: " << (ok ? "PASS" : "FAIL") << endl;
+    }
+}
+
+/**
+ * @brief Measures API calls per meter and tracking error of velocity mode.
+ *
+ * The reference moves forward at 0.12 m/s while it sways sideways and its heading
+ * swings, for 120 s, with a 20 ms control period. The discrete controller uses the
+ * same period and the primitives only; it sends a command whenever the error calls
+ * for a different one.
+ */
+void TestRobotControler::benchmarkVelocityTracking() {
+    cout << "\n--- Benchmark: Velocity Mode Tracking ---" << endl;
+    const double seconds = 120.0;
+    const double period = 0.02;
+    const double hysteresis[] = { 0.0, 0.02, 0.05, 0.1, 0.2 };
+
+    TrackingResult discrete = trackReference(-1.0, seconds, period);
+    cout << "Discrete commands:          " << discrete.calls / discrete.length << " calls/m, RMS error "
+        << discrete.rmsError * 1000.0 << " mm, max " << discrete.maxError * 1000.0 << " mm" << endl;
+
+    TrackingResult chosen = discrete;
+    for (double h : hysteresis) {
+        TrackingResult result = trackReference(h, seconds, period);
+        cout << "Velocity mode, hysteresis " << h << " s: " << result.calls / result.length << " calls/m, RMS error "
+            << result.rmsError * 1000.0 << " mm, max " << result.maxError * 1000.0 << " mm" << endl;
+        if (h == 0.05) {
+            chosen = result;
+        }
+    }
+
+    bool ok = chosen.calls < discrete.calls && chosen.rmsError <= discrete.rmsError;
+    cout << "Default hysteresis: " << static_cast<double>(discrete.calls) / chosen.calls << "x fewer calls than discrete commands, "
+        << "no larger RMS error: " << (ok ? "PASS" : "FAIL") << endl;
+}
+
 /**
  * @brief Runs all available test scenarios for RobotControler.
  *
@@ -183,6 +474,13 @@ void TestRobotControler::runAllTests() {
     testMultipleConnections();
     testStopWhileMoving();
 
+    ostream discard(nullptr);
+    Logger::setOutput(&discard);
+    testVelocityMode();
+    benchmarkVelocityTracking();
+    Logger::flush();
+    Logger::setOutput(nullptr);
+
     cout << "\n================ Ending RobotControler Tests ================\n" << endl;
 }
 
@@ -10,8 +10,8 @@
  * including connected and disconnected states, movement tests, and edge case scenarios.
  */
 
-#include "../../oop_project/Project_Packet/FestoRobotAPI.h"
 #include "RobotControler.h"
+#include "SimulatedRobot.h"
 
  /**
   * @class TestRobotControler
@@ -72,6 +72,22 @@ public:
      */
     void testStopWhileMoving();
 
+    /**
+     * @brief Tests velocity mode on a simulated robot.
+     *
+     * Checks that a twist along one primitive is a single API call, that mixed and
+     * saturated twists reach the expected pose and that a zero twist stops the robot.
+     */
+    void testVelocityMode();
+
+    /**
+     * @brief Measures API calls per meter and tracking error of velocity mode.
+     *
+     * Follows a curved reference trajectory with velocity mode at several slice
+     * hysteresis values and with discrete commands switched by a bang-bang controller.
+     */
+    void benchmarkVelocityTracking();
+
     /**
      * @brief Runs all available test scenarios for RobotControler.
      *
@@ -82,12 +98,13 @@ public:
 
 private:
     /**
-     * @brief Creates a dummy instance of FestoRobotAPI.
+     * @brief Creates a simulated robot backend.
      *
-     * This function initializes and returns a pointer to a FestoRobotAPI object
-     * to simulate the robot API during tests.
+     * This function initializes and returns a pointer to a SimulatedRobot object
+     * to simulate the robot API during tests, so they run without Webots. The tests
+     * advance its simulated time instead of sleeping.
      *
-     * @return A pointer to a FestoRobotAPI instance.
+     * @return A pointer to a SimulatedRobot instance.
      */
-    FestoRobotAPI* createDummyAPI();
+    SimulatedRobot* createDummyAPI();
 };
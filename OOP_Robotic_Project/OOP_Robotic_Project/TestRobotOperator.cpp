@@ -0,0 +1,404 @@
+/**
+ * @file TestRobotOperator.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestRobotOperator class for testing the RobotOperator class.
+ */
+
+#include "TestRobotOperator.h"
+#include "Logger.h"
+#include "RobotControler.h"
+#include "SimulatedRobot.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const char* SCRIPT_FILE = "TestRobotOperator.txt";
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Returns the pose of a simulated robot.
+ */
+static void poseOf(SimulatedRobot& robot, double& x, double& y, double& th) {
+    robot.getXYTh(x, y, th);
+}
+
+/**
+ * @brief Runs the lines of a script the way a hand-written loop would: every line is
+ * split and matched again each time it is executed.
+ * @return the motion commands sent.
+ */
+static unsigned long long interpretText(RobotControler& controler, RobotInterface& api, const vector<string>& lines, int repeats) {
+    IRSensor ir(&api);
+    unsigned long long commands = 0;
+    for (int r = 0; r < repeats; r++) {
+        for (const string& line : lines) {
+            istringstream words(line);
+            string name;
+            string argument;
+            words >> name >> argument;
+            if (name == "move") {
+                if (argument == "forward") {
+                    controler.moveForward();
+                }
+                else if (argument == "left") {
+                    controler.moveLeft();
+                }
+                commands++;
+            }
+            else if (name == "rotate") {
+                if (argument == "right") {
+                    controler.turnRight();
+                }
+                commands++;
+            }
+            else if (name == "stop") {
+                controler.stop();
+                commands++;
+            }
+            else if (name == "wait_clear") {
+                ir.refresh();
+                if (!(ir.minRange() > stod(argument))) {
+                    return commands;
+                }
+            }
+            else if (name == "wait_pose") {
+                double x;
+                double y;
+                double th;
+                double tolerance;
+                string yText;
+                words >> yText >> tolerance;
+                api.getXYTh(x, y, th);
+                if (hypot(x - stod(argument), y - stod(yText)) > tolerance) {
+                    return commands;
+                }
+            }
+        }
+    }
+    return commands;
+}
+
+/**
+ * @brief Default constructor for the TestRobotOperator class.
+ */
+TestRobotOperator::TestRobotOperator() {
+    cout << "[TestRobotOperator] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestRobotOperator class.
+ */
+TestRobotOperator::~TestRobotOperator() {
+    remove(SCRIPT_FILE);
+    cout << "[TestRobotOperator] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the RobotOperator class.
+ *
+ * The controller logs every command it sends, so its log output is discarded while
+ * the tests run.
+ */
+void TestRobotOperator::runAllTests() {
+    cout << "\n================ Starting RobotOperator Tests ================\n" << endl;
+
+    ostream discard(nullptr);
+    Logger::setOutput(&discard);
+
+    testCompile();
+    testTimedCommands();
+    testConditions();
+    testLoops();
+    testAsync();
+    benchmarkInterpreter();
+
+    Logger::flush();
+    Logger::setOutput(nullptr);
+
+    cout << "\n================ Ending RobotOperator Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests the compiled instructions and the rejection of invalid scripts.
+ *
+ * A square drawn with a loop must compile to 8 instructions with both jumps resolved.
+ * Every invalid script must fail with its line number and leave the loaded program
+ * as it was.
+ */
+void TestRobotOperator::testCompile() {
+    cout << "--- Test: Compilation ---" << endl;
+
+    RobotOperator robotOperator(nullptr, nullptr);
+    bool compiled = robotOperator.compile(
+        "# drive a square\n"
+        "repeat 4\n"
+        "    move forward 2.5   # 0.5 m\n"
+        "    rotate left 3.14159\n"
+        "end\n"
+        "\n"
+        "stop\n");
+    const vector<OperatorInstruction>& program = robotOperator.getProgram();
+    bool layout = compiled && program.size() == 8 && program[0].op == OP_REPEAT && program[0].arg == 4 && program[0].target == 6
+        && program[1].op == OP_COMMAND && program[1].arg == COMMAND_MOVE_FORWARD && program[2].op == OP_WAIT && program[2].a == 2.5f
+        && program[3].arg == COMMAND_TURN_LEFT && program[5].op == OP_LOOP && program[5].target == 1 && program[5].line == 5
+        && program[6].arg == COMMAND_STOP && program[7].op == OP_HALT;
+    cout << "Square compiles to " << program.size() << " instructions of " << sizeof(OperatorInstruction) << " bytes: "
+        << (layout && sizeof(OperatorInstruction) == 28 ? "PASS" : "FAIL") << endl;
+
+    compiled = robotOperator.compile("wait_pose 1 2\nwait_pose 1 2 0.1 5\nwait_clear 0.3\nwait_clear left 0.3 2\n");
+    bool defaults = compiled && program[0].c == 0.05f && program[0].d == static_cast<float>(RobotOperator::DEFAULT_TIMEOUT)
+        && program[1].c == 0.1f && program[1].d == 5.0f && program[2].arg == 4 && program[3].arg == LEFT && program[3].d == 2.0f;
+    cout << "Optional operands take their defaults: " << (defaults ? "PASS" : "FAIL") << endl;
+
+    string nested;
+    for (int i = 0; i <= RobotOperator::MAX_NESTING; i++) {
+        nested += "repeat 2\n";
+    }
+    const char* invalid[][2] = {
+        { "stop\njump forward\n", "line 2" },
+        { "move up 1\n", "line 1" },
+        { "rotate forward\n", "line 1" },
+        { "move forward fast\n", "line 1" },
+        { "wait -1\n", "line 1" },
+        { "wait_pose 1\n", "line 1" },
+        { "wait_clear left\n", "line 1" },
+        { "stop\nrepeat 3\nstop\n", "line 2" },
+        { "end\n", "line 1" },
+        { "repeat 1.5\nend\n", "line 1" },
+        { nested.c_str(), "line 17" },
+    };
+    size_t before = program.size();
+    int rejected = 0;
+    for (const auto& script : invalid) {
+        if (!robotOperator.compile(script[0]) && robotOperator.getError().compare(0, strlen(script[1]), script[1]) == 0
+            && robotOperator.getError()[strlen(script[1])] == ':') {
+            rejected++;
+        }
+    }
+    int total = static_cast<int>(sizeof(invalid) / sizeof(invalid[0]));
+    cout << "Invalid scripts rejected at their line: " << rejected << " of " << total << ": "
+        << (rejected == total && program.size() == before ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests timed moves and rotations on a simulated robot.
+ *
+ * The robot moves at 0.2 m/s and turns at 0.5 rad/s, so a 2.5 s move covers 0.5 m and
+ * a pi s rotation a quarter turn; the clock runs the simulation.
+ */
+void TestRobotOperator::testTimedCommands() {
+    cout << "\n--- Test: Timed Commands ---" << endl;
+
+    SimulatedRobot robot(4.0);
+    RobotControler controler(&robot, Pose());
+    RobotOperator robotOperator(&controler, &robot);
+    robotOperator.setClock([&robot](double seconds) { robot.run(seconds); });
+
+    robotOperator.compile("move forward 2.5\nrotate left 3.14159265\nmove forward 2.5\nstop\n");
+    OperatorStatus status = robotOperator.run();
+    double x;
+    double y;
+    double th;
+    poseOf(robot, x, y, th);
+    cout << "Forward, quarter turn, forward ends at (0.5, 0.5): "
+        << (status == OPERATOR_DONE && fabs(x - 0.5) < 1e-2 && fabs(y - 0.5) < 1e-2 && fabs(th - PI / 2.0) < 1e-2 ? "PASS" : "FAIL") << endl;
+    cout << "Clock time and commands are counted: "
+        << (fabs(robotOperator.getElapsed() - (5.0 + PI)) < 1e-6 && robotOperator.getCommandCount() == 4 && robotOperator.getExecutedCount() == 8
+            && robotOperator.getPollCount() == 0 ? "PASS" : "FAIL") << endl;
+    controler.disconnectRobot();
+}
+
+/**
+ * @brief Tests waiting for a pose, for clearance and running out of time.
+ *
+ * The room walls are 2 m from its center and the robot radius is 0.2 m. Conditions
+ * are checked every 10 ms of simulated time, in which the robot moves 2 mm.
+ */
+void TestRobotOperator::testConditions() {
+    cout << "\n--- Test: Waiting on Conditions ---" << endl;
+
+    SimulatedRobot robot(4.0);
+    RobotControler controler(&robot, Pose());
+    RobotOperator robotOperator(&controler, &robot);
+    robotOperator.setClock([&robot](double seconds) { robot.run(seconds); });
+    double x;
+    double y;
+    double th;
+
+    robotOperator.compile("move forward\nwait_pose 1.0 0.0 0.01 20\nstop\n");
+    OperatorStatus status = robotOperator.run();
+    poseOf(robot, x, y, th);
+    cout << "Robot stops within 1 cm of the pose: " << (status == OPERATOR_DONE && fabs(x - 1.0) <= 0.01 && robotOperator.getPollCount() > 400 ? "PASS" : "FAIL") << endl;
+
+    robot.setPose(1.5, 0.0, 0.0);
+    robotOperator.compile("move backward\nwait_clear forward 0.7 10\nstop\n");
+    status = robotOperator.run();
+    poseOf(robot, x, y, th);
+    double front = robot.getIRRange(0);
+    cout << "Robot backs away until the front reads 0.7 m: " << (status == OPERATOR_DONE && front > 0.7 && front < 0.71 && fabs(x - 1.3) < 0.01 ? "PASS" : "FAIL") << endl;
+
+    robotOperator.compile("wait_clear 0.1\nwait_pose 1.3 0 0.05\n");
+    status = robotOperator.run();
+    cout << "Conditions that hold cost no time: " << (status == OPERATOR_DONE && robotOperator.getElapsed() == 0.0 && robotOperator.getPollCount() == 2 ? "PASS" : "FAIL") << endl;
+
+    robotOperator.compile("move left\nwait_pose -1 -1 0.05 0.5\nmove forward\n");
+    status = robotOperator.run();
+    double stoppedX;
+    double stoppedY;
+    poseOf(robot, stoppedX, stoppedY, th);
+    robot.run(1.0);
+    poseOf(robot, x, y, th);
+    cout << "A wait that times out stops the robot: "
+        << (status == OPERATOR_TIMEOUT && robotOperator.getError().compare(0, 7, "line 2:") == 0 && robotOperator.getCommandCount() == 2
+            && robotOperator.getPollCount() >= 51 && robotOperator.getPollCount() <= 52 && x == stoppedX && y == stoppedY ? "PASS" : "FAIL") << endl;
+    controler.disconnectRobot();
+}
+
+/**
+ * @brief Tests nested and empty repeat loops and loading a script file.
+ */
+void TestRobotOperator::testLoops() {
+    cout << "\n--- Test: Loops ---" << endl;
+
+    SimulatedRobot robot(4.0);
+    RobotControler controler(&robot, Pose());
+    RobotOperator robotOperator(&controler, &robot);
+    robotOperator.setClock([&robot](double seconds) { robot.run(seconds); });
+
+    robotOperator.compile("repeat 3\n  repeat 2\n    stop\n  end\n  move left\nend\nrepeat 0\n  stop\nend\n");
+    OperatorStatus status = robotOperator.run();
+    cout << "Nested loops run 3 x (2 + 1) commands, an empty one none: "
+        << (status == OPERATOR_DONE && robotOperator.getCommandCount() == 9 && robotOperator.getExecutedCount() == 24 ? "PASS" : "FAIL") << endl;
+
+    robotOperator.compile("repeat 1000000\nend\n");
+    status = robotOperator.run();
+    cout << "A million empty iterations: " << (status == OPERATOR_DONE && robotOperator.getExecutedCount() == 1000002 ? "PASS" : "FAIL") << endl;
+
+    {
+        ofstream file(SCRIPT_FILE);
+        file << "# out and back four times\nrepeat 4\n  move forward 1\n  move backward 1\nend\nstop\n";
+    }
+    bool loaded = robotOperator.load(SCRIPT_FILE);
+    robot.setPose(0.0, 0.0, 0.0);
+    status = robotOperator.run();
+    double x;
+    double y;
+    double th;
+    poseOf(robot, x, y, th);
+    bool missing = !robotOperator.load("TestRobotOperator.missing");
+    cout << "Script file runs, a missing file is refused: "
+        << (loaded && status == OPERATOR_DONE && fabs(x) < 1e-9 && robotOperator.getCommandCount() == 9 && missing ? "PASS" : "FAIL") << endl;
+
+    RobotOperator empty(&controler, &robot);
+    OperatorStatus refused = empty.run();
+    cout << "Running without a program is refused: " << (refused == OPERATOR_NOT_READY ? "PASS" : "FAIL") << endl;
+    controler.disconnectRobot();
+}
+
+/**
+ * @brief Tests that a mission ends at the same pose with queued and direct commands.
+ *
+ * With startAsync() the commands go through the dispatcher thread, and the first check
+ * of every wait runs while the command is being sent. The queue is flushed before the
+ * clock advances, so the simulated robot must follow exactly the same path.
+ */
+void TestRobotOperator::testAsync() {
+    cout << "\n--- Test: Queued Commands ---" << endl;
+
+    const char* mission =
+        "repeat 3\n"
+        "  move forward\n"
+        "  wait_clear forward 0.5 20\n"
+        "  wait_pose 0.6 0 0.02 20\n"
+        "  rotate left 0.5\n"
+        "  rotate right 0.5\n"
+        "  move backward\n"
+        "  wait_pose 0 0 0.02 20\n"
+        "  stop\n"
+        "end\n"
+        "move left 2\n"
+        "stop\n";
+    double poses[2][3];
+    unsigned long long commands[2];
+    unsigned long long issued = 0;
+    bool done = true;
+    for (int async = 0; async < 2; async++) {
+        SimulatedRobot robot(4.0);
+        RobotControler controler(&robot, Pose());
+        if (async == 1) {
+            controler.startAsync();
+        }
+        RobotOperator robotOperator(&controler, &robot);
+        robotOperator.setClock([&robot](double seconds) { robot.run(seconds); });
+        robotOperator.compile(mission);
+        done &= robotOperator.run() == OPERATOR_DONE;
+        poseOf(robot, poses[async][0], poses[async][1], poses[async][2]);
+        commands[async] = robotOperator.getCommandCount();
+        if (async == 1) {
+            issued = controler.getDispatcher()->getIssuedCount() + controler.getDispatcher()->getCoalescedCount();
+            controler.stopAsync();
+        }
+        controler.disconnectRobot();
+    }
+    cout << "Queued commands all reach the robot: " << (done && commands[0] == 17 && commands[1] == 17 && issued == 17 ? "PASS" : "FAIL") << endl;
+    cout << "Queued and direct commands end at the same pose: "
+        << (poses[0][0] == poses[1][0] && poses[0][1] == poses[1][1] && poses[0][2] == poses[1][2] ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures commands per second of compiled scripts against parsing every line.
+ *
+ * The loop body sends four commands and checks two conditions that hold, so no
+ * simulated time passes and only the interpreter, the controller and the simulated
+ * sensors are measured. The same lines are then run by splitting and matching each
+ * one every time it executes. The rates depend on the load of the machine and are only
+ * reported; the counts of instructions, commands and sensor checks are exact.
+ */
+void TestRobotOperator::benchmarkInterpreter() {
+    cout << "\n--- Benchmark: Interpreter Throughput ---" << endl;
+
+    SimulatedRobot robot(4.0);
+    RobotControler controler(&robot, Pose());
+    RobotOperator robotOperator(&controler, &robot);
+    robotOperator.setClock([&robot](double seconds) { robot.run(seconds); });
+    vector<string> body = { "move forward", "move left", "rotate right", "wait_clear 0.1", "stop", "wait_pose 0 0 100" };
+    const int repeats = 200000;
+    string script = "repeat " + to_string(repeats) + "\n";
+    for (const string& line : body) {
+        script += line + "\n";
+    }
+    script += "end\n";
+    robotOperator.compile(script);
+
+    robotOperator.run();
+    auto start = chrono::steady_clock::now();
+    OperatorStatus status = robotOperator.run();
+    double compiledSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double compiledRate = robotOperator.getCommandCount() / compiledSeconds;
+
+    start = chrono::steady_clock::now();
+    unsigned long long textCommands = interpretText(controler, robot, body, repeats);
+    double textSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double textRate = textCommands / textSeconds;
+
+    cout << "Compiled: " << robotOperator.getExecutedCount() / compiledSeconds << " instructions/s, " << compiledRate << " commands/s, "
+        << robotOperator.getPollCount() / compiledSeconds << " sensor checks/s" << endl;
+    cout << "Parsed every line: " << textRate << " commands/s" << endl;
+    cout << "Compiled scripts against parsed lines: " << compiledRate / textRate << "x" << endl;
+
+    // repeat, then six body instructions and the loop per pass, then halt.
+    unsigned long long passes = repeats;
+    bool counted = robotOperator.getExecutedCount() == 7 * passes + 2 && robotOperator.getCommandCount() == 4 * passes
+        && robotOperator.getPollCount() == 2 * passes && textCommands == 4 * passes;
+    cout << "Both interpreters execute every instruction and command: " << (status == OPERATOR_DONE && counted ? "PASS" : "FAIL") << endl;
+    controler.disconnectRobot();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file TestRobotOperator.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestRobotOperator class for testing the RobotOperator class.
+ *
+ * This file contains the class declaration for testing script compilation, timed and
+ * sensor-driven commands, loops and queued commands on a simulated robot, and for
+ * measuring commands per second through the interpreter.
+ */
+
+#include "RobotOperator.h"
+
+ /**
+  * @class TestRobotOperator
+  * @brief A class to test the functionality of the RobotOperator class.
+  */
+class TestRobotOperator {
+public:
+    /**
+     * @brief Default constructor for TestRobotOperator.
+     */
+    TestRobotOperator();
+
+    /**
+     * @brief Destructor for TestRobotOperator.
+     */
+    ~TestRobotOperator();
+
+    /**
+     * @brief Runs all test cases for the RobotOperator class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests the compiled instructions and the rejection of invalid scripts.
+     */
+    void testCompile();
+
+    /**
+     * @brief Tests timed moves and rotations on a simulated robot.
+     */
+    void testTimedCommands();
+
+    /**
+     * @brief Tests waiting for a pose, for clearance and running out of time.
+     */
+    void testConditions();
+
+    /**
+     * @brief Tests nested and empty repeat loops and loading a script file.
+     */
+    void testLoops();
+
+    /**
+     * @brief Tests that a mission ends at the same pose with queued and direct commands.
+     */
+    void testAsync();
+
+    /**
+     * @brief Measures commands per second of compiled scripts against parsing every line.
+     */
+    void benchmarkInterpreter();
+};
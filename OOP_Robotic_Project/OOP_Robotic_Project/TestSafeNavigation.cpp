@@ -0,0 +1,283 @@
+/**
+ * @file TestSafeNavigation.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestSafeNavigation class for testing the SafeNavigation class.
+ */
+
+#include "TestSafeNavigation.h"
+#include "LatencyHistogram.h"
+#include "RobotControler.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/** Time available to one control tick; the safety check must fit well inside it. */
+static const long long TICK_BUDGET_NS = 1000000;
+
+/**
+ * @brief Stand-in robot API that records motion commands.
+ */
+class RecordingRobotAPI : public RobotInterface {
+public:
+    vector<RobotCommand> commands;
+
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION direction) override {
+        commands.push_back(direction == FORWARD ? COMMAND_MOVE_FORWARD : direction == BACKWARD ? COMMAND_MOVE_BACKWARD :
+            direction == LEFT ? COMMAND_MOVE_LEFT : COMMAND_MOVE_RIGHT);
+    }
+    void rotate(DIRECTION direction) override { commands.push_back(direction == LEFT ? COMMAND_TURN_LEFT : COMMAND_TURN_RIGHT); }
+    void stop() override { commands.push_back(COMMAND_STOP); }
+    double getIRRange(int) override { return 1.0; }
+    void getXYTh(double& X, double& Y, double& TH) override { X = 0; Y = 0; TH = 0; }
+    void getLidarRange(float*) override {}
+    int getLidarRangeNumber() override { return 0; }
+};
+
+/**
+ * @brief Fills a scan with the ranges to a wall perpendicular to a direction, at distance meters.
+ */
+static void wallScan(vector<float>& ranges, const LidarGeometry& geometry, double direction, double distance) {
+    for (size_t i = 0; i < ranges.size(); i++) {
+        double along = cos(geometry.startAngle + i * geometry.angleIncrement - direction);
+        double range = along > 1e-9 ? distance / along : geometry.maxRange;
+        ranges[i] = static_cast<float>(range < geometry.maxRange ? range : geometry.maxRange);
+    }
+}
+
+/**
+ * @brief Default constructor for the TestSafeNavigation class.
+ */
+TestSafeNavigation::TestSafeNavigation() {
+    cout << "[TestSafeNavigation] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestSafeNavigation class.
+ */
+TestSafeNavigation::~TestSafeNavigation() {
+    cout << "[TestSafeNavigation] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the SafeNavigation class.
+ */
+void TestSafeNavigation::runAllTests() {
+    cout << "\n================ Starting SafeNavigation Tests ================\n" << endl;
+
+    testEnvelope();
+    testIR();
+    testCommands();
+    benchmarkTick();
+
+    cout << "\n================ Ending SafeNavigation Tests ================\n" << endl;
+}
+
+/**
+ * @brief Compares the lidar envelopes with a point-in-corridor check on random scans.
+ *
+ * With robot radius 0.25 m, margin 0.05 m and stop distance 0.3 m, a direction is
+ * blocked by a beam end closer than 0.55 m along it and 0.3 m across it.
+ */
+void TestSafeNavigation::testEnvelope() {
+    cout << "--- Test: Lidar Envelope ---" << endl;
+
+    const int beams = 360;
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 8.0);
+    SafeNavigation navigation(nullptr, 0.25, 0.05, 0.3);
+    navigation.setLidarGeometry(geometry, beams);
+    double far[IRSensor::SENSOR_COUNT];
+    for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+        far[i] = 5.0;
+    }
+
+    int count = 0;
+    const SafeNavigation::BeamRun* runs = navigation.getRuns(FORWARD, count);
+    int beamsAhead = 0;
+    for (int r = 0; r < count; r++) {
+        beamsAhead += runs[r].end - runs[r].begin;
+    }
+    navigation.getRuns(BACKWARD, count);
+    cout << "Forward corridor uses the front half of the scan: " << (beamsAhead == beams / 2 - 1 && count >= 1 && count <= 2 ? "PASS" : "FAIL") << endl;
+
+    vector<float> ranges(beams);
+    wallScan(ranges, geometry, 0.0, 0.5);
+    navigation.update(far, ranges.data(), beams);
+    cout << "Wall 0.5 m ahead blocks forward only: " << (navigation.isBlocked(FORWARD) && !navigation.isBlocked(BACKWARD)
+        && !navigation.isBlocked(LEFT) && !navigation.isBlocked(RIGHT) ? "PASS" : "FAIL") << endl;
+    wallScan(ranges, geometry, 0.0, 0.6);
+    navigation.update(far, ranges.data(), beams);
+    cout << "Wall 0.6 m ahead is outside the stopping distance: " << (!navigation.isBlocked(FORWARD) ? "PASS" : "FAIL") << endl;
+    wallScan(ranges, geometry, PI / 2.0, 0.35);
+    navigation.update(far, ranges.data(), beams);
+    cout << "Wall 0.35 m to the left blocks left but not forward: " << (navigation.isBlocked(LEFT) && !navigation.isBlocked(FORWARD) ? "PASS" : "FAIL") << endl;
+
+    srand(13);
+    int mismatches = 0;
+    int blockedCount = 0;
+    for (int scan = 0; scan < 300; scan++) {
+        for (int i = 0; i < beams; i++) {
+            // A few close returns among far ones, and some invalid readings.
+            int kind = rand() % 100;
+            ranges[i] = kind == 0 ? 0.0f : kind == 1 ? -1.0f : kind == 2 ? numeric_limits<float>::quiet_NaN()
+                : kind == 3 ? static_cast<float>(rand() % 1000) / 1000.0f : 1.0f + static_cast<float>(rand() % 4000) / 1000.0f;
+        }
+        navigation.update(far, ranges.data(), beams);
+        for (int d = 0; d < SafeNavigation::DIRECTION_COUNT; d++) {
+            double direction = d == FORWARD ? 0.0 : d == BACKWARD ? PI : d == LEFT ? PI / 2.0 : -PI / 2.0;
+            bool inside = false;
+            for (int i = 0; i < beams; i++) {
+                double r = ranges[i];
+                if (!(r > 0.0)) {
+                    continue;
+                }
+                double angle = geometry.startAngle + i * geometry.angleIncrement - direction;
+                // A beam exactly abeam does not point into the corridor.
+                bool ahead = cos(angle) > 1e-9;
+                double x = r * cos(angle);
+                double y = r * sin(angle);
+                inside = inside || (ahead && x < 0.55 && fabs(y) < 0.3);
+            }
+            mismatches += inside != navigation.isBlocked(static_cast<DIRECTION>(d));
+            blockedCount += inside;
+        }
+    }
+    cout << "Blocked directions: " << blockedCount << " of 1200" << endl;
+    cout << "Envelopes match a point-in-corridor check: " << (mismatches == 0 && blockedCount > 0 && blockedCount < 1200 ? "PASS" : "FAIL") << endl;
+
+    navigation.update(far, ranges.data(), beams - 1);
+    cout << "A scan of the wrong size is not used: " << (!navigation.isBlocked(FORWARD) && !navigation.isBlocked(LEFT) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that a close IR sector blocks its direction only.
+ */
+void TestSafeNavigation::testIR() {
+    cout << "\n--- Test: IR Sectors ---" << endl;
+
+    SafeNavigation navigation(nullptr);
+    navigation.setIRThreshold(0.2f);
+    double ranges[IRSensor::SENSOR_COUNT];
+    for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+        ranges[i] = 1.0;
+    }
+    navigation.update(ranges, nullptr, 0);
+    cout << "Open space blocks nothing: " << (!navigation.isBlocked(FORWARD) && !navigation.isBlocked(BACKWARD)
+        && !navigation.isBlocked(LEFT) && !navigation.isBlocked(RIGHT) ? "PASS" : "FAIL") << endl;
+
+    // Sensor 8 is in the forward sector, sensor 5 in the backward one.
+    ranges[8] = 0.1;
+    navigation.update(ranges, nullptr, 0);
+    cout << "Close front sensor blocks forward only: " << (navigation.isBlocked(FORWARD) && !navigation.isBlocked(BACKWARD)
+        && !navigation.isBlocked(LEFT) && !navigation.isBlocked(RIGHT) ? "PASS" : "FAIL") << endl;
+    ranges[8] = 1.0;
+    ranges[5] = 0.15;
+    navigation.update(ranges, nullptr, 0);
+    cout << "Close rear sensor blocks backward only: " << (navigation.isBlocked(BACKWARD) && !navigation.isBlocked(FORWARD) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests veto, substitution and resending of commands through RobotControler.
+ */
+void TestSafeNavigation::testCommands() {
+    cout << "\n--- Test: Veto and Substitution ---" << endl;
+
+    RecordingRobotAPI api;
+    RobotControler rc(&api);
+    rc.connectRobot();
+    SafeNavigation navigation(&rc);
+    double ranges[IRSensor::SENSOR_COUNT];
+    for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+        ranges[i] = 1.0;
+    }
+
+    navigation.update(ranges, nullptr, 0);
+    navigation.move(FORWARD);
+    navigation.move(FORWARD);
+    cout << "Free move is sent once: " << (api.commands.size() == 1 && api.commands[0] == COMMAND_MOVE_FORWARD ? "PASS" : "FAIL") << endl;
+
+    ranges[0] = 0.1;
+    navigation.update(ranges, nullptr, 0);
+    RobotCommand running = navigation.move(FORWARD);
+    cout << "Obstacle ahead stops the moving robot: " << (running == COMMAND_STOP && api.commands.back() == COMMAND_STOP && navigation.getVetoCount() == 1 ? "PASS" : "FAIL") << endl;
+    running = navigation.tick(COMMAND_TURN_LEFT);
+    cout << "Turning in place is always allowed: " << (running == COMMAND_TURN_LEFT && api.commands.back() == COMMAND_TURN_LEFT ? "PASS" : "FAIL") << endl;
+
+    // Left sensors read 0.5 m, right sensors 0.9 m: the robot sidesteps to the right.
+    navigation.setSubstitution(true);
+    ranges[2] = 0.5;
+    ranges[3] = 0.5;
+    ranges[6] = 0.9;
+    ranges[7] = 0.9;
+    navigation.update(ranges, nullptr, 0);
+    running = navigation.move(FORWARD);
+    cout << "Blocked move is replaced by the clearer side: " << (running == COMMAND_MOVE_RIGHT && api.commands.back() == COMMAND_MOVE_RIGHT ? "PASS" : "FAIL") << endl;
+
+    ranges[6] = 0.1;
+    navigation.update(ranges, nullptr, 0);
+    running = navigation.move(FORWARD);
+    cout << "Only the free side is used: " << (running == COMMAND_MOVE_LEFT && navigation.getSubstitutionCount() == 2 ? "PASS" : "FAIL") << endl;
+
+    ranges[2] = 0.1;
+    navigation.update(ranges, nullptr, 0);
+    running = navigation.move(FORWARD);
+    cout << "Robot stops when no side is free: " << (running == COMMAND_STOP && api.commands.back() == COMMAND_STOP ? "PASS" : "FAIL") << endl;
+    cout << "Commands reached the API in order: " << (api.commands.size() == 6 && navigation.getTickCount() == 7 ? "PASS" : "FAIL") << endl;
+    rc.disconnectRobot();
+}
+
+/**
+ * @brief Measures the per-tick latency distribution and its worst case.
+ *
+ * Each tick loads 9 IR ranges and a 720-beam scan from a pool of 64 random scans,
+ * decides all four directions and filters a command, as the control loop would.
+ * Latencies depend on the load of the machine, so the budget is only reported.
+ */
+void TestSafeNavigation::benchmarkTick() {
+    cout << "\n--- Benchmark: Safety Tick Latency ---" << endl;
+
+    const int beams = 720;
+    const int ticks = 200000;
+    LidarGeometry geometry = LidarGeometry::fullCircle(beams, 8.0);
+    SafeNavigation navigation(nullptr);
+    navigation.setLidarGeometry(geometry, beams);
+    navigation.setSubstitution(true);
+
+    static float scans[64][beams];
+    static double irs[64][IRSensor::SENSOR_COUNT];
+    srand(21);
+    for (int s = 0; s < 64; s++) {
+        for (int i = 0; i < beams; i++) {
+            scans[s][i] = rand() % 200 == 0 ? static_cast<float>(rand() % 1000) / 1000.0f : 1.0f + static_cast<float>(rand() % 5000) / 1000.0f;
+        }
+        for (int i = 0; i < IRSensor::SENSOR_COUNT; i++) {
+            irs[s][i] = 0.15 + static_cast<double>(rand() % 1000) / 1000.0;
+        }
+    }
+
+    RobotCommand requests[4] = { COMMAND_MOVE_FORWARD, COMMAND_MOVE_LEFT, COMMAND_MOVE_FORWARD, COMMAND_TURN_RIGHT };
+    LatencyHistogram histogram;
+    int stops = 0;
+    for (int t = 0; t < ticks; t++) {
+        auto start = chrono::steady_clock::now();
+        navigation.update(irs[t & 63], scans[t & 63], beams);
+        RobotCommand command = navigation.tick(requests[t & 3]);
+        histogram.record(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+        stops += command == COMMAND_STOP;
+    }
+
+    histogram.print("safety tick (720 beams + 9 IR)");
+    cout << "Vetoed: " << navigation.getVetoCount() << ", substituted: " << navigation.getSubstitutionCount() << " of " << ticks << " ticks" << endl;
+    cout << "Worst-case tick: " << histogram.getMax() << " ns of a " << TICK_BUDGET_NS << " ns budget" << endl;
+    cout << "p99.9 tick: " << histogram.getPercentile(99.9) << " ns of a " << TICK_BUDGET_NS << " ns budget" << endl;
+    cout << "Blocked requests are stopped: " << (stops > 0 ? "PASS" : "FAIL") << endl;
+}
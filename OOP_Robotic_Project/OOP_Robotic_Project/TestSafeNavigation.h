@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file TestSafeNavigation.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestSafeNavigation class for testing the SafeNavigation class.
+ *
+ * This file contains the class declaration for testing the direction-dependent safety
+ * envelopes, the IR checks, the veto and substitution of commands, and for measuring
+ * the worst-case time of one safety tick.
+ */
+
+#include "SafeNavigation.h"
+
+ /**
+  * @class TestSafeNavigation
+  * @brief A class to test the functionality of the SafeNavigation class.
+  */
+class TestSafeNavigation {
+public:
+    /**
+     * @brief Default constructor for TestSafeNavigation.
+     */
+    TestSafeNavigation();
+
+    /**
+     * @brief Destructor for TestSafeNavigation.
+     */
+    ~TestSafeNavigation();
+
+    /**
+     * @brief Runs all test cases for the SafeNavigation class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Compares the lidar envelopes with a point-in-corridor check on random scans.
+     */
+    void testEnvelope();
+
+    /**
+     * @brief Tests that a close IR sector blocks its direction only.
+     */
+    void testIR();
+
+    /**
+     * @brief Tests veto, substitution and resending of commands through RobotControler.
+     */
+    void testCommands();
+
+    /**
+     * @brief Measures the per-tick latency distribution and its worst case.
+     */
+    void benchmarkTick();
+};
@@ -0,0 +1,362 @@
+/**
+ * @file TestScanMatcher.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestScanMatcher class for testing the ScanMatcher, Point
+ * and PointCloud classes.
+ */
+
+#include "TestScanMatcher.h"
+#include "SimulatedRobot.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Returns a random value in [low, high).
+ */
+static double uniform(double low, double high) {
+    return low + (high - low) * (rand() / (RAND_MAX + 1.0));
+}
+
+/**
+ * @brief Fills a world with a square room of the given side and count boxes and
+ * triangles inside.
+ */
+static void buildWorld(SimulationWorld& world, double size, int count, unsigned int seed) {
+    srand(seed);
+    double half = size / 2.0;
+    world.addBox(-half, -half, half, half);
+    for (int i = 0; i < count; i++) {
+        double cx = uniform(-half + 1.0, half - 1.0);
+        double cy = uniform(-half + 1.0, half - 1.0);
+        double r = uniform(0.2, 0.6);
+        if (i % 2 == 0) {
+            world.addBox(cx - r, cy - r * 0.5, cx + r, cy + r * 0.5);
+        }
+        else {
+            double a = uniform(0.0, 2.0 * PI);
+            double corners[6];
+            for (int k = 0; k < 3; k++) {
+                corners[2 * k] = cx + r * cos(a + k * 2.0 * PI / 3.0);
+                corners[2 * k + 1] = cy + r * sin(a + k * 2.0 * PI / 3.0);
+            }
+            world.addPolygon(corners, 3, true);
+        }
+    }
+    world.prepare();
+}
+
+/**
+ * @brief Casts a full-circle scan from a pose, with uniform range noise of +-noise.
+ */
+static void castScan(const SimulationWorld& world, const Pose& pose, int count, double noise, float* ranges) {
+    for (int i = 0; i < count; i++) {
+        double range = world.castRay(pose.getX(), pose.getY(), pose.getTh() - PI + i * (2.0 * PI / count), 10.0);
+        if (range < 10.0) {
+            range += uniform(-noise, noise);
+        }
+        ranges[i] = static_cast<float>(range);
+    }
+}
+
+/**
+ * @brief Returns a random pose of the world at least 0.5 m from every wall.
+ */
+static Pose freePose(const SimulationWorld& world, double half) {
+    while (true) {
+        Pose pose(uniform(-half, half), uniform(-half, half), uniform(-PI, PI));
+        if (!world.collides(pose.getX(), pose.getY(), 0.5)) {
+            return pose;
+        }
+    }
+}
+
+/**
+ * @brief Default constructor for the TestScanMatcher class.
+ */
+TestScanMatcher::TestScanMatcher() {
+    cout << "[TestScanMatcher] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestScanMatcher class.
+ */
+TestScanMatcher::~TestScanMatcher() {
+    cout << "[TestScanMatcher] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the ScanMatcher class.
+ */
+void TestScanMatcher::runAllTests() {
+    cout << "\n================ Starting ScanMatcher Tests ================\n" << endl;
+
+    testPointCloud();
+    testNearest();
+    testMatch();
+    testOdometry();
+    benchmarkMatch();
+
+    cout << "\n================ Ending ScanMatcher Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests Point, PointCloud and the pose composition helpers.
+ */
+void TestScanMatcher::testPointCloud() {
+    cout << "--- Test: Points and Poses ---" << endl;
+
+    Point a(3.0, 4.0);
+    cout << "Point distance: " << (a.findDistanceTo(Point()) == 5.0 && a.findSquaredDistanceTo(Point(3.0, 0.0)) == 16.0 ? "PASS" : "FAIL") << endl;
+
+    srand(3);
+    PointCloud cloud;
+    for (int i = 0; i < 1001; i++) {
+        cloud.append(uniform(-5.0, 5.0), uniform(-5.0, 5.0));
+    }
+    Pose frame(1.5, -2.0, 0.7);
+    PointCloud moved;
+    cloud.transform(frame, moved);
+    bool same = moved.size() == cloud.size();
+    for (int i = 0; i < cloud.size(); i++) {
+        Point expected = cloud.get(i).transformed(frame);
+        same &= fabs(moved.get(i).getX() - expected.getX()) < 1e-12 && fabs(moved.get(i).getY() - expected.getY()) < 1e-12;
+    }
+    cout << "Cloud transform matches Point::transformed: " << (same ? "PASS" : "FAIL") << endl;
+
+    PointCloud copy;
+    copy.copyFrom(moved);
+    PointCloud other;
+    other.swap(copy);
+    cout << "Copy and swap keep the points: " << (other.size() == 1001 && copy.size() == 0 && other.get(1000) == moved.get(1000) ? "PASS" : "FAIL") << endl;
+
+    Pose p(2.0, 1.0, 2.5);
+    Pose q(-1.0, 3.0, -2.9);
+    Pose back = ScanMatcher::compose(p, ScanMatcher::between(p, q));
+    cout << "compose(p, between(p, q)) is q: " << (fabs(back.getX() - q.getX()) < 1e-12 && fabs(back.getY() - q.getY()) < 1e-12
+        && fabs(back.getTh() - q.getTh()) < 1e-12 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares grid nearest neighbor search with testing every point.
+ *
+ * The reference is a scan of a cluttered room; the queries are random positions near
+ * the scan points and far from them.
+ */
+void TestScanMatcher::testNearest() {
+    cout << "\n--- Test: Grid Nearest Neighbor ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 20.0, 150, 5);
+    ScanMatcher matcher(0.3);
+    matcher.setLidarGeometry(LidarGeometry::fullCircle(1080), 1080);
+    vector<float> ranges(1080);
+    castScan(world, Pose(0.3, 0.2, 0.1), 1080, 0.01, ranges.data());
+    PointCloud reference;
+    matcher.toPoints(ranges.data(), reference);
+    matcher.setReference(reference);
+
+    int mismatches = 0;
+    int found = 0;
+    const int queries = 20000;
+    for (int q = 0; q < queries; q++) {
+        double x;
+        double y;
+        if (q % 2 == 0) {
+            Point near = reference.get(rand() % reference.size());
+            x = near.getX() + uniform(-0.4, 0.4);
+            y = near.getY() + uniform(-0.4, 0.4);
+        }
+        else {
+            x = uniform(-12.0, 12.0);
+            y = uniform(-12.0, 12.0);
+        }
+        double best = 0.3 * 0.3;
+        int expected = -1;
+        for (int i = 0; i < reference.size(); i++) {
+            double d = reference.get(i).findSquaredDistanceTo(Point(x, y));
+            if (d < best) {
+                best = d;
+                expected = i;
+            }
+        }
+        mismatches += matcher.findNearest(x, y) != expected;
+        found += expected >= 0;
+    }
+    cout << "Scan points: " << reference.size() << ", queries with a neighbor: " << found << " of " << queries << endl;
+    cout << "Grid finds the same neighbor as brute force: " << (mismatches == 0 && found > queries / 3 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that matching two scans recovers the motion between them.
+ *
+ * For 360 and 1080 beams, 100 pairs of poses up to 15 cm and 6 degrees apart are
+ * scanned with 1 cm of range noise and matched from the identity, as if there were no
+ * odometry at all. A match is good within 2 cm and 0.5 degrees.
+ */
+void TestScanMatcher::testMatch() {
+    cout << "\n--- Test: Scan Alignment ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 20.0, 150, 8);
+    for (int beams = 360; beams <= 1080; beams += 720) {
+        ScanMatcher matcher(0.3);
+        matcher.setLidarGeometry(LidarGeometry::fullCircle(beams), beams);
+        vector<float> ranges(beams);
+        PointCloud reference;
+        PointCloud source;
+        const int trials = 100;
+        int good = 0;
+        int failed = 0;
+        double sumError = 0.0;
+        for (int t = 0; t < trials; t++) {
+            Pose a = freePose(world, 9.0);
+            Pose motion(uniform(-0.15, 0.15), uniform(-0.1, 0.1), uniform(-6.0, 6.0) * PI / 180.0);
+            Pose b = ScanMatcher::compose(a, motion);
+            castScan(world, a, beams, 0.01, ranges.data());
+            matcher.toPoints(ranges.data(), reference);
+            castScan(world, b, beams, 0.01, ranges.data());
+            matcher.toPoints(ranges.data(), source);
+            matcher.setReference(reference);
+
+            Pose estimate;
+            if (!matcher.match(source, estimate)) {
+                failed++;
+                continue;
+            }
+            double error = hypot(estimate.getX() - motion.getX(), estimate.getY() - motion.getY());
+            sumError += error;
+            good += error < 0.02 && fabs(remainder(estimate.getTh() - motion.getTh(), 2.0 * PI)) < 0.5 * PI / 180.0;
+        }
+        cout << beams << " beams: " << good << " of " << trials << " good, " << failed << " failed, mean error "
+            << sumError / (trials - failed) * 1000.0 << " mm" << endl;
+        cout << "Matching recovers the motion between " << beams << "-beam scans: " << (good >= trials * 9 / 10 ? "PASS" : "FAIL") << endl;
+    }
+}
+
+/**
+ * @brief Tests that scan matching corrects drifting odometry along a path.
+ *
+ * A SimulatedRobot wanders for 60 simulated seconds with a 360-beam lidar read every
+ * 0.1 s, turning when its front IR sees a wall or when it bumps into one. The odometry
+ * overestimates distances and turns by 5 %, the way worn wheels do. Along the path the
+ * update() estimate must have less than half the position error of the odometry, and
+ * at the end less than a quarter of its heading error.
+ */
+void TestScanMatcher::testOdometry() {
+    cout << "\n--- Test: Odometry Correction ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 20.0, 150, 12);
+    SimulatedRobot robot(&world, 360);
+    srand(4);
+    Pose start = freePose(world, 8.0);
+    robot.setPose(start.getX(), start.getY(), start.getTh());
+    robot.connect();
+    robot.move(FORWARD);
+
+    ScanMatcher matcher(0.3);
+    matcher.setLidarGeometry(LidarGeometry::fullCircle(360), 360);
+    matcher.reset(start);
+    vector<float> ranges(360);
+    Pose truth = start;
+    Pose odometry = start;
+    double odometryError = 0.0;
+    double matchError = 0.0;
+    int scans = 0;
+    int turnSteps = 0;
+    unsigned long long collisions = 0;
+    for (int step = 0; step < 6000; step++) {
+        if (step % 10 == 0) {
+            double x;
+            double y;
+            double th;
+            robot.getXYTh(x, y, th);
+            Pose now(x, y, th);
+            Pose delta = ScanMatcher::between(truth, now);
+            odometry = ScanMatcher::compose(odometry, Pose(delta.getX() * 1.05, delta.getY() * 1.05, delta.getTh() * 1.05));
+            truth = now;
+            robot.getLidarRange(ranges.data());
+            for (int i = 0; i < 360; i++) {
+                ranges[i] += ranges[i] < 10.0f ? static_cast<float>(uniform(-0.01, 0.01)) : 0.0f;
+            }
+            Pose estimate = matcher.update(ranges.data(), odometry);
+            odometryError += odometry.findDistanceTo(truth);
+            matchError += estimate.findDistanceTo(truth);
+            scans++;
+        }
+        if (turnSteps > 0 && --turnSteps == 0) {
+            robot.move(FORWARD);
+        }
+        else if (turnSteps == 0 && (robot.getIRRange(0) < 0.5 || robot.getCollisionCount() != collisions)) {
+            robot.rotate(step % 3 == 0 ? LEFT : RIGHT);
+            turnSteps = 40 + step % 80;
+        }
+        collisions = robot.getCollisionCount();
+        robot.step();
+    }
+    odometryError /= scans;
+    matchError /= scans;
+    Pose estimate = matcher.getPose();
+    double odometryHeading = fabs(remainder(odometry.getTh() - truth.getTh(), 2.0 * PI)) * 180.0 / PI;
+    double matchHeading = fabs(remainder(estimate.getTh() - truth.getTh(), 2.0 * PI)) * 180.0 / PI;
+    cout << "Mean position error: odometry " << odometryError << " m, scan matching " << matchError << " m" << endl;
+    cout << "Final heading error: odometry " << odometryHeading << " deg, scan matching " << matchHeading
+        << " deg, odometry fallbacks: " << matcher.getFailureCount() << endl;
+    cout << "Scan matching removes most of the odometry drift: " << (matchError < odometryError / 2.0 && matchHeading < odometryHeading / 4.0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures scan matches per second for 360- and 1080-beam scans.
+ *
+ * A match is the work of one update(): converting the scan to points, matching it from
+ * an odometry guess 5 cm and 2 degrees off, and building the next reference. A single
+ * core should keep up with a 40 Hz lidar with time to spare; the rate depends on the
+ * load of the machine, so it is only reported, and every match has to converge.
+ */
+void TestScanMatcher::benchmarkMatch() {
+    cout << "\n--- Benchmark: Scan Matches per Second ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildWorld(world, 20.0, 150, 8);
+    for (int beams = 360; beams <= 1080; beams += 720) {
+        const int pairs = 200;
+        vector<vector<float>> scans(2 * pairs, vector<float>(beams));
+        vector<Pose> guesses(pairs);
+        for (int p = 0; p < pairs; p++) {
+            Pose a = freePose(world, 9.0);
+            Pose motion(uniform(-0.1, 0.1), uniform(-0.05, 0.05), uniform(-4.0, 4.0) * PI / 180.0);
+            castScan(world, a, beams, 0.01, scans[2 * p].data());
+            castScan(world, ScanMatcher::compose(a, motion), beams, 0.01, scans[2 * p + 1].data());
+            guesses[p] = Pose(motion.getX() + 0.05, motion.getY() - 0.03, motion.getTh() + 2.0 * PI / 180.0);
+        }
+
+        ScanMatcher matcher(0.3);
+        matcher.setLidarGeometry(LidarGeometry::fullCircle(beams), beams);
+        PointCloud reference;
+        PointCloud source;
+        int iterations = 0;
+        int matched = 0;
+        auto start = chrono::steady_clock::now();
+        for (int p = 0; p < pairs; p++) {
+            matcher.toPoints(scans[2 * p].data(), reference);
+            matcher.setReference(reference);
+            matcher.toPoints(scans[2 * p + 1].data(), source);
+            Pose estimate = guesses[p];
+            matched += matcher.match(source, estimate);
+            iterations += matcher.getIterationCount();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        double rate = pairs / seconds;
+        cout << beams << " beams: " << rate << " matches per second, " << seconds / pairs * 1e6 << " us per match, "
+            << static_cast<double>(iterations) / pairs << " iterations on average, " << matched << " of " << pairs << " matched" << endl;
+        cout << "Every " << beams << "-beam pair matches: " << (matched == pairs ? "PASS" : "FAIL") << endl;
+    }
+}
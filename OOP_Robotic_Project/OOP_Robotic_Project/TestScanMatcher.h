@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file TestScanMatcher.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestScanMatcher class for testing the ScanMatcher, Point and
+ * PointCloud classes.
+ *
+ * This file contains the class declaration for testing point clouds, grid nearest
+ * neighbor search, scan alignment and odometry correction, and for measuring scan
+ * matches per second.
+ */
+
+#include "ScanMatcher.h"
+
+ /**
+  * @class TestScanMatcher
+  * @brief A class to test the functionality of the ScanMatcher class.
+  */
+class TestScanMatcher {
+public:
+    /**
+     * @brief Default constructor for TestScanMatcher.
+     */
+    TestScanMatcher();
+
+    /**
+     * @brief Destructor for TestScanMatcher.
+     */
+    ~TestScanMatcher();
+
+    /**
+     * @brief Runs all test cases for the ScanMatcher class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests Point, PointCloud and the pose composition helpers.
+     */
+    void testPointCloud();
+
+    /**
+     * @brief Compares grid nearest neighbor search with testing every point.
+     */
+    void testNearest();
+
+    /**
+     * @brief Tests that matching two scans recovers the motion between them.
+     */
+    void testMatch();
+
+    /**
+     * @brief Tests that scan matching corrects drifting odometry along a path.
+     */
+    void testOdometry();
+
+    /**
+     * @brief Measures scan matches per second for 360- and 1080-beam scans.
+     */
+    void benchmarkMatch();
+};
@@ -0,0 +1,161 @@
+/**
+ * @file TestSensorPipeline.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestSensorPipeline class for testing the SensorPipeline class.
+ */
+
+#include "TestSensorPipeline.h"
+#include "LatencyHistogram.h"
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+/**
+ * @brief Simulated robot API whose pose advances on every getXYTh call.
+ */
+class SimulatedSensorAPI : public RobotInterface {
+private:
+    double x;
+
+public:
+    SimulatedSensorAPI() : x(0) {}
+    void connect() override {}
+    void disconnect() override {}
+    void move(DIRECTION) override {}
+    void rotate(DIRECTION) override {}
+    void stop() override {}
+    double getIRRange(int i) override { return 0.1 * (i + 1); }
+    void getXYTh(double& X, double& Y, double& TH) override { x += 0.001; X = x; Y = 2.0; TH = 0.5; }
+    void getLidarRange(float* ranges) override {
+        for (int i = 0; i < 720; i++) {
+            ranges[i] = 4.0f;
+        }
+    }
+    int getLidarRangeNumber() override { return 720; }
+};
+
+/**
+ * @brief Default constructor for the TestSensorPipeline class.
+ */
+TestSensorPipeline::TestSensorPipeline() {
+    cout << "[TestSensorPipeline] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestSensorPipeline class.
+ */
+TestSensorPipeline::~TestSensorPipeline() {
+    cout << "[TestSensorPipeline] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the SensorPipeline class.
+ */
+void TestSensorPipeline::runAllTests() {
+    cout << "\n================ Starting SensorPipeline Tests ================\n" << endl;
+
+    testRing();
+    testSnapshots();
+    benchmarkLatency();
+
+    cout << "\n================ Ending SensorPipeline Tests ================\n" << endl;
+}
+
+/**
+ * @brief Tests ordering, full and empty behaviour of SpscRing.
+ */
+void TestSensorPipeline::testRing() {
+    cout << "--- Test: SPSC Ring ---" << endl;
+
+    SpscRing<int, 4> ring;
+    int value = 0;
+    cout << "Empty ring pops nothing: " << (!ring.tryPop(value) ? "PASS" : "FAIL") << endl;
+
+    bool pushed = true;
+    for (int i = 1; i <= 4; i++) {
+        pushed = pushed && ring.tryPush(i);
+    }
+    cout << "Ring accepts capacity elements: " << (pushed ? "PASS" : "FAIL") << endl;
+    cout << "Full ring rejects push: " << (!ring.tryPush(5) ? "PASS" : "FAIL") << endl;
+
+    bool ordered = ring.tryPop(value) && value == 1 && ring.tryPop(value) && value == 2;
+    cout << "Elements come out in order: " << (ordered ? "PASS" : "FAIL") << endl;
+
+    ring.tryPush(5);
+    int* newest = ring.latest();
+    bool latest = newest != nullptr && *newest == 5 && ring.size() == 1;
+    ring.pop();
+    cout << "latest() skips to the newest element: " << (latest && ring.size() == 0 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests that snapshots arrive in order with the simulated sensor values.
+ */
+void TestSensorPipeline::testSnapshots() {
+    cout << "\n--- Test: Sensor Snapshots ---" << endl;
+
+    SimulatedSensorAPI api;
+    SensorPipeline pipeline(&api, 1000);
+    pipeline.start();
+
+    int received = 0;
+    bool ordered = true;
+    bool values = true;
+    unsigned long long lastSequence = 0;
+    auto deadline = chrono::steady_clock::now() + chrono::seconds(2);
+    while (received < 20 && chrono::steady_clock::now() < deadline) {
+        const SensorSnapshot* snapshot = pipeline.next();
+        if (snapshot == nullptr) {
+            this_thread::yield();
+            continue;
+        }
+        if (received > 0 && snapshot->sequence <= lastSequence) {
+            ordered = false;
+        }
+        if (snapshot->y != 2.0 || snapshot->ir[8] != 0.1 * 9 || snapshot->lidarCount != 720 || snapshot->lidar[719] != 4.0f) {
+            values = false;
+        }
+        lastSequence = snapshot->sequence;
+        received++;
+        pipeline.release();
+    }
+    pipeline.stop();
+
+    cout << "Received 20 snapshots: " << (received == 20 ? "PASS" : "FAIL") << endl;
+    cout << "Snapshots arrive in order: " << (ordered ? "PASS" : "FAIL") << endl;
+    cout << "Snapshots hold the sensor values: " << (values ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures publish-to-consume latency and prints a histogram.
+ *
+ * The acquisition thread publishes every 200 microseconds and the consumer polls
+ * latest() without blocking, yielding between polls as a control loop would.
+ */
+void TestSensorPipeline::benchmarkLatency() {
+    cout << "\n--- Benchmark: Publish-to-Consume Latency ---" << endl;
+
+    SimulatedSensorAPI api;
+    SensorPipeline pipeline(&api, 200);
+    LatencyHistogram histogram;
+    pipeline.start();
+
+    auto end = chrono::steady_clock::now() + chrono::milliseconds(500);
+    while (chrono::steady_clock::now() < end) {
+        const SensorSnapshot* snapshot = pipeline.latest();
+        if (snapshot == nullptr) {
+            this_thread::yield();
+            continue;
+        }
+        histogram.record(SensorPipeline::nowNs() - snapshot->timestampNs);
+        pipeline.release();
+    }
+    pipeline.stop();
+
+    histogram.print("publish-to-consume");
+    cout << "Published: " << pipeline.getPublishedCount() << ", dropped (ring full): "
+        << pipeline.getDroppedCount() << endl;
+}
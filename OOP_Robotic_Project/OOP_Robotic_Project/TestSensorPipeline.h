@@ -0,0 +1,53 @@
+#pragma once
+
+/**
+ * @file TestSensorPipeline.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestSensorPipeline class for testing the SensorPipeline class.
+ *
+ * This file contains the class declaration for testing the SPSC ring and the sensor
+ * acquisition thread, and for measuring publish-to-consume latency.
+ */
+
+#include "SensorPipeline.h"
+
+ /**
+  * @class TestSensorPipeline
+  * @brief A class to test the functionality of the SensorPipeline class.
+  *
+  * The tests run against a simulated robot API, so no simulator is needed.
+  */
+class TestSensorPipeline {
+public:
+    /**
+     * @brief Default constructor for TestSensorPipeline.
+     */
+    TestSensorPipeline();
+
+    /**
+     * @brief Destructor for TestSensorPipeline.
+     */
+    ~TestSensorPipeline();
+
+    /**
+     * @brief Runs all test cases for the SensorPipeline class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Tests ordering, full and empty behaviour of SpscRing.
+     */
+    void testRing();
+
+    /**
+     * @brief Tests that snapshots arrive in order with the simulated sensor values.
+     */
+    void testSnapshots();
+
+    /**
+     * @brief Measures publish-to-consume latency and prints a histogram.
+     */
+    void benchmarkLatency();
+};
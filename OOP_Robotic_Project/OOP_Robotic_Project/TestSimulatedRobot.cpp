@@ -0,0 +1,302 @@
+/**
+ * @file TestSimulatedRobot.cpp
+ * @date October, 2026
+ *
+ * @brief Implementation of the TestSimulatedRobot class for testing the SimulatedRobot and
+ * SimulationWorld classes.
+ */
+
+#include "TestSimulatedRobot.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+static const double PI = 3.14159265358979323846;
+
+/**
+ * @brief Returns a random value in [low, high).
+ */
+static double uniform(double low, double high) {
+    return low + (high - low) * (rand() / (RAND_MAX + 1.0));
+}
+
+/**
+ * @brief Fills a world with a square room of the given side and count obstacles inside:
+ * axis-aligned boxes and rotated triangles, so walls of every slope are present.
+ */
+static void buildClutter(SimulationWorld& world, double size, int count, unsigned int seed) {
+    srand(seed);
+    double half = size / 2.0;
+    world.addBox(-half, -half, half, half);
+    for (int i = 0; i < count; i++) {
+        double cx = uniform(-half + 1.0, half - 1.0);
+        double cy = uniform(-half + 1.0, half - 1.0);
+        double r = uniform(0.1, 0.5);
+        if (i % 2 == 0) {
+            world.addBox(cx - r, cy - r * 0.6, cx + r, cy + r * 0.6);
+        }
+        else {
+            double a = uniform(0.0, 2.0 * PI);
+            double corners[6];
+            for (int k = 0; k < 3; k++) {
+                corners[2 * k] = cx + r * cos(a + k * 2.0 * PI / 3.0);
+                corners[2 * k + 1] = cy + r * sin(a + k * 2.0 * PI / 3.0);
+            }
+            world.addPolygon(corners, 3, true);
+        }
+    }
+    world.prepare();
+}
+
+/**
+ * @brief Default constructor for the TestSimulatedRobot class.
+ */
+TestSimulatedRobot::TestSimulatedRobot() {
+    cout << "[TestSimulatedRobot] Test class created." << endl;
+}
+
+/**
+ * @brief Destructor for the TestSimulatedRobot class.
+ */
+TestSimulatedRobot::~TestSimulatedRobot() {
+    cout << "[TestSimulatedRobot] Test class destroyed." << endl;
+}
+
+/**
+ * @brief Runs all test cases for the SimulatedRobot class.
+ */
+void TestSimulatedRobot::runAllTests() {
+    cout << "\n================ Starting SimulatedRobot Tests ================\n" << endl;
+
+    testRays();
+    testMotion();
+    testSensors();
+    benchmarkLidar();
+    benchmarkSimulation();
+
+    cout << "\n================ Ending SimulatedRobot Tests ================\n" << endl;
+}
+
+/**
+ * @brief Compares grid ray casting with testing every segment.
+ *
+ * Rays start inside and outside the world, along the axes and at random angles, and
+ * use several maximum ranges.
+ */
+void TestSimulatedRobot::testRays() {
+    cout << "--- Test: Grid Ray Casting ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildClutter(world, 20.0, 300, 7);
+    int mismatches = 0;
+    int hits = 0;
+    const int rays = 20000;
+    for (int i = 0; i < rays; i++) {
+        double x = uniform(-12.0, 12.0);
+        double y = uniform(-12.0, 12.0);
+        double angle = i % 8 == 0 ? (i / 8 % 4) * PI / 2.0 : uniform(-PI, PI);
+        double maxRange = i % 3 == 0 ? 2.0 : 30.0;
+        double grid = world.castRay(x, y, angle, maxRange);
+        double brute = world.castRayBruteForce(x, y, angle, maxRange);
+        mismatches += fabs(grid - brute) > 1e-9;
+        hits += brute < maxRange;
+    }
+    cout << "Grid cell: " << world.getCellSize() << " m, segments: " << world.getSegments().size() << ", rays hitting a wall: " << hits << " of " << rays << endl;
+    cout << "Grid ranges equal brute force ranges: " << (mismatches == 0 && hits > rays / 2 ? "PASS" : "FAIL") << endl;
+
+    SimulationWorld empty;
+    cout << "Empty world returns the maximum range: " << (empty.castRay(0, 0, 1.0, 5.0) == 5.0 && !empty.collides(0, 0, 1.0) ? "PASS" : "FAIL") << endl;
+
+    SimulationWorld wall(0.5);
+    wall.addSegment(1.0, -1.0, 1.0, 1.0);
+    cout << "Collision uses the disc radius: " << (wall.collides(0.85, 0.0, 0.2) && !wall.collides(0.75, 0.0, 0.2) ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Tests motion, rotation and wall collisions in simulated time.
+ *
+ * The room is 4 m wide and the robot moves at 0.2 m/s and turns at 0.5 rad/s.
+ */
+void TestSimulatedRobot::testMotion() {
+    cout << "\n--- Test: Kinematics and Collisions ---" << endl;
+
+    SimulatedRobot robot(4.0);
+    double x = 0.0;
+    double y = 0.0;
+    double th = 0.0;
+    robot.move(FORWARD);
+    robot.run(1.0);
+    robot.getXYTh(x, y, th);
+    cout << "Disconnected robot does not move: " << (x == 0.0 && y == 0.0 ? "PASS" : "FAIL") << endl;
+
+    robot.connect();
+    robot.move(FORWARD);
+    robot.run(3.0);
+    robot.getXYTh(x, y, th);
+    cout << "Forward for 3 s moves 0.6 m: " << (fabs(x - 0.6) < 1e-9 && fabs(y) < 1e-9 ? "PASS" : "FAIL") << endl;
+
+    robot.rotate(LEFT);
+    robot.run(PI);
+    robot.move(FORWARD);
+    robot.run(1.0);
+    robot.getXYTh(x, y, th);
+    cout << "Quarter turn left then forward moves along +y: " << (fabs(th - PI / 2.0) < 1e-2 && fabs(x - 0.6) < 1e-2 && fabs(y - 0.2) < 1e-2 ? "PASS" : "FAIL") << endl;
+
+    robot.move(RIGHT);
+    robot.run(1.0);
+    robot.getXYTh(x, y, th);
+    cout << "Moving right of a +y heading moves along +x: " << (fabs(x - 0.8) < 1e-2 && fabs(y - 0.2) < 1e-2 ? "PASS" : "FAIL") << endl;
+
+    robot.setPose(0.0, 0.0, 0.0);
+    robot.move(FORWARD);
+    robot.run(20.0);
+    robot.getXYTh(x, y, th);
+    cout << "Wall stops the robot at its radius: " << (x <= 1.8 + 1e-9 && x > 1.8 - 0.2 * SimulatedRobot::DEFAULT_TIME_STEP - 1e-9
+        && robot.getCollisionCount() > 0 ? "PASS" : "FAIL") << endl;
+    cout << "Simulated time: " << robot.getTime() << " s" << endl;
+}
+
+/**
+ * @brief Tests the IR and lidar ranges in a known room.
+ */
+void TestSimulatedRobot::testSensors() {
+    cout << "\n--- Test: Sensors ---" << endl;
+
+    SimulatedRobot robot(4.0, 8);
+    robot.setPose(1.5, 0.0, 0.0);
+    double front = robot.getIRRange(0);
+    double left = robot.getIRRange(2);
+    cout << "Front IR sees the wall 0.5 m away: " << (fabs(front - 0.5) < 1e-9 ? "PASS" : "FAIL") << endl;
+    cout << "IR is limited to its maximum range: " << (left == SimulatedRobot::IR_MAX_RANGE && robot.getIRRange(9) == SimulatedRobot::IR_MAX_RANGE ? "PASS" : "FAIL") << endl;
+
+    // Eight beams, 45 degrees apart: beam 0 points backwards, beam 4 forwards, beam 6 to the left.
+    float ranges[8];
+    robot.getLidarRange(ranges);
+    cout << "Lidar beams follow the full circle geometry: " << (robot.getLidarRangeNumber() == 8 && fabs(ranges[0] - 3.5f) < 1e-5f
+        && fabs(ranges[4] - 0.5f) < 1e-5f && fabs(ranges[6] - 2.0f) < 1e-5f ? "PASS" : "FAIL") << endl;
+
+    robot.setPose(1.5, 0.0, PI / 2.0);
+    robot.getLidarRange(ranges);
+    cout << "Lidar turns with the robot: " << (fabs(ranges[4] - 2.0f) < 1e-5f && fabs(ranges[2] - 0.5f) < 1e-5f ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Compares the time of a lidar scan with and without the grid.
+ *
+ * 1080 beams in a 50 m room with 2000 obstacles (about 7000 walls). The times are
+ * only reported; the grid scan must return the same ranges as the brute force one.
+ */
+void TestSimulatedRobot::benchmarkLidar() {
+    cout << "\n--- Benchmark: Lidar Scan Ray Casting ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildClutter(world, 50.0, 2000, 11);
+    const int beams = 1080;
+    const int scans = 200;
+    vector<double> poses(3 * scans);
+    for (int s = 0; s < scans; s++) {
+        poses[3 * s] = uniform(-24.0, 24.0);
+        poses[3 * s + 1] = uniform(-24.0, 24.0);
+        poses[3 * s + 2] = uniform(-PI, PI);
+    }
+
+    double sum = 0.0;
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < scans; s++) {
+        for (int i = 0; i < beams; i++) {
+            sum += world.castRay(poses[3 * s], poses[3 * s + 1], poses[3 * s + 2] - PI + i * (2.0 * PI / beams), 10.0);
+        }
+    }
+    double gridUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / scans;
+
+    const int bruteScans = 5;
+    double bruteSum = 0.0;
+    double check = 0.0;
+    start = chrono::steady_clock::now();
+    for (int s = 0; s < bruteScans; s++) {
+        for (int i = 0; i < beams; i++) {
+            bruteSum += world.castRayBruteForce(poses[3 * s], poses[3 * s + 1], poses[3 * s + 2] - PI + i * (2.0 * PI / beams), 10.0);
+        }
+    }
+    double bruteUs = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / bruteScans;
+    for (int s = 0; s < bruteScans; s++) {
+        for (int i = 0; i < beams; i++) {
+            check += world.castRay(poses[3 * s], poses[3 * s + 1], poses[3 * s + 2] - PI + i * (2.0 * PI / beams), 10.0);
+        }
+    }
+
+    cout << "Walls: " << world.getSegments().size() << ", beams per scan: " << beams << " (checksum " << sum / scans << ")" << endl;
+    cout << "Uniform grid: " << gridUs << " us per scan" << endl;
+    cout << "All segments: " << bruteUs << " us per scan" << endl;
+    cout << "Speedup: " << bruteUs / gridUs << "x" << endl;
+    cout << "Grid scan equals the brute force scan: " << (fabs(check - bruteSum) < 1e-6 ? "PASS" : "FAIL") << endl;
+}
+
+/**
+ * @brief Measures simulated seconds per wall second with sensors read at robot rates.
+ *
+ * The robot wanders through the cluttered room: each 10 ms step reads the 9 IR ranges,
+ * every tenth step reads a 360-beam scan, and the robot turns away when the front IR
+ * sees a wall or backs off when it bumps into one, so collisions and ray queries both
+ * happen. The speed depends on the load of the machine and is only reported.
+ */
+void TestSimulatedRobot::benchmarkSimulation() {
+    cout << "\n--- Benchmark: Simulation Speed ---" << endl;
+
+    SimulationWorld world(0.5);
+    buildClutter(world, 20.0, 200, 3);
+    SimulatedRobot robot(&world, 360);
+    robot.setPose(0.0, 0.0, 0.0);
+    robot.connect();
+    vector<float> scan(360);
+    const int steps = 100000;
+    double ir[SimulatedRobot::IR_COUNT];
+    int turnSteps = 0;
+    unsigned long long collisions = 0;
+
+    auto start = chrono::steady_clock::now();
+    robot.move(FORWARD);
+    for (int s = 0; s < steps; s++) {
+        for (int i = 0; i < SimulatedRobot::IR_COUNT; i++) {
+            ir[i] = robot.getIRRange(i);
+        }
+        if (s % 10 == 0) {
+            robot.getLidarRange(scan.data());
+        }
+        bool bumped = robot.getCollisionCount() != collisions;
+        collisions = robot.getCollisionCount();
+        if (turnSteps > 0) {
+            if (--turnSteps == 0) {
+                robot.move(FORWARD);
+            }
+        }
+        else if (bumped || ir[0] < 0.35 || ir[1] < 0.3 || ir[8] < 0.3) {
+            // Turn away for 0.3 to 1.5 s; a bumped robot backs off instead.
+            turnSteps = 30 + s % 120;
+            if (bumped) {
+                robot.move(BACKWARD);
+            }
+            else {
+                robot.rotate(s % 2 == 0 ? RIGHT : LEFT);
+            }
+        }
+        else if (s % 500 == 250) {
+            robot.rotate(LEFT);
+            turnSteps = 20;
+        }
+        robot.step();
+    }
+    double wall = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    double simulated = robot.getTime();
+
+    double x = 0.0;
+    double y = 0.0;
+    double th = 0.0;
+    robot.getXYTh(x, y, th);
+    cout << "Simulated " << simulated << " s in " << wall * 1000.0 << " ms wall time: " << simulated / wall << " simulated seconds per second" << endl;
+    cout << "Final pose: (" << x << ", " << y << "), collisions: " << robot.getCollisionCount() << endl;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file TestSimulatedRobot.h
+ * @date October, 2026
+ *
+ * @brief Declaration of the TestSimulatedRobot class for testing the SimulatedRobot and
+ * SimulationWorld classes.
+ *
+ * This file contains the class declaration for testing grid ray casting against a brute
+ * force reference, robot kinematics and collisions in simulated time, and for measuring
+ * the speed of lidar scans and of the simulation.
+ */
+
+#include "SimulatedRobot.h"
+
+ /**
+  * @class TestSimulatedRobot
+  * @brief A class to test the functionality of the SimulatedRobot class.
+  */
+class TestSimulatedRobot {
+public:
+    /**
+     * @brief Default constructor for TestSimulatedRobot.
+     */
+    TestSimulatedRobot();
+
+    /**
+     * @brief Destructor for TestSimulatedRobot.
+     */
+    ~TestSimulatedRobot();
+
+    /**
+     * @brief Runs all test cases for the SimulatedRobot class.
+     */
+    void runAllTests();
+
+private:
+    /**
+     * @brief Compares grid ray casting with testing every segment.
+     */
+    void testRays();
+
+    /**
+     * @brief Tests motion, rotation and wall collisions in simulated time.
+     */
+    void testMotion();
+
+    /**
+     * @brief Tests the IR and lidar ranges in a known room.
+     */
+    void testSensors();
+
+    /**
+     * @brief Compares the time of a lidar scan with and without the grid.
+     */
+    void benchmarkLidar();
+
+    /**
+     * @brief Measures simulated seconds per wall second with sensors read at robot rates.
+     */
+    void benchmarkSimulation();
+};
@@ -0,0 +1,179 @@
+/**
+ * @file   WorkStealingPool.cpp
+ * @date   October, 2026
+ * @brief  Implementation of the WorkStealingPool class.
+ */
+
+#include <algorithm>
+#include "WorkStealingPool.h"
+
+using namespace std;
+
+/**
+ * @brief Parameterized Constructor. Starts the worker threads, which sleep until the
+ * first parallelFor().
+ */
+WorkStealingPool::WorkStealingPool(int threadCount)
+    : generation(0), quitting(false), body(nullptr), pending(0) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(thread::hardware_concurrency());
+    }
+    this->threadCount = max(threadCount, 1);
+    for (int i = 0; i < this->threadCount; i++) {
+        unique_ptr<WorkerQueue> queue(new WorkerQueue());
+        queue->front = 0;
+        queue->back = 0;
+        queue->executed = 0;
+        queue->stolen = 0;
+        this->queues.push_back(move(queue));
+    }
+    for (int i = 1; i < this->threadCount; i++) {
+        this->threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief Destructor. Wakes the workers to quit and joins them.
+ */
+WorkStealingPool::~WorkStealingPool() {
+    {
+        lock_guard<mutex> guard(this->wakeLock);
+        this->quitting = true;
+    }
+    this->wake.notify_all();
+    for (thread& worker : this->threads) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Takes the front chunk of the worker's own queue, or else the back chunk of the
+ * first other queue that has one, starting with the next worker.
+ */
+bool WorkStealingPool::take(int worker, Chunk& chunk) {
+    WorkerQueue& own = *this->queues[worker];
+    {
+        lock_guard<mutex> guard(own.lock);
+        if (own.front < own.back) {
+            chunk = own.chunks[own.front++];
+            return true;
+        }
+    }
+    for (int i = 1; i < this->threadCount; i++) {
+        WorkerQueue& victim = *this->queues[(worker + i) % this->threadCount];
+        lock_guard<mutex> guard(victim.lock);
+        if (victim.front < victim.back) {
+            chunk = victim.chunks[--victim.back];
+            own.stolen++;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Runs chunks until the pending count of the current loop reaches zero.
+ *
+ * A worker that finds every queue empty yields until the chunks that others are still
+ * running are finished.
+ */
+void WorkStealingPool::work(int worker) {
+    WorkerQueue& own = *this->queues[worker];
+    Chunk chunk;
+    while (this->pending.load(memory_order_acquire) > 0) {
+        if (take(worker, chunk)) {
+            (*this->body)(chunk.begin, chunk.end);
+            own.executed++;
+            this->pending.fetch_sub(1, memory_order_acq_rel);
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Sleeps until a loop starts, helps with it, and sleeps again until shutdown.
+ */
+void WorkStealingPool::workerLoop(int worker) {
+    unsigned long long seen = 0;
+    while (true) {
+        {
+            unique_lock<mutex> guard(this->wakeLock);
+            this->wake.wait(guard, [this, seen] { return this->quitting || this->generation.load() != seen; });
+            if (this->quitting) {
+                return;
+            }
+            seen = this->generation.load();
+        }
+        work(worker);
+    }
+}
+
+/**
+ * @brief Runs a parallel loop.
+ *
+ * Worker w gets chunks w * chunkCount / threadCount up to (w + 1) * chunkCount /
+ * threadCount. The pending count is set before any chunk is queued, so a worker still
+ * busy with the end of the previous loop cannot finish the new one early.
+ */
+void WorkStealingPool::parallelFor(int count, int grain, const RangeBody& body) {
+    if (count <= 0) {
+        return;
+    }
+    grain = max(grain, 1);
+    int chunkCount = (count - 1) / grain + 1;
+    if (this->threadCount == 1 || chunkCount == 1) {
+        for (int begin = 0; begin < count; begin += grain) {
+            body(begin, min(begin + grain, count));
+            this->queues[0]->executed++;
+        }
+        return;
+    }
+
+    this->body = &body;
+    this->pending.store(chunkCount, memory_order_release);
+    for (int w = 0; w < this->threadCount; w++) {
+        WorkerQueue& queue = *this->queues[w];
+        int first = static_cast<int>(static_cast<long long>(chunkCount) * w / this->threadCount);
+        int last = static_cast<int>(static_cast<long long>(chunkCount) * (w + 1) / this->threadCount);
+        lock_guard<mutex> guard(queue.lock);
+        queue.chunks.clear();
+        for (int c = first; c < last; c++) {
+            Chunk chunk;
+            chunk.begin = c * grain;
+            chunk.end = min(chunk.begin + grain, count);
+            queue.chunks.push_back(chunk);
+        }
+        queue.front = 0;
+        queue.back = queue.chunks.size();
+    }
+    {
+        lock_guard<mutex> guard(this->wakeLock);
+        this->generation.fetch_add(1);
+    }
+    this->wake.notify_all();
+    work(0);
+}
+
+int WorkStealingPool::getThreadCount() const {
+    return this->threadCount;
+}
+
+/**
+ * @brief Returns the chunks run by a worker, 0 for an invalid worker.
+ */
+unsigned long long WorkStealingPool::getExecutedCount(int worker) const {
+    if (worker < 0 || worker >= this->threadCount) {
+        return 0;
+    }
+    return this->queues[worker]->executed;
+}
+
+unsigned long long WorkStealingPool::getStealCount() const {
+    unsigned long long total = 0;
+    for (const unique_ptr<WorkerQueue>& queue : this->queues) {
+        total += queue->stolen;
+    }
+    return total;
+}
@@ -0,0 +1,135 @@
+#pragma once
+/**
+ * @file   WorkStealingPool.h
+ * @date   October, 2026
+ * @brief  Header file for the WorkStealingPool class.
+ *
+ * This file contains the definition of the WorkStealingPool class, a fixed set of
+ * worker threads that run the chunks of a parallel loop and steal chunks from each
+ * other when their own run out.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//! WorkStealingPool class
+/*!
+ * @brief Runs parallel loops over an index range on a fixed set of threads.
+ *
+ * parallelFor() cuts [0, count) into chunks of grain indices and gives every worker a
+ * contiguous block of chunks, so the same worker gets the same indices on every call
+ * and finds their data in its cache. A worker takes chunks from the front of its own
+ * queue; once it is empty it steals from the back of another worker's queue, where
+ * the chunks its owner would reach last are. Uneven chunks therefore end up spread
+ * over the workers without a central queue that every worker contends for.
+ *
+ * The calling thread is worker 0 and runs chunks too, so a pool of one thread runs
+ * everything inline. Between calls the other workers sleep on a condition variable.
+ * Only one thread may call parallelFor() at a time, and the body must not call it.
+ */
+class WorkStealingPool {
+public:
+    //! RangeBody type
+    /*!
+     * Body of a parallel loop, called with the indices begin..end-1 of one chunk.
+     */
+    typedef std::function<void(int begin, int end)> RangeBody;
+
+private:
+    //! Chunk struct
+    /*!
+     * @brief Indices begin..end-1 of a parallel loop.
+     */
+    struct Chunk {
+        int begin; /*!< First index. */
+        int end;   /*!< One past the last index. */
+    };
+
+    //! WorkerQueue struct
+    /*!
+     * @brief Chunks and counters of one worker, on cache lines of its own.
+     */
+    struct alignas(64) WorkerQueue {
+        std::mutex lock;            /*!< Guards chunks, front and back. */
+        std::vector<Chunk> chunks;  /*!< Chunks of the current loop. */
+        size_t front;               /*!< Next chunk the owner takes. */
+        size_t back;                /*!< One past the next chunk a thief takes. */
+        unsigned long long executed; /*!< Chunks run by this worker. */
+        unsigned long long stolen;  /*!< Chunks this worker took from other queues. */
+    };
+
+    int threadCount;               /*!< Workers, the calling thread included. */
+    std::vector<std::unique_ptr<WorkerQueue>> queues; /*!< One queue per worker. */
+    std::vector<std::thread> threads; /*!< Workers 1..threadCount-1. */
+    std::mutex wakeLock;           /*!< Guards generation and quitting for the condition variable. */
+    std::condition_variable wake;  /*!< Signals a new loop or shutdown to the workers. */
+    std::atomic<unsigned long long> generation; /*!< Number of loops started. */
+    bool quitting;                 /*!< The destructor is stopping the workers. */
+    const RangeBody* body;         /*!< Body of the current loop. */
+    alignas(64) std::atomic<int> pending; /*!< Chunks of the current loop not finished yet. */
+
+    //! take function
+    /*!
+    * Takes the next chunk of a worker's own queue, or steals one from another queue.
+    * @return false if every queue is empty.
+    */
+    bool take(int worker, Chunk& chunk);
+
+    //! work function
+    /*!
+    * Runs chunks until every chunk of the current loop is finished.
+    */
+    void work(int worker);
+
+    //! workerLoop function
+    /*!
+    * Thread function of workers 1..threadCount-1.
+    */
+    void workerLoop(int worker);
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+public:
+    //! Parameterized Constructor
+    /*!
+    * Starts threadCount - 1 worker threads.
+    * @param threadCount Workers, the calling thread included; 0 for one per hardware thread.
+    */
+    explicit WorkStealingPool(int threadCount = 0);
+
+    //! Destructor
+    /*!
+    * Stops and joins the worker threads.
+    */
+    ~WorkStealingPool();
+
+    //! parallelFor function
+    /*!
+    * Runs body over [0, count) and returns when every chunk is finished.
+    * @param count Number of indices.
+    * @param grain Indices per chunk, at least 1.
+    * @param body Called once per chunk, from any worker.
+    */
+    void parallelFor(int count, int grain, const RangeBody& body);
+
+    //! getThreadCount function
+    int getThreadCount() const;
+
+    //! getExecutedCount function
+    /*!
+    * @return the chunks run by a worker since construction.
+    */
+    unsigned long long getExecutedCount(int worker) const;
+
+    //! getStealCount function
+    /*!
+    * @return the chunks that workers took from another worker's queue since construction.
+    */
+    unsigned long long getStealCount() const;
+};